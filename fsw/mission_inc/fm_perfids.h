@@ -29,8 +29,9 @@
  * \{
  */
 
-#define FM_APPMAIN_PERF_ID    39 /**< \brief Main application performance ID */
-#define FM_CHILD_TASK_PERF_ID 44 /**< \brief Child task performance ID */
+#define FM_APPMAIN_PERF_ID        39 /**< \brief Main application performance ID */
+#define FM_CHILD_TASK_PERF_ID     44 /**< \brief Child task performance ID */
+#define FM_CHILD_PIPELINE_PERF_ID 45 /**< \brief Child task transfer pipeline helper performance ID */
 
 /**\}*/
 
@@ -154,6 +154,20 @@
  */
 #define FM_DIR_LIST_FILE_SUBTYPE 12345
 
+/**
+ * \brief Split File Manifest Header Sub-Type
+ *
+ *  \par Description:
+ *       This definition sets the cFE File Header sub-type value for the
+ *       manifest files written by the #FM_SPLIT_CC command.  The value may
+ *       be used to differentiate FM split manifest files from other data
+ *       files.
+ *
+ *  \par Limits:
+ *       The FM application places no limits on this unsigned 32 bit value.
+ */
+#define FM_SPLIT_MANIFEST_SUBTYPE 12346
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM platform configuration parameters - TLM packet definitions   */
@@ -186,84 +200,157 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 /**
- * \brief Child Task File I/O Control Settings
+ * \brief Child Task File I/O Block Size
  *
  *  \par Description:
- *       These definitions control the amount of file data that the FM child task
- *       will process before giving up the CPU to allow other tasks time to run.
+ *       FM_CHILD_FILE_BLOCK_SIZE defines the startup size of each block of file
+ *       data that the FM child task will read or write.  The block size may be
+ *       changed at runtime with the #FM_SET_BLOCK_SIZE_CC command, up to
+ *       #FM_CHILD_MAX_BLOCK_SIZE.  Larger blocks reduce the number of OS calls
+ *       per file, smaller blocks let the throttle and abort checks act sooner.
  *
- *       FM_CHILD_FILE_BLOCK_SIZE defines the size of each block of file data that
- *       the FM child task will read or write.  This value also defines the size
- *       of the FM child task I/O buffer that exists in global memory.
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 256 bytes and
+ *       no greater than #FM_CHILD_MAX_BLOCK_SIZE, and to be a multiple of
+ *       #FM_CHILD_BUFFER_ALIGNMENT.
+ */
+#define FM_CHILD_FILE_BLOCK_SIZE 2048
+
+/**
+ * \brief Child Task File I/O Maximum Block Size
  *
- *       FM_CHILD_FILE_LOOP_COUNT defines the number of file data blocks that may
- *       be processed before the FM child task sleeps (gives up the CPU).
+ *  \par Description:
+ *       This definition sets the size of each child task file I/O buffer, and
+ *       so the largest block size that may be commanded.  At startup, FM
+ *       creates a cFE memory pool holding one buffer for each child task
+ *       worker and one for each block of its transfer pipeline, that is
+ *       #FM_CHILD_WORKER_COUNT * (#FM_CHILD_PIPELINE_DEPTH + 1) buffers.
+ *       The Delete All Files command lists directory entry names in the
+ *       worker buffer, so a larger buffer also means fewer batches.
  *
- *       FM_CHILD_FILE_SLEEP_MS defines the length of time (in milli-secs) before
- *       the FM child task wakes (re-acquires the CPU).  Note that many platforms
- *       will limit the precision of this value.
+ *  \par Limits:
+ *       The FM application limits this value to be no less than
+ *       #FM_CHILD_FILE_BLOCK_SIZE and no greater than 16MB, and to be a
+ *       multiple of #FM_CHILD_BUFFER_ALIGNMENT.  It must also hold the list
+ *       of open files, OS_MAX_NUM_OPEN_FILES * (OS_MAX_PATH_LEN +
+ *       OS_MAX_API_NAME) bytes, plus one path.
+ */
+#define FM_CHILD_MAX_BLOCK_SIZE 65536
+
+/**
+ * \brief Child Task File I/O Buffer Alignment
  *
- *       Thus the combination of the 3 values control CPU use by the FM child task.
- *       Using a smaller block size minimizes the amount of RAM used by the file
- *       I/O buffer, but at the expense of file efficiency.  Adjust each of the
- *       values such that the combination is appropriate for the target platform.
+ *  \par Description:
+ *       This definition sets the address alignment (in bytes) of each child
+ *       task file I/O buffer.  Block sizes are multiples of the alignment, so
+ *       file offsets stay aligned as well.  Devices that transfer directly to
+ *       and from the buffers may need page (4096) or sector (512) alignment.
  *
- *       For example, if the block size is 2048 and the loop count is 16 and the
- *       sleep time is 20, then while processing a 1 Mbyte file there will be
- *       32 sleep cycles of 20ms each, for a total task delay of 0.64 seconds.
+ *  \par Limits:
+ *       The FM application limits this value to be a power of two no less
+ *       than 8 and no greater than 4096.
+ */
+#define FM_CHILD_BUFFER_ALIGNMENT 64
+
+/**
+ * \brief Child Task I/O Throttle Settings
+ *
+ *  \par Description:
+ *       These definitions are the startup settings of the token bucket throttle
+ *       that controls CPU and file system use by the FM child task.  Every child
+ *       task worker shares the throttle, and the rates may be changed at runtime
+ *       with the #FM_SET_THROTTLE_CC command.
+ *
+ *       FM_CHILD_THROTTLE_BYTES_PER_SEC defines the rate at which the FM child
+ *       task may read or write file data.  Each block of file data takes tokens
+ *       from the throttle, and a worker that runs out of tokens sleeps (gives up
+ *       the CPU) until enough have accumulated.  Zero means unlimited, in which
+ *       case the child task only gives up the CPU to higher priority tasks.
+ *
+ *       FM_CHILD_THROTTLE_STATS_PER_SEC defines the rate at which the FM child
+ *       task may call OS_stat when directory listing commands request file size,
+ *       time and mode.  OS_stat is a CPU intensive call.  Zero means unlimited.
+ *
+ *       FM_CHILD_THROTTLE_BURST_MS defines how many milli-secs worth of tokens
+ *       the throttle accumulates while the child task is idle, allowing a short
+ *       command to run at full speed.  The throttle always holds at least one
+ *       file data block or one OS_stat call.
+ *
+ *       FM_CHILD_THROTTLE_LATENCY_US defines the smoothed time (in micro-secs)
+ *       between file data blocks above which the file data rate backs off.  The
+ *       time to process a block rises when higher priority tasks or other users
+ *       of the file system are busy.  The rate is halved while the latency stays
+ *       high, and recovers in steps while it is low, but never falls below
+ *       1/16th of the configured rate.  Zero disables the backoff.
+ *
+ *       For example, the former fixed pacing of 16 blocks of 2048 bytes followed
+ *       by a 20 ms sleep limited the child task to at most 1600 Kbytes/sec.
  *
  *  \par Limits:
- *       FM_CHILD_FILE_BLOCK_SIZE: The FM application limits this value to be no
- *       less than 256 bytes and no greater than 32KB.
+ *       FM_CHILD_THROTTLE_BYTES_PER_SEC: The FM application limits this value to
+ *       be zero or no less than FM_CHILD_FILE_BLOCK_SIZE.
  *
- *       FM_CHILD_FILE_LOOP_COUNT: The FM application limits this value to be
- *       non-zero.  There is no upper limit - a very large number effectively
- *       means that the FM child task will not surrender the CPU to other lower
- *       priority tasks.
+ *       FM_CHILD_THROTTLE_STATS_PER_SEC: There is no limit.
  *
- *       FM_CHILD_FILE_SLEEP_MS: The FM application limits this value to be no
- *       no greater than 100 ms.  The value zero generally means a very short
- *       task delay - refer to the target platform documentation for specifics.
+ *       FM_CHILD_THROTTLE_BURST_MS: The FM application limits this value to be
+ *       no greater than 1000 ms.
+ *
+ *       FM_CHILD_THROTTLE_LATENCY_US: There is no limit.
  */
-#define FM_CHILD_FILE_BLOCK_SIZE 2048
-#define FM_CHILD_FILE_LOOP_COUNT 16
-#define FM_CHILD_FILE_SLEEP_MS   20
+#define FM_CHILD_THROTTLE_BYTES_PER_SEC 1638400
+#define FM_CHILD_THROTTLE_STATS_PER_SEC 0
+#define FM_CHILD_THROTTLE_BURST_MS      100
+#define FM_CHILD_THROTTLE_LATENCY_US    0
 
 /**
- * \brief Child file stat sleep
+ * \brief Child Task Job Progress Telemetry Interval
  *
  *  \par Description:
- *       OS_stat is a CPU intensive call. FM uses the OS_stat call to query a
- *       file’s size, date, and mode when setting up directory listings.
- *       Querying a large number of files and/or files large in size when
- *       processing directory listing commands can cause FM to hog the CPU. To
- *       mitigate this, options to sleep a configurable number of milliseconds
- *       between calls to OS_stat for a configurable number of files
- *       in a directory listing is provided. A large sleep cycle will not hang the CPU
- *       but it may take a long time for directory listing to complete. A shorter
- *       sleep cycle will speed up the directory listing commands but may cause
- *       FM to hog the CPU.
+ *       This definition sets the minimum time (in milli-secs) between job
+ *       progress telemetry packets sent by each child task worker while it
+ *       reads or writes file data.  The packet reports the bytes done, the
+ *       expected total, the current throughput and the estimated time to
+ *       completion for the command being executed.  Zero disables the job
+ *       progress telemetry.
  *
- *       FM_CHILD_STAT_SLEEP_MS: The number of milliseconds to sleep each
- *       cycle. One cycle is FM_CHILD_STAT_SLEEP_FILECOUNT.
+ *  \par Limits:
+ *       The FM application limits this value to be no greater than 60000 ms.
+ */
+#define FM_CHILD_PROGRESS_INTERVAL_MS 1000
+
+/**
+ * \brief Child Task Directory Tree Depth
  *
- *       FM_CHILD_STAT_SLEEP_FILECOUNT: The number of files to process (OS_stat) before
- *       sleeping FM_CHILD_STAT_SLEEP_MS.
- *       Works in tandem with FM_CHILD_STAT_SLEEP_MS to reduce CPU hogging
- *       while allowing slightly more customization to balance time the operator is waiting to
- *       get data back from a directory listing versus FM hogging the CPU with calls to OS_stat
+ *  \par Description:
+ *       This definition sets the number of directory levels, including the
+ *       top directory itself, that the #FM_COPY_DIR_CC and #FM_DELETE_TREE_CC
+ *       commands walk.  Subdirectories below this depth are skipped and
+ *       counted in the command summary event.  The child task worker holds
+ *       one OSAL directory handle for each level it has descended into, so
+ *       this value should leave room in OS_MAX_NUM_OPEN_DIRS for the other
+ *       workers and applications.
  *
- *       In short:
- *       High SLEEP_MS means less CPU hogging by FM but a longer time to process a dir listing command
- *       Low SLEEP_MS means more potential CPU hogging by FM but shorter time to process a dir listing command
- *       High FILECOUNT means more potential CPU hogging by FM but a shorter time to process a dir listing command
- *       Low FILECOUNT means less CPU hogging by FM but longer time to process a dir listing command
  *  \par Limits:
- *       The default is zero unless the mission needs require them to be changed.
+ *       The FM application limits this value to be no less than 1 and
+ *       no greater than 32.
+ */
+#define FM_CHILD_DIR_TREE_DEPTH 4
+
+/**
+ * \brief Child Task Split File Segment Count
  *
+ *  \par Description:
+ *       This definition sets the largest number of segment files that one
+ *       #FM_SPLIT_CC command may write.  A source file that needs more
+ *       segments at the commanded segment size is rejected before any
+ *       segment is written, so that a small segment size cannot fill a
+ *       directory with files.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and
+ *       no greater than 10000.
  */
-#define FM_CHILD_STAT_SLEEP_MS        0
-#define FM_CHILD_STAT_SLEEP_FILECOUNT 0
+#define FM_CHILD_SPLIT_MAX_SEGMENTS 1000
 
 /**
  * \brief Child Task Command Queue Entry Count
@@ -276,13 +363,157 @@
  *       command queue prevents the occasional slow command from being rejected
  *       because the child task has not yet completed the previous slow command.
  *
+ *       Queue entries do not hold the command path arguments, paths are stored
+ *       in the path arena (see #FM_CHILD_PATH_ARENA_SIZE), so a deep queue costs
+ *       only a few dozen bytes per entry.
+ *
  *  \par Limits:
  *       The FM application limits this value to be no less than 1 and no greater
- *       than 10.  There must be at least one because this is the method for
+ *       than 100.  There must be at least one because this is the method for
  *       passing command arguments from the parent to the child task.  The upper
- *       limit is arbitrary.
+ *       limit keeps the command queue lane ring indexes within 8 bits.
+ */
+#define FM_CHILD_QUEUE_DEPTH 32
+
+/**
+ * \brief Child Task Command Queue Path Arena Size
+ *
+ *  \par Description:
+ *       This definition sets the size in bytes of the arena that holds the
+ *       path arguments (source and target file or directory names) for the
+ *       commands waiting in the child task command queue.  Each path uses
+ *       only as many arena blocks as its length requires.  When the arena
+ *       cannot hold the paths for another command, the command is written to
+ *       the pending commands file (see #FM_CHILD_PENDING_DEPTH).
+ *
+ *  \par Limits:
+ *       The FM application requires that the arena hold the longest possible
+ *       paths for at least one command, and limits this value to be no
+ *       greater than 65535.
  */
-#define FM_CHILD_QUEUE_DEPTH 3
+#define FM_CHILD_PATH_ARENA_SIZE 4096
+
+/**
+ * \brief Child Task Command Queue Path Arena Block Size
+ *
+ *  \par Description:
+ *       This definition sets the size in bytes of the blocks that the path
+ *       arena is divided into.  Smaller blocks waste less of the arena on
+ *       short paths, larger blocks make allocation faster.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 8 and no
+ *       greater than OS_MAX_PATH_LEN.
+ */
+#define FM_CHILD_PATH_BLOCK_SIZE 32
+
+/**
+ * \brief Child Task Pending Commands File Entry Count
+ *
+ *  \par Description:
+ *       This definition sets the number of commands that can be written to
+ *       the pending commands file when the child task command queue (or the
+ *       path arena) is full.  The child task processes pending commands in
+ *       the order they were received, after the commands already in the
+ *       queue.  While any command is pending, new commands are also written
+ *       to the file so that command order is preserved.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no greater than 16000.
+ *       Set this value to zero to disable the pending commands file, in
+ *       which case commands are rejected when the queue is full.
+ */
+#define FM_CHILD_PENDING_DEPTH 256
+
+/**
+ * \brief Child Task Pending Commands File Name
+ *
+ *  \par Description:
+ *       This definition sets the name of the file used to hold the commands
+ *       that do not fit in the child task command queue.  The file is created
+ *       (emptied) at startup, and grows to no more than
+ *       #FM_CHILD_PENDING_DEPTH command entries.
+ *
+ *  \par Limits:
+ *       The file should be on a fast, volatile file system.  The length of
+ *       the name must not exceed OS_MAX_PATH_LEN.
+ */
+#define FM_CHILD_PENDING_FILE "/ram/fm_pending.dat"
+
+/**
+ * \brief Child Task Worker Count
+ *
+ *  \par Description:
+ *       This definition sets the number of FM child tasks (workers) created
+ *       at startup.  All workers pend on the same handshake semaphore and
+ *       take commands from the shared child task command queue, so that a
+ *       slow command (large copy, CRC, directory listing) executing in one
+ *       worker does not prevent the remaining workers from processing other
+ *       queued commands.  Each worker has a private file I/O buffer and
+ *       private telemetry packets, and reports its own command counter and
+ *       current/previous command code in housekeeping telemetry.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and no greater
+ *       than 4.  A value of 1 is equivalent to the single child task design.
+ *       Commands that operate on the same file or directory are not serialized
+ *       against each other, so ground procedures that depend on command order
+ *       should either wait for completion or use a single worker.
+ */
+#define FM_CHILD_WORKER_COUNT 2
+
+/**
+ * \brief Child Task Transfer Pipeline Depth
+ *
+ *  \par Description:
+ *       This definition sets the number of file blocks in the transfer
+ *       pipeline of each child task worker.  With more than one block, each
+ *       worker has a helper task that writes (Copy File, Move File and Concat
+ *       Files) or CRCs (Get File Info) the blocks already read, while the
+ *       worker reads the next block.  Transfers then run near the speed of
+ *       the slower device, rather than the sum of the read and write times.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and no
+ *       greater than 4.  A value of 1 creates no helper tasks, and each
+ *       block is read and then written by the worker.  Each block adds
+ *       #FM_CHILD_MAX_BLOCK_SIZE bytes of memory to each worker.
+ */
+#define FM_CHILD_PIPELINE_DEPTH 2
+
+/**
+ * \brief Child Task Copy Checkpoint Interval
+ *
+ *  \par Description:
+ *       This definition sets the number of file blocks (of
+ *       #FM_CHILD_FILE_BLOCK_SIZE bytes) that the Copy File and Concat Files
+ *       commands write between copy checkpoints.  A checkpoint holds the
+ *       source and target names, the offset reached and a running CRC of
+ *       the target file, and is saved in the cFE Critical Data Store.  After
+ *       a processor reset, FM resumes an unfinished copy from its most
+ *       recent checkpoint rather than from the start of the file.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 0 and no
+ *       greater than 65535.  Set this value to zero to disable copy
+ *       checkpoints.  Smaller values lose less progress on reset at the
+ *       cost of more frequent Critical Data Store updates.
+ */
+#define FM_CHILD_CHECKPOINT_INTERVAL 64
+
+/**
+ * \brief Child Task Copy Checkpoint CDS Name
+ *
+ *  \par Description:
+ *       This definition sets the base name of the Critical Data Store
+ *       blocks that hold the copy checkpoints.  Each child task worker
+ *       registers one block, named with the worker number appended.
+ *
+ *  \par Limits:
+ *       The length of the name plus one digit must not exceed
+ *       CFE_MISSION_ES_CDS_MAX_NAME_LENGTH.
+ */
+#define FM_CHILD_CHECKPOINT_CDS_NAME "FM_CKPT"
 
 /**
  * \brief Child Task Name - cFE object name
@@ -457,6 +688,102 @@
  */
 /* #define FM_INCLUDE_DECOMPRESS */
 
+/**
+ * \brief Include Kernel Copy
+ *
+ *  \par Description:
+ *       If this setting is defined, FM will be built with the Linux kernel
+ *       copy backend.  The Copy File and Concat Files commands then move file
+ *       data with copy_file_range (or sendfile) rather than reading it into
+ *       the child task I/O buffer and writing it back out, falling back to
+ *       the portable read/write loop when the kernel or file system does not
+ *       support either call.  The kernel copy is not used when the command
+ *       requests a CRC of the copied data.  A copy checkpoint written by the
+ *       kernel copy holds no target file CRC, so a resumed copy checks only
+ *       the target file size.
+ *
+ *  \par Limits:
+ *       Linux only, requires glibc 2.27 or later.
+ */
+/* #define FM_INCLUDE_KERNEL_COPY */
+
+/**
+ * \brief Kernel Copy Chunk Size
+ *
+ *  \par Description:
+ *       This definition sets the number of bytes that each kernel copy call
+ *       moves.  The I/O throttle, job progress, abort checks and copy
+ *       checkpoints are applied between chunks, the same as between file
+ *       blocks of the portable loop.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than
+ *       #FM_CHILD_FILE_BLOCK_SIZE and no greater than 16MB.  Only used when
+ *       #FM_INCLUDE_KERNEL_COPY is defined.
+ */
+#define FM_CHILD_KERNEL_COPY_SIZE 65536
+
+/**
+ * \brief Include Allocated Size
+ *
+ *  \par Description:
+ *       If this setting is defined, the File Information telemetry packet
+ *       reports the number of bytes allocated to a closed file, which is
+ *       less than the file size for a sparse file.  Otherwise the allocated
+ *       size is reported as #FM_FILE_SIZE_UNKNOWN.
+ *
+ *  \par Limits:
+ *       POSIX only, the allocated size is read with stat.
+ */
+/* #define FM_INCLUDE_ALLOCATED_SIZE */
+
+/**
+ * \brief Include File Allocate
+ *
+ *  \par Description:
+ *       If this setting is defined, FM will be built with the Linux file
+ *       allocation backend.  The Preallocate File command then reserves
+ *       file space with fallocate, falling back to writing zero blocks when
+ *       the file system does not support it.  Otherwise the Preallocate File
+ *       command always writes zero blocks.
+ *
+ *  \par Limits:
+ *       Linux only.
+ */
+/* #define FM_INCLUDE_FILE_ALLOCATE */
+
+/**
+ * \brief Include File Truncate
+ *
+ *  \par Description:
+ *       If this setting is defined, FM will be built with the POSIX file
+ *       truncate backend, which performs the Truncate File command with
+ *       truncate.  OSAL has no truncate call.  Otherwise the Truncate File
+ *       command is rejected.
+ *
+ *  \par Limits:
+ *       POSIX only, the file is truncated by its local path.
+ */
+#define FM_INCLUDE_FILE_TRUNCATE
+
+/**
+ * \brief Include File Link
+ *
+ *  \par Description:
+ *       If this setting is defined, FM will be built with the Linux file
+ *       link backend.  A Copy File command with a link argument then shares
+ *       the source data with a hard link or a copy-on-write clone, which is
+ *       one metadata operation rather than a copy of every byte.  When the
+ *       link cannot be made, for example across volumes or on a file system
+ *       without clone support, the file data is copied.  Otherwise the link
+ *       argument is accepted and the file data is always copied.
+ *
+ *  \par Limits:
+ *       Linux only, clones require kernel 4.5 or later and a file system
+ *       with reflink support (btrfs, XFS).
+ */
+/* #define FM_INCLUDE_FILE_LINK */
+
 /**\}*/
 
 #endif
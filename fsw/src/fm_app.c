@@ -37,8 +37,10 @@
 #include "fm_app.h"
 #include "fm_tbl.h"
 #include "fm_child.h"
+#include "fm_checkpoint.h"
 #include "fm_cmds.h"
 #include "fm_cmd_utils.h"
+#include "fm_queue.h"
 #include "fm_events.h"
 #include "fm_perfids.h"
 #include "fm_platform_cfg.h"
@@ -229,6 +231,9 @@ int32 FM_AppInit(void)
                 /* Create low priority child task */
                 FM_ChildInit();
 
+                /* Resume copies interrupted by a processor reset */
+                FM_CheckpointInit();
+
                 /* Application startup event message */
                 CFE_EVS_SendEvent(FM_STARTUP_EID, CFE_EVS_EventType_INFORMATION,
                                   "Initialization complete: version %d.%d.%d.%d", FM_MAJOR_VERSION, FM_MINOR_VERSION,
@@ -313,6 +318,10 @@ void FM_ProcessCmd(const CFE_SB_Buffer_t *BufPtr)
             Result = FM_DeleteFileCmd(BufPtr);
             break;
 
+        case FM_ABORT_CC:
+            Result = FM_AbortCmd(BufPtr);
+            break;
+
         case FM_DELETE_ALL_CC:
             Result = FM_DeleteAllFilesCmd(BufPtr);
             break;
@@ -357,10 +366,46 @@ void FM_ProcessCmd(const CFE_SB_Buffer_t *BufPtr)
             Result = FM_SetTableStateCmd(BufPtr);
             break;
 
+        case FM_SET_THROTTLE_CC:
+            Result = FM_SetThrottleCmd(BufPtr);
+            break;
+
         case FM_SET_FILE_PERM_CC:
             Result = FM_SetPermissionsCmd(BufPtr);
             break;
 
+        case FM_SET_BLOCK_SIZE_CC:
+            Result = FM_SetBlockSizeCmd(BufPtr);
+            break;
+
+        case FM_COPY_DIR_CC:
+            Result = FM_CopyDirCmd(BufPtr);
+            break;
+
+        case FM_DELETE_TREE_CC:
+            Result = FM_DeleteTreeCmd(BufPtr);
+            break;
+
+        case FM_DELETE_FILTER_CC:
+            Result = FM_DeleteFilterCmd(BufPtr);
+            break;
+
+        case FM_CONCAT_LIST_CC:
+            Result = FM_ConcatListCmd(BufPtr);
+            break;
+
+        case FM_SPLIT_CC:
+            Result = FM_SplitCmd(BufPtr);
+            break;
+
+        case FM_PREALLOCATE_CC:
+            Result = FM_PreallocateCmd(BufPtr);
+            break;
+
+        case FM_TRUNCATE_CC:
+            Result = FM_TruncateCmd(BufPtr);
+            break;
+
         default:
             Result = false;
             CFE_EVS_SendEvent(FM_CC_ERR_EID, CFE_EVS_EventType_ERROR, "Main loop error: invalid command code: cc = %d",
@@ -391,8 +436,12 @@ void FM_ProcessCmd(const CFE_SB_Buffer_t *BufPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void FM_ReportHK(const CFE_MSG_CommandHeader_t *Msg)
 {
-    const char *CmdText = "HK Request";
-    bool        Result  = true;
+    const char *      CmdText        = "HK Request";
+    FM_ChildWorker_t *Worker         = NULL;
+    bool              Result         = true;
+    uint32            WorkerIndex    = 0;
+    uint32            Sequence       = 0;
+    uint32            LatestSequence = 0;
 
     /* Verify command packet length */
     Result = FM_IsValidCmdPktLength(&Msg->Msg, sizeof(FM_HousekeepingCmd_t), FM_HK_REQ_ERR_EID, CmdText);
@@ -414,15 +463,52 @@ void FM_ReportHK(const CFE_MSG_CommandHeader_t *Msg)
         FM_GlobalData.HousekeepingPkt.NumOpenFiles = FM_GetOpenFilesData(NULL);
 
         /* Report child task command counters */
-        FM_GlobalData.HousekeepingPkt.ChildCmdCounter     = FM_GlobalData.ChildCmdCounter;
-        FM_GlobalData.HousekeepingPkt.ChildCmdErrCounter  = FM_GlobalData.ChildCmdErrCounter;
-        FM_GlobalData.HousekeepingPkt.ChildCmdWarnCounter = FM_GlobalData.ChildCmdWarnCounter;
+        FM_GlobalData.HousekeepingPkt.ChildCmdCounter     = FM_ATOMIC_LOAD(&FM_GlobalData.ChildCmdCounter);
+        FM_GlobalData.HousekeepingPkt.ChildCmdErrCounter  = FM_ATOMIC_LOAD(&FM_GlobalData.ChildCmdErrCounter);
+        FM_GlobalData.HousekeepingPkt.ChildCmdWarnCounter = FM_ATOMIC_LOAD(&FM_GlobalData.ChildCmdWarnCounter);
+
+        FM_GlobalData.HousekeepingPkt.ChildQueueCount = FM_ATOMIC_LOAD(&FM_GlobalData.ChildQueueCount);
+
+        FM_GlobalData.HousekeepingPkt.ChildInteractiveQueueCount =
+            FM_QueueLaneCount(&FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE]);
+        FM_GlobalData.HousekeepingPkt.ChildBulkQueueCount =
+            FM_QueueLaneCount(&FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK]);
+        FM_GlobalData.HousekeepingPkt.ChildPendingCount = FM_QueuePendingCount();
+        FM_GlobalData.HousekeepingPkt.ChildLastJobID    = FM_GlobalData.ChildLastJobID;
+
+        /* Report the throttle rate in effect after any latency backoff */
+        FM_GlobalData.HousekeepingPkt.ChildThrottleRate    = FM_GlobalData.ChildThrottle.Bytes.Current;
+        FM_GlobalData.HousekeepingPkt.ChildThrottleLatency = FM_GlobalData.ChildThrottle.Latency;
+
+        FM_GlobalData.HousekeepingPkt.ChildBlockSize = FM_ATOMIC_LOAD(&FM_GlobalData.ChildBlockSize);
+
+        /*
+        ** Report status of each child task worker.  The child task current
+        **  command is that of the first busy worker, the previous command is
+        **  that of the worker that finished a command last...
+        */
+        FM_GlobalData.HousekeepingPkt.ChildCurrentCC  = 0;
+        FM_GlobalData.HousekeepingPkt.ChildPreviousCC = 0;
 
-        FM_GlobalData.HousekeepingPkt.ChildQueueCount = FM_GlobalData.ChildQueueCount;
+        for (WorkerIndex = 0; WorkerIndex < FM_CHILD_WORKER_COUNT; WorkerIndex++)
+        {
+            Worker = &FM_GlobalData.ChildWorker[WorkerIndex];
+
+            FM_GlobalData.HousekeepingPkt.ChildWorker[WorkerIndex] = Worker->Status;
+
+            if (FM_GlobalData.HousekeepingPkt.ChildCurrentCC == 0)
+            {
+                FM_GlobalData.HousekeepingPkt.ChildCurrentCC = Worker->Status.CurrentCC;
+            }
 
-        /* Report current and previous commands executed by the child task */
-        FM_GlobalData.HousekeepingPkt.ChildCurrentCC  = FM_GlobalData.ChildCurrentCC;
-        FM_GlobalData.HousekeepingPkt.ChildPreviousCC = FM_GlobalData.ChildPreviousCC;
+            Sequence = FM_ATOMIC_LOAD(&Worker->CompleteSequence);
+
+            if (Sequence > LatestSequence)
+            {
+                LatestSequence                                = Sequence;
+                FM_GlobalData.HousekeepingPkt.ChildPreviousCC = Worker->Status.PreviousCC;
+            }
+        }
 
         CFE_SB_TimeStampMsg(&FM_GlobalData.HousekeepingPkt.TlmHeader.Msg);
         CFE_SB_TransmitMsg(&FM_GlobalData.HousekeepingPkt.TlmHeader.Msg, true);
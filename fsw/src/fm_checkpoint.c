@@ -0,0 +1,403 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task Copy Checkpoint Functions
+ *
+ *  Each child task worker owns one Critical Data Store block holding the
+ *  checkpoint of the copy or concatenate command it is executing, so the
+ *  workers never write the same block.  At startup the FM main task
+ *  restores every block and queues the unfinished commands to resume.
+ *  A restored block is left as is until the resumed command has saved
+ *  its own checkpoint or finished, so that a second reset before then
+ *  still resumes the command.  The worker owning the block saves no
+ *  checkpoints of other commands meanwhile.
+ *
+ *  The checkpoint CRC covers the target file bytes written before the
+ *  checkpoint was saved.  Data written after the last checkpoint may not
+ *  have reached the file system before a reset, so the child task checks
+ *  the partial target file against the CRC before resuming the copy.
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_msgdefs.h"
+#include "fm_checkpoint.h"
+#include "fm_cmd_utils.h"
+#include "fm_crc.h"
+#include "fm_events.h"
+#include "fm_queue.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- queue restored command to resume      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_CheckpointResume(uint32 Index)
+{
+    const char *                CmdText    = "Resume Copy";
+    const FM_ChildCheckpoint_t *Checkpoint = &FM_GlobalData.ChildCheckpoint[Index];
+    FM_ChildQueueEntry_t *      CmdArgs    = &FM_GlobalData.ChildQueueEntry;
+
+    if (FM_VerifyChildTask(FM_CHECKPOINT_CHILD_BASE_EID, CmdText) == true)
+    {
+        memset(CmdArgs, 0, sizeof(FM_ChildQueueEntry_t));
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = Checkpoint->CommandCode;
+        CmdArgs->FileInfoCRC = Checkpoint->CRCType;
+        CmdArgs->Verify      = (uint8)Checkpoint->Verify;
+        CmdArgs->Sparse      = (uint8)Checkpoint->Sparse;
+        CmdArgs->Resume      = Index + 1;
+
+        strncpy(CmdArgs->Source1, Checkpoint->Source1, OS_MAX_PATH_LEN);
+        strncpy(CmdArgs->Source2, Checkpoint->Source2, OS_MAX_PATH_LEN);
+        strncpy(CmdArgs->Target, Checkpoint->Target, OS_MAX_PATH_LEN);
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+
+        /* Commands prepared later in the same queue entry are not resumed */
+        CmdArgs->Resume = 0;
+
+        CFE_EVS_SendEvent(FM_CHECKPOINT_RESUME_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s queued: job = %lu, cc = %d, offset = %lu, tgt = %s", CmdText,
+                          (unsigned long)CmdArgs->JobID, (int)Checkpoint->CommandCode,
+                          (unsigned long)Checkpoint->TargetOffset, Checkpoint->Target);
+    }
+
+} /* End of FM_CheckpointResume() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- copy checkpoint to own CDS block      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static bool FM_CheckpointWrite(FM_ChildWorker_t *Worker)
+{
+    bool   Result      = false;
+    int32  Status      = CFE_SUCCESS;
+    uint32 WorkerIndex = (uint32)(Worker - FM_GlobalData.ChildWorker);
+
+    /* The block may still hold a restored checkpoint that another worker is resuming */
+    if ((FM_CheckpointIsEnabled(Worker) == true) &&
+        ((FM_ATOMIC_LOAD(&FM_GlobalData.ChildCheckpoint[WorkerIndex].JobID) == FM_CHILD_JOB_ID_NONE) ||
+         (Worker->CheckpointResume == (WorkerIndex + 1))))
+    {
+        Status = CFE_ES_CopyToCDS(Worker->CheckpointHandle, &Worker->Checkpoint);
+
+        if (Status == CFE_SUCCESS)
+        {
+            Result = true;
+        }
+        else
+        {
+            Worker->CheckpointHandle = CFE_ES_CDS_BAD_HANDLE;
+
+            CFE_EVS_SendEvent(FM_CHECKPOINT_SAVE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Copy checkpoints disabled: CFE_ES_CopyToCDS failed: result = 0x%08X, job = %lu",
+                              (unsigned int)Status, (unsigned long)Worker->Checkpoint.JobID);
+        }
+    }
+
+    return (Result);
+
+} /* End of FM_CheckpointWrite() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- give up restored checkpoint block     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_CheckpointRelease(FM_ChildWorker_t *Worker)
+{
+    FM_ChildCheckpoint_t Empty;
+    uint32               WorkerIndex = (uint32)(Worker - FM_GlobalData.ChildWorker);
+    uint32               ResumeIndex = 0;
+
+    if ((Worker->CheckpointResume > 0) && (Worker->CheckpointResume <= FM_CHILD_WORKER_COUNT))
+    {
+        ResumeIndex = Worker->CheckpointResume - 1;
+
+        /* The owning worker saves nothing into the block until it is released */
+        if ((ResumeIndex != WorkerIndex) &&
+            (FM_CheckpointIsEnabled(&FM_GlobalData.ChildWorker[ResumeIndex]) == true))
+        {
+            memset(&Empty, 0, sizeof(Empty));
+
+            CFE_ES_CopyToCDS(FM_GlobalData.ChildWorker[ResumeIndex].CheckpointHandle, &Empty);
+        }
+
+        FM_ATOMIC_STORE(&FM_GlobalData.ChildCheckpoint[ResumeIndex].JobID, FM_CHILD_JOB_ID_NONE);
+    }
+
+    Worker->CheckpointResume = 0;
+
+} /* End of FM_CheckpointRelease() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- register and restore CDS blocks       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CheckpointInit(void)
+{
+    FM_ChildWorker_t * Worker      = NULL;
+    CFE_ES_CDSHandle_t Handle      = CFE_ES_CDS_BAD_HANDLE;
+    int32              Status      = CFE_SUCCESS;
+    uint32             WorkerIndex = 0;
+    char               Name[CFE_MISSION_ES_CDS_MAX_NAME_LENGTH];
+
+    memset(FM_GlobalData.ChildCheckpoint, 0, sizeof(FM_GlobalData.ChildCheckpoint));
+
+    for (WorkerIndex = 0; WorkerIndex < FM_CHILD_WORKER_COUNT; WorkerIndex++)
+    {
+        Worker = &FM_GlobalData.ChildWorker[WorkerIndex];
+
+        Worker->CheckpointHandle = CFE_ES_CDS_BAD_HANDLE;
+        memset(&Worker->Checkpoint, 0, sizeof(FM_ChildCheckpoint_t));
+
+        if (FM_CHILD_CHECKPOINT_INTERVAL > 0)
+        {
+            snprintf(Name, sizeof(Name), "%s%u", FM_CHILD_CHECKPOINT_CDS_NAME, (unsigned int)WorkerIndex);
+
+            Status = CFE_ES_RegisterCDS(&Handle, sizeof(FM_ChildCheckpoint_t), Name);
+
+            if (Status == CFE_ES_CDS_ALREADY_EXISTS)
+            {
+                /* The block survived a reset, a corrupt block is only reported */
+                Status = CFE_ES_RestoreFromCDS(&FM_GlobalData.ChildCheckpoint[WorkerIndex], Handle);
+
+                if (Status != CFE_SUCCESS)
+                {
+                    CFE_EVS_SendEvent(FM_CHECKPOINT_CDS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Copy checkpoint discarded: CFE_ES_RestoreFromCDS failed: result = 0x%08X, "
+                                      "cds = %s",
+                                      (unsigned int)Status, Name);
+                }
+
+                if ((Status != CFE_SUCCESS) ||
+                    (FM_CheckpointIsValid(&FM_GlobalData.ChildCheckpoint[WorkerIndex]) == false))
+                {
+                    memset(&FM_GlobalData.ChildCheckpoint[WorkerIndex], 0, sizeof(FM_ChildCheckpoint_t));
+                }
+
+                Status = CFE_SUCCESS;
+            }
+
+            /* A valid checkpoint stays in the block until the resumed command replaces it */
+            if ((Status == CFE_SUCCESS) && (FM_GlobalData.ChildCheckpoint[WorkerIndex].JobID == FM_CHILD_JOB_ID_NONE))
+            {
+                Status = CFE_ES_CopyToCDS(Handle, &Worker->Checkpoint);
+            }
+
+            if (Status == CFE_SUCCESS)
+            {
+                Worker->CheckpointHandle = Handle;
+            }
+            else
+            {
+                CFE_EVS_SendEvent(FM_CHECKPOINT_CDS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Copy checkpoints disabled: CDS init failed: result = 0x%08X, cds = %s",
+                                  (unsigned int)Status, Name);
+            }
+        }
+    }
+
+    /* Resume only after every worker has a checkpoint block to save into */
+    for (WorkerIndex = 0; WorkerIndex < FM_CHILD_WORKER_COUNT; WorkerIndex++)
+    {
+        if (FM_CheckpointIsValid(&FM_GlobalData.ChildCheckpoint[WorkerIndex]) == true)
+        {
+            FM_CheckpointResume(WorkerIndex);
+        }
+    }
+
+} /* End of FM_CheckpointInit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- verify restored checkpoint            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_CheckpointIsValid(const FM_ChildCheckpoint_t *Checkpoint)
+{
+    bool Result = false;
+
+    if ((Checkpoint->JobID != FM_CHILD_JOB_ID_NONE) && (Checkpoint->Target[0] != '\0') &&
+        (Checkpoint->Source1[0] != '\0') && (Checkpoint->Source1[OS_MAX_PATH_LEN - 1] == '\0') &&
+        (Checkpoint->Source2[OS_MAX_PATH_LEN - 1] == '\0') && (Checkpoint->Target[OS_MAX_PATH_LEN - 1] == '\0') &&
+        (Checkpoint->SourceOffset <= Checkpoint->TargetOffset))
+    {
+        if ((Checkpoint->CommandCode == FM_COPY_CC) || (Checkpoint->CommandCode == FM_MOVE_CC))
+        {
+            Result = (Checkpoint->Segment == 0);
+        }
+        else if (Checkpoint->CommandCode == FM_CONCAT_CC)
+        {
+            Result = (Checkpoint->Segment <= 1) && (Checkpoint->Source2[0] != '\0');
+        }
+        else if (Checkpoint->CommandCode == FM_CONCAT_LIST_CC)
+        {
+            /* Source1 is the list file, Source2 is the listed entry being appended */
+            Result = (Checkpoint->Segment > 0) && (Checkpoint->Source2[0] != '\0');
+        }
+    }
+
+    return (Result);
+
+} /* End of FM_CheckpointIsValid() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- worker has a checkpoint block         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_CheckpointIsEnabled(const FM_ChildWorker_t *Worker)
+{
+    return (CFE_RESOURCEID_TEST_DEFINED(Worker->CheckpointHandle));
+
+} /* End of FM_CheckpointIsEnabled() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- prepare checkpoint for a command      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CheckpointStart(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildCheckpoint_t *Checkpoint = &Worker->Checkpoint;
+
+    if ((CmdArgs->Resume > 0) && (CmdArgs->Resume <= FM_CHILD_WORKER_COUNT) &&
+        (FM_GlobalData.ChildCheckpoint[CmdArgs->Resume - 1].CommandCode == CmdArgs->CommandCode))
+    {
+        /* Restored at startup and not modified since */
+        memcpy(Checkpoint, &FM_GlobalData.ChildCheckpoint[CmdArgs->Resume - 1], sizeof(FM_ChildCheckpoint_t));
+
+        Worker->CheckpointResume = CmdArgs->Resume;
+    }
+    else
+    {
+        memset(Checkpoint, 0, sizeof(FM_ChildCheckpoint_t));
+
+        Worker->CheckpointResume = 0;
+    }
+
+    Checkpoint->JobID       = CmdArgs->JobID;
+    Checkpoint->CommandCode = CmdArgs->CommandCode;
+    Checkpoint->CRCType     = CmdArgs->FileInfoCRC;
+    Checkpoint->Verify      = CmdArgs->Verify;
+    Checkpoint->Sparse      = CmdArgs->Sparse;
+
+    strncpy(Checkpoint->Source1, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
+    Checkpoint->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+    strncpy(Checkpoint->Source2, CmdArgs->Source2, OS_MAX_PATH_LEN - 1);
+    Checkpoint->Source2[OS_MAX_PATH_LEN - 1] = '\0';
+
+    strncpy(Checkpoint->Target, CmdArgs->Target, OS_MAX_PATH_LEN - 1);
+    Checkpoint->Target[OS_MAX_PATH_LEN - 1] = '\0';
+
+    Worker->CheckpointBlocks = 0;
+
+} /* End of FM_CheckpointStart() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- add written block to checkpoint       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CheckpointUpdate(FM_ChildWorker_t *Worker, const void *Data, uint32 Size)
+{
+    Worker->Checkpoint.SourceOffset += Size;
+    Worker->Checkpoint.TargetOffset += Size;
+
+    /* The CRC is only needed to verify the target file when resuming */
+    if (FM_CheckpointIsEnabled(Worker) == true)
+    {
+        if ((Data == NULL) || (Worker->Checkpoint.TargetCRC == FM_CHECKPOINT_CRC_UNKNOWN))
+        {
+            /* Data copied by the kernel never passed through the child task */
+            Worker->Checkpoint.TargetCRC = FM_CHECKPOINT_CRC_UNKNOWN;
+        }
+        else
+        {
+            Worker->Checkpoint.TargetCRC =
+                FM_CrcCalculate(Data, Size, Worker->Checkpoint.TargetCRC, CFE_MISSION_ES_CRC_16);
+        }
+
+        /* Kernel copy chunks count as several file blocks */
+        Worker->CheckpointBlocks += (Size + FM_CHILD_FILE_BLOCK_SIZE - 1) / FM_CHILD_FILE_BLOCK_SIZE;
+
+        if (Worker->CheckpointBlocks >= FM_CHILD_CHECKPOINT_INTERVAL)
+        {
+            FM_CheckpointSave(Worker);
+        }
+    }
+
+} /* End of FM_CheckpointUpdate() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- copy checkpoint to CDS block          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CheckpointSave(FM_ChildWorker_t *Worker)
+{
+    if (FM_CheckpointWrite(Worker) == true)
+    {
+        /* The resumed command no longer needs the restored checkpoint */
+        FM_CheckpointRelease(Worker);
+    }
+
+    Worker->CheckpointBlocks = 0;
+
+} /* End of FM_CheckpointSave() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- command no longer needs a checkpoint  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CheckpointClear(FM_ChildWorker_t *Worker)
+{
+    memset(&Worker->Checkpoint, 0, sizeof(FM_ChildCheckpoint_t));
+
+    FM_CheckpointWrite(Worker);
+
+    /* A finished command is never resumed, even when its block was not written */
+    FM_CheckpointRelease(Worker);
+
+    Worker->CheckpointBlocks = 0;
+
+} /* End of FM_CheckpointClear() */
@@ -0,0 +1,181 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS File Manager child task copy
+ *   checkpoint functions.
+ */
+#ifndef FM_CHECKPOINT_H
+#define FM_CHECKPOINT_H
+
+#include "cfe.h"
+#include "fm_msg.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM copy checkpoint function prototypes (FM main task)           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Copy Checkpoint Initialization Function
+ *
+ *  \par Description
+ *       Registers one Critical Data Store block for each child task worker.
+ *       When a block already exists (processor reset or application restart)
+ *       its contents are restored, and a copy or concatenate command that
+ *       was executing is queued to resume from the checkpoint.  Blocks that
+ *       do not hold a valid checkpoint are cleared, a valid checkpoint is
+ *       kept until the resumed command saves its own checkpoint or finishes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called after #FM_ChildInit, as resumed commands are queued
+ *       to the child task.  Failure is not fatal, checkpoints are disabled
+ *       for a worker whose block cannot be registered.
+ *
+ *  \sa #FM_AppInit, #FM_CheckpointIsValid
+ */
+void FM_CheckpointInit(void);
+
+/**
+ *  \brief Copy Checkpoint Validation Function
+ *
+ *  \par Description
+ *       Verifies that a restored copy checkpoint describes a copy or
+ *       concatenate command in progress and that its filenames are
+ *       terminated.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The Critical Data Store detects corruption of the stored data,
+ *       this function rejects records that are unused or inconsistent.
+ *
+ *  \param [in]  Checkpoint Pointer to the copy checkpoint
+ *
+ *  \return Boolean checkpoint valid response
+ *  \retval true  Checkpoint describes a command that may be resumed
+ *  \retval false Checkpoint is unused or invalid
+ *
+ *  \sa #FM_CheckpointInit
+ */
+bool FM_CheckpointIsValid(const FM_ChildCheckpoint_t *Checkpoint);
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM copy checkpoint function prototypes (child task)             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Copy Checkpoint Enabled Function
+ *
+ *  \par Description
+ *       Returns whether the worker has a Critical Data Store block in
+ *       which to save copy checkpoints.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The running target CRC is only calculated when checkpoints are
+ *       enabled.
+ *
+ *  \param [in]  Worker Pointer to the child task worker
+ *
+ *  \return Boolean checkpoint enabled response
+ *  \retval true  Checkpoints are saved for this worker
+ *  \retval false Checkpoints are disabled for this worker
+ */
+bool FM_CheckpointIsEnabled(const FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Copy Checkpoint Start Function
+ *
+ *  \par Description
+ *       Prepares the worker copy checkpoint for a copy or concatenate
+ *       command.  A new command starts at offset zero, a resumed command
+ *       starts from the restored checkpoint named in the command arguments.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The checkpoint is not saved until the copy engine opens the files.
+ *       The caller must verify a resumed checkpoint before using it.
+ *
+ *  \param [in]  Worker  Pointer to the child task worker
+ *  \param [in]  CmdArgs Pointer to the command arguments
+ *
+ *  \sa #FM_CheckpointSave, #FM_CheckpointClear
+ */
+void FM_CheckpointStart(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Copy Checkpoint Update Function
+ *
+ *  \par Description
+ *       Adds a block written to the target file to the worker copy
+ *       checkpoint, and saves the checkpoint every
+ *       #FM_CHILD_CHECKPOINT_INTERVAL blocks.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A NULL data pointer means the kernel copied the data, so the
+ *       target CRC becomes #FM_CHECKPOINT_CRC_UNKNOWN for the rest of
+ *       the command.
+ *
+ *  \param [in]  Worker Pointer to the child task worker
+ *  \param [in]  Data   Pointer to the block written to the target file, or NULL
+ *  \param [in]  Size   Number of bytes written to the target file
+ *
+ *  \sa #FM_CheckpointSave
+ */
+void FM_CheckpointUpdate(FM_ChildWorker_t *Worker, const void *Data, uint32 Size);
+
+/**
+ *  \brief Copy Checkpoint Save Function
+ *
+ *  \par Description
+ *       Copies the worker copy checkpoint to the worker Critical Data
+ *       Store block.  The first save of a resumed command releases the
+ *       block holding the checkpoint it was resumed from.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A save failure is reported once and disables checkpoints for the
+ *       worker, the copy itself continues.  Nothing is saved while the
+ *       worker block still holds a checkpoint restored for another worker.
+ *
+ *  \param [in]  Worker Pointer to the child task worker
+ *
+ *  \sa #FM_CheckpointUpdate, #FM_CheckpointClear
+ */
+void FM_CheckpointSave(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Copy Checkpoint Clear Function
+ *
+ *  \par Description
+ *       Clears the worker copy checkpoint when a copy or concatenate
+ *       command completes, fails or is aborted, so that the command is
+ *       not resumed after a processor reset.  A resumed command also
+ *       releases the block holding the checkpoint it was resumed from.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]  Worker Pointer to the child task worker
+ *
+ *  \sa #FM_CheckpointStart
+ */
+void FM_CheckpointClear(FM_ChildWorker_t *Worker);
+
+#endif
@@ -22,6 +22,17 @@
  *  File Manager (FM) Child task (low priority command handler)
  */
 
+/*
+** copy_file_range and fallocate are GNU extensions, and truncate is hidden
+** by strict C modes, so they must be requested before any system header is
+** included
+*/
+#include "fm_platform_cfg.h"
+#if (defined(FM_INCLUDE_KERNEL_COPY) || defined(FM_INCLUDE_FILE_ALLOCATE) || defined(FM_INCLUDE_FILE_TRUNCATE)) && \
+    !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include "cfe.h"
 #include "fm_msg.h"
 #include "fm_msgdefs.h"
@@ -29,8 +40,13 @@
 #include "fm_events.h"
 #include "fm_app.h"
 #include "fm_child.h"
+#include "fm_checkpoint.h"
+#include "fm_throttle.h"
+#include "fm_pipeline.h"
+#include "fm_crc.h"
 #include "fm_cmds.h"
 #include "fm_cmd_utils.h"
+#include "fm_queue.h"
 #include "fm_perfids.h"
 #include "fm_platform_cfg.h"
 #include "fm_verify.h"
@@ -41,6 +57,36 @@
 #include "cfs_fs_lib.h"
 #endif
 
+#ifdef FM_INCLUDE_KERNEL_COPY
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/sendfile.h>
+#endif
+
+#ifdef FM_INCLUDE_ALLOCATED_SIZE
+#include <sys/stat.h>
+#endif
+
+#ifdef FM_INCLUDE_FILE_ALLOCATE
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef FM_INCLUDE_FILE_TRUNCATE
+#include <unistd.h>
+#endif
+
+#ifdef FM_INCLUDE_FILE_LINK
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <linux/fs.h>
+#endif
+
 /************************************************************************
 ** OSAL Compatibility for directory name access
 ** New OSAL version have an access macro to get the string.  If that
@@ -52,6 +98,38 @@
 
 #define FM_QUEUE_SEM_NAME "FM_QUEUE_SEM"
 
+/* Delete All keeps its open file list, then its batch of names, in the worker buffer */
+#define FM_CHILD_OPEN_LIST_SIZE (sizeof(FM_OpenFilesEntry_t) * OS_MAX_NUM_OPEN_FILES)
+#define FM_CHILD_NAME_LIST_SIZE (FM_CHILD_MAX_BLOCK_SIZE - FM_CHILD_OPEN_LIST_SIZE)
+
+/* Copy engine failure events - copy reports one event for every failure */
+static const FM_ChildCopyEvents_t FM_ChildCopyEvents = {FM_COPY_OS_ERR_EID, FM_COPY_OS_ERR_EID, FM_COPY_OS_ERR_EID,
+                                                        FM_COPY_OS_ERR_EID, FM_COPY_VERIFY_READ_ERR_EID};
+
+/* Copy engine failure events - move across volumes replaces the former OS_mv */
+static const FM_ChildCopyEvents_t FM_ChildMoveEvents = {FM_MOVE_OS_ERR_EID, FM_MOVE_OS_ERR_EID, FM_MOVE_OS_ERR_EID,
+                                                        FM_MOVE_OS_ERR_EID, FM_MOVE_OS_ERR_EID};
+
+/* Copy engine failure events - concat source file #1 replaces the former OS_cp */
+static const FM_ChildCopyEvents_t FM_ChildConcatCopyEvents = {FM_CONCAT_OSCPY_ERR_EID, FM_CONCAT_OSCPY_ERR_EID,
+                                                              FM_CONCAT_OSCPY_ERR_EID, FM_CONCAT_OSCPY_ERR_EID,
+                                                              FM_CONCAT_OSCPY_ERR_EID};
+
+/* Copy engine failure events - concat source file #2 is appended to the target */
+static const FM_ChildCopyEvents_t FM_ChildConcatAppendEvents = {FM_CONCAT_OPEN_SRC2_ERR_EID, FM_CONCAT_OPEN_TGT_ERR_EID,
+                                                                FM_CONCAT_OSRD_ERR_EID, FM_CONCAT_OSWR_ERR_EID,
+                                                                FM_CONCAT_OSRD_ERR_EID};
+
+/* Copy engine failure events - concat file list reports one event for every failure */
+static const FM_ChildCopyEvents_t FM_ChildConcatListEvents = {FM_CONCAT_LIST_OS_ERR_EID, FM_CONCAT_LIST_OS_ERR_EID,
+                                                              FM_CONCAT_LIST_OS_ERR_EID, FM_CONCAT_LIST_OS_ERR_EID,
+                                                              FM_CONCAT_LIST_OS_ERR_EID};
+
+/* Copy engine failure events - copy directory reports one event for every failure */
+static const FM_ChildCopyEvents_t FM_ChildCopyDirEvents = {FM_COPY_DIR_OS_ERR_EID, FM_COPY_DIR_OS_ERR_EID,
+                                                           FM_COPY_DIR_OS_ERR_EID, FM_COPY_DIR_OS_ERR_EID,
+                                                           FM_COPY_DIR_OS_ERR_EID};
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM child task -- startup initialization                         */
@@ -62,8 +140,10 @@ int32 FM_ChildInit(void)
 {
     int32  TaskTextLen               = OS_MAX_PATH_LEN;
     char   TaskText[OS_MAX_PATH_LEN] = "\0";
+    char   TaskName[OS_MAX_API_NAME] = FM_CHILD_TASK_NAME;
     int32  Result                    = CFE_SUCCESS;
     uint32 TaskEID                   = 0;
+    uint32 WorkerIndex               = 0;
 
     /* Create counting semaphore (given by parent to wake-up child) */
     Result = OS_CountSemCreate(&FM_GlobalData.ChildSemaphore, FM_CHILD_SEM_NAME, 0, 0);
@@ -75,7 +155,7 @@ int32 FM_ChildInit(void)
     }
     else
     {
-        /* Create mutex semaphore (protect access to ChildQueueCount) */
+        /* Create mutex semaphore (one child task worker at a time removes queue entries) */
         Result = OS_MutSemCreate(&FM_GlobalData.ChildQueueCountSem, FM_QUEUE_SEM_NAME, 0);
 
         if (Result != CFE_SUCCESS)
@@ -87,15 +167,60 @@ int32 FM_ChildInit(void)
         }
         else
         {
-            /* Create child task (low priority command handler) */
-            Result = CFE_ES_CreateChildTask(&FM_GlobalData.ChildTaskID, FM_CHILD_TASK_NAME, FM_ChildTask, 0,
-                                            FM_CHILD_TASK_STACK_SIZE, FM_CHILD_TASK_PRIORITY, 0);
+            /* Create mutex semaphore (child task workers share the I/O throttle) */
+            Result = FM_ThrottleInit();
+
             if (Result != CFE_SUCCESS)
             {
-                TaskEID = FM_CHILD_INIT_CREATE_ERR_EID;
-                strncpy(TaskText, "create task failed", TaskTextLen - 1);
+                TaskEID = FM_CHILD_INIT_TSEM_ERR_EID;
+                strncpy(TaskText, "create throttle semaphore failed", TaskTextLen - 1);
                 TaskText[TaskTextLen - 1] = '\0';
             }
+            else
+            {
+                /* Workers need their file I/O buffers before they run */
+                Result = FM_PipelineBufferInit();
+
+                if (Result != CFE_SUCCESS)
+                {
+                    TaskEID = FM_CHILD_INIT_POOL_ERR_EID;
+                    strncpy(TaskText, "create buffer pool failed", TaskTextLen - 1);
+                    TaskText[TaskTextLen - 1] = '\0';
+                }
+            }
+        }
+    }
+
+    if (Result == CFE_SUCCESS)
+    {
+        /* CRC tables are shared read-only by the workers, so build them first */
+        FM_CrcInit();
+
+        /* Commands that do not fit in the queue wait in a file (disabled on error) */
+        FM_QueuePendingInit();
+
+        /* Create the pool of child tasks (low priority command handlers) */
+        for (WorkerIndex = 0; (WorkerIndex < FM_CHILD_WORKER_COUNT) && (Result == CFE_SUCCESS); WorkerIndex++)
+        {
+            /* First worker keeps the configured name, others get an index suffix */
+            if (WorkerIndex > 0)
+            {
+                snprintf(TaskName, sizeof(TaskName), "%s_%u", FM_CHILD_TASK_NAME, (unsigned int)WorkerIndex);
+            }
+
+            Result = CFE_ES_CreateChildTask(&FM_GlobalData.ChildWorker[WorkerIndex].TaskID, TaskName, FM_ChildTask, 0,
+                                            FM_CHILD_TASK_STACK_SIZE, FM_CHILD_TASK_PRIORITY, 0);
+        }
+
+        if (Result != CFE_SUCCESS)
+        {
+            TaskEID = FM_CHILD_INIT_CREATE_ERR_EID;
+            snprintf(TaskText, TaskTextLen, "create task %s failed", TaskName);
+        }
+        else
+        {
+            /* Helper tasks overlap file reads with writes (serial transfers on error) */
+            FM_PipelineInit();
         }
     }
 
@@ -158,19 +283,25 @@ void FM_ChildLoop(void)
         if (Result == CFE_SUCCESS)
         {
             /* Make sure the parent/child handshake is not broken */
-            if (FM_GlobalData.ChildQueueCount == 0)
+            if (((FM_ATOMIC_LOAD(&FM_GlobalData.ChildQueueCount) == 0) ||
+                 ((FM_QueueLaneCount(&FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE]) +
+                   FM_QueueLaneCount(&FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK])) == 0)) &&
+                (FM_QueuePendingCount() == 0))
             {
-                FM_GlobalData.ChildCmdErrCounter++;
+                FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdErrCounter);
                 CFE_EVS_SendEvent(FM_CHILD_TERM_EMPTYQ_ERR_EID, CFE_EVS_EventType_ERROR, "%s empty queue", TaskText);
 
                 /* Set result that will terminate child task run loop */
                 Result = OS_ERROR;
             }
-            else if (FM_GlobalData.ChildReadIndex >= FM_CHILD_QUEUE_DEPTH)
+            else if ((FM_QueueLaneIsValid(&FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE]) == false) ||
+                     (FM_QueueLaneIsValid(&FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK]) == false))
             {
-                FM_GlobalData.ChildCmdErrCounter++;
+                FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdErrCounter);
                 CFE_EVS_SendEvent(FM_CHILD_TERM_QIDX_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "%s invalid queue index: index = %d", TaskText, (int)FM_GlobalData.ChildReadIndex);
+                                  "%s invalid queue index: interactive index = %d, bulk index = %d", TaskText,
+                                  (int)FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE].ReadIndex,
+                                  (int)FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].ReadIndex);
 
                 /* Set result that will terminate child task run loop */
                 Result = OS_ERROR;
@@ -200,1412 +331,4183 @@ void FM_ChildLoop(void)
 
 void FM_ChildProcess(void)
 {
-    const char *          TaskText = "Child Task";
-    FM_ChildQueueEntry_t *CmdArgs  = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildReadIndex];
+    const char *          TaskText   = "Child Task";
+    FM_ChildWorker_t *    Worker     = FM_ChildGetWorker();
+    FM_ChildQueueEntry_t *CmdArgs    = &Worker->CmdArgs;
+    uint8                 QueueIndex = 0;
+    bool                  Dequeued   = false;
+    bool                  FromQueue  = false;
+
+    /*
+    ** Take a private copy of the next queue entry so that other workers
+    **  may dequeue while this worker executes the command.  The mutex also
+    **  keeps the FM main task from searching for a command to abort while
+    **  the command moves from the queue to a worker...
+    */
+    OS_MutSemTake(FM_GlobalData.ChildQueueCountSem);
 
-    /* Invoke the command specific handler */
-    switch (CmdArgs->CommandCode)
+    /* Interactive commands are always processed before bulk commands */
+    Dequeued = FM_QueueLanePop(&FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE], &QueueIndex);
+
+    if (Dequeued == false)
     {
-        case FM_COPY_CC:
-            FM_ChildCopyCmd(CmdArgs);
-            break;
+        Dequeued = FM_QueueLanePop(&FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK], &QueueIndex);
+    }
 
-        case FM_MOVE_CC:
-            FM_ChildMoveCmd(CmdArgs);
-            break;
+    if (Dequeued == true)
+    {
+        FM_QueueEntryUnpack(QueueIndex, CmdArgs);
 
-        case FM_RENAME_CC:
-            FM_ChildRenameCmd(CmdArgs);
-            break;
+        /* Return the queue entry to the FM main task */
+        FM_ATOMIC_STORE(&FM_GlobalData.ChildQueueBusy[QueueIndex], false);
 
-        case FM_DELETE_CC:
-            FM_ChildDeleteCmd(CmdArgs);
-            break;
+        FromQueue = true;
+    }
+    else
+    {
+        /* Commands only wait in the pending commands file while the queue is full */
+        Dequeued = FM_QueuePendingPop(CmdArgs);
+    }
 
-        case FM_DELETE_ALL_CC:
-            FM_ChildDeleteAllCmd(CmdArgs);
-            break;
-#ifdef FM_INCLUDE_DECOMPRESS
-        case FM_DECOMPRESS_CC:
-            FM_ChildDecompressCmd(CmdArgs);
-            break;
-#endif
-        case FM_CONCAT_CC:
-            FM_ChildConcatCmd(CmdArgs);
-            break;
+    if (Dequeued == true)
+    {
+        /* Abort requests for the job are now made to the worker */
+        Worker->Status.CurrentJobID = CmdArgs->JobID;
+    }
 
-        case FM_CREATE_DIR_CC:
-            FM_ChildCreateDirCmd(CmdArgs);
-            break;
+    OS_MutSemGive(FM_GlobalData.ChildQueueCountSem);
 
-        case FM_DELETE_DIR_CC:
-            FM_ChildDeleteDirCmd(CmdArgs);
-            break;
+    /* Abort requests apply only to the command just dequeued */
+    Worker->Aborted = false;
 
-        case FM_GET_FILE_INFO_CC:
-            FM_ChildFileInfoCmd(CmdArgs);
-            break;
+    if (Dequeued == true)
+    {
+        FM_ChildJobStart(Worker);
+    }
 
-        case FM_GET_DIR_FILE_CC:
-            FM_ChildDirListFileCmd(CmdArgs);
-            break;
+    if (Dequeued == false)
+    {
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdErrCounter);
+        CFE_EVS_SendEvent(FM_CHILD_EXE_ERR_EID, CFE_EVS_EventType_ERROR, "%s execution error: no queued command",
+                          TaskText);
+    }
+    else if (FM_ChildCheckAbort(Worker, TaskText) == true)
+    {
+        /* Command was aborted while waiting in the queue - do not start it */
+        if (CmdArgs->Resume > 0)
+        {
+            /* An aborted resumed command must not be resumed again after a reset */
+            FM_CheckpointStart(Worker, CmdArgs);
+            FM_CheckpointClear(Worker);
+        }
+    }
+    else
+    {
+        /* Report current worker activity */
+        Worker->Status.CurrentCC = CmdArgs->CommandCode;
 
-        case FM_GET_DIR_PKT_CC:
-            FM_ChildDirListPktCmd(CmdArgs);
-            break;
+        /* Invoke the command specific handler */
+        switch (CmdArgs->CommandCode)
+        {
+            case FM_COPY_CC:
+                FM_ChildCopyCmd(CmdArgs);
+                break;
 
-        case FM_SET_FILE_PERM_CC:
-            FM_ChildSetPermissionsCmd(CmdArgs);
-            break;
+            case FM_MOVE_CC:
+                FM_ChildMoveCmd(CmdArgs);
+                break;
 
-        default:
-            FM_GlobalData.ChildCmdErrCounter++;
-            CFE_EVS_SendEvent(FM_CHILD_EXE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s execution error: invalid command code: cc = %d", TaskText, (int)CmdArgs->CommandCode);
-            break;
-    }
+            case FM_RENAME_CC:
+                FM_ChildRenameCmd(CmdArgs);
+                break;
 
-    /* Update the handshake queue read index */
-    FM_GlobalData.ChildReadIndex++;
+            case FM_DELETE_CC:
+                FM_ChildDeleteCmd(CmdArgs);
+                break;
 
-    if (FM_GlobalData.ChildReadIndex >= FM_CHILD_QUEUE_DEPTH)
+            case FM_DELETE_ALL_CC:
+                FM_ChildDeleteAllCmd(CmdArgs);
+                break;
+#ifdef FM_INCLUDE_DECOMPRESS
+            case FM_DECOMPRESS_CC:
+                FM_ChildDecompressCmd(CmdArgs);
+                break;
+#endif
+            case FM_CONCAT_CC:
+                FM_ChildConcatCmd(CmdArgs);
+                break;
+
+            case FM_CREATE_DIR_CC:
+                FM_ChildCreateDirCmd(CmdArgs);
+                break;
+
+            case FM_DELETE_DIR_CC:
+                FM_ChildDeleteDirCmd(CmdArgs);
+                break;
+
+            case FM_GET_FILE_INFO_CC:
+                FM_ChildFileInfoCmd(CmdArgs);
+                break;
+
+            case FM_GET_DIR_FILE_CC:
+                FM_ChildDirListFileCmd(CmdArgs);
+                break;
+
+            case FM_GET_DIR_PKT_CC:
+                FM_ChildDirListPktCmd(CmdArgs);
+                break;
+
+            case FM_SET_FILE_PERM_CC:
+                FM_ChildSetPermissionsCmd(CmdArgs);
+                break;
+
+            case FM_COPY_DIR_CC:
+                FM_ChildCopyDirCmd(CmdArgs);
+                break;
+
+            case FM_DELETE_TREE_CC:
+                FM_ChildDeleteTreeCmd(CmdArgs);
+                break;
+
+            case FM_DELETE_FILTER_CC:
+                FM_ChildDeleteFilterCmd(CmdArgs);
+                break;
+
+            case FM_CONCAT_LIST_CC:
+                FM_ChildConcatListCmd(CmdArgs);
+                break;
+
+            case FM_SPLIT_CC:
+                FM_ChildSplitCmd(CmdArgs);
+                break;
+
+            case FM_PREALLOCATE_CC:
+                FM_ChildPreallocateCmd(CmdArgs);
+                break;
+
+            case FM_TRUNCATE_CC:
+                FM_ChildTruncateCmd(CmdArgs);
+                break;
+
+            default:
+                FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+                CFE_EVS_SendEvent(FM_CHILD_EXE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s execution error: invalid command code: cc = %d", TaskText,
+                                  (int)CmdArgs->CommandCode);
+                break;
+        }
+
+        /* Report previous worker activity */
+        Worker->Status.CmdCounter++;
+        Worker->Status.PreviousCC = CmdArgs->CommandCode;
+        Worker->Status.CurrentCC  = 0;
+
+        /* Housekeeping reports the previous command of the worker that finished last */
+        FM_ATOMIC_STORE(&Worker->CompleteSequence, FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCompleteCount));
+    }
+
+    /* Report completion of every dequeued command, including commands aborted while queued */
+    if (Dequeued == true)
     {
-        FM_GlobalData.ChildReadIndex = 0;
+        FM_ChildJobComplete(Worker);
+
+        FM_ATOMIC_STORE(&Worker->Status.CurrentJobID, FM_CHILD_JOB_ID_NONE);
     }
 
-    /* Prevent parent/child updating queue counter at same time */
-    OS_MutSemTake(FM_GlobalData.ChildQueueCountSem);
-    FM_GlobalData.ChildQueueCount--;
-    OS_MutSemGive(FM_GlobalData.ChildQueueCountSem);
+    /* The queue count includes commands still executing */
+    if (FromQueue == true)
+    {
+        FM_ATOMIC_DECREMENT(&FM_GlobalData.ChildQueueCount);
+    }
 
 } /* End of FM_ChildProcess() */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Copy File                      */
+/* FM child task -- get data for the calling worker                */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildCopyCmd(const FM_ChildQueueEntry_t *CmdArgs)
+FM_ChildWorker_t *FM_ChildGetWorker(void)
 {
-    const char *CmdText   = "Copy File";
-    int32       OS_Status = OS_SUCCESS;
-
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    CFE_ES_TaskId_t   TaskID      = CFE_ES_TASKID_UNDEFINED;
+    FM_ChildWorker_t *Worker      = &FM_GlobalData.ChildWorker[0];
+    uint32            WorkerIndex = 0;
 
-    /* Note the order of the arguments to OS_cp (src,tgt) */
-    OS_Status = OS_cp(CmdArgs->Source1, CmdArgs->Target);
+    /* Worker task ID's are stored by FM_ChildInit before any command is queued */
+    CFE_ES_GetTaskID(&TaskID);
 
-    if (OS_Status != OS_SUCCESS)
-    {
-        FM_GlobalData.ChildCmdErrCounter++;
-
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_COPY_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_cp failed: result = %d, src = %s, tgt = %s", CmdText, (int)OS_Status,
-                          CmdArgs->Source1, CmdArgs->Target);
-    }
-    else
+    for (WorkerIndex = 0; WorkerIndex < FM_CHILD_WORKER_COUNT; WorkerIndex++)
     {
-        FM_GlobalData.ChildCmdCounter++;
-
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_COPY_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src = %s, tgt = %s", CmdText,
-                          CmdArgs->Source1, CmdArgs->Target);
+        if (CFE_RESOURCEID_TEST_EQUAL(TaskID, FM_GlobalData.ChildWorker[WorkerIndex].TaskID))
+        {
+            Worker = &FM_GlobalData.ChildWorker[WorkerIndex];
+            break;
+        }
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    return (Worker);
 
-} /* End of FM_ChildCopyCmd() */
+} /* End of FM_ChildGetWorker() */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Move File                      */
+/* FM child task -- search abort list for job ID                   */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildMoveCmd(const FM_ChildQueueEntry_t *CmdArgs)
+bool FM_ChildIsAborted(uint32 JobID)
 {
-    const char *CmdText   = "Move File";
-    int32       OS_Status = OS_SUCCESS;
+    bool   Result     = false;
+    uint32 AbortIndex = 0;
+
+    if (JobID != FM_CHILD_JOB_ID_NONE)
+    {
+        for (AbortIndex = 0; AbortIndex < FM_CHILD_ABORT_COUNT; AbortIndex++)
+        {
+            if (FM_ATOMIC_LOAD(&FM_GlobalData.ChildAbortJobID[AbortIndex]) == JobID)
+            {
+                Result = true;
+                break;
+            }
+        }
+    }
 
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    return (Result);
 
-    OS_Status = OS_mv(CmdArgs->Source1, CmdArgs->Target);
+} /* End of FM_ChildIsAborted() */
 
-    if (OS_Status != OS_SUCCESS)
-    {
-        FM_GlobalData.ChildCmdErrCounter++;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- check for abort of worker's current command    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_MOVE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_mv failed: result = %d, src = %s, tgt = %s", CmdText, (int)OS_Status,
-                          CmdArgs->Source1, CmdArgs->Target);
-    }
-    else
+bool FM_ChildCheckAbort(FM_ChildWorker_t *Worker, const char *CmdText)
+{
+    if ((Worker->Aborted == false) &&
+        ((Worker->CmdArgs.Aborted == true) || (FM_ChildIsAborted(Worker->CmdArgs.JobID) == true)))
     {
-        FM_GlobalData.ChildCmdCounter++;
+        /* Report the abort once, callers keep checking until they stop */
+        Worker->Aborted = true;
 
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_MOVE_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src = %s, tgt = %s", CmdText,
-                          CmdArgs->Source1, CmdArgs->Target);
+        FM_ChildReportStatus(FM_JOB_STATUS_ABORTED);
+
+        CFE_EVS_SendEvent(FM_CHILD_ABORT_EID, CFE_EVS_EventType_INFORMATION, "%s aborted: job = %lu", CmdText,
+                          (unsigned long)Worker->CmdArgs.JobID);
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    return (Worker->Aborted);
 
-} /* End of FM_ChildMoveCmd() */
+} /* End of FM_ChildCheckAbort() */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Rename File                    */
+/* FM child task -- report error or warning for current command    */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildRenameCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildReportStatus(uint8 Status)
 {
-    const char *CmdText   = "Rename File";
-    int32       OS_Status = OS_SUCCESS;
-
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
-
-    OS_Status = OS_rename(CmdArgs->Source1, CmdArgs->Target);
+    FM_ChildWorker_t *Worker = FM_ChildGetWorker();
 
-    if (OS_Status != OS_SUCCESS)
+    if (Status == FM_JOB_STATUS_ERROR)
     {
-        FM_GlobalData.ChildCmdErrCounter++;
-
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_RENAME_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_rename failed: result = %d, src = %s, tgt = %s", CmdText, (int)OS_Status,
-                          CmdArgs->Source1, CmdArgs->Target);
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdErrCounter);
     }
     else
     {
-        FM_GlobalData.ChildCmdCounter++;
-
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_RENAME_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src = %s, tgt = %s", CmdText,
-                          CmdArgs->Source1, CmdArgs->Target);
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdWarnCounter);
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    /* Job completion telemetry reports the most severe status */
+    if (Status > Worker->JobCompletePkt.Status)
+    {
+        Worker->JobCompletePkt.Status = Status;
+    }
 
-} /* End of FM_ChildRenameCmd() */
+} /* End of FM_ChildReportStatus() */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Delete File                    */
+/* FM child task -- start of job completion telemetry              */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDeleteCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildJobStart(FM_ChildWorker_t *Worker)
 {
-    const char *CmdText   = "Delete File";
-    int32       OS_Status = OS_SUCCESS;
+    FM_JobCompletePkt_t *JobPkt    = &Worker->JobCompletePkt;
+    int64                QueueTime = 0;
 
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    OS_GetLocalTime(&Worker->JobStartTime);
 
-    OS_Status = OS_remove(CmdArgs->Source1);
+    CFE_MSG_Init(&JobPkt->TlmHeader.Msg, CFE_SB_ValueToMsgId(FM_JOB_COMPLETE_TLM_MID), sizeof(FM_JobCompletePkt_t));
 
-    if (OS_Status != OS_SUCCESS)
-    {
-        FM_GlobalData.ChildCmdErrCounter++;
+    JobPkt->JobID          = Worker->CmdArgs.JobID;
+    JobPkt->CommandCode    = (uint8)Worker->CmdArgs.CommandCode;
+    JobPkt->Status         = FM_JOB_STATUS_SUCCESS;
+    JobPkt->CRCType        = FM_IGNORE_CRC;
+    JobPkt->BytesProcessed = 0;
+    JobPkt->WallTime       = 0;
+    JobPkt->CRC            = 0;
+    JobPkt->Verified       = FM_JOB_VERIFY_NONE;
+    JobPkt->TargetCRC      = 0;
 
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_DELETE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_remove failed: result = %d, file = %s", CmdText, (int)OS_Status,
-                          CmdArgs->Source1);
+    /* A block size commanded while the job runs applies to the next job */
+    Worker->BlockSize = FM_ATOMIC_LOAD(&FM_GlobalData.ChildBlockSize);
+
+    /* Local time may have been set backwards while the command was queued */
+    QueueTime = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(Worker->JobStartTime, Worker->CmdArgs.QueueTime));
+    if (QueueTime < 0)
+    {
+        QueueTime = 0;
     }
-    else
+    else if (QueueTime > 0xFFFFFFFF)
     {
-        FM_GlobalData.ChildCmdCounter++;
-
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_DELETE_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: file = %s", CmdText,
-                          CmdArgs->Source1);
+        QueueTime = 0xFFFFFFFF;
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    JobPkt->QueueTime = (uint32)QueueTime;
 
-} /* End of FM_ChildDeleteCmd() */
+    /* Commands that read or write file data set the expected total */
+    Worker->JobProgressPkt.BytesTotal = 0;
+    Worker->ProgressTime              = Worker->JobStartTime;
+    Worker->ProgressBytes             = 0;
+
+} /* End of FM_ChildJobStart() */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Delete All Files               */
+/* FM child task -- send job completion telemetry                  */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDeleteAllCmd(FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildJobComplete(FM_ChildWorker_t *Worker)
 {
-    const char *CmdText = "Delete All Files";
-    osal_id_t   DirId   = OS_OBJECT_ID_UNDEFINED;
-    os_dirent_t DirEntry;
-    int32       OS_Status                     = OS_SUCCESS;
-    uint32      FilenameState                 = FM_NAME_IS_INVALID;
-    uint32      NameLength                    = 0;
-    uint32      DeleteCount                   = 0;
-    uint32      FilesNotDeletedCount          = 0;
-    uint32      DirectoriesSkippedCount       = 0;
-    char        Filename[2 * OS_MAX_PATH_LEN] = "";
-
-    /*
-    ** Command argument useage for this command:
-    **
-    **  CmdArgs->CommandCode = FM_DELETE_ALL_CC
-    **  CmdArgs->Source1     = directory name
-    **  CmdArgs->Source2     = directory name plus separator
-    */
-    char *Directory  = CmdArgs->Source1;
-    char *DirWithSep = CmdArgs->Source2;
-
-    memset(&DirEntry, 0, sizeof(DirEntry));
+    FM_JobCompletePkt_t *JobPkt   = &Worker->JobCompletePkt;
+    int64                WallTime = 0;
+    OS_time_t            EndTime;
 
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    OS_GetLocalTime(&EndTime);
 
-    /* Open directory so that we can read from it */
-    OS_Status = OS_DirectoryOpen(&DirId, Directory);
-
-    if (OS_Status != OS_SUCCESS)
+    WallTime = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(EndTime, Worker->JobStartTime));
+    if (WallTime < 0)
     {
-        FM_GlobalData.ChildCmdErrCounter++;
-
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_DELETE_ALL_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, Directory);
+        WallTime = 0;
     }
-    else
+    else if (WallTime > 0xFFFFFFFF)
     {
-        /* Read each directory entry and delete the files */
+        WallTime = 0xFFFFFFFF;
+    }
 
-        while (OS_DirectoryRead(DirId, &DirEntry) == OS_SUCCESS)
-        {
-            /*
-            ** Ignore the "." and ".." directory entries
-            */
-            if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
-                (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
-            {
-                /* Construct full path filename */
-                NameLength = snprintf(Filename, sizeof(Filename), "%s%s", DirWithSep, OS_DIRENTRY_NAME(DirEntry));
+    JobPkt->WallTime = (uint32)WallTime;
 
-                if (NameLength >= OS_MAX_PATH_LEN)
-                {
-                    FilesNotDeletedCount++;
-                }
-                else
-                {
-                    /* What kind of directory entry is this? */
-                    FilenameState = FM_GetFilenameState(Filename, OS_MAX_PATH_LEN, false);
+    CFE_SB_TimeStampMsg(&JobPkt->TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&JobPkt->TlmHeader.Msg, true);
 
-                    /* FilenameState cannot have a value beyond five macros in cases below */
-                    switch (FilenameState)
-                    {
-                        case FM_NAME_IS_INVALID:
-                            FilesNotDeletedCount++;
-                            break;
+} /* End of FM_ChildJobComplete() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- add file size to expected job total            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-                        case FM_NAME_IS_NOT_IN_USE:
+void FM_ChildJobTotal(FM_ChildWorker_t *Worker, const char *Filename)
+{
+    uint32 FileSize = 0;
+    uint32 FileTime = 0;
+    uint32 FileMode = 0;
 
-                            /* This result is very unlikely - the */
-                            /*   name existed a moment ago when   */
-                            /*   the directory entry was read but */
-                            /*   now the call to OS_stat() failed */
-                            /*   implying that the entry is gone  */
-                            FilesNotDeletedCount++;
-                            break;
+    if (FM_ChildSizeTimeMode(Filename, &FileSize, &FileTime, &FileMode) == OS_SUCCESS)
+    {
+        Worker->JobProgressPkt.BytesTotal += FileSize;
+    }
 
-                        case FM_NAME_IS_DIRECTORY:
-                            DirectoriesSkippedCount++;
-                            break;
+} /* End of FM_ChildJobTotal() */
 
-                        case FM_NAME_IS_FILE_OPEN:
-                            FilesNotDeletedCount++;
-                            break;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- count a block of file data for the current job */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-                        case FM_NAME_IS_FILE_CLOSED:
-                            if ((OS_Status = OS_remove(Filename)) == OS_SUCCESS)
-                            {
-                                /*
-                                ** After deleting the file, rewind the directory
-                                ** to keep the file system from getting confused
-                                */
-                                OS_DirectoryRewind(DirId);
-
-                                /* Increment delete count */
-                                DeleteCount++;
-                            }
-                            else
-                            {
-                                FilesNotDeletedCount++;
-                            }
+void FM_ChildJobBytes(FM_ChildWorker_t *Worker, uint32 Bytes)
+{
+    int64     Elapsed = 0;
+    OS_time_t Now;
 
-                            break;
-                        default:
-                            FilesNotDeletedCount++;
-                            break;
-                    } /* end switch statement */
-                }
-            } /* end if "." or ".." directory entries */
-        }     /* End while OS_ReadDirectory */
+    Worker->JobCompletePkt.BytesProcessed += Bytes;
 
-        OS_DirectoryClose(DirId);
+    if (FM_CHILD_PROGRESS_INTERVAL_MS > 0)
+    {
+        OS_GetLocalTime(&Now);
 
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_DELETE_ALL_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: deleted %d files: dir = %s",
-                          CmdText, (int)DeleteCount, Directory);
-        FM_GlobalData.ChildCmdCounter++;
+        Elapsed = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(Now, Worker->ProgressTime));
 
-        if (FilesNotDeletedCount > 0)
+        if (Elapsed < 0)
         {
-            /* If errors occured, report generic event(s) */
-            CFE_EVS_SendEvent(FM_DELETE_ALL_FILES_ND_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                              "%s command: one or more files could not be deleted. Files may be open : dir = %s",
-                              CmdText, Directory);
-            FM_GlobalData.ChildCmdWarnCounter++;
+            /* Local time was set backwards, restart the progress interval */
+            Worker->ProgressTime  = Now;
+            Worker->ProgressBytes = Worker->JobCompletePkt.BytesProcessed;
         }
-
-        if (DirectoriesSkippedCount > 0)
+        else if (Elapsed >= FM_CHILD_PROGRESS_INTERVAL_MS)
         {
-            /* If errors occured, report generic event(s) */
-            CFE_EVS_SendEvent(FM_DELETE_ALL_SKIP_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                              "%s command: one or more directories skipped : dir = %s", CmdText, Directory);
-            FM_GlobalData.ChildCmdWarnCounter++;
-        }
-
-    } /* end if OS_Status != OS_SUCCESS */
+            FM_ChildJobProgress(Worker, Elapsed);
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+            Worker->ProgressTime  = Now;
+            Worker->ProgressBytes = Worker->JobCompletePkt.BytesProcessed;
+        }
+    }
 
-} /* End of FM_ChildDeleteAllCmd() */
+} /* End of FM_ChildJobBytes() */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Decompress File                */
+/* FM child task -- send job progress telemetry                    */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-#ifdef FM_INCLUDE_DECOMPRESS
-
-void FM_ChildDecompressCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildJobProgress(FM_ChildWorker_t *Worker, int64 Elapsed)
 {
-    const char *CmdText    = "Decompress File";
-    int32       CFE_Status = CFE_SUCCESS;
+    FM_JobProgressPkt_t *ProgressPkt = &Worker->JobProgressPkt;
+    uint32               BytesDone   = Worker->JobCompletePkt.BytesProcessed;
 
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    CFE_MSG_Init(&ProgressPkt->TlmHeader.Msg, CFE_SB_ValueToMsgId(FM_JOB_PROGRESS_TLM_MID),
+                 sizeof(FM_JobProgressPkt_t));
 
-    /* Decompress source file into target file */
-    CFE_Status = FS_LIB_Decompress(&FM_GlobalData.DecompressState, CmdArgs->Source1, CmdArgs->Target);
+    ProgressPkt->JobID       = Worker->CmdArgs.JobID;
+    ProgressPkt->CommandCode = (uint8)Worker->CmdArgs.CommandCode;
+    ProgressPkt->BytesDone   = BytesDone;
+    ProgressPkt->Throughput  = 0;
 
-    if (CFE_Status != CFE_SUCCESS)
+    /* Throughput since the previous progress packet */
+    if (Elapsed > 0)
     {
-        FM_GlobalData.ChildCmdErrCounter++;
+        ProgressPkt->Throughput = (uint32)(((uint64)(BytesDone - Worker->ProgressBytes) * 1000) / (uint64)Elapsed);
+    }
 
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_DECOM_CFE_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: CFE_FS_Decompress failed: result = %d, src = %s, tgt = %s", CmdText,
-                          (int)CFE_Status, CmdArgs->Source1, CmdArgs->Target);
+    if (ProgressPkt->BytesTotal == 0)
+    {
+        ProgressPkt->TimeRemaining = FM_JOB_TIME_UNKNOWN;
+    }
+    else if (BytesDone >= ProgressPkt->BytesTotal)
+    {
+        ProgressPkt->TimeRemaining = 0;
+    }
+    else if (ProgressPkt->Throughput == 0)
+    {
+        /* No data moved since the previous packet - stalled */
+        ProgressPkt->TimeRemaining = FM_JOB_TIME_UNKNOWN;
     }
     else
     {
-        FM_GlobalData.ChildCmdCounter++;
-
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_DECOM_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src = %s, tgt = %s", CmdText,
-                          CmdArgs->Source1, CmdArgs->Target);
+        ProgressPkt->TimeRemaining = (ProgressPkt->BytesTotal - BytesDone) / ProgressPkt->Throughput;
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
-
-} /* End of FM_ChildDecompressCmd() */
+    CFE_SB_TimeStampMsg(&ProgressPkt->TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&ProgressPkt->TlmHeader.Msg, true);
 
-#endif
+} /* End of FM_ChildJobProgress() */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Concatenate Files              */
+/* FM child task command handler -- Copy File                      */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildConcatCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildCopyCmd(const FM_ChildQueueEntry_t *CmdArgs)
 {
-    const char *CmdText        = "Concat Files";
-    bool        ConcatResult   = false;
-    bool        CopyInProgress = false;
-    bool        CreatedTgtFile = false;
-    bool        OpenedSource2  = false;
-    bool        OpenedTgtFile  = false;
-    int32       LoopCount      = 0;
-    int32       OS_Status      = OS_SUCCESS;
-    osal_id_t   FileHandleSrc  = OS_OBJECT_ID_UNDEFINED;
-    osal_id_t   FileHandleTgt  = OS_OBJECT_ID_UNDEFINED;
-    int32       BytesRead      = 0;
-    int32       BytesWritten   = 0;
-
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
-
-    /* Copy source file #1 to the target file */
-    OS_Status = OS_cp(CmdArgs->Source1, CmdArgs->Target);
-
-    if (OS_Status != OS_SUCCESS)
+    FM_ChildWorker_t *Worker        = FM_ChildGetWorker();
+    const char *      CmdText       = "Copy File";
+    const char *      MethodText    = "copy";
+    bool              CopyResult    = false;
+    bool              OpenedTgtFile = false;
+
+    /* Sharing the source data is one metadata operation, the file data is copied when it fails */
+    if ((CmdArgs->Link != FM_COPY_LINK_NONE) && (CmdArgs->CrossVolume == false) &&
+        (FM_ChildLinkFile(CmdArgs->Source1, CmdArgs->Target, CmdArgs->Link) == OS_SUCCESS))
     {
-        FM_GlobalData.ChildCmdErrCounter++;
-
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_CONCAT_OSCPY_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_cp failed: result = %d, src = %s, tgt = %s", CmdText, (int)OS_Status,
-                          CmdArgs->Source1, CmdArgs->Target);
+        CopyResult = true;
+        MethodText = (CmdArgs->Link == FM_COPY_LINK_HARD) ? "link" : "clone";
     }
     else
     {
-        CreatedTgtFile = true;
-    }
-
-    /* Open source file #2 */
-    if (CreatedTgtFile)
-    {
-        OS_Status = OS_OpenCreate(&FileHandleSrc, CmdArgs->Source2, OS_FILE_FLAG_NONE, OS_READ_ONLY);
-
-        if (OS_Status != OS_SUCCESS)
-        {
-            FM_GlobalData.ChildCmdErrCounter++;
+        /* Copy in blocks, saving checkpoints so that a reset does not restart the copy */
+        FM_CheckpointStart(Worker, CmdArgs);
+        FM_ChildJobTotal(Worker, CmdArgs->Source1);
+        FM_ChildCopyResume(Worker, CmdText);
 
-            /* Send command failure event (error) */
-            CFE_EVS_SendEvent(FM_CONCAT_OPEN_SRC2_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s error: OS_OpenCreate failed: result = %d, src2 = %s", CmdText, (int)OS_Status,
-                              CmdArgs->Source2);
-        }
-        else
+        if (CmdArgs->Verify == true)
         {
-            OpenedSource2 = true;
+            /* Target file is read again after it is written */
+            FM_ChildJobTotal(Worker, CmdArgs->Source1);
         }
-    }
-
-    /* Open target file */
-    if (OpenedSource2)
-    {
-        OS_Status = OS_OpenCreate(&FileHandleTgt, CmdArgs->Target, OS_FILE_FLAG_NONE, OS_READ_WRITE);
 
-        if (OS_Status != OS_SUCCESS)
-        {
-            FM_GlobalData.ChildCmdErrCounter++;
+        CopyResult = FM_ChildCopySegment(Worker, CmdText, &FM_ChildCopyEvents, &OpenedTgtFile);
 
-            /* Send command failure event (error) */
-            CFE_EVS_SendEvent(FM_CONCAT_OPEN_TGT_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s error: OS_OpenCreate failed: result = %d, tgt = %s", CmdText, (int)OS_Status,
-                              CmdArgs->Target);
-        }
-        else
+        /* Read back the target file, the checkpoint is kept until the read back completes */
+        if ((CopyResult == true) && (CmdArgs->Verify == true))
         {
-            OpenedTgtFile = true;
+            CopyResult = FM_ChildVerifyTarget(Worker, CmdText, &FM_ChildCopyEvents);
         }
-    }
 
-    /* Append source file #2 to target file */
-    if (OpenedTgtFile)
-    {
-        /* Seek to end of target file */
-        OS_lseek(FileHandleTgt, 0, OS_SEEK_END);
-        CopyInProgress = true;
-        LoopCount      = 0;
+        FM_CheckpointClear(Worker);
 
-        while (CopyInProgress)
+        if ((OpenedTgtFile == true) && (CopyResult == false))
         {
-            BytesRead = OS_read(FileHandleSrc, FM_GlobalData.ChildBuffer, FM_CHILD_FILE_BLOCK_SIZE);
-
-            if (BytesRead == 0)
-            {
-                /* Success - finished reading source file #2 */
-                CopyInProgress = false;
-                ConcatResult   = true;
-            }
-            else if (BytesRead < 0)
-            {
-                CopyInProgress = false;
-                FM_GlobalData.ChildCmdErrCounter++;
-
-                /* Send command failure event (error) */
-                CFE_EVS_SendEvent(FM_CONCAT_OSRD_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "%s error: OS_read failed: result = %d, file = %s", CmdText, (int)BytesRead,
-                                  CmdArgs->Source2);
-            }
-            else
-            {
-                /* Write source file #2 to target file */
-                BytesWritten = OS_write(FileHandleTgt, FM_GlobalData.ChildBuffer, BytesRead);
-
-                if (BytesWritten != BytesRead)
-                {
-                    CopyInProgress = false;
-                    FM_GlobalData.ChildCmdErrCounter++;
-
-                    /* Send command failure event (error) */
-                    CFE_EVS_SendEvent(FM_CONCAT_OSWR_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "%s error: OS_write failed: result = %d, expected = %d", CmdText,
-                                      (int)BytesWritten, (int)BytesRead);
-                }
-            }
-
-            /* Avoid CPU hogging */
-            if (CopyInProgress)
-            {
-                LoopCount++;
-                if (LoopCount == FM_CHILD_FILE_LOOP_COUNT)
-                {
-                    /* Give up the CPU */
-                    CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
-                    OS_TaskDelay(FM_CHILD_FILE_SLEEP_MS);
-                    CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
-                    LoopCount = 0;
-                }
-            }
+            /* Remove partial target file after copy error or abort */
+            OS_remove(CmdArgs->Target);
         }
     }
 
-    if (OpenedTgtFile)
-    {
-        /* Close target file */
-        OS_close(FileHandleTgt);
-    }
-
-    if (OpenedSource2)
-    {
-        /* Close source file #2 */
-        OS_close(FileHandleSrc);
-    }
-
-    if ((CreatedTgtFile == true) && (ConcatResult == false))
+    if (CopyResult == true)
     {
-        /* Remove partial target file after concat error */
-        OS_remove(CmdArgs->Target);
-    }
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
 
-    if (ConcatResult == true)
-    {
-        FM_GlobalData.ChildCmdCounter++;
+        /* CRC of the copied data (if requested) is reported with the job completion */
+        Worker->JobCompletePkt.CRCType = (uint8)CmdArgs->FileInfoCRC;
 
         /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_CONCAT_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src1 = %s, src2 = %s, tgt = %s",
-                          CmdText, CmdArgs->Source1, CmdArgs->Source2, CmdArgs->Target);
+        CFE_EVS_SendEvent(FM_COPY_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src = %s, tgt = %s, method = %s",
+                          CmdText, CmdArgs->Source1, CmdArgs->Target, MethodText);
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
-
-} /* End of FM_ChildConcatCmd() */
+} /* End of FM_ChildCopyCmd() */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Get File Info                  */
+/* FM child task command handler -- Move File                      */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildFileInfoCmd(FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildMoveCmd(const FM_ChildQueueEntry_t *CmdArgs)
 {
-    const char *CmdText    = "Get File Info";
-    bool        GettingCRC = false;
-    uint32      CurrentCRC = 0;
-    int32       LoopCount  = 0;
-    int32       BytesRead  = 0;
-    osal_id_t   FileHandle = OS_OBJECT_ID_UNDEFINED;
-    int32       Status     = 0;
-
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
-
-    /*
-    ** Command argument useage for this command:
-    **
-    **  CmdArgs->CommandCode   = FM_GET_DIR_FILE_CC
-    **  CmdArgs->Source1       = name of directory or file
-    **  CmdArgs->FileInfoState = state of directory or file
-    **  CmdArgs->FileInfoSize  = file size, else zero
-    **  CmdArgs->FileInfoTime  = last modify time
-    */
-
-    /* Initialize file info packet (set all data to zero) */
-    CFE_MSG_Init(&FM_GlobalData.FileInfoPkt.TlmHeader.Msg, CFE_SB_ValueToMsgId(FM_FILE_INFO_TLM_MID),
-                 sizeof(FM_FileInfoPkt_t));
-
-    /* Report directory or filename state, name, size and time */
-    FM_GlobalData.FileInfoPkt.FileStatus = (uint8)CmdArgs->FileInfoState;
-    strncpy(FM_GlobalData.FileInfoPkt.Filename, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
-    FM_GlobalData.FileInfoPkt.Filename[OS_MAX_PATH_LEN - 1] = '\0';
-
-    FM_GlobalData.FileInfoPkt.FileSize         = CmdArgs->FileInfoSize;
-    FM_GlobalData.FileInfoPkt.LastModifiedTime = CmdArgs->FileInfoTime;
-    FM_GlobalData.FileInfoPkt.Mode             = CmdArgs->Mode;
-
-    /* Validate CRC algorithm */
-    if (CmdArgs->FileInfoCRC != FM_IGNORE_CRC)
+    FM_ChildWorker_t *Worker        = FM_ChildGetWorker();
+    const char *      CmdText       = "Move File";
+    bool              MoveResult    = false;
+    bool              OpenedTgtFile = false;
+    int32             OS_Status     = OS_ERROR;
+
+    /* Same or unknown volumes, only the directory entry changes */
+    if (CmdArgs->CrossVolume == false)
     {
-        if (CmdArgs->FileInfoState != FM_NAME_IS_FILE_CLOSED)
-        {
-            /* Can only calculate CRC for closed files */
-            FM_GlobalData.ChildCmdWarnCounter++;
-
-            CFE_EVS_SendEvent(FM_GET_FILE_INFO_STATE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                              "%s warning: unable to compute CRC: invalid file state = %d, file = %s", CmdText,
-                              (int)CmdArgs->FileInfoState, CmdArgs->Source1);
-
-            CmdArgs->FileInfoCRC = FM_IGNORE_CRC;
-        }
-        else if ((CmdArgs->FileInfoCRC != CFE_MISSION_ES_CRC_8) && (CmdArgs->FileInfoCRC != CFE_MISSION_ES_CRC_16) &&
-                 (CmdArgs->FileInfoCRC != CFE_MISSION_ES_CRC_32))
-        {
-            /* Can only calculate CRC using known algorithms */
-            FM_GlobalData.ChildCmdWarnCounter++;
-
-            CFE_EVS_SendEvent(FM_GET_FILE_INFO_TYPE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                              "%s warning: unable to compute CRC: invalid CRC type = %d, file = %s", CmdText,
-                              (int)CmdArgs->FileInfoCRC, CmdArgs->Source1);
-
-            CmdArgs->FileInfoCRC = FM_IGNORE_CRC;
-        }
+        OS_Status = OS_rename(CmdArgs->Source1, CmdArgs->Target);
     }
 
-    /* Compute CRC */
-    if (CmdArgs->FileInfoCRC != FM_IGNORE_CRC)
+    if (OS_Status == OS_SUCCESS)
     {
-        Status = OS_OpenCreate(&FileHandle, CmdArgs->Source1, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+        MoveResult = true;
+    }
+    else
+    {
+        /* Across volumes the file data is streamed, then read back to verify the CRC */
+        FM_CheckpointStart(Worker, CmdArgs);
+        FM_ChildJobTotal(Worker, CmdArgs->Source1);
+        FM_ChildJobTotal(Worker, CmdArgs->Source1);
+        FM_ChildCopyResume(Worker, CmdText);
 
-        if (Status != OS_SUCCESS)
+        MoveResult = FM_ChildCopySegment(Worker, CmdText, &FM_ChildMoveEvents, &OpenedTgtFile);
+
+        if (MoveResult == true)
         {
-            FM_GlobalData.ChildCmdWarnCounter++;
+            MoveResult = FM_ChildVerifyTarget(Worker, CmdText, &FM_ChildMoveEvents);
+        }
 
-            /* Send CRC failure event (warning) */
-            CFE_EVS_SendEvent(FM_GET_FILE_INFO_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s warning: unable to compute CRC: OS_OpenCreate result = %d, file = %s", CmdText,
-                              (int)Status, CmdArgs->Source1);
+        /* A reset after this point leaves both files, never neither */
+        FM_CheckpointClear(Worker);
 
-            GettingCRC = false;
-        }
-        else
+        if ((OpenedTgtFile == true) && (MoveResult == false))
         {
-            GettingCRC = true;
+            /* Remove partial or unverified target file, the source file is kept */
+            OS_remove(CmdArgs->Target);
         }
 
-        while (GettingCRC)
+        if (MoveResult == true)
         {
-            BytesRead = OS_read(FileHandle, FM_GlobalData.ChildBuffer, FM_CHILD_FILE_BLOCK_SIZE);
-
-            if (BytesRead == 0)
-            {
-                /* Finished reading file */
-                GettingCRC = false;
-                OS_close(FileHandle);
-
-                /* Add CRC to telemetry packet */
-                FM_GlobalData.FileInfoPkt.CRC_Computed = true;
-                FM_GlobalData.FileInfoPkt.CRC          = CurrentCRC;
-            }
-            else if (BytesRead < 0)
-            {
-                /* Error reading file */
-                CurrentCRC = 0;
-                GettingCRC = false;
-                OS_close(FileHandle);
+            OS_Status = OS_remove(CmdArgs->Source1);
 
-                /* Send CRC failure event (warning) */
-                FM_GlobalData.ChildCmdWarnCounter++;
-                CFE_EVS_SendEvent(FM_GET_FILE_INFO_READ_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                                  "%s warning: unable to compute CRC: OS_read result = %d, file = %s", CmdText,
-                                  (int)BytesRead, CmdArgs->Source1);
-            }
-            else
+            if (OS_Status != OS_SUCCESS)
             {
-                /* Continue CRC calculation */
-                CurrentCRC =
-                    CFE_ES_CalculateCRC(FM_GlobalData.ChildBuffer, BytesRead, CurrentCRC, CmdArgs->FileInfoCRC);
-            }
+                MoveResult = false;
+                FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
 
-            /* Avoid CPU hogging */
-            if (GettingCRC)
-            {
-                LoopCount++;
-                if (LoopCount == FM_CHILD_FILE_LOOP_COUNT)
-                {
-                    /* Give up the CPU */
-                    CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
-                    OS_TaskDelay(FM_CHILD_FILE_SLEEP_MS);
-                    CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
-                    LoopCount = 0;
-                }
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_MOVE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: OS_remove failed: result = %d, src = %s", CmdText, (int)OS_Status,
+                                  CmdArgs->Source1);
             }
         }
-
-        FM_GlobalData.FileInfoPkt.CRC = CurrentCRC;
     }
 
-    /* Timestamp and send file info telemetry packet */
-    CFE_SB_TimeStampMsg(&FM_GlobalData.FileInfoPkt.TlmHeader.Msg);
-    CFE_SB_TransmitMsg(&FM_GlobalData.FileInfoPkt.TlmHeader.Msg, true);
-
-    FM_GlobalData.ChildCmdCounter++;
-
-    /* Send command completion event (debug) */
-    CFE_EVS_SendEvent(FM_GET_FILE_INFO_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: file = %s", CmdText,
-                      CmdArgs->Source1);
+    if (MoveResult == true)
+    {
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_MOVE_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src = %s, tgt = %s", CmdText,
+                          CmdArgs->Source1, CmdArgs->Target);
+    }
 
-} /* End of FM_ChildFileInfoCmd() */
+} /* End of FM_ChildMoveCmd() */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Create Directory               */
+/* FM child task command handler -- Rename File                    */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildCreateDirCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildRenameCmd(const FM_ChildQueueEntry_t *CmdArgs)
 {
-    const char *CmdText   = "Create Directory";
+    const char *CmdText   = "Rename File";
     int32       OS_Status = OS_SUCCESS;
 
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
-
-    OS_Status = OS_mkdir(CmdArgs->Source1, 0);
+    OS_Status = OS_rename(CmdArgs->Source1, CmdArgs->Target);
 
     if (OS_Status != OS_SUCCESS)
     {
-        FM_GlobalData.ChildCmdErrCounter++;
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
 
         /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_CREATE_DIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_mkdir failed: result = %d, dir = %s", CmdText, (int)OS_Status,
-                          CmdArgs->Source1);
+        CFE_EVS_SendEvent(FM_RENAME_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_rename failed: result = %d, src = %s, tgt = %s", CmdText, (int)OS_Status,
+                          CmdArgs->Source1, CmdArgs->Target);
     }
     else
     {
-        FM_GlobalData.ChildCmdCounter++;
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
 
         /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_CREATE_DIR_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src = %s", CmdText,
-                          CmdArgs->Source1);
+        CFE_EVS_SendEvent(FM_RENAME_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src = %s, tgt = %s", CmdText,
+                          CmdArgs->Source1, CmdArgs->Target);
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
-
-} /* End of FM_ChildCreateDirCmd() */
+} /* End of FM_ChildRenameCmd() */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Delete Directory               */
+/* FM child task command handler -- Delete File                    */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDeleteDirCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildDeleteCmd(const FM_ChildQueueEntry_t *CmdArgs)
 {
-    const char *CmdText      = "Delete Directory";
-    bool        RemoveTheDir = true;
-    osal_id_t   DirId        = OS_OBJECT_ID_UNDEFINED;
-    os_dirent_t DirEntry;
+    const char *CmdText   = "Delete File";
     int32       OS_Status = OS_SUCCESS;
 
-    memset(&DirEntry, 0, sizeof(DirEntry));
-
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
-
-    /* Open the dir so we can see if it is empty */
-    OS_Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+    OS_Status = OS_remove(CmdArgs->Source1);
 
     if (OS_Status != OS_SUCCESS)
     {
-        CFE_EVS_SendEvent(FM_DELETE_OPENDIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
 
-        RemoveTheDir = false;
-        FM_GlobalData.ChildCmdErrCounter++;
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_DELETE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_remove failed: result = %d, file = %s", CmdText, (int)OS_Status,
+                          CmdArgs->Source1);
     }
     else
     {
-        /* Look for a directory entry that is not "." or ".." */
-        while ((OS_DirectoryRead(DirId, &DirEntry) == OS_SUCCESS) && (RemoveTheDir == true))
-        {
-            if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_DELETE_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: file = %s", CmdText,
+                          CmdArgs->Source1);
+    }
+
+} /* End of FM_ChildDeleteCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Delete All Files               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDeleteAllCmd(FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildWorker_t *   Worker    = FM_ChildGetWorker();
+    FM_OpenFilesEntry_t *OpenFiles = (FM_OpenFilesEntry_t *)Worker->ChildBuffer;
+    char *               NameList  = &Worker->ChildBuffer[FM_CHILD_OPEN_LIST_SIZE];
+    const char *         CmdText   = "Delete All Files";
+    osal_id_t            DirId     = OS_OBJECT_ID_UNDEFINED;
+    os_dirent_t          DirEntry;
+    int32                OS_Status                 = OS_SUCCESS;
+    bool                 DirEnd                    = false;
+    uint32               FilenameState             = FM_NAME_IS_INVALID;
+    uint32               OpenCount                 = 0;
+    uint32               DirLength                 = 0;
+    uint32               NameLength                = 0;
+    uint32               ListLength                = 0;
+    uint32               ListOffset                = 0;
+    uint32               DeleteCount               = 0;
+    uint32               FilesNotDeletedCount      = 0;
+    uint32               DirectoriesSkippedCount   = 0;
+    char                 Filename[OS_MAX_PATH_LEN] = "";
+
+    /*
+    ** Command argument useage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_DELETE_ALL_CC
+    **  CmdArgs->Source1     = directory name
+    **  CmdArgs->Source2     = directory name plus separator
+    */
+    char *Directory  = CmdArgs->Source1;
+    char *DirWithSep = CmdArgs->Source2;
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    /* Open directory so that we can read from it */
+    OS_Status = OS_DirectoryOpen(&DirId, Directory);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_DELETE_ALL_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, Directory);
+    }
+    else
+    {
+        /* One list of open files serves every entry, rather than a search of every OSAL object per entry */
+        memset(OpenFiles, 0, FM_CHILD_OPEN_LIST_SIZE);
+        OpenCount = FM_GetOpenFilesData(OpenFiles);
+
+        strncpy(Filename, DirWithSep, OS_MAX_PATH_LEN - 1);
+        Filename[OS_MAX_PATH_LEN - 1] = '\0';
+        DirLength                     = strlen(Filename);
+
+        /*
+        ** Names are listed in batches that fill the worker buffer, then each
+        **  batch is deleted.  The directory is read once and never rewound,
+        **  deleting entries that were already read does not change which
+        **  entries are read next.
+        */
+        while (DirEnd == false)
+        {
+            ListLength = 0;
+
+            /* Every name that fits in a path also fits in the space left */
+            while ((DirEnd == false) && ((ListLength + OS_MAX_PATH_LEN) <= FM_CHILD_NAME_LIST_SIZE))
+            {
+                if (OS_DirectoryRead(DirId, &DirEntry) != OS_SUCCESS)
+                {
+                    DirEnd = true;
+                }
+                else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+                         (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+                {
+                    NameLength = strlen(OS_DIRENTRY_NAME(DirEntry));
+
+                    if ((DirLength + NameLength) >= OS_MAX_PATH_LEN)
+                    {
+                        FilesNotDeletedCount++;
+                    }
+                    else
+                    {
+                        memcpy(&NameList[ListLength], OS_DIRENTRY_NAME(DirEntry), NameLength + 1);
+                        ListLength += NameLength + 1;
+                    }
+                }
+            }
+
+            for (ListOffset = 0; ListOffset < ListLength; ListOffset += NameLength + 1)
+            {
+                /* Construct full path filename */
+                NameLength = strlen(&NameList[ListOffset]);
+                memcpy(&Filename[DirLength], &NameList[ListOffset], NameLength + 1);
+
+                /* What kind of directory entry is this? */
+                FM_ThrottleStats();
+                FilenameState = FM_GetFilenameStateFromList(Filename, OS_MAX_PATH_LEN, OpenFiles, OpenCount);
+
+                switch (FilenameState)
+                {
+                    case FM_NAME_IS_DIRECTORY:
+                        DirectoriesSkippedCount++;
+                        break;
+
+                    case FM_NAME_IS_FILE_CLOSED:
+                        if (OS_remove(Filename) == OS_SUCCESS)
+                        {
+                            DeleteCount++;
+                        }
+                        else
+                        {
+                            FilesNotDeletedCount++;
+                        }
+                        break;
+
+                    default:
+                        /* Invalid, open, or gone since the directory was read */
+                        FilesNotDeletedCount++;
+                        break;
+                }
+            }
+        }
+
+        OS_DirectoryClose(DirId);
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_DELETE_ALL_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: deleted %d files: dir = %s",
+                          CmdText, (int)DeleteCount, Directory);
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        if (FilesNotDeletedCount > 0)
+        {
+            /* If errors occured, report generic event(s) */
+            CFE_EVS_SendEvent(FM_DELETE_ALL_FILES_ND_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s command: one or more files could not be deleted. Files may be open : dir = %s",
+                              CmdText, Directory);
+            FM_ChildReportStatus(FM_JOB_STATUS_WARNING);
+        }
+
+        if (DirectoriesSkippedCount > 0)
+        {
+            /* If errors occured, report generic event(s) */
+            CFE_EVS_SendEvent(FM_DELETE_ALL_SKIP_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s command: one or more directories skipped : dir = %s", CmdText, Directory);
+            FM_ChildReportStatus(FM_JOB_STATUS_WARNING);
+        }
+
+    } /* end if OS_Status != OS_SUCCESS */
+
+} /* End of FM_ChildDeleteAllCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Decompress File                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifdef FM_INCLUDE_DECOMPRESS
+
+void FM_ChildDecompressCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildWorker_t *Worker     = FM_ChildGetWorker();
+    const char *      CmdText    = "Decompress File";
+    int32             CFE_Status = CFE_SUCCESS;
+
+    /* Decompress source file into target file */
+    CFE_Status = FS_LIB_Decompress(&Worker->DecompressState, CmdArgs->Source1, CmdArgs->Target);
+
+    if (CFE_Status != CFE_SUCCESS)
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_DECOM_CFE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: CFE_FS_Decompress failed: result = %d, src = %s, tgt = %s", CmdText,
+                          (int)CFE_Status, CmdArgs->Source1, CmdArgs->Target);
+    }
+    else
+    {
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_DECOM_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src = %s, tgt = %s", CmdText,
+                          CmdArgs->Source1, CmdArgs->Target);
+    }
+
+} /* End of FM_ChildDecompressCmd() */
+
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Concatenate Files              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildConcatCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildWorker_t *Worker        = FM_ChildGetWorker();
+    const char *      CmdText       = "Concat Files";
+    bool              ConcatResult  = true;
+    bool              OpenedTgtFile = false;
+
+    /* Copy in blocks, saving checkpoints so that a reset does not restart the concat */
+    FM_CheckpointStart(Worker, CmdArgs);
+    FM_ChildJobTotal(Worker, CmdArgs->Source1);
+    FM_ChildJobTotal(Worker, CmdArgs->Source2);
+    FM_ChildCopyResume(Worker, CmdText);
+
+    /* Copy source file #1 to the target file (skipped when resuming with source file #2) */
+    if (Worker->Checkpoint.Segment == 0)
+    {
+        ConcatResult = FM_ChildCopySegment(Worker, CmdText, &FM_ChildConcatCopyEvents, &OpenedTgtFile);
+
+        if (ConcatResult == true)
+        {
+            Worker->Checkpoint.Segment      = 1;
+            Worker->Checkpoint.SourceOffset = 0;
+        }
+    }
+
+    /* Append source file #2 to target file */
+    if (ConcatResult == true)
+    {
+        ConcatResult = FM_ChildCopySegment(Worker, CmdText, &FM_ChildConcatAppendEvents, &OpenedTgtFile);
+    }
+
+    FM_CheckpointClear(Worker);
+
+    if ((OpenedTgtFile == true) && (ConcatResult == false))
+    {
+        /* Remove partial target file after concat error or abort */
+        OS_remove(CmdArgs->Target);
+    }
+
+    if (ConcatResult == true)
+    {
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        /* CRC of the concatenated data (if requested) is reported with the job completion */
+        Worker->JobCompletePkt.CRCType = (uint8)CmdArgs->FileInfoCRC;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_CONCAT_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src1 = %s, src2 = %s, tgt = %s",
+                          CmdText, CmdArgs->Source1, CmdArgs->Source2, CmdArgs->Target);
+    }
+
+} /* End of FM_ChildConcatCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Get File Info                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildFileInfoCmd(FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildWorker_t *Worker     = FM_ChildGetWorker();
+    const char *      CmdText    = "Get File Info";
+    bool              GettingCRC = false;
+    uint32            CurrentCRC = 0;
+    int32             BytesRead  = 0;
+    char *            Buffer     = NULL;
+    osal_id_t         FileHandle = OS_OBJECT_ID_UNDEFINED;
+    int32             Status     = 0;
+
+    /*
+    ** Command argument useage for this command:
+    **
+    **  CmdArgs->CommandCode   = FM_GET_DIR_FILE_CC
+    **  CmdArgs->Source1       = name of directory or file
+    **  CmdArgs->FileInfoState = state of directory or file
+    **  CmdArgs->FileInfoSize  = file size, else zero
+    **  CmdArgs->FileInfoTime  = last modify time
+    */
+
+    /* Initialize file info packet (set all data to zero) */
+    CFE_MSG_Init(&Worker->FileInfoPkt.TlmHeader.Msg, CFE_SB_ValueToMsgId(FM_FILE_INFO_TLM_MID),
+                 sizeof(FM_FileInfoPkt_t));
+
+    /* Report directory or filename state, name, size and time */
+    Worker->FileInfoPkt.FileStatus = (uint8)CmdArgs->FileInfoState;
+    strncpy(Worker->FileInfoPkt.Filename, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
+    Worker->FileInfoPkt.Filename[OS_MAX_PATH_LEN - 1] = '\0';
+
+    Worker->FileInfoPkt.FileSize         = CmdArgs->FileInfoSize;
+    Worker->FileInfoPkt.AllocatedSize    = FM_FILE_SIZE_UNKNOWN;
+    Worker->FileInfoPkt.LastModifiedTime = CmdArgs->FileInfoTime;
+    Worker->FileInfoPkt.Mode             = CmdArgs->Mode;
+
+    /* A sparse file has fewer bytes allocated than its logical size */
+    if (CmdArgs->FileInfoState == FM_NAME_IS_FILE_CLOSED)
+    {
+        Worker->FileInfoPkt.AllocatedSize = FM_ChildAllocatedSize(CmdArgs->Source1);
+    }
+
+    /* Validate CRC algorithm */
+    if (CmdArgs->FileInfoCRC != FM_IGNORE_CRC)
+    {
+        if (CmdArgs->FileInfoState != FM_NAME_IS_FILE_CLOSED)
+        {
+            /* Can only calculate CRC for closed files */
+            FM_ChildReportStatus(FM_JOB_STATUS_WARNING);
+
+            CFE_EVS_SendEvent(FM_GET_FILE_INFO_STATE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s warning: unable to compute CRC: invalid file state = %d, file = %s", CmdText,
+                              (int)CmdArgs->FileInfoState, CmdArgs->Source1);
+
+            CmdArgs->FileInfoCRC = FM_IGNORE_CRC;
+        }
+        else if ((CmdArgs->FileInfoCRC != CFE_MISSION_ES_CRC_8) && (CmdArgs->FileInfoCRC != CFE_MISSION_ES_CRC_16) &&
+                 (CmdArgs->FileInfoCRC != CFE_MISSION_ES_CRC_32))
+        {
+            /* Can only calculate CRC using known algorithms */
+            FM_ChildReportStatus(FM_JOB_STATUS_WARNING);
+
+            CFE_EVS_SendEvent(FM_GET_FILE_INFO_TYPE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s warning: unable to compute CRC: invalid CRC type = %d, file = %s", CmdText,
+                              (int)CmdArgs->FileInfoCRC, CmdArgs->Source1);
+
+            CmdArgs->FileInfoCRC = FM_IGNORE_CRC;
+        }
+    }
+
+    /* Compute CRC */
+    if (CmdArgs->FileInfoCRC != FM_IGNORE_CRC)
+    {
+        /* The pipeline computes the CRC of each block while the next block is read */
+        FM_PipelineStart(Worker, FM_PIPELINE_MODE_CRC, OS_OBJECT_ID_UNDEFINED, CmdArgs->FileInfoCRC, 0);
+
+        Status = OS_OpenCreate(&FileHandle, CmdArgs->Source1, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+        if (Status != OS_SUCCESS)
+        {
+            FM_ChildReportStatus(FM_JOB_STATUS_WARNING);
+
+            /* Send CRC failure event (warning) */
+            CFE_EVS_SendEvent(FM_GET_FILE_INFO_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s warning: unable to compute CRC: OS_OpenCreate result = %d, file = %s", CmdText,
+                              (int)Status, CmdArgs->Source1);
+
+            GettingCRC = false;
+        }
+        else
+        {
+            GettingCRC = true;
+            FM_ThrottleStart(Worker);
+
+            /* Size from the command verification is the expected job total */
+            Worker->JobProgressPkt.BytesTotal = CmdArgs->FileInfoSize;
+        }
+
+        while (GettingCRC)
+        {
+            Buffer    = FM_PipelineBuffer(Worker);
+            BytesRead = OS_read(FileHandle, Buffer, Worker->BlockSize);
+
+            if (BytesRead == 0)
+            {
+                /* Finished reading file */
+                GettingCRC = false;
+                OS_close(FileHandle);
+
+                /* Add CRC to telemetry packet */
+                Worker->FileInfoPkt.CRC_Computed = true;
+            }
+            else if (BytesRead < 0)
+            {
+                /* Error reading file */
+                CurrentCRC = 0;
+                GettingCRC = false;
+                OS_close(FileHandle);
+
+                /* Send CRC failure event (warning) */
+                FM_ChildReportStatus(FM_JOB_STATUS_WARNING);
+                CFE_EVS_SendEvent(FM_GET_FILE_INFO_READ_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                  "%s warning: unable to compute CRC: OS_read result = %d, file = %s", CmdText,
+                                  (int)BytesRead, CmdArgs->Source1);
+            }
+            else
+            {
+                /* Continue CRC calculation */
+                FM_PipelineSubmit(Worker, BytesRead);
+
+                /* Stop between blocks if the command has been aborted */
+                if (FM_ChildCheckAbort(Worker, CmdText) == true)
+                {
+                    GettingCRC = false;
+                    OS_close(FileHandle);
+                }
+            }
+
+            /* Avoid CPU hogging */
+            if (GettingCRC)
+            {
+                FM_ThrottleBytes(Worker, BytesRead);
+            }
+        }
+
+        /* Wait for the blocks already read to be added to the CRC */
+        if (FM_PipelineFinish(Worker) == false)
+        {
+            Worker->FileInfoPkt.CRC_Computed = false;
+
+            /* Send CRC failure event (warning) */
+            FM_ChildReportStatus(FM_JOB_STATUS_WARNING);
+            CFE_EVS_SendEvent(FM_GET_FILE_INFO_READ_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s warning: unable to compute CRC: pipeline result = %d, file = %s", CmdText,
+                              (int)Worker->Pipeline.Result, CmdArgs->Source1);
+        }
+
+        if (Worker->FileInfoPkt.CRC_Computed == true)
+        {
+            CurrentCRC = Worker->Pipeline.CRC;
+        }
+
+        Worker->FileInfoPkt.CRC = CurrentCRC;
+    }
+
+    /* An aborted command sends no partial results */
+    if (Worker->Aborted == false)
+    {
+        /* Timestamp and send file info telemetry packet */
+        CFE_SB_TimeStampMsg(&Worker->FileInfoPkt.TlmHeader.Msg);
+        CFE_SB_TransmitMsg(&Worker->FileInfoPkt.TlmHeader.Msg, true);
+
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        /* Send command completion event (debug) */
+        CFE_EVS_SendEvent(FM_GET_FILE_INFO_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: file = %s", CmdText,
+                          CmdArgs->Source1);
+    }
+
+} /* End of FM_ChildFileInfoCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Create Directory               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCreateDirCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *CmdText   = "Create Directory";
+    int32       OS_Status = OS_SUCCESS;
+
+    OS_Status = OS_mkdir(CmdArgs->Source1, 0);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_CREATE_DIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_mkdir failed: result = %d, dir = %s", CmdText, (int)OS_Status,
+                          CmdArgs->Source1);
+    }
+    else
+    {
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_CREATE_DIR_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src = %s", CmdText,
+                          CmdArgs->Source1);
+    }
+
+} /* End of FM_ChildCreateDirCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Delete Directory               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDeleteDirCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *CmdText      = "Delete Directory";
+    bool        RemoveTheDir = true;
+    osal_id_t   DirId        = OS_OBJECT_ID_UNDEFINED;
+    os_dirent_t DirEntry;
+    int32       OS_Status = OS_SUCCESS;
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    /* Open the dir so we can see if it is empty */
+    OS_Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(FM_DELETE_OPENDIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+
+        RemoveTheDir = false;
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+    }
+    else
+    {
+        /* Look for a directory entry that is not "." or ".." */
+        while ((OS_DirectoryRead(DirId, &DirEntry) == OS_SUCCESS) && (RemoveTheDir == true))
+        {
+            if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
                 (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
             {
-                CFE_EVS_SendEvent(FM_DELETE_DIR_EMPTY_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "%s error: directory is not empty: dir = %s", CmdText, CmdArgs->Source1);
+                CFE_EVS_SendEvent(FM_DELETE_DIR_EMPTY_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: directory is not empty: dir = %s", CmdText, CmdArgs->Source1);
+
+                RemoveTheDir = false;
+                FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+            }
+        }
+
+        OS_DirectoryClose(DirId);
+    }
+
+    if (RemoveTheDir)
+    {
+        /* Remove the directory */
+        OS_Status = OS_rmdir(CmdArgs->Source1);
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_DELETE_RMDIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_rmdir failed: result = %d, dir = %s", CmdText, (int)OS_Status,
+                              CmdArgs->Source1);
+
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+        }
+        else
+        {
+            /* Send command completion event (info) */
+            CFE_EVS_SendEvent(FM_DELETE_DIR_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src = %s", CmdText,
+                              CmdArgs->Source1);
+
+            FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+        }
+    }
+
+} /* End of FM_ChildDeleteDirCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Get Directory List (to file)   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirListFileCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildWorker_t *Worker     = FM_ChildGetWorker();
+    const char *      CmdText    = "Directory List to File";
+    bool              Result     = false;
+    osal_id_t         FileHandle = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t         DirId      = OS_OBJECT_ID_UNDEFINED;
+    int32             Status     = 0;
+
+    /*
+    ** Command argument useage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_GET_DIR_FILE_CC
+    **  CmdArgs->Source1     = directory name
+    **  CmdArgs->Source2     = directory name plus separator
+    **  CmdArgs->Target      = output filename
+    */
+
+    /* Open directory for reading directory list */
+    Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+
+    if (Status != OS_SUCCESS)
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_GET_DIR_FILE_OSOPENDIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+    }
+    else
+    {
+        /* Create output file, write placeholder for statistics, etc. */
+        Result = FM_ChildDirListFileInit(&FileHandle, CmdArgs->Source1, CmdArgs->Target);
+        if (Result == true)
+        {
+            /* Read directory listing and write contents to output file */
+            FM_ChildDirListFileLoop(DirId, FileHandle, CmdArgs->Source1, CmdArgs->Source2, CmdArgs->Target,
+                                    CmdArgs->GetSizeTimeMode);
+
+            /* Close output file */
+            OS_close(FileHandle);
+
+            if (Worker->Aborted == true)
+            {
+                /* Remove partial output file after abort */
+                OS_remove(CmdArgs->Target);
+            }
+        }
+
+        /* Close directory list access handle */
+        OS_DirectoryClose(DirId);
+    }
+
+} /* End of FM_ChildDirListFileCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Get Directory List (to pkt)    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildWorker_t * Worker                       = FM_ChildGetWorker();
+    const char *       CmdText                      = "Directory List to Packet";
+    char               LogicalName[OS_MAX_PATH_LEN] = "\0";
+    bool               StillProcessing              = true;
+    osal_id_t          DirId                        = OS_OBJECT_ID_UNDEFINED;
+    os_dirent_t        DirEntry;
+    int32              ListIndex   = 0;
+    FM_DirListEntry_t *ListEntry   = NULL;
+    int32              PathLength  = 0;
+    int32              EntryLength = 0;
+    int32              Status;
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    /*
+    ** Command argument useage for this command:
+    **
+    **  CmdArgs->CommandCode   = FM_GET_DIR_PKT_CC
+    **  CmdArgs->Source1       = directory name
+    **  CmdArgs->Source2       = directory name plus separator
+    **  CmdArgs->DirListOffset = index of 1st reported dir entry
+    */
+    PathLength = strlen(CmdArgs->Source2);
+
+    /* Open source directory for reading directory list */
+    Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+
+    if (Status != OS_SUCCESS)
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_GET_DIR_PKT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+    }
+    else
+    {
+        /* Initialize the directory list telemetry packet */
+        CFE_MSG_Init(&Worker->DirListPkt.TlmHeader.Msg, CFE_SB_ValueToMsgId(FM_DIR_LIST_TLM_MID),
+                     sizeof(FM_DirListPkt_t));
+
+        strncpy(Worker->DirListPkt.DirName, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
+        Worker->DirListPkt.DirName[OS_MAX_PATH_LEN - 1] = '\0';
+        Worker->DirListPkt.FirstFile                    = CmdArgs->DirListOffset;
+
+        StillProcessing = true;
+        while (StillProcessing == true)
+        {
+            /* Read next directory entry */
+            Status = OS_DirectoryRead(DirId, &DirEntry);
+
+            if (Status != OS_SUCCESS)
+            {
+                /* Stop reading directory - no more entries */
+                StillProcessing = false;
+            }
+            else if (FM_ChildCheckAbort(Worker, CmdText) == true)
+            {
+                /* Stop reading directory - command aborted */
+                StillProcessing = false;
+            }
+            else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+                     (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+            {
+                /* Do not count the "." and ".." directory entries */
+                Worker->DirListPkt.TotalFiles++;
+
+                /* Start collecting directory entries at command specified offset */
+                /* Stop collecting directory entries when telemetry packet is full */
+                if ((Worker->DirListPkt.TotalFiles > Worker->DirListPkt.FirstFile) &&
+                    (Worker->DirListPkt.PacketFiles < FM_DIR_LIST_PKT_ENTRIES))
+                {
+                    /* Create a shorthand access to the packet list entry */
+                    ListIndex = Worker->DirListPkt.PacketFiles;
+                    ListEntry = &Worker->DirListPkt.FileList[ListIndex];
+
+                    EntryLength = strlen(OS_DIRENTRY_NAME(DirEntry));
+
+                    /* Verify combined directory plus filename length */
+                    if ((PathLength + EntryLength) < OS_MAX_PATH_LEN)
+                    {
+                        /* Add filename to directory listing telemetry packet */
+                        strncpy(ListEntry->EntryName, OS_DIRENTRY_NAME(DirEntry), EntryLength);
+                        ListEntry->EntryName[EntryLength] = '\0';
+
+                        /* Build filename - Directory already has path separator */
+                        strncpy(LogicalName, CmdArgs->Source2, PathLength);
+                        LogicalName[PathLength] = '\0';
+
+                        strncat(LogicalName, OS_DIRENTRY_NAME(DirEntry), EntryLength);
+
+                        FM_ChildSleepStat(LogicalName, ListEntry, CmdArgs->GetSizeTimeMode);
+
+                        /* Add another entry to the telemetry packet */
+                        Worker->DirListPkt.PacketFiles++;
+                    }
+                    else
+                    {
+                        FM_ChildReportStatus(FM_JOB_STATUS_WARNING);
+
+                        /* Send command warning event (info) */
+                        CFE_EVS_SendEvent(FM_GET_DIR_PKT_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                          "%s warning: dir + entry is too long: dir = %s, entry = %s", CmdText,
+                                          CmdArgs->Source2, OS_DIRENTRY_NAME(DirEntry));
+                    }
+                }
+            }
+        }
+
+        OS_DirectoryClose(DirId);
+
+        /* An aborted command sends no partial results */
+        if (Worker->Aborted == false)
+        {
+            /* Timestamp and send directory listing telemetry packet */
+            CFE_SB_TimeStampMsg(&Worker->DirListPkt.TlmHeader.Msg);
+            CFE_SB_TransmitMsg(&Worker->DirListPkt.TlmHeader.Msg, true);
+
+            /* Send command completion event (info) */
+            CFE_EVS_SendEvent(FM_GET_DIR_PKT_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: offset = %d, dir = %s",
+                              CmdText, (int)CmdArgs->DirListOffset, CmdArgs->Source1);
+
+            FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+        }
+    }
+
+} /* End of FM_ChildDirListPktCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Set File Permissions           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void FM_ChildSetPermissionsCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    int32       OS_Status = OS_SUCCESS;
+    const char *CmdText   = "Set Permissions";
+
+    OS_Status = OS_chmod(CmdArgs->Source1, CmdArgs->Mode);
+
+    if (OS_Status == OS_SUCCESS)
+    {
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_SET_PERM_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: file = %s, access = %d", CmdText,
+                          CmdArgs->Source1, (int)CmdArgs->Mode);
+    }
+    else
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send OS error message */
+        CFE_EVS_SendEvent(FM_SET_PERM_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s command: OS_chmod error, RC=0x%08X, file = %s, access = %d", CmdText,
+                          (unsigned int)OS_Status, CmdArgs->Source1, (int)CmdArgs->Mode);
+    }
+
+} /* End of FM_ChildSetPermissionsCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Copy Directory                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCopyDirCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildWorker_t *Worker  = FM_ChildGetWorker();
+    const char *      CmdText = "Copy Directory";
+    osal_id_t         DirId[FM_CHILD_DIR_TREE_DEPTH];
+    uint32            SourceLength[FM_CHILD_DIR_TREE_DEPTH];
+    uint32            TargetLength[FM_CHILD_DIR_TREE_DEPTH];
+    os_dirent_t       DirEntry;
+    char              Source[OS_MAX_PATH_LEN] = "\0";
+    char              Target[OS_MAX_PATH_LEN] = "\0";
+    const char *      Name                    = NULL;
+    bool              CopyResult              = false;
+    uint32            NameLength              = 0;
+    uint32            FilenameState           = FM_NAME_IS_INVALID;
+    uint32            Depth                   = 0;
+    uint32            FileCount               = 0;
+    uint32            DirCount                = 0;
+    uint32            OpenCount               = 0;
+    uint32            SkipCount               = 0;
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    strncpy(Source, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
+    Source[OS_MAX_PATH_LEN - 1] = '\0';
+
+    strncpy(Target, CmdArgs->Target, OS_MAX_PATH_LEN - 1);
+    Target[OS_MAX_PATH_LEN - 1] = '\0';
+
+    CopyResult = FM_ChildCopyDirOpen(CmdText, Source, Target, &DirId[0]);
+
+    if (CopyResult == true)
+    {
+        SourceLength[0] = strlen(Source);
+        TargetLength[0] = strlen(Target);
+        DirCount        = 1;
+        Depth           = 1;
+    }
+
+    /*
+    ** Walk the source tree without recursion - each level keeps its open
+    **  directory and the length of its source and target path names, so
+    **  entry names are written over the names of the previous entries...
+    */
+    while (Depth > 0)
+    {
+        if ((CopyResult == true) && (FM_ChildCheckAbort(Worker, CmdText) == true))
+        {
+            CopyResult = false;
+        }
+
+        if ((CopyResult == false) || (OS_DirectoryRead(DirId[Depth - 1], &DirEntry) != OS_SUCCESS))
+        {
+            /* Done with this directory, continue with its parent */
+            OS_DirectoryClose(DirId[Depth - 1]);
+            Depth--;
+        }
+        else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+                 (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+        {
+            Name       = OS_DIRENTRY_NAME(DirEntry);
+            NameLength = strlen(Name);
+
+            if (((SourceLength[Depth - 1] + NameLength) >= OS_MAX_PATH_LEN) ||
+                ((TargetLength[Depth - 1] + NameLength) >= OS_MAX_PATH_LEN))
+            {
+                SkipCount++;
+            }
+            else
+            {
+                memcpy(&Source[SourceLength[Depth - 1]], Name, NameLength + 1);
+                memcpy(&Target[TargetLength[Depth - 1]], Name, NameLength + 1);
+
+                /* What kind of directory entry is this? */
+                FM_ThrottleStats();
+                FilenameState = FM_GetFilenameState(Source, OS_MAX_PATH_LEN, false);
+
+                switch (FilenameState)
+                {
+                    case FM_NAME_IS_FILE_CLOSED:
+                        FM_ThrottleStats();
+                        FilenameState = FM_GetFilenameState(Target, OS_MAX_PATH_LEN, false);
+
+                        if (FilenameState == FM_NAME_IS_FILE_OPEN)
+                        {
+                            OpenCount++;
+                        }
+                        else if ((FilenameState == FM_NAME_IS_DIRECTORY) || (FilenameState == FM_NAME_IS_INVALID))
+                        {
+                            SkipCount++;
+                        }
+                        else
+                        {
+                            CopyResult = FM_ChildCopyDirFile(Worker, CmdText, Source, Target);
+
+                            if (CopyResult == true)
+                            {
+                                FileCount++;
+                            }
+                        }
+                        break;
+
+                    case FM_NAME_IS_FILE_OPEN:
+                        OpenCount++;
+                        break;
+
+                    case FM_NAME_IS_DIRECTORY:
+                        if (Depth >= FM_CHILD_DIR_TREE_DEPTH)
+                        {
+                            SkipCount++;
+                        }
+                        else
+                        {
+                            CopyResult = FM_ChildCopyDirOpen(CmdText, Source, Target, &DirId[Depth]);
+
+                            if (CopyResult == true)
+                            {
+                                SourceLength[Depth] = strlen(Source);
+                                TargetLength[Depth] = strlen(Target);
+                                DirCount++;
+                                Depth++;
+                            }
+                        }
+                        break;
+
+                    default:
+                        /* Entry removed since the directory was read, or not a file or directory */
+                        SkipCount++;
+                        break;
+                }
+            }
+        }
+    }
+
+    if (CopyResult == true)
+    {
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_COPY_DIR_CMD_EID, CFE_EVS_EventType_DEBUG,
+                          "%s command: copied %d files, %d dirs: src = %s, tgt = %s", CmdText, (int)FileCount,
+                          (int)DirCount, CmdArgs->Source1, CmdArgs->Target);
+
+        if ((OpenCount > 0) || (SkipCount > 0))
+        {
+            CFE_EVS_SendEvent(FM_COPY_DIR_SKIP_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s command: skipped %d open files, %d other entries: src = %s", CmdText,
+                              (int)OpenCount, (int)SkipCount, CmdArgs->Source1);
+            FM_ChildReportStatus(FM_JOB_STATUS_WARNING);
+        }
+    }
+
+} /* End of FM_ChildCopyDirCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Delete Directory Tree          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDeleteTreeCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildWorker_t *Worker  = FM_ChildGetWorker();
+    const char *      CmdText = "Delete Tree";
+    osal_id_t         DirId[FM_CHILD_DIR_TREE_DEPTH];
+    uint32            DirLength[FM_CHILD_DIR_TREE_DEPTH];
+    uint32            PathLength[FM_CHILD_DIR_TREE_DEPTH];
+    os_dirent_t       DirEntry;
+    char              Path[OS_MAX_PATH_LEN] = "\0";
+    const char *      Name                  = NULL;
+    bool              DeleteResult          = false;
+    int32             OS_Status             = OS_SUCCESS;
+    uint32            NameLength            = 0;
+    uint32            FilenameState         = FM_NAME_IS_INVALID;
+    uint32            Depth                 = 0;
+    uint32            FileCount             = 0;
+    uint32            DirCount              = 0;
+    uint32            OpenCount             = 0;
+    uint32            SkipCount             = 0;
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    strncpy(Path, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
+    Path[OS_MAX_PATH_LEN - 1] = '\0';
+
+    OS_Status = OS_DirectoryOpen(&DirId[0], Path);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_DELETE_TREE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: result = %d, dir = %s", CmdText, (int)OS_Status, Path);
+    }
+    else
+    {
+        DirLength[0] = strlen(Path);
+        FM_AppendPathSep(Path, OS_MAX_PATH_LEN);
+        PathLength[0] = strlen(Path);
+
+        DeleteResult = true;
+        Depth        = 1;
+    }
+
+    /*
+    ** Walk the tree without recursion, in the same way as copy directory.  A
+    **  directory is removed after its last entry has been read, so the tree
+    **  is removed from the bottom up.  Entries are not re-read after each
+    **  removal, a directory that still holds a missed entry fails to be
+    **  removed and is counted as skipped.
+    */
+    while (Depth > 0)
+    {
+        if ((DeleteResult == true) && (FM_ChildCheckAbort(Worker, CmdText) == true))
+        {
+            DeleteResult = false;
+        }
+
+        if ((DeleteResult == false) || (OS_DirectoryRead(DirId[Depth - 1], &DirEntry) != OS_SUCCESS))
+        {
+            OS_DirectoryClose(DirId[Depth - 1]);
+            Depth--;
+
+            /* Done with this directory, remove it unless the command was aborted */
+            if (DeleteResult == true)
+            {
+                Path[DirLength[Depth]] = '\0';
+
+                if (OS_rmdir(Path) == OS_SUCCESS)
+                {
+                    DirCount++;
+                }
+                else
+                {
+                    SkipCount++;
+                }
+            }
+        }
+        else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+                 (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+        {
+            Name       = OS_DIRENTRY_NAME(DirEntry);
+            NameLength = strlen(Name);
+
+            if ((PathLength[Depth - 1] + NameLength) >= OS_MAX_PATH_LEN)
+            {
+                SkipCount++;
+            }
+            else
+            {
+                memcpy(&Path[PathLength[Depth - 1]], Name, NameLength + 1);
+
+                /* What kind of directory entry is this? */
+                FM_ThrottleStats();
+                FilenameState = FM_GetFilenameState(Path, OS_MAX_PATH_LEN, false);
+
+                switch (FilenameState)
+                {
+                    case FM_NAME_IS_FILE_CLOSED:
+                        if (OS_remove(Path) == OS_SUCCESS)
+                        {
+                            FileCount++;
+                        }
+                        else
+                        {
+                            SkipCount++;
+                        }
+                        break;
+
+                    case FM_NAME_IS_FILE_OPEN:
+                        OpenCount++;
+                        break;
+
+                    case FM_NAME_IS_DIRECTORY:
+                        if (Depth >= FM_CHILD_DIR_TREE_DEPTH)
+                        {
+                            SkipCount++;
+                        }
+                        else if (OS_DirectoryOpen(&DirId[Depth], Path) == OS_SUCCESS)
+                        {
+                            DirLength[Depth] = strlen(Path);
+                            FM_AppendPathSep(Path, OS_MAX_PATH_LEN);
+                            PathLength[Depth] = strlen(Path);
+                            Depth++;
+                        }
+                        else
+                        {
+                            SkipCount++;
+                        }
+                        break;
+
+                    case FM_NAME_IS_NOT_IN_USE:
+                        /* Entry removed since the directory was read */
+                        break;
+
+                    default:
+                        SkipCount++;
+                        break;
+                }
+            }
+        }
+    }
+
+    if (DeleteResult == true)
+    {
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_DELETE_TREE_CMD_EID, CFE_EVS_EventType_DEBUG,
+                          "%s command: removed %d files, %d dirs: dir = %s", CmdText, (int)FileCount, (int)DirCount,
+                          CmdArgs->Source1);
+
+        if ((OpenCount > 0) || (SkipCount > 0))
+        {
+            CFE_EVS_SendEvent(FM_DELETE_TREE_SKIP_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s command: skipped %d open files, %d other entries: dir = %s", CmdText,
+                              (int)OpenCount, (int)SkipCount, CmdArgs->Source1);
+            FM_ChildReportStatus(FM_JOB_STATUS_WARNING);
+        }
+    }
+
+} /* End of FM_ChildDeleteTreeCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Delete Filtered Files          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDeleteFilterCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildWorker_t *Worker  = FM_ChildGetWorker();
+    const char *      CmdText = "Delete Filtered Files";
+    osal_id_t         DirId   = OS_OBJECT_ID_UNDEFINED;
+    os_dirent_t       DirEntry;
+    OS_time_t         Now;
+    char              Path[OS_MAX_PATH_LEN] = "\0";
+    const char *      Name                  = NULL;
+    bool              DeleteResult          = false;
+    bool              CheckRange            = false;
+    bool              InRange               = false;
+    int32             OS_Status             = OS_SUCCESS;
+    uint32            NowSeconds            = 0;
+    uint32            PathLength            = 0;
+    uint32            NameLength            = 0;
+    uint32            FileSize              = 0;
+    uint32            FileTime              = 0;
+    uint32            FileMode              = 0;
+    uint32            Age                   = 0;
+    uint32            DeleteCount           = 0;
+    uint32            OpenCount             = 0;
+    uint32            SkipCount             = 0;
+
+    /*
+    ** Command argument useage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_DELETE_FILTER_CC
+    **  CmdArgs->Source1     = directory name
+    **  CmdArgs->Target      = filename pattern
+    **  CmdArgs->MinAge      = minimum age (seconds), 0 for none
+    **  CmdArgs->MaxAge      = maximum age (seconds), 0 for none
+    **  CmdArgs->MinSize     = minimum file size (bytes), 0 for none
+    **  CmdArgs->MaxSize     = maximum file size (bytes), 0 for none
+    */
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    /* Every file is aged against the same time */
+    OS_GetLocalTime(&Now);
+    NowSeconds = OS_TimeGetTotalSeconds(Now);
+
+    /* File status is only read for names that match when a range is given */
+    CheckRange = (CmdArgs->MinAge != 0) || (CmdArgs->MaxAge != 0) || (CmdArgs->MinSize != 0) || (CmdArgs->MaxSize != 0);
+
+    strncpy(Path, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
+    Path[OS_MAX_PATH_LEN - 1] = '\0';
+
+    OS_Status = OS_DirectoryOpen(&DirId, Path);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_DELETE_FILTER_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: result = %d, dir = %s", CmdText, (int)OS_Status, Path);
+    }
+    else
+    {
+        FM_AppendPathSep(Path, OS_MAX_PATH_LEN);
+        PathLength   = strlen(Path);
+        DeleteResult = true;
+
+        /* Entries are not re-read after each delete, so the directory is read once */
+        while ((DeleteResult == true) && (OS_DirectoryRead(DirId, &DirEntry) == OS_SUCCESS))
+        {
+            Name = OS_DIRENTRY_NAME(DirEntry);
+
+            if (FM_ChildCheckAbort(Worker, CmdText) == true)
+            {
+                DeleteResult = false;
+            }
+            else if ((strcmp(Name, FM_THIS_DIRECTORY) != 0) && (strcmp(Name, FM_PARENT_DIRECTORY) != 0) &&
+                     (FM_ChildPatternMatch(CmdArgs->Target, Name) == true))
+            {
+                NameLength = strlen(Name);
+
+                if ((PathLength + NameLength) >= OS_MAX_PATH_LEN)
+                {
+                    SkipCount++;
+                }
+                else
+                {
+                    memcpy(&Path[PathLength], Name, NameLength + 1);
+                    InRange = true;
+
+                    if (CheckRange == true)
+                    {
+                        FM_ThrottleStats();
+
+                        if (FM_ChildSizeTimeMode(Path, &FileSize, &FileTime, &FileMode) != OS_SUCCESS)
+                        {
+                            /* Entry removed since the directory was read */
+                            InRange = false;
+                        }
+                        else
+                        {
+                            /* Files modified after the command started have an age of zero */
+                            Age = (NowSeconds > FileTime) ? (NowSeconds - FileTime) : 0;
+
+                            if ((Age < CmdArgs->MinAge) || ((CmdArgs->MaxAge != 0) && (Age > CmdArgs->MaxAge)) ||
+                                (FileSize < CmdArgs->MinSize) ||
+                                ((CmdArgs->MaxSize != 0) && (FileSize > CmdArgs->MaxSize)))
+                            {
+                                InRange = false;
+                            }
+                        }
+                    }
+
+                    /* The open file search is only made for selected files */
+                    if (InRange == true)
+                    {
+                        FM_ThrottleStats();
+
+                        switch (FM_GetFilenameState(Path, OS_MAX_PATH_LEN, false))
+                        {
+                            case FM_NAME_IS_FILE_CLOSED:
+                                if (OS_remove(Path) == OS_SUCCESS)
+                                {
+                                    DeleteCount++;
+                                }
+                                else
+                                {
+                                    SkipCount++;
+                                }
+                                break;
+
+                            case FM_NAME_IS_FILE_OPEN:
+                                OpenCount++;
+                                break;
+
+                            case FM_NAME_IS_NOT_IN_USE:
+                                /* Entry removed since the directory was read */
+                                break;
+
+                            default:
+                                SkipCount++;
+                                break;
+                        }
+                    }
+                }
+            }
+        }
+
+        OS_DirectoryClose(DirId);
+    }
+
+    if (DeleteResult == true)
+    {
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_DELETE_FILTER_CMD_EID, CFE_EVS_EventType_DEBUG,
+                          "%s command: deleted %d files: pattern = %s, dir = %s", CmdText, (int)DeleteCount,
+                          CmdArgs->Target, CmdArgs->Source1);
+
+        if ((OpenCount > 0) || (SkipCount > 0))
+        {
+            CFE_EVS_SendEvent(FM_DELETE_FILTER_SKIP_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s command: skipped %d open files, %d other entries: dir = %s", CmdText,
+                              (int)OpenCount, (int)SkipCount, CmdArgs->Source1);
+            FM_ChildReportStatus(FM_JOB_STATUS_WARNING);
+        }
+    }
+
+} /* End of FM_ChildDeleteFilterCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Concatenate File List          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildConcatListCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildWorker_t *    Worker                = FM_ChildGetWorker();
+    FM_ChildCheckpoint_t *Checkpoint            = &Worker->Checkpoint;
+    const char *          CmdText               = "Concat File List";
+    FM_ChildListFile_t    ListFile;
+    char                  Name[OS_MAX_PATH_LEN] = "\0";
+    bool                  ConcatResult          = false;
+    bool                  OpenedTgtFile         = false;
+    bool                  OpenedList            = false;
+    bool                  Reading               = false;
+    int32                 OS_Status             = OS_SUCCESS;
+    uint32                EntryCount            = 0;
+    uint32                Entry                 = 0;
+
+    /*
+    ** Command argument useage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_CONCAT_LIST_CC
+    **  CmdArgs->Source1     = source list filename
+    **  CmdArgs->Source2     = listed source being appended (resume only)
+    **  CmdArgs->Target      = target filename
+    **  CmdArgs->FileInfoCRC = CRC method for the concatenated data
+    */
+
+    /* The checkpoint segment is the number of the list entry being appended */
+    FM_CheckpointStart(Worker, CmdArgs);
+
+    /* Every source is checked before the target file is created */
+    if (FM_ChildConcatListCheck(Worker, CmdText, &EntryCount) == true)
+    {
+        FM_ChildCopyResume(Worker, CmdText);
+
+        OS_Status = FM_ChildListOpen(&ListFile, Checkpoint->Source1);
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_CONCAT_LIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: list OS_OpenCreate failed: result = %d, list = %s", CmdText, (int)OS_Status,
+                              Checkpoint->Source1);
+        }
+        else
+        {
+            OpenedList = true;
+            Reading    = true;
+        }
+
+        /* Each source is appended once, the target file is never copied again */
+        while (Reading)
+        {
+            OS_Status = FM_ChildListNext(&ListFile, Name);
+
+            if (OS_Status == 0)
+            {
+                Reading      = false;
+                ConcatResult = (Entry == EntryCount);
+
+                if (ConcatResult == false)
+                {
+                    FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+                    /* Send command failure event (error) */
+                    CFE_EVS_SendEvent(FM_CONCAT_LIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "%s error: list modified: files = %d, expected = %d, list = %s", CmdText,
+                                      (int)Entry, (int)EntryCount, Checkpoint->Source1);
+                }
+            }
+            else if (OS_Status < 0)
+            {
+                Reading = false;
+                FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_CONCAT_LIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: list read failed: result = %d, line = %d, list = %s", CmdText,
+                                  (int)OS_Status, (int)ListFile.Line, Checkpoint->Source1);
+            }
+            else if (FM_ChildCheckAbort(Worker, CmdText) == true)
+            {
+                Reading = false;
+            }
+            else
+            {
+                Entry++;
+
+                /* Entries before a resumed entry are already in the target file */
+                if (Entry >= Checkpoint->Segment)
+                {
+                    if (Entry > Checkpoint->Segment)
+                    {
+                        Checkpoint->Segment      = Entry;
+                        Checkpoint->SourceOffset = 0;
+
+                        strncpy(Checkpoint->Source2, Name, OS_MAX_PATH_LEN - 1);
+                        Checkpoint->Source2[OS_MAX_PATH_LEN - 1] = '\0';
+                    }
+
+                    Reading = FM_ChildCopySegment(Worker, CmdText, &FM_ChildConcatListEvents, &OpenedTgtFile);
+                }
+            }
+        }
+
+        if (OpenedList == true)
+        {
+            OS_close(ListFile.FileHandle);
+        }
+    }
+
+    FM_CheckpointClear(Worker);
+
+    if ((OpenedTgtFile == true) && (ConcatResult == false))
+    {
+        /* Remove partial target file after concat error or abort */
+        OS_remove(CmdArgs->Target);
+    }
+
+    if (ConcatResult == true)
+    {
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        /* CRC of the concatenated data (if requested) is reported with the job completion */
+        Worker->JobCompletePkt.CRCType = (uint8)CmdArgs->FileInfoCRC;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_CONCAT_LIST_CMD_EID, CFE_EVS_EventType_DEBUG,
+                          "%s command: appended %d files: list = %s, tgt = %s", CmdText, (int)EntryCount,
+                          CmdArgs->Source1, CmdArgs->Target);
+    }
+
+} /* End of FM_ChildConcatListCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Split File                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildSplitCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildWorker_t *      Worker                       = FM_ChildGetWorker();
+    const char *            CmdText                      = "Split File";
+    FM_SplitManifestStats_t Stats;
+    FM_SplitManifestEntry_t Entry;
+    CFE_FS_Header_t         FileHeader;
+    char                    SegmentName[OS_MAX_PATH_LEN] = "\0";
+    bool                    SplitResult                  = false;
+    bool                    OpenedSource                 = false;
+    bool                    OpenedManifest               = false;
+    int32                   OS_Status                    = OS_SUCCESS;
+    int32                   BytesWritten                 = 0;
+    uint32                  FileTime                     = 0;
+    uint32                  FileMode                     = 0;
+    uint32                  Segment                      = 0;
+    osal_id_t               FileHandleSrc                = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t               FileHandleMan                = OS_OBJECT_ID_UNDEFINED;
+
+    /*
+    ** Command argument useage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_SPLIT_CC
+    **  CmdArgs->Source1     = source filename
+    **  CmdArgs->Target      = manifest filename, segment filenames add ".NNN"
+    **  CmdArgs->SegmentSize = size of each segment file
+    **  CmdArgs->FileInfoCRC = CRC method for each segment
+    */
+
+    memset(&Stats, 0, sizeof(Stats));
+    memset(&Entry, 0, sizeof(Entry));
+
+    /* Split is never resumed, the checkpoint holds the command args for the segment writes */
+    FM_CheckpointStart(Worker, CmdArgs);
+
+    strncpy(Stats.Source, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
+    Stats.Source[OS_MAX_PATH_LEN - 1] = '\0';
+    Stats.SegmentSize                 = CmdArgs->SegmentSize;
+    Stats.CRCType                     = CmdArgs->FileInfoCRC;
+
+    /* Data appended to the source file after this is not split */
+    OS_Status = FM_ChildSizeTimeMode(CmdArgs->Source1, &Stats.SourceSize, &FileTime, &FileMode);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_SPLIT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_stat failed: result = %d, src = %s", CmdText, (int)OS_Status,
+                          CmdArgs->Source1);
+    }
+    else
+    {
+        Worker->JobProgressPkt.BytesTotal += Stats.SourceSize;
+
+        /* Every segment filename is checked before any segment file is written */
+        SplitResult = FM_ChildSplitCheck(CmdText, CmdArgs->Target, Stats.SourceSize, Stats.SegmentSize,
+                                         &Stats.SegmentCount);
+    }
+
+    if (SplitResult == true)
+    {
+        OS_Status = OS_OpenCreate(&FileHandleSrc, CmdArgs->Source1, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            SplitResult = false;
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_SPLIT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_OpenCreate failed: result = %d, src = %s", CmdText, (int)OS_Status,
+                              CmdArgs->Source1);
+        }
+        else
+        {
+            OpenedSource = true;
+        }
+    }
+
+    /* The manifest describes every segment before the first is written */
+    if (SplitResult == true)
+    {
+        memset(&FileHeader, 0, sizeof(FileHeader));
+        FileHeader.SubType = FM_SPLIT_MANIFEST_SUBTYPE;
+        strncpy(FileHeader.Description, CmdText, sizeof(FileHeader.Description) - 1);
+        FileHeader.Description[sizeof(FileHeader.Description) - 1] = '\0';
+
+        OS_Status = OS_OpenCreate(&FileHandleMan, CmdArgs->Target, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                                  OS_WRITE_ONLY);
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            SplitResult = false;
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_SPLIT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: manifest OS_OpenCreate failed: result = %d, tgt = %s", CmdText,
+                              (int)OS_Status, CmdArgs->Target);
+        }
+        else
+        {
+            OpenedManifest = true;
+            BytesWritten   = CFE_FS_WriteHeader(FileHandleMan, &FileHeader);
+
+            if (BytesWritten == sizeof(CFE_FS_Header_t))
+            {
+                BytesWritten = OS_write(FileHandleMan, &Stats, sizeof(Stats));
+            }
+            else
+            {
+                BytesWritten = -1;
+            }
+
+            if (BytesWritten != sizeof(Stats))
+            {
+                SplitResult = false;
+                FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_SPLIT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: manifest write failed: result = %d, tgt = %s", CmdText,
+                                  (int)BytesWritten, CmdArgs->Target);
+            }
+        }
+    }
+
+    /* The source file is read once, each block is written to exactly one segment file */
+    while ((SplitResult == true) && (Segment < Stats.SegmentCount))
+    {
+        Entry.Offset = Segment * CmdArgs->SegmentSize;
+        Entry.Size   = Stats.SourceSize - Entry.Offset;
+
+        if (Entry.Size > CmdArgs->SegmentSize)
+        {
+            Entry.Size = CmdArgs->SegmentSize;
+        }
+
+        FM_ChildSplitName(SegmentName, CmdArgs->Target, Segment);
+
+        if (FM_ChildCheckAbort(Worker, CmdText) == true)
+        {
+            SplitResult = false;
+        }
+        else if (FM_ChildSplitSegment(Worker, CmdText, FileHandleSrc, SegmentName, &Entry) == false)
+        {
+            SplitResult = false;
+        }
+        else
+        {
+            Segment++;
+
+            BytesWritten = OS_write(FileHandleMan, &Entry, sizeof(Entry));
+
+            if (BytesWritten != sizeof(Entry))
+            {
+                SplitResult = false;
+                FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_SPLIT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: manifest write failed: result = %d, tgt = %s", CmdText,
+                                  (int)BytesWritten, CmdArgs->Target);
+            }
+        }
+    }
+
+    if (OpenedManifest == true)
+    {
+        OS_close(FileHandleMan);
+    }
+
+    if (OpenedSource == true)
+    {
+        OS_close(FileHandleSrc);
+    }
+
+    FM_CheckpointClear(Worker);
+
+    if (SplitResult == false)
+    {
+        /* Remove complete segment files after a split error or abort, the partial segment is already gone */
+        while (Segment > 0)
+        {
+            Segment--;
+            FM_ChildSplitName(SegmentName, CmdArgs->Target, Segment);
+            OS_remove(SegmentName);
+        }
+
+        if (OpenedManifest == true)
+        {
+            OS_remove(CmdArgs->Target);
+        }
+    }
+    else
+    {
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        /* Send command completion event (debug) */
+        CFE_EVS_SendEvent(FM_SPLIT_CMD_EID, CFE_EVS_EventType_DEBUG,
+                          "%s command: wrote %d segments: src = %s, tgt = %s", CmdText, (int)Stats.SegmentCount,
+                          CmdArgs->Source1, CmdArgs->Target);
+    }
+
+} /* End of FM_ChildSplitCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Preallocate File               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildPreallocateCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildWorker_t *Worker        = FM_ChildGetWorker();
+    const char *      CmdText       = "Preallocate File";
+    const char *      MethodText    = "none";
+    bool              CommandResult = false;
+    bool              Allocated     = false;
+    int32             OS_Status     = OS_SUCCESS;
+    uint32            FileSize      = 0;
+    uint32            FileTime      = 0;
+    uint32            FileMode      = 0;
+    osal_id_t         FileHandle    = OS_OBJECT_ID_UNDEFINED;
+
+    /*
+    ** Command argument useage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_PREALLOCATE_CC
+    **  CmdArgs->Source1     = filename, created if it does not exist
+    **  CmdArgs->FileSize    = file size to reserve
+    */
+
+    /* Preallocate is never resumed, the checkpoint follows the zero blocks written */
+    FM_CheckpointStart(Worker, CmdArgs);
+
+    /* A file that does not exist yet reports a size of zero */
+    FM_ChildSizeTimeMode(CmdArgs->Source1, &FileSize, &FileTime, &FileMode);
+
+    if (FileSize >= CmdArgs->FileSize)
+    {
+        /* The file is never shortened */
+        CommandResult = true;
+    }
+    else
+    {
+        Worker->JobProgressPkt.BytesTotal += CmdArgs->FileSize - FileSize;
+
+        OS_Status = OS_OpenCreate(&FileHandle, CmdArgs->Source1, OS_FILE_FLAG_CREATE, OS_WRITE_ONLY);
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_PREALLOCATE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_OpenCreate failed: result = %d, file = %s", CmdText, (int)OS_Status,
+                              CmdArgs->Source1);
+        }
+        else
+        {
+#ifdef FM_INCLUDE_FILE_ALLOCATE
+            Allocated = FM_ChildFileAllocate(Worker, CmdText, CmdArgs->Source1, FileSize, CmdArgs->FileSize,
+                                             &CommandResult);
+            MethodText = "fallocate";
+#endif
+            if (Allocated == false)
+            {
+                CommandResult =
+                    FM_ChildPreallocateWrite(Worker, CmdText, FileHandle, CmdArgs->Source1, FileSize, CmdArgs->FileSize);
+                MethodText = "write";
+            }
+
+            OS_close(FileHandle);
+        }
+    }
+
+    FM_CheckpointClear(Worker);
+
+    if (CommandResult == true)
+    {
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        /* Send command completion event (debug) */
+        CFE_EVS_SendEvent(FM_PREALLOCATE_CMD_EID, CFE_EVS_EventType_DEBUG,
+                          "%s command: size = %lu, was = %lu, method = %s, file = %s", CmdText,
+                          (unsigned long)CmdArgs->FileSize, (unsigned long)FileSize, MethodText, CmdArgs->Source1);
+    }
+
+} /* End of FM_ChildPreallocateCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Truncate File                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildTruncateCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *CmdText   = "Truncate File";
+    int32       OS_Status = OS_SUCCESS;
+    uint32      FileSize  = 0;
+    uint32      FileTime  = 0;
+    uint32      FileMode  = 0;
+
+    /*
+    ** Command argument useage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_TRUNCATE_CC
+    **  CmdArgs->Source1     = filename
+    **  CmdArgs->FileSize    = file size after truncation
+    */
+
+    OS_Status = FM_ChildSizeTimeMode(CmdArgs->Source1, &FileSize, &FileTime, &FileMode);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_TRUNCATE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_stat failed: result = %d, file = %s", CmdText, (int)OS_Status,
+                          CmdArgs->Source1);
+    }
+    else if (CmdArgs->FileSize > FileSize)
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_TRUNCATE_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: size is greater than file size: size = %lu, file size = %lu, file = %s",
+                          CmdText, (unsigned long)CmdArgs->FileSize, (unsigned long)FileSize, CmdArgs->Source1);
+    }
+    else
+    {
+        OS_Status = FM_ChildTruncateFile(CmdArgs->Source1, CmdArgs->FileSize);
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_TRUNCATE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: truncate failed: result = %d, file = %s", CmdText, (int)OS_Status,
+                              CmdArgs->Source1);
+        }
+        else
+        {
+            FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+            /* Send command completion event (debug) */
+            CFE_EVS_SendEvent(FM_TRUNCATE_CMD_EID, CFE_EVS_EventType_DEBUG,
+                              "%s command: size = %lu, was = %lu, file = %s", CmdText,
+                              (unsigned long)CmdArgs->FileSize, (unsigned long)FileSize, CmdArgs->Source1);
+        }
+    }
+
+} /* End of FM_ChildTruncateCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- create dir list output file   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename)
+{
+    FM_ChildWorker_t *Worker        = FM_ChildGetWorker();
+    const char *      CmdText       = "Directory List to File";
+    bool              CommandResult = true;
+    CFE_FS_Header_t   FileHeader;
+    osal_id_t         FileHandle   = OS_OBJECT_ID_UNDEFINED;
+    int32             BytesWritten = 0;
+    int32             Status       = 0;
+
+    /* Initialize the standard cFE File Header for the Directory Listing File */
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.SubType = FM_DIR_LIST_FILE_SUBTYPE;
+    strncpy(FileHeader.Description, CmdText, sizeof(FileHeader.Description) - 1);
+    FileHeader.Description[sizeof(FileHeader.Description) - 1] = '\0';
+
+    /* Create directory listing output file */
+    Status = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+
+    if (Status == OS_SUCCESS)
+    {
+        /* Write the standard CFE file header */
+        BytesWritten = CFE_FS_WriteHeader(FileHandle, &FileHeader);
+        if (BytesWritten == sizeof(CFE_FS_Header_t))
+        {
+            /* Initialize directory statistics structure */
+            memset(&Worker->DirListFileStats, 0, sizeof(Worker->DirListFileStats));
+            strncpy(Worker->DirListFileStats.DirName, Directory, OS_MAX_PATH_LEN - 1);
+            Worker->DirListFileStats.DirName[OS_MAX_PATH_LEN - 1] = '\0';
+
+            /* Write blank FM directory statistics structure as a place holder */
+            BytesWritten = OS_write(FileHandle, &Worker->DirListFileStats, sizeof(FM_DirListFileStats_t));
+            if (BytesWritten == sizeof(FM_DirListFileStats_t))
+            {
+                /* Return output file handle */
+                *FileHandlePtr = FileHandle;
+            }
+            else
+            {
+                CommandResult = false;
+                FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRBLANK_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: OS_write blank stats failed: result = %d, expected = %u", CmdText,
+                                  (int)BytesWritten, (unsigned int)sizeof(FM_DirListFileStats_t));
+            }
+        }
+        else
+        {
+            CommandResult = false;
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRHDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: CFE_FS_WriteHeader failed: result = %d, expected = %u", CmdText,
+                              (int)BytesWritten, (unsigned int)sizeof(CFE_FS_Header_t));
+        }
+
+        /* Close output file after write error */
+        if (CommandResult == false)
+        {
+            OS_close(FileHandle);
+        }
+    }
+    else
+    {
+        CommandResult = false;
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_GET_DIR_FILE_OSCREAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_OpenCreate failed: result = %d, file = %s", CmdText, (int)Status, Filename);
+    }
+
+    return (CommandResult);
+
+} /* End FM_ChildDirListFileInit */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- write to dir list output file */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirListFileLoop(osal_id_t DirId, osal_id_t FileHandle, const char *Directory, const char *DirWithSep,
+                             const char *Filename, uint8 getSizeTimeMode)
+{
+    FM_ChildWorker_t *Worker                    = FM_ChildGetWorker();
+    const char *      CmdText                   = "Directory List to File";
+    int32             WriteLength               = sizeof(FM_DirListEntry_t);
+    bool              ReadingDirectory          = true;
+    bool              CommandResult             = true;
+    uint32            DirEntries                = 0;
+    uint32            FileEntries               = 0;
+    int32             EntryLength               = 0;
+    int32             PathLength                = 0;
+    int32             BytesWritten              = 0;
+    int32             Status                    = 0;
+    char              TempName[OS_MAX_PATH_LEN] = "\0";
+    os_dirent_t       DirEntry;
+    FM_DirListEntry_t DirListData;
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    PathLength = strlen(DirWithSep);
+
+    /* Until end of directory entries or output file write error */
+    while ((CommandResult == true) && (ReadingDirectory == true))
+    {
+        Status = OS_DirectoryRead(DirId, &DirEntry);
+
+        /* Normal loop end - no more directory entries */
+        if (Status != OS_SUCCESS)
+        {
+            ReadingDirectory = false;
+        }
+        else if (FM_ChildCheckAbort(Worker, CmdText) == true)
+        {
+            /* Command aborted - caller removes the partial output file */
+            CommandResult = false;
+        }
+        else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+                 (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+        {
+            /* Do not count the "." and ".." files */
+            DirEntries++;
+
+            /* Count all files - write limited number */
+            if (FileEntries < FM_DIR_LIST_FILE_ENTRIES)
+            {
+                EntryLength = strlen(OS_DIRENTRY_NAME(DirEntry));
+
+                /*
+                 * DirListData.EntryName and TempName are both OS_MAX_PATH_LEN, DirEntry name is OS_MAX_FILE_NAME,
+                 * so limiting test is PathLength and EntryLength together
+                 */
+                if ((PathLength + EntryLength) < OS_MAX_PATH_LEN)
+                {
+                    /* Build qualified directory entry name */
+                    strncpy(TempName, DirWithSep, PathLength);
+                    TempName[PathLength] = '\0';
+
+                    strncat(TempName, OS_DIRENTRY_NAME(DirEntry), (OS_MAX_PATH_LEN - PathLength));
+
+                    /* Populate directory list file entry */
+                    strncpy(DirListData.EntryName, OS_DIRENTRY_NAME(DirEntry), EntryLength);
+                    DirListData.EntryName[EntryLength] = '\0';
+
+                    FM_ChildSleepStat(TempName, (FM_DirListEntry_t *)&DirListData, getSizeTimeMode);
+
+                    /* Write directory list file entry to output file */
+                    BytesWritten = OS_write(FileHandle, &DirListData, WriteLength);
+
+                    if (BytesWritten == WriteLength)
+                    {
+                        FileEntries++;
+                    }
+                    else
+                    {
+                        CommandResult = false;
+                        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+                        /* Send command failure event (error) */
+                        CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRENTRY_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "%s error: OS_write entry failed: result = %d, expected = %d", CmdText,
+                                          (int)BytesWritten, (int)WriteLength);
+                    }
+                }
+                else
+                {
+                    FM_ChildReportStatus(FM_JOB_STATUS_WARNING);
+
+                    /* Send command failure event (error) */
+                    CFE_EVS_SendEvent(FM_GET_DIR_FILE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                      "%s error: combined directory and entry name too long: dir = %s, entry = %s",
+                                      CmdText, Directory, OS_DIRENTRY_NAME(DirEntry));
+                }
+            }
+        }
+    }
+
+    /* Update directory statistics in output file */
+    if ((CommandResult == true) && (DirEntries != 0))
+    {
+        /* Update entries found in directory vs entries written to file */
+        Worker->DirListFileStats.DirEntries  = DirEntries;
+        Worker->DirListFileStats.FileEntries = FileEntries;
+
+        /* Back up to the start of the statisitics data */
+        OS_lseek(FileHandle, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
+
+        /* Write an updated version of the statistics data */
+        WriteLength  = sizeof(FM_DirListFileStats_t);
+        BytesWritten = OS_write(FileHandle, &Worker->DirListFileStats, WriteLength);
+
+        if (BytesWritten != WriteLength)
+        {
+            CommandResult = false;
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_GET_DIR_FILE_UPSTATS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_write update stats failed: result = %d, expected = %d", CmdText,
+                              (int)BytesWritten, (int)WriteLength);
+        }
+    }
+
+    /* Send command completion event (info) */
+    if (CommandResult == true)
+    {
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildCmdCounter);
+
+        CFE_EVS_SendEvent(FM_GET_DIR_FILE_CMD_EID, CFE_EVS_EventType_DEBUG,
+                          "%s command: wrote %d of %d names: dir = %s, filename = %s", CmdText, (int)FileEntries,
+                          (int)DirEntries, Directory, Filename);
+    }
+
+} /* End of FM_ChildDirListFileLoop */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- open one copy dir level       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildCopyDirOpen(const char *CmdText, char *Source, char *Target, osal_id_t *DirIdPtr)
+{
+    bool  OpenResult = false;
+    int32 OS_Status  = OS_SUCCESS;
+
+    /* An existing target directory is only reached with the overwrite argument set */
+    FM_ThrottleStats();
+
+    if (FM_GetFilenameState(Target, OS_MAX_PATH_LEN, false) != FM_NAME_IS_DIRECTORY)
+    {
+        OS_Status = OS_mkdir(Target, 0);
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_COPY_DIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_mkdir failed: result = %d, dir = %s", CmdText, (int)OS_Status, Target);
+        }
+    }
+
+    if (OS_Status == OS_SUCCESS)
+    {
+        OS_Status = OS_DirectoryOpen(DirIdPtr, Source);
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_COPY_DIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_DirectoryOpen failed: result = %d, dir = %s", CmdText, (int)OS_Status,
+                              Source);
+        }
+        else
+        {
+            /* Entry names are appended to both directory names */
+            FM_AppendPathSep(Source, OS_MAX_PATH_LEN);
+            FM_AppendPathSep(Target, OS_MAX_PATH_LEN);
+
+            OpenResult = true;
+        }
+    }
+
+    return (OpenResult);
+
+} /* End of FM_ChildCopyDirOpen */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- copy one copy dir file        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildCopyDirFile(FM_ChildWorker_t *Worker, const char *CmdText, const char *Source, const char *Target)
+{
+    FM_ChildQueueEntry_t FileArgs;
+    bool                 CopyResult    = false;
+    bool                 OpenedTgtFile = false;
+
+    /* Each file is checkpointed as a Copy File of the same job, so a reset resumes only that file */
+    memset(&FileArgs, 0, sizeof(FileArgs));
+
+    FileArgs.CommandCode = FM_COPY_CC;
+    FileArgs.JobID       = Worker->CmdArgs.JobID;
+    FileArgs.FileInfoCRC = FM_IGNORE_CRC;
+
+    strncpy(FileArgs.Source1, Source, OS_MAX_PATH_LEN - 1);
+    FileArgs.Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+    strncpy(FileArgs.Target, Target, OS_MAX_PATH_LEN - 1);
+    FileArgs.Target[OS_MAX_PATH_LEN - 1] = '\0';
+
+    FM_CheckpointStart(Worker, &FileArgs);
+
+    CopyResult = FM_ChildCopySegment(Worker, CmdText, &FM_ChildCopyDirEvents, &OpenedTgtFile);
+
+    FM_CheckpointClear(Worker);
+
+    if ((OpenedTgtFile == true) && (CopyResult == false))
+    {
+        /* Remove partial target file after copy error or abort */
+        OS_remove(Target);
+    }
+
+    return (CopyResult);
+
+} /* End of FM_ChildCopyDirFile */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- verify checkpoint to resume   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCopyResume(FM_ChildWorker_t *Worker, const char *CmdText)
+{
+    FM_ChildCheckpoint_t *Checkpoint = &Worker->Checkpoint;
+    const char *          Source     = Checkpoint->Source1;
+    bool                  Resumed    = false;
+    int32                 BytesRead  = 0;
+    uint32                BytesLeft  = 0;
+    uint32                CurrentCRC = 0;
+    uint32                FileSize   = 0;
+    uint32                FileTime   = 0;
+    uint32                FileMode   = 0;
+    osal_id_t             FileHandle = OS_OBJECT_ID_UNDEFINED;
+
+    if (Checkpoint->Segment != 0)
+    {
+        Source = Checkpoint->Source2;
+    }
+
+    /* Nothing to verify unless the target file has data from before the reset */
+    if (Checkpoint->TargetOffset != 0)
+    {
+        /* The source file must not have been modified since the checkpoint */
+        if ((FM_ChildSizeTimeMode(Source, &FileSize, &FileTime, &FileMode) != OS_SUCCESS) ||
+            (FileSize != Checkpoint->SourceSize) || (FileTime != Checkpoint->SourceTime) ||
+            (Checkpoint->SourceOffset > FileSize))
+        {
+            Resumed = false;
+        }
+        else if (Checkpoint->TargetCRC == FM_CHECKPOINT_CRC_UNKNOWN)
+        {
+            /* Data copied by the kernel has no CRC, the target file must still hold all of it */
+            Resumed = (FM_ChildSizeTimeMode(Checkpoint->Target, &FileSize, &FileTime, &FileMode) == OS_SUCCESS) &&
+                      (FileSize >= Checkpoint->TargetOffset);
+
+            /* Kept target data counts as done, without a burst of throughput */
+            Worker->JobCompletePkt.BytesProcessed = Checkpoint->TargetOffset;
+            Worker->ProgressBytes                 = Checkpoint->TargetOffset;
+        }
+        else if (OS_OpenCreate(&FileHandle, Checkpoint->Target, OS_FILE_FLAG_NONE, OS_READ_ONLY) == OS_SUCCESS)
+        {
+            /* The target file must hold the data described by the checkpoint CRC */
+            BytesLeft = Checkpoint->TargetOffset;
+            BytesRead = 1;
+
+            FM_ThrottleStart(Worker);
+
+            while ((BytesLeft > 0) && (BytesRead > 0))
+            {
+                if (BytesLeft < Worker->BlockSize)
+                {
+                    BytesRead = OS_read(FileHandle, Worker->ChildBuffer, BytesLeft);
+                }
+                else
+                {
+                    BytesRead = OS_read(FileHandle, Worker->ChildBuffer, Worker->BlockSize);
+                }
+
+                if (BytesRead > 0)
+                {
+                    CurrentCRC = FM_CrcCalculate(Worker->ChildBuffer, BytesRead, CurrentCRC, CFE_MISSION_ES_CRC_16);
+                    BytesLeft -= BytesRead;
+
+                    /* The data CRC covers the target file bytes kept from before the reset */
+                    if (Checkpoint->CRCType != FM_IGNORE_CRC)
+                    {
+                        Worker->JobCompletePkt.CRC = FM_CrcCalculate(Worker->ChildBuffer, BytesRead,
+                                                                     Worker->JobCompletePkt.CRC, Checkpoint->CRCType);
+                    }
+
+                    FM_ChildJobBytes(Worker, BytesRead);
+
+                    /* Avoid CPU hogging */
+                    FM_ThrottleBytes(Worker, BytesRead);
+                }
+            }
+
+            OS_close(FileHandle);
+
+            Resumed = (BytesLeft == 0) && (CurrentCRC == Checkpoint->TargetCRC);
+        }
+
+        if (Resumed == true)
+        {
+            CFE_EVS_SendEvent(FM_CHILD_RESUME_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s resumed: job = %lu, offset = %lu, tgt = %s", CmdText,
+                              (unsigned long)Checkpoint->JobID, (unsigned long)Checkpoint->TargetOffset,
+                              Checkpoint->Target);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(FM_CHILD_RESUME_RESTART_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s resume restarted: checkpoint mismatch: job = %lu, offset = %lu, tgt = %s", CmdText,
+                              (unsigned long)Checkpoint->JobID, (unsigned long)Checkpoint->TargetOffset,
+                              Checkpoint->Target);
+
+            /* Start over with the first source file, target data read so far is not progress */
+            Worker->JobCompletePkt.BytesProcessed = 0;
+            Worker->JobCompletePkt.CRC            = 0;
+            Worker->ProgressBytes                 = 0;
+
+            Checkpoint->Segment      = 0;
+            Checkpoint->SourceOffset = 0;
+            Checkpoint->TargetOffset = 0;
+            Checkpoint->TargetCRC    = 0;
+        }
+    }
+
+} /* End of FM_ChildCopyResume */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- copy one source to target     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildCopySegment(FM_ChildWorker_t *Worker, const char *CmdText, const FM_ChildCopyEvents_t *Events,
+                         bool *OpenedTgtFile)
+{
+    FM_ChildCheckpoint_t *Checkpoint     = &Worker->Checkpoint;
+    const char *          Source         = Checkpoint->Source1;
+    bool                  CopyResult     = false;
+    bool                  CopyInProgress = false;
+    bool                  OpenedSource   = false;
+    bool                  OpenedTarget   = false;
+    int32                 OS_Status      = OS_SUCCESS;
+    int32                 BytesRead      = 0;
+    uint32                FileMode       = 0;
+    uint8                 PipelineMode   = FM_PIPELINE_MODE_WRITE;
+    char *                Buffer         = NULL;
+    osal_id_t             FileHandleSrc  = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t             FileHandleTgt  = OS_OBJECT_ID_UNDEFINED;
+
+    if (Checkpoint->Segment != 0)
+    {
+        Source = Checkpoint->Source2;
+    }
+
+    /* Holes are only left in a new target file, appended or resumed data is written */
+    if ((Checkpoint->Sparse == true) && (Checkpoint->TargetOffset == 0))
+    {
+        PipelineMode = FM_PIPELINE_MODE_SPARSE;
+    }
+
+    /* Open source file */
+    OS_Status = OS_OpenCreate(&FileHandleSrc, Source, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(Events->OpenSrcEID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_OpenCreate failed: result = %d, src = %s", CmdText, (int)OS_Status, Source);
+    }
+    else
+    {
+        OpenedSource = true;
+    }
+
+    /* Open target file, creating it unless there is data to keep */
+    if (OpenedSource)
+    {
+        if (Checkpoint->TargetOffset == 0)
+        {
+            OS_Status = OS_OpenCreate(&FileHandleTgt, Checkpoint->Target, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                                      OS_WRITE_ONLY);
+        }
+        else
+        {
+            OS_Status = OS_OpenCreate(&FileHandleTgt, Checkpoint->Target, OS_FILE_FLAG_NONE, OS_READ_WRITE);
+        }
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(Events->OpenTgtEID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_OpenCreate failed: result = %d, tgt = %s", CmdText, (int)OS_Status,
+                              Checkpoint->Target);
+        }
+        else
+        {
+            OpenedTarget   = true;
+            *OpenedTgtFile = true;
+            CopyInProgress = true;
+        }
+    }
+
+    /* Continue from the checkpoint offsets (zero unless resuming or appending) */
+    if (OpenedTarget)
+    {
+        if ((OS_lseek(FileHandleSrc, Checkpoint->SourceOffset, OS_SEEK_SET) != (int32)Checkpoint->SourceOffset) ||
+            (OS_lseek(FileHandleTgt, Checkpoint->TargetOffset, OS_SEEK_SET) != (int32)Checkpoint->TargetOffset))
+        {
+            CopyInProgress = false;
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(Events->ReadEID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_lseek failed: offset = %lu, src = %s", CmdText,
+                              (unsigned long)Checkpoint->SourceOffset, Source);
+        }
+        else if (FM_CheckpointIsEnabled(Worker) == true)
+        {
+            /* Source file size and time let a resume detect a modified source file */
+            if (Checkpoint->SourceOffset == 0)
+            {
+                FM_ChildSizeTimeMode(Source, &Checkpoint->SourceSize, &Checkpoint->SourceTime, &FileMode);
+            }
 
-                RemoveTheDir = false;
-                FM_GlobalData.ChildCmdErrCounter++;
+            FM_CheckpointSave(Worker);
+        }
+    }
+
+#ifdef FM_INCLUDE_KERNEL_COPY
+    /* Data that must pass through the child task for a CRC or a sparse copy cannot be copied by the kernel */
+    if ((CopyInProgress == true) && (Checkpoint->CRCType == FM_IGNORE_CRC) &&
+        (PipelineMode == FM_PIPELINE_MODE_WRITE) &&
+        (FM_ChildKernelCopy(Worker, CmdText, Events, Source, &CopyResult) == true))
+    {
+        CopyInProgress = false;
+    }
+#endif
+
+    /* The pipeline writes each block, computes the data CRC and advances the checkpoint */
+    FM_PipelineStart(Worker, PipelineMode, FileHandleTgt, Checkpoint->CRCType, Worker->JobCompletePkt.CRC);
+    FM_ThrottleStart(Worker);
+
+    while (CopyInProgress)
+    {
+        Buffer    = FM_PipelineBuffer(Worker);
+        BytesRead = OS_read(FileHandleSrc, Buffer, Worker->BlockSize);
+
+        if (BytesRead == 0)
+        {
+            /* Success - finished reading source file */
+            CopyInProgress = false;
+            CopyResult     = true;
+        }
+        else if (BytesRead < 0)
+        {
+            CopyInProgress = false;
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(Events->ReadEID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_read failed: result = %d, file = %s", CmdText, (int)BytesRead, Source);
+        }
+        else if (FM_PipelineSubmit(Worker, BytesRead) == false)
+        {
+            /* A block already read failed to write, reported below */
+            CopyInProgress = false;
+        }
+
+        /* Stop between blocks if the command has been aborted */
+        if ((CopyInProgress == true) && (FM_ChildCheckAbort(Worker, CmdText) == true))
+        {
+            CopyInProgress = false;
+        }
+
+        /* Avoid CPU hogging */
+        if (CopyInProgress)
+        {
+            FM_ThrottleBytes(Worker, BytesRead);
+        }
+    }
+
+    /* Wait for the blocks already read to reach the target file */
+    if (FM_PipelineFinish(Worker) == false)
+    {
+        CopyResult = false;
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(Events->WriteEID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_write failed: result = %d, expected = %d", CmdText,
+                          (int)Worker->Pipeline.Result, (int)Worker->Pipeline.Expected);
+    }
+
+    /* CRC of the data as it streamed to the target file */
+    Worker->JobCompletePkt.CRC = Worker->Pipeline.CRC;
+
+    if (OpenedTarget)
+    {
+        /* Close target file */
+        OS_close(FileHandleTgt);
+    }
+
+    if (OpenedSource)
+    {
+        /* Close source file */
+        OS_close(FileHandleSrc);
+    }
+
+    return (CopyResult);
+
+} /* End of FM_ChildCopySegment */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- read back copy target file    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildVerifyTarget(FM_ChildWorker_t *Worker, const char *CmdText, const FM_ChildCopyEvents_t *Events)
+{
+    FM_ChildCheckpoint_t *Checkpoint = &Worker->Checkpoint;
+    bool                  ReadResult = false;
+    bool                  Reading    = false;
+    int32                 OS_Status  = OS_SUCCESS;
+    int32                 BytesRead  = 0;
+    char *                Buffer     = NULL;
+    osal_id_t             FileHandle = OS_OBJECT_ID_UNDEFINED;
+
+    /* The pipeline computes the CRC of each block while the next block is read */
+    FM_PipelineStart(Worker, FM_PIPELINE_MODE_CRC, OS_OBJECT_ID_UNDEFINED, Checkpoint->CRCType, 0);
+
+    OS_Status = OS_OpenCreate(&FileHandle, Checkpoint->Target, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(Events->VerifyEID, CFE_EVS_EventType_ERROR,
+                          "%s error: read back OS_OpenCreate failed: result = %d, tgt = %s", CmdText, (int)OS_Status,
+                          Checkpoint->Target);
+    }
+    else
+    {
+        Reading = true;
+        FM_ThrottleStart(Worker);
+    }
+
+    while (Reading)
+    {
+        Buffer    = FM_PipelineBuffer(Worker);
+        BytesRead = OS_read(FileHandle, Buffer, Worker->BlockSize);
+
+        if (BytesRead == 0)
+        {
+            /* Finished reading target file */
+            Reading    = false;
+            ReadResult = true;
+        }
+        else if (BytesRead < 0)
+        {
+            Reading = false;
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(Events->VerifyEID, CFE_EVS_EventType_ERROR,
+                              "%s error: read back OS_read failed: result = %d, tgt = %s", CmdText, (int)BytesRead,
+                              Checkpoint->Target);
+        }
+        else
+        {
+            /* Continue CRC calculation */
+            FM_PipelineSubmit(Worker, BytesRead);
+
+            /* Stop between blocks if the command has been aborted */
+            if (FM_ChildCheckAbort(Worker, CmdText) == true)
+            {
+                Reading = false;
+            }
+        }
+
+        /* Avoid CPU hogging */
+        if (Reading)
+        {
+            FM_ThrottleBytes(Worker, BytesRead);
+        }
+    }
+
+    /* Wait for the blocks already read to be added to the CRC */
+    if ((FM_PipelineFinish(Worker) == false) && (ReadResult == true))
+    {
+        ReadResult = false;
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(Events->VerifyEID, CFE_EVS_EventType_ERROR,
+                          "%s error: read back failed: pipeline result = %d, tgt = %s", CmdText,
+                          (int)Worker->Pipeline.Result, Checkpoint->Target);
+    }
+
+    if (OS_Status == OS_SUCCESS)
+    {
+        OS_close(FileHandle);
+    }
+
+    /* Both CRC's are reported, whether or not they match */
+    if (ReadResult == true)
+    {
+        Worker->JobCompletePkt.CRCType   = (uint8)Checkpoint->CRCType;
+        Worker->JobCompletePkt.TargetCRC = Worker->Pipeline.CRC;
+
+        if (Worker->JobCompletePkt.TargetCRC == Worker->JobCompletePkt.CRC)
+        {
+            Worker->JobCompletePkt.Verified = FM_JOB_VERIFY_MATCH;
+        }
+        else
+        {
+            Worker->JobCompletePkt.Verified = FM_JOB_VERIFY_MISMATCH;
+            ReadResult                      = false;
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(Events->VerifyEID, CFE_EVS_EventType_ERROR,
+                              "%s error: read back CRC mismatch: src CRC = 0x%08X, tgt CRC = 0x%08X, tgt = %s", CmdText,
+                              (unsigned int)Worker->JobCompletePkt.CRC, (unsigned int)Worker->JobCompletePkt.TargetCRC,
+                              Checkpoint->Target);
+        }
+    }
+
+    return (ReadResult);
+
+} /* End of FM_ChildVerifyTarget */
+
+#ifdef FM_INCLUDE_KERNEL_COPY
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- kernel copy one source        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildKernelCopy(FM_ChildWorker_t *Worker, const char *CmdText, const FM_ChildCopyEvents_t *Events,
+                        const char *Source, bool *CopyResult)
+{
+    FM_ChildCheckpoint_t *Checkpoint     = &Worker->Checkpoint;
+    bool                  Handled        = false;
+    bool                  CopyInProgress = false;
+    bool                  UseSendfile    = false;
+    int                   FileDescSrc    = -1;
+    int                   FileDescTgt    = -1;
+    loff_t                SourceOffset   = Checkpoint->SourceOffset;
+    loff_t                TargetOffset   = Checkpoint->TargetOffset;
+    off_t                 SendOffset     = 0;
+    ssize_t               BytesCopied    = 0;
+    char                  LocalPath[OS_MAX_LOCAL_PATH_LEN];
+
+    /* OSAL does not share its file descriptors, so open the files again by local path */
+    if (OS_TranslatePath(Source, LocalPath) == OS_SUCCESS)
+    {
+        FileDescSrc = open(LocalPath, O_RDONLY);
+    }
+
+    if ((FileDescSrc >= 0) && (OS_TranslatePath(Checkpoint->Target, LocalPath) == OS_SUCCESS))
+    {
+        FileDescTgt = open(LocalPath, O_WRONLY);
+    }
+
+    CopyInProgress = (FileDescTgt >= 0);
+
+    FM_ThrottleStart(Worker);
+
+    while (CopyInProgress)
+    {
+        if (UseSendfile == false)
+        {
+            BytesCopied = copy_file_range(FileDescSrc, &SourceOffset, FileDescTgt, &TargetOffset,
+                                          FM_CHILD_KERNEL_COPY_SIZE, 0);
+        }
+        else
+        {
+            /* sendfile writes at the target file position */
+            SendOffset  = (off_t)SourceOffset;
+            BytesCopied = sendfile(FileDescTgt, FileDescSrc, &SendOffset, FM_CHILD_KERNEL_COPY_SIZE);
+
+            if (BytesCopied > 0)
+            {
+                SourceOffset += BytesCopied;
+                TargetOffset += BytesCopied;
             }
         }
 
-        OS_DirectoryClose(DirId);
-    }
+        if (BytesCopied == 0)
+        {
+            /* Success - finished reading source file */
+            CopyInProgress = false;
+            Handled        = true;
+            *CopyResult    = true;
+        }
+        else if ((BytesCopied < 0) && (Handled == false) && (UseSendfile == false))
+        {
+            /* Kernel or file systems do not support copy_file_range, try sendfile */
+            UseSendfile    = (lseek(FileDescTgt, (off_t)TargetOffset, SEEK_SET) == (off_t)TargetOffset);
+            CopyInProgress = UseSendfile;
+        }
+        else if ((BytesCopied < 0) && (Handled == false))
+        {
+            /* Nothing copied yet, leave the copy to the portable loop */
+            CopyInProgress = false;
+        }
+        else if (BytesCopied < 0)
+        {
+            CopyInProgress = false;
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(Events->WriteEID, CFE_EVS_EventType_ERROR,
+                              "%s error: kernel copy failed: errno = %d, src = %s", CmdText, errno, Source);
+        }
+        else
+        {
+            /* Advance the checkpoint, no data CRC is possible */
+            Handled = true;
+            FM_CheckpointUpdate(Worker, NULL, (uint32)BytesCopied);
+            FM_ChildJobBytes(Worker, (uint32)BytesCopied);
+        }
+
+        /* Stop between chunks if the command has been aborted */
+        if ((CopyInProgress == true) && (FM_ChildCheckAbort(Worker, CmdText) == true))
+        {
+            CopyInProgress = false;
+            Handled        = true;
+        }
+
+        /* Avoid CPU hogging */
+        if ((CopyInProgress == true) && (BytesCopied > 0))
+        {
+            FM_ThrottleBytes(Worker, (uint32)BytesCopied);
+        }
+    }
+
+    if (FileDescTgt >= 0)
+    {
+        close(FileDescTgt);
+    }
+
+    if (FileDescSrc >= 0)
+    {
+        close(FileDescSrc);
+    }
+
+    return (Handled);
+
+} /* End of FM_ChildKernelCopy */
+
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- get dir entry size and time   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileTime, uint32 *FileMode)
+{
+    int32      Result = OS_SUCCESS;
+    os_fstat_t FileStatus;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+
+    Result = OS_stat(Filename, &FileStatus);
+
+    if (Result != OS_SUCCESS)
+    {
+        *FileSize = 0;
+        *FileTime = 0;
+        *FileMode = 0;
+    }
+    else
+    {
+        *FileTime = OS_FILESTAT_TIME(FileStatus);
+        *FileSize = OS_FILESTAT_SIZE(FileStatus);
+        *FileMode = OS_FILESTAT_MODE(FileStatus);
+    }
+
+    return (Result);
+
+} /* End of FM_ChildSizeTimeMode */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- get file allocated size       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_ChildAllocatedSize(const char *Filename)
+{
+    uint32 AllocatedSize = FM_FILE_SIZE_UNKNOWN;
+
+#ifdef FM_INCLUDE_ALLOCATED_SIZE
+    struct stat FileStatus;
+    char        LocalPath[OS_MAX_LOCAL_PATH_LEN];
+
+    /* OSAL reports only the logical file size, so stat the file again by local path */
+    if ((OS_TranslatePath(Filename, LocalPath) == OS_SUCCESS) && (stat(LocalPath, &FileStatus) == 0))
+    {
+        /* POSIX counts allocated blocks in 512 byte units */
+        if ((uint64)FileStatus.st_blocks < ((uint64)FM_FILE_SIZE_UNKNOWN / 512))
+        {
+            AllocatedSize = (uint32)FileStatus.st_blocks * 512;
+        }
+    }
+#else
+    (void)Filename;
+#endif
+
+    return (AllocatedSize);
+
+} /* End of FM_ChildAllocatedSize */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- sleep between OS_stat on files*/
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, bool getSizeTimeMode)
+{
+    /* Check if command requested size and time */
+    if (getSizeTimeMode == true)
+    {
+        /* Avoid CPU hogging */
+        FM_ThrottleStats();
+
+        /* Get file size, date, and mode */
+        FM_ChildSizeTimeMode(Filename, &(DirListData->EntrySize), &(DirListData->ModifyTime), &(DirListData->Mode));
+    }
+    else
+    {
+        DirListData->EntrySize  = 0;
+        DirListData->ModifyTime = 0;
+        DirListData->Mode       = 0;
+    }
+} /* FM_ChildSleepStat */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- match name against pattern    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildPatternMatch(const char *Pattern, const char *Name)
+{
+    const char *StarPattern = NULL;
+    const char *StarName    = NULL;
+    bool        Matched     = false;
+    bool        Done        = false;
 
-    if (RemoveTheDir)
+    while (Done == false)
     {
-        /* Remove the directory */
-        OS_Status = OS_rmdir(CmdArgs->Source1);
-
-        if (OS_Status != OS_SUCCESS)
+        if (*Pattern == '*')
         {
-            /* Send command failure event (error) */
-            CFE_EVS_SendEvent(FM_DELETE_RMDIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s error: OS_rmdir failed: result = %d, dir = %s", CmdText, (int)OS_Status,
-                              CmdArgs->Source1);
-
-            FM_GlobalData.ChildCmdErrCounter++;
+            /* Remember the star, it first matches no characters */
+            Pattern++;
+            StarPattern = Pattern;
+            StarName    = Name;
+        }
+        else if ((*Name != '\0') && ((*Pattern == '?') || (*Pattern == *Name)))
+        {
+            Pattern++;
+            Name++;
+        }
+        else if ((*Name == '\0') && (*Pattern == '\0'))
+        {
+            Matched = true;
+            Done    = true;
+        }
+        else if ((StarPattern != NULL) && (*StarName != '\0'))
+        {
+            /* Let the most recent star match one more character and retry */
+            StarName++;
+            Pattern = StarPattern;
+            Name    = StarName;
         }
         else
         {
-            /* Send command completion event (info) */
-            CFE_EVS_SendEvent(FM_DELETE_DIR_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: src = %s", CmdText,
-                              CmdArgs->Source1);
-
-            FM_GlobalData.ChildCmdCounter++;
+            Done = true;
         }
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    return (Matched);
 
-} /* End of FM_ChildDeleteDirCmd() */
+} /* End of FM_ChildPatternMatch */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Get Directory List (to file)   */
+/* FM child task utility function -- check concat source list      */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDirListFileCmd(const FM_ChildQueueEntry_t *CmdArgs)
+bool FM_ChildConcatListCheck(FM_ChildWorker_t *Worker, const char *CmdText, uint32 *EntryCount)
 {
-    const char *CmdText    = "Directory List to File";
-    bool        Result     = false;
-    osal_id_t   FileHandle = OS_OBJECT_ID_UNDEFINED;
-    osal_id_t   DirId      = OS_OBJECT_ID_UNDEFINED;
-    int32       Status     = 0;
-
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    FM_ChildCheckpoint_t *Checkpoint = &Worker->Checkpoint;
+    FM_ChildListFile_t    ListFile;
+    char                  Name[OS_MAX_PATH_LEN] = "\0";
+    bool                  CheckResult           = false;
+    bool                  OpenedList            = false;
+    bool                  Reading               = false;
+    int32                 OS_Status             = OS_SUCCESS;
+    uint32                FilenameState         = FM_NAME_IS_INVALID;
 
-    /*
-    ** Command argument useage for this command:
-    **
-    **  CmdArgs->CommandCode = FM_GET_DIR_FILE_CC
-    **  CmdArgs->Source1     = directory name
-    **  CmdArgs->Source2     = directory name plus separator
-    **  CmdArgs->Target      = output filename
-    */
+    *EntryCount = 0;
 
-    /* Open directory for reading directory list */
-    Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+    OS_Status = FM_ChildListOpen(&ListFile, Checkpoint->Source1);
 
-    if (Status != OS_SUCCESS)
+    if (OS_Status != OS_SUCCESS)
     {
-        FM_GlobalData.ChildCmdErrCounter++;
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
 
         /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_GET_DIR_FILE_OSOPENDIR_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+        CFE_EVS_SendEvent(FM_CONCAT_LIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: list OS_OpenCreate failed: result = %d, list = %s", CmdText, (int)OS_Status,
+                          Checkpoint->Source1);
     }
     else
     {
-        /* Create output file, write placeholder for statistics, etc. */
-        Result = FM_ChildDirListFileInit(&FileHandle, CmdArgs->Source1, CmdArgs->Target);
-        if (Result == true)
+        OpenedList = true;
+        Reading    = true;
+    }
+
+    while (Reading)
+    {
+        OS_Status = FM_ChildListNext(&ListFile, Name);
+
+        if (OS_Status == 0)
         {
-            /* Read directory listing and write contents to output file */
-            FM_ChildDirListFileLoop(DirId, FileHandle, CmdArgs->Source1, CmdArgs->Source2, CmdArgs->Target,
-                                    CmdArgs->GetSizeTimeMode);
+            Reading     = false;
+            CheckResult = (*EntryCount > 0);
 
-            /* Close output file */
-            OS_close(FileHandle);
+            if (CheckResult == false)
+            {
+                FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_CONCAT_LIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: list names no files: list = %s", CmdText, Checkpoint->Source1);
+            }
         }
+        else if (OS_Status < 0)
+        {
+            Reading = false;
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
 
-        /* Close directory list access handle */
-        OS_DirectoryClose(DirId);
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_CONCAT_LIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: list read failed: result = %d, line = %d, list = %s", CmdText,
+                              (int)OS_Status, (int)ListFile.Line, Checkpoint->Source1);
+        }
+        else
+        {
+            (*EntryCount)++;
+
+            /* Each source must be a closed file, the target would be read while it is written */
+            FM_ThrottleStats();
+            FilenameState = FM_GetFilenameState(Name, sizeof(Name), false);
+
+            if ((FilenameState != FM_NAME_IS_FILE_CLOSED) || (strcmp(Name, Checkpoint->Target) == 0))
+            {
+                Reading = false;
+                FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_CONCAT_LIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: invalid source: state = %d, line = %d, src = %s", CmdText,
+                                  (int)FilenameState, (int)ListFile.Line, Name);
+            }
+            else if ((*EntryCount == Checkpoint->Segment) && (strcmp(Name, Checkpoint->Source2) != 0))
+            {
+                Reading = false;
+                FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_CONCAT_LIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: list modified since checkpoint: line = %d, src = %s, expected = %s",
+                                  CmdText, (int)ListFile.Line, Name, Checkpoint->Source2);
+            }
+            else
+            {
+                FM_ChildJobTotal(Worker, Name);
+            }
+        }
+    }
+
+    if (OpenedList == true)
+    {
+        OS_close(ListFile.FileHandle);
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    return (CheckResult);
 
-} /* End of FM_ChildDirListFileCmd() */
+} /* End of FM_ChildConcatListCheck */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Get Directory List (to pkt)    */
+/* FM child task utility function -- open file list for reading    */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs)
+int32 FM_ChildListOpen(FM_ChildListFile_t *ListFile, const char *Filename)
 {
-    const char *       CmdText                      = "Directory List to Packet";
-    char               LogicalName[OS_MAX_PATH_LEN] = "\0";
-    bool               StillProcessing              = true;
-    osal_id_t          DirId                        = OS_OBJECT_ID_UNDEFINED;
-    os_dirent_t        DirEntry;
-    int32              ListIndex      = 0;
-    FM_DirListEntry_t *ListEntry      = NULL;
-    int32              PathLength     = 0;
-    int32              EntryLength    = 0;
-    int32              FilesTillSleep = FM_CHILD_STAT_SLEEP_FILECOUNT;
-    int32              Status;
+    ListFile->FileHandle = OS_OBJECT_ID_UNDEFINED;
+    ListFile->Line       = 0;
+    ListFile->Length     = 0;
+    ListFile->Ended      = false;
 
-    memset(&DirEntry, 0, sizeof(DirEntry));
+    return (OS_OpenCreate(&ListFile->FileHandle, Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY));
 
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+} /* End of FM_ChildListOpen */
 
-    /*
-    ** Command argument useage for this command:
-    **
-    **  CmdArgs->CommandCode   = FM_GET_DIR_PKT_CC
-    **  CmdArgs->Source1       = directory name
-    **  CmdArgs->Source2       = directory name plus separator
-    **  CmdArgs->DirListOffset = index of 1st reported dir entry
-    */
-    PathLength = strlen(CmdArgs->Source2);
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- read next name from file list */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-    /* Open source directory for reading directory list */
-    Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+int32 FM_ChildListNext(FM_ChildListFile_t *ListFile, char *Name)
+{
+    const char *NewLine    = NULL;
+    bool        Reading    = true;
+    int32       Result     = 0;
+    int32       BytesRead  = 0;
+    uint32      LineLength = 0;
+    uint32      NameLength = 0;
 
-    if (Status != OS_SUCCESS)
+    while (Reading)
     {
-        FM_GlobalData.ChildCmdErrCounter++;
+        NewLine = memchr(ListFile->Buffer, '\n', ListFile->Length);
 
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_GET_DIR_PKT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
-    }
-    else
-    {
-        /* Initialize the directory list telemetry packet */
-        CFE_MSG_Init(&FM_GlobalData.DirListPkt.TlmHeader.Msg, CFE_SB_ValueToMsgId(FM_DIR_LIST_TLM_MID),
-                     sizeof(FM_DirListPkt_t));
+        if (NewLine != NULL)
+        {
+            LineLength = (NewLine - ListFile->Buffer) + 1;
+            NameLength = LineLength - 1;
+        }
+        else if ((ListFile->Ended == true) && (ListFile->Length < sizeof(ListFile->Buffer)))
+        {
+            /* The last line need not end with a newline */
+            LineLength = ListFile->Length;
+            NameLength = LineLength;
+        }
+        else
+        {
+            LineLength = 0;
+        }
 
-        strncpy(FM_GlobalData.DirListPkt.DirName, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
-        FM_GlobalData.DirListPkt.DirName[OS_MAX_PATH_LEN - 1] = '\0';
-        FM_GlobalData.DirListPkt.FirstFile                    = CmdArgs->DirListOffset;
+        if (LineLength > 0)
+        {
+            ListFile->Line++;
 
-        StillProcessing = true;
-        while (StillProcessing == true)
+            if ((NameLength > 0) && (ListFile->Buffer[NameLength - 1] == '\r'))
+            {
+                NameLength--;
+            }
+
+            /* Empty lines are skipped */
+            if (NameLength > 0)
+            {
+                memcpy(Name, ListFile->Buffer, NameLength);
+                Name[NameLength] = '\0';
+
+                Result  = NameLength;
+                Reading = false;
+            }
+
+            ListFile->Length -= LineLength;
+            memmove(ListFile->Buffer, &ListFile->Buffer[LineLength], ListFile->Length);
+        }
+        else if (ListFile->Length == sizeof(ListFile->Buffer))
         {
-            /* Read next directory entry */
-            Status = OS_DirectoryRead(DirId, &DirEntry);
+            /* Line does not fit in a filename with its terminator */
+            Result  = OS_FS_ERR_PATH_TOO_LONG;
+            Reading = false;
+        }
+        else if (ListFile->Ended == true)
+        {
+            /* End of the list */
+            Reading = false;
+        }
+        else
+        {
+            BytesRead = OS_read(ListFile->FileHandle, &ListFile->Buffer[ListFile->Length],
+                                sizeof(ListFile->Buffer) - ListFile->Length);
 
-            if (Status != OS_SUCCESS)
+            if (BytesRead < 0)
             {
-                /* Stop reading directory - no more entries */
-                StillProcessing = false;
+                Result  = BytesRead;
+                Reading = false;
             }
-            else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
-                     (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+            else if (BytesRead == 0)
             {
-                /* Do not count the "." and ".." directory entries */
-                FM_GlobalData.DirListPkt.TotalFiles++;
+                ListFile->Ended = true;
+            }
+            else
+            {
+                ListFile->Length += BytesRead;
+            }
+        }
+    }
 
-                /* Start collecting directory entries at command specified offset */
-                /* Stop collecting directory entries when telemetry packet is full */
-                if ((FM_GlobalData.DirListPkt.TotalFiles > FM_GlobalData.DirListPkt.FirstFile) &&
-                    (FM_GlobalData.DirListPkt.PacketFiles < FM_DIR_LIST_PKT_ENTRIES))
-                {
-                    /* Create a shorthand access to the packet list entry */
-                    ListIndex = FM_GlobalData.DirListPkt.PacketFiles;
-                    ListEntry = &FM_GlobalData.DirListPkt.FileList[ListIndex];
+    return (Result);
 
-                    EntryLength = strlen(OS_DIRENTRY_NAME(DirEntry));
+} /* End of FM_ChildListNext */
 
-                    /* Verify combined directory plus filename length */
-                    if ((PathLength + EntryLength) < OS_MAX_PATH_LEN)
-                    {
-                        /* Add filename to directory listing telemetry packet */
-                        strncpy(ListEntry->EntryName, OS_DIRENTRY_NAME(DirEntry), EntryLength);
-                        ListEntry->EntryName[EntryLength] = '\0';
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- check split segment names     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-                        /* Build filename - Directory already has path separator */
-                        strncpy(LogicalName, CmdArgs->Source2, PathLength);
-                        LogicalName[PathLength] = '\0';
+bool FM_ChildSplitCheck(const char *CmdText, const char *Target, uint32 SourceSize, uint32 SegmentSize,
+                        uint32 *SegmentCount)
+{
+    char   Name[OS_MAX_PATH_LEN] = "\0";
+    bool   CheckResult           = false;
+    uint32 FilenameState         = FM_NAME_IS_INVALID;
+    uint32 Segment               = 0;
 
-                        strncat(LogicalName, OS_DIRENTRY_NAME(DirEntry), EntryLength);
+    *SegmentCount = 0;
 
-                        FM_ChildSleepStat(LogicalName, ListEntry, &FilesTillSleep, CmdArgs->GetSizeTimeMode);
+    /* The last segment holds the remainder of the source file */
+    if (SegmentSize != 0)
+    {
+        *SegmentCount = (SourceSize / SegmentSize) + (((SourceSize % SegmentSize) != 0) ? 1 : 0);
+    }
 
-                        /* Add another entry to the telemetry packet */
-                        FM_GlobalData.DirListPkt.PacketFiles++;
-                    }
-                    else
-                    {
-                        FM_GlobalData.ChildCmdWarnCounter++;
+    if ((SegmentSize == 0) || (*SegmentCount > FM_CHILD_SPLIT_MAX_SEGMENTS))
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
 
-                        /* Send command warning event (info) */
-                        CFE_EVS_SendEvent(FM_GET_DIR_PKT_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                                          "%s warning: dir + entry is too long: dir = %s, entry = %s", CmdText,
-                                          CmdArgs->Source2, OS_DIRENTRY_NAME(DirEntry));
-                    }
-                }
-            }
-        }
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_SPLIT_SEGMENT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid segment count: size = %lu, count = %lu, max = %d, tgt = %s", CmdText,
+                          (unsigned long)SegmentSize, (unsigned long)*SegmentCount, FM_CHILD_SPLIT_MAX_SEGMENTS,
+                          Target);
+    }
+    else
+    {
+        CheckResult = true;
+    }
 
-        OS_DirectoryClose(DirId);
+    for (Segment = 0; (Segment < *SegmentCount) && (CheckResult == true); Segment++)
+    {
+        if (FM_ChildSplitName(Name, Target, Segment) == false)
+        {
+            CheckResult = false;
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
 
-        /* Timestamp and send directory listing telemetry packet */
-        CFE_SB_TimeStampMsg(&FM_GlobalData.DirListPkt.TlmHeader.Msg);
-        CFE_SB_TransmitMsg(&FM_GlobalData.DirListPkt.TlmHeader.Msg, true);
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_SPLIT_SEGMENT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: segment filename too long: segment = %lu, tgt = %s", CmdText,
+                              (unsigned long)Segment, Target);
+        }
+        else
+        {
+            /* A segment file is never overwritten */
+            FM_ThrottleStats();
+            FilenameState = FM_GetFilenameState(Name, sizeof(Name), false);
 
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_GET_DIR_PKT_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: offset = %d, dir = %s", CmdText,
-                          (int)CmdArgs->DirListOffset, CmdArgs->Source1);
+            if (FilenameState != FM_NAME_IS_NOT_IN_USE)
+            {
+                CheckResult = false;
+                FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
 
-        FM_GlobalData.ChildCmdCounter++;
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_SPLIT_SEGMENT_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: segment file exists: state = %d, name = %s", CmdText,
+                                  (int)FilenameState, Name);
+            }
+        }
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    return (CheckResult);
 
-} /* End of FM_ChildDirListPktCmd() */
+} /* End of FM_ChildSplitCheck */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Set File Permissions           */
+/* FM child task utility function -- write one split segment file  */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void FM_ChildSetPermissionsCmd(const FM_ChildQueueEntry_t *CmdArgs)
+
+bool FM_ChildSplitSegment(FM_ChildWorker_t *Worker, const char *CmdText, osal_id_t FileHandleSrc, const char *Name,
+                          FM_SplitManifestEntry_t *Entry)
 {
-    int32       OS_Status = OS_SUCCESS;
-    const char *CmdText   = "Set Permissions";
+    FM_ChildCheckpoint_t *Checkpoint     = &Worker->Checkpoint;
+    bool                  SegmentResult  = false;
+    bool                  CopyInProgress = false;
+    int32                 OS_Status      = OS_SUCCESS;
+    int32                 BytesRead      = 0;
+    uint32                BytesLeft      = Entry->Size;
+    uint32                ReadSize       = 0;
+    char *                Buffer         = NULL;
+    osal_id_t             FileHandleTgt  = OS_OBJECT_ID_UNDEFINED;
+
+    OS_Status = OS_OpenCreate(&FileHandleTgt, Name, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
 
-    OS_Status = OS_chmod(CmdArgs->Source1, CmdArgs->Mode);
+    if (OS_Status != OS_SUCCESS)
+    {
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_SPLIT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_OpenCreate failed: result = %d, tgt = %s", CmdText, (int)OS_Status, Name);
+    }
+    else
+    {
+        CopyInProgress = true;
+    }
+
+    /* The pipeline writes each block and computes the segment CRC */
+    FM_PipelineStart(Worker, FM_PIPELINE_MODE_WRITE, FileHandleTgt, Checkpoint->CRCType, 0);
+    FM_ThrottleStart(Worker);
+
+    while (CopyInProgress)
+    {
+        /* A block never crosses the end of the segment */
+        ReadSize = Worker->BlockSize;
+
+        if (ReadSize > BytesLeft)
+        {
+            ReadSize = BytesLeft;
+        }
+
+        Buffer    = FM_PipelineBuffer(Worker);
+        BytesRead = OS_read(FileHandleSrc, Buffer, ReadSize);
+
+        if (BytesRead <= 0)
+        {
+            /* The source file ended early if it was truncated during the split */
+            CopyInProgress = false;
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_SPLIT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_read failed: result = %d, offset = %lu, src = %s", CmdText,
+                              (int)BytesRead, (unsigned long)(Entry->Offset + Entry->Size - BytesLeft),
+                              Checkpoint->Source1);
+        }
+        else if (FM_PipelineSubmit(Worker, BytesRead) == false)
+        {
+            /* A block already read failed to write, reported below */
+            CopyInProgress = false;
+        }
+        else
+        {
+            BytesLeft -= BytesRead;
+
+            if (BytesLeft == 0)
+            {
+                CopyInProgress = false;
+                SegmentResult  = true;
+            }
+        }
+
+        /* Stop between blocks if the command has been aborted */
+        if ((CopyInProgress == true) && (FM_ChildCheckAbort(Worker, CmdText) == true))
+        {
+            CopyInProgress = false;
+        }
+
+        /* Avoid CPU hogging */
+        if (CopyInProgress)
+        {
+            FM_ThrottleBytes(Worker, BytesRead);
+        }
+    }
+
+    /* Wait for the blocks already read to reach the segment file */
+    if (FM_PipelineFinish(Worker) == false)
+    {
+        SegmentResult = false;
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_SPLIT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_write failed: result = %d, expected = %d, tgt = %s", CmdText,
+                          (int)Worker->Pipeline.Result, (int)Worker->Pipeline.Expected, Name);
+    }
 
     if (OS_Status == OS_SUCCESS)
     {
-        FM_GlobalData.ChildCmdCounter++;
+        OS_close(FileHandleTgt);
 
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_SET_PERM_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command: file = %s, access = %d", CmdText,
-                          CmdArgs->Source1, (int)CmdArgs->Mode);
+        if (SegmentResult == false)
+        {
+            /* Remove partial segment file after split error or abort */
+            OS_remove(Name);
+        }
     }
-    else
-    {
-        FM_GlobalData.ChildCmdErrCounter++;
 
-        /* Send OS error message */
-        CFE_EVS_SendEvent(FM_SET_PERM_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s command: OS_chmod error, RC=0x%08X, file = %s, access = %d", CmdText,
-                          (unsigned int)OS_Status, CmdArgs->Source1, (int)CmdArgs->Mode);
-    }
+    Entry->CRC = Worker->Pipeline.CRC;
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    return (SegmentResult);
 
-} /* End of FM_ChildSetPermissionsCmd() */
+} /* End of FM_ChildSplitSegment */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task utility function -- create dir list output file   */
+/* FM child task utility function -- build split segment filename  */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename)
+bool FM_ChildSplitName(char *Name, const char *Target, uint32 Segment)
 {
-    const char *    CmdText       = "Directory List to File";
-    bool            CommandResult = true;
-    CFE_FS_Header_t FileHeader;
-    osal_id_t       FileHandle   = OS_OBJECT_ID_UNDEFINED;
-    int32           BytesWritten = 0;
-    int32           Status       = 0;
+    int32 Length = snprintf(Name, OS_MAX_PATH_LEN, "%s.%03u", Target, (unsigned int)Segment);
 
-    /* Initialize the standard cFE File Header for the Directory Listing File */
-    memset(&FileHeader, 0, sizeof(FileHeader));
-    FileHeader.SubType = FM_DIR_LIST_FILE_SUBTYPE;
-    strncpy(FileHeader.Description, CmdText, sizeof(FileHeader.Description) - 1);
-    FileHeader.Description[sizeof(FileHeader.Description) - 1] = '\0';
+    return ((Length > 0) && (Length < OS_MAX_PATH_LEN));
 
-    /* Create directory listing output file */
-    Status = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+} /* End of FM_ChildSplitName */
 
-    if (Status == OS_SUCCESS)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- extend file with zero blocks  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildPreallocateWrite(FM_ChildWorker_t *Worker, const char *CmdText, osal_id_t FileHandle,
+                              const char *Filename, uint32 Offset, uint32 FileSize)
+{
+    bool   WriteResult     = false;
+    bool   WriteInProgress = true;
+    int32  SeekResult      = 0;
+    uint32 BytesLeft       = FileSize - Offset;
+    uint32 WriteSize       = 0;
+    char * Buffer          = NULL;
+
+    /* Zero blocks are appended after the existing file data */
+    SeekResult = OS_lseek(FileHandle, Offset, OS_SEEK_SET);
+
+    if (SeekResult != (int32)Offset)
     {
-        /* Write the standard CFE file header */
-        BytesWritten = CFE_FS_WriteHeader(FileHandle, &FileHeader);
-        if (BytesWritten == sizeof(CFE_FS_Header_t))
+        WriteInProgress = false;
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_PREALLOCATE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_lseek failed: result = %d, offset = %lu, file = %s", CmdText, (int)SeekResult,
+                          (unsigned long)Offset, Filename);
+    }
+
+    FM_PipelineStart(Worker, FM_PIPELINE_MODE_WRITE, FileHandle, FM_IGNORE_CRC, 0);
+    FM_ThrottleStart(Worker);
+
+    while (WriteInProgress)
+    {
+        WriteSize = Worker->BlockSize;
+
+        if (WriteSize > BytesLeft)
         {
-            /* Initialize directory statistics structure */
-            memset(&FM_GlobalData.DirListFileStats, 0, sizeof(FM_GlobalData.DirListFileStats));
-            strncpy(FM_GlobalData.DirListFileStats.DirName, Directory, OS_MAX_PATH_LEN - 1);
-            FM_GlobalData.DirListFileStats.DirName[OS_MAX_PATH_LEN - 1] = '\0';
+            WriteSize = BytesLeft;
+        }
 
-            /* Write blank FM directory statistics structure as a place holder */
-            BytesWritten = OS_write(FileHandle, &FM_GlobalData.DirListFileStats, sizeof(FM_DirListFileStats_t));
-            if (BytesWritten == sizeof(FM_DirListFileStats_t))
-            {
-                /* Return output file handle */
-                *FileHandlePtr = FileHandle;
-            }
-            else
-            {
-                CommandResult = false;
-                FM_GlobalData.ChildCmdErrCounter++;
+        /* Pipeline buffers are reused, so clear each one before it is written */
+        Buffer = FM_PipelineBuffer(Worker);
+        memset(Buffer, 0, WriteSize);
 
-                /* Send command failure event (error) */
-                CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRBLANK_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "%s error: OS_write blank stats failed: result = %d, expected = %u", CmdText,
-                                  (int)BytesWritten, (unsigned int)sizeof(FM_DirListFileStats_t));
-            }
+        if (FM_PipelineSubmit(Worker, WriteSize) == false)
+        {
+            /* A block already submitted failed to write, reported below */
+            WriteInProgress = false;
         }
         else
         {
-            CommandResult = false;
-            FM_GlobalData.ChildCmdErrCounter++;
+            BytesLeft -= WriteSize;
 
-            /* Send command failure event (error) */
-            CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRHDR_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s error: CFE_FS_WriteHeader failed: result = %d, expected = %u", CmdText,
-                              (int)BytesWritten, (unsigned int)sizeof(CFE_FS_Header_t));
+            if (BytesLeft == 0)
+            {
+                WriteInProgress = false;
+                WriteResult     = true;
+            }
         }
 
-        /* Close output file after write error */
-        if (CommandResult == false)
+        /* Stop between blocks if the command has been aborted */
+        if ((WriteInProgress == true) && (FM_ChildCheckAbort(Worker, CmdText) == true))
         {
-            OS_close(FileHandle);
+            WriteInProgress = false;
+        }
+
+        /* Avoid CPU hogging */
+        if (WriteInProgress)
+        {
+            FM_ThrottleBytes(Worker, WriteSize);
         }
     }
-    else
+
+    /* Wait for the blocks already submitted to reach the file */
+    if (FM_PipelineFinish(Worker) == false)
     {
-        CommandResult = false;
-        FM_GlobalData.ChildCmdErrCounter++;
+        WriteResult = false;
+        FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
 
         /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_GET_DIR_FILE_OSCREAT_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_OpenCreate failed: result = %d, file = %s", CmdText, (int)Status, Filename);
+        CFE_EVS_SendEvent(FM_PREALLOCATE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_write failed: result = %d, expected = %d, file = %s", CmdText,
+                          (int)Worker->Pipeline.Result, (int)Worker->Pipeline.Expected, Filename);
     }
 
-    return (CommandResult);
+    return (WriteResult);
 
-} /* End FM_ChildDirListFileInit */
+} /* End of FM_ChildPreallocateWrite */
+
+#ifdef FM_INCLUDE_FILE_ALLOCATE
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task utility function -- write to dir list output file */
+/* FM child task utility function -- fallocate file space          */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDirListFileLoop(osal_id_t DirId, osal_id_t FileHandle, const char *Directory, const char *DirWithSep,
-                             const char *Filename, uint8 getSizeTimeMode)
+bool FM_ChildFileAllocate(FM_ChildWorker_t *Worker, const char *CmdText, const char *Filename, uint32 Offset,
+                          uint32 FileSize, bool *AllocateResult)
 {
-    const char *      CmdText                   = "Directory List to File";
-    int32             WriteLength               = sizeof(FM_DirListEntry_t);
-    bool              ReadingDirectory          = true;
-    bool              CommandResult             = true;
-    uint32            DirEntries                = 0;
-    uint32            FileEntries               = 0;
-    int32             EntryLength               = 0;
-    int32             PathLength                = 0;
-    int32             BytesWritten              = 0;
-    int32             FilesTillSleep            = FM_CHILD_STAT_SLEEP_FILECOUNT;
-    int32             Status                    = 0;
-    char              TempName[OS_MAX_PATH_LEN] = "\0";
-    os_dirent_t       DirEntry;
-    FM_DirListEntry_t DirListData;
-
-    memset(&DirEntry, 0, sizeof(DirEntry));
-
-    PathLength = strlen(DirWithSep);
+    bool Handled  = false;
+    int  FileDesc = -1;
+    char LocalPath[OS_MAX_LOCAL_PATH_LEN];
 
-    /* Until end of directory entries or output file write error */
-    while ((CommandResult == true) && (ReadingDirectory == true))
+    /* OSAL does not share its file descriptors, so open the file again by local path */
+    if (OS_TranslatePath(Filename, LocalPath) == OS_SUCCESS)
     {
-        Status = OS_DirectoryRead(DirId, &DirEntry);
+        FileDesc = open(LocalPath, O_WRONLY);
+    }
 
-        /* Normal loop end - no more directory entries */
-        if (Status != OS_SUCCESS)
+    if (FileDesc >= 0)
+    {
+        /* Holes in the existing file data are allocated too, the new bytes read as zero */
+        if (fallocate(FileDesc, 0, 0, (off_t)FileSize) == 0)
         {
-            ReadingDirectory = false;
+            Handled         = true;
+            *AllocateResult = true;
+            FM_ChildJobBytes(Worker, FileSize - Offset);
         }
-        else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
-                 (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+        else if ((errno != EOPNOTSUPP) && (errno != ENOSYS))
         {
-            /* Do not count the "." and ".." files */
-            DirEntries++;
+            Handled = true;
+            FM_ChildReportStatus(FM_JOB_STATUS_ERROR);
 
-            /* Count all files - write limited number */
-            if (FileEntries < FM_DIR_LIST_FILE_ENTRIES)
-            {
-                EntryLength = strlen(OS_DIRENTRY_NAME(DirEntry));
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_PREALLOCATE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: fallocate failed: errno = %d, file = %s", CmdText, errno, Filename);
+        }
 
-                /*
-                 * DirListData.EntryName and TempName are both OS_MAX_PATH_LEN, DirEntry name is OS_MAX_FILE_NAME,
-                 * so limiting test is PathLength and EntryLength together
-                 */
-                if ((PathLength + EntryLength) < OS_MAX_PATH_LEN)
-                {
-                    /* Build qualified directory entry name */
-                    strncpy(TempName, DirWithSep, PathLength);
-                    TempName[PathLength] = '\0';
+        close(FileDesc);
+    }
 
-                    strncat(TempName, OS_DIRENTRY_NAME(DirEntry), (OS_MAX_PATH_LEN - PathLength));
+    return (Handled);
 
-                    /* Populate directory list file entry */
-                    strncpy(DirListData.EntryName, OS_DIRENTRY_NAME(DirEntry), EntryLength);
-                    DirListData.EntryName[EntryLength] = '\0';
+} /* End of FM_ChildFileAllocate */
 
-                    FM_ChildSleepStat(TempName, (FM_DirListEntry_t *)&DirListData, &FilesTillSleep, getSizeTimeMode);
+#endif
 
-                    /* Write directory list file entry to output file */
-                    BytesWritten = OS_write(FileHandle, &DirListData, WriteLength);
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- truncate file in place        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-                    if (BytesWritten == WriteLength)
-                    {
-                        FileEntries++;
-                    }
-                    else
-                    {
-                        CommandResult = false;
-                        FM_GlobalData.ChildCmdErrCounter++;
+int32 FM_ChildTruncateFile(const char *Filename, uint32 FileSize)
+{
+    int32 Status = OS_ERR_NOT_IMPLEMENTED;
 
-                        /* Send command failure event (error) */
-                        CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRENTRY_ERR_EID, CFE_EVS_EventType_ERROR,
-                                          "%s error: OS_write entry failed: result = %d, expected = %d", CmdText,
-                                          (int)BytesWritten, (int)WriteLength);
-                    }
-                }
-                else
-                {
-                    FM_GlobalData.ChildCmdWarnCounter++;
+#ifdef FM_INCLUDE_FILE_TRUNCATE
+    char LocalPath[OS_MAX_LOCAL_PATH_LEN];
 
-                    /* Send command failure event (error) */
-                    CFE_EVS_SendEvent(FM_GET_DIR_FILE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                                      "%s error: combined directory and entry name too long: dir = %s, entry = %s",
-                                      CmdText, Directory, OS_DIRENTRY_NAME(DirEntry));
-                }
-            }
-        }
-    }
+    /* OSAL has no truncate call, so truncate the file by local path */
+    Status = OS_TranslatePath(Filename, LocalPath);
 
-    /* Update directory statistics in output file */
-    if ((CommandResult == true) && (DirEntries != 0))
+    if ((Status == OS_SUCCESS) && (truncate(LocalPath, (off_t)FileSize) != 0))
     {
-        /* Update entries found in directory vs entries written to file */
-        FM_GlobalData.DirListFileStats.DirEntries  = DirEntries;
-        FM_GlobalData.DirListFileStats.FileEntries = FileEntries;
-
-        /* Back up to the start of the statisitics data */
-        OS_lseek(FileHandle, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
-
-        /* Write an updated version of the statistics data */
-        WriteLength  = sizeof(FM_DirListFileStats_t);
-        BytesWritten = OS_write(FileHandle, &FM_GlobalData.DirListFileStats, WriteLength);
-
-        if (BytesWritten != WriteLength)
-        {
-            CommandResult = false;
-            FM_GlobalData.ChildCmdErrCounter++;
-
-            /* Send command failure event (error) */
-            CFE_EVS_SendEvent(FM_GET_DIR_FILE_UPSTATS_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s error: OS_write update stats failed: result = %d, expected = %d", CmdText,
-                              (int)BytesWritten, (int)WriteLength);
-        }
+        Status = OS_ERROR;
     }
+#else
+    (void)Filename;
+    (void)FileSize;
+#endif
 
-    /* Send command completion event (info) */
-    if (CommandResult == true)
-    {
-        FM_GlobalData.ChildCmdCounter++;
-
-        CFE_EVS_SendEvent(FM_GET_DIR_FILE_CMD_EID, CFE_EVS_EventType_DEBUG,
-                          "%s command: wrote %d of %d names: dir = %s, filename = %s", CmdText, (int)FileEntries,
-                          (int)DirEntries, Directory, Filename);
-    }
+    return (Status);
 
-} /* End of FM_ChildDirListFileLoop */
+} /* End of FM_ChildTruncateFile */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task utility function -- get dir entry size and time   */
+/* FM child task utility function -- link or clone a file          */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileTime, uint32 *FileMode)
+int32 FM_ChildLinkFile(const char *Source, const char *Target, uint8 Link)
 {
-    int32      Result = OS_SUCCESS;
-    os_fstat_t FileStatus;
+    int32 Status = OS_ERR_NOT_IMPLEMENTED;
 
-    memset(&FileStatus, 0, sizeof(FileStatus));
+#ifdef FM_INCLUDE_FILE_LINK
+    int         FileDescSrc  = -1;
+    int         FileDescTgt  = -1;
+    bool        TargetExists = false;
+    bool        SameFile     = false;
+    struct stat SourceStat;
+    struct stat TargetStat;
+    char        LocalSource[OS_MAX_LOCAL_PATH_LEN];
+    char        LocalTarget[OS_MAX_LOCAL_PATH_LEN];
 
-    Result = OS_stat(Filename, &FileStatus);
+    /* OSAL has no link or clone call, so share the data by local path */
+    Status = OS_TranslatePath(Source, LocalSource);
 
-    if (Result != OS_SUCCESS)
+    if (Status == OS_SUCCESS)
     {
-        *FileSize = 0;
-        *FileTime = 0;
-        *FileMode = 0;
+        Status = OS_TranslatePath(Target, LocalTarget);
     }
-    else
+
+    if ((Status == OS_SUCCESS) && (stat(LocalSource, &SourceStat) != 0))
     {
-        *FileTime = OS_FILESTAT_TIME(FileStatus);
-        *FileSize = OS_FILESTAT_SIZE(FileStatus);
-        *FileMode = OS_FILESTAT_MODE(FileStatus);
+        Status = OS_ERROR;
     }
 
-    return (Result);
-
-} /* End of FM_ChildSizeTimeMode */
+    /*
+    ** A target that is already the source file (another name for it, or a
+    **  link made earlier) shares the source data, removing or emptying it
+    **  first would destroy the source file
+    */
+    if (Status == OS_SUCCESS)
+    {
+        TargetExists = (stat(LocalTarget, &TargetStat) == 0);
 
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/*                                                                 */
-/* FM child task utility function -- sleep between OS_stat on files*/
-/*                                                                 */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+        if ((TargetExists == true) && (TargetStat.st_dev == SourceStat.st_dev) &&
+            (TargetStat.st_ino == SourceStat.st_ino))
+        {
+            SameFile = true;
+        }
+    }
 
-void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep,
-                       bool getSizeTimeMode)
-{
-    /* Check if command requested size and time */
-    if (getSizeTimeMode == true)
+    if ((Status == OS_SUCCESS) && (SameFile == false) && (Link == FM_COPY_LINK_HARD))
     {
-        if (*FilesTillSleep <= 0)
+        /* An overwritten target is replaced by the link, as a copy would have replaced its data */
+        if ((link(LocalSource, LocalTarget) != 0) &&
+            ((errno != EEXIST) || (unlink(LocalTarget) != 0) || (link(LocalSource, LocalTarget) != 0)))
         {
-            CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
-            OS_TaskDelay(FM_CHILD_STAT_SLEEP_MS);
-            CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
-            *FilesTillSleep = FM_CHILD_STAT_SLEEP_FILECOUNT;
+            Status = OS_ERROR;
         }
-
-        /* Get file size, date, and mode */
-        FM_ChildSizeTimeMode(Filename, &(DirListData->EntrySize), &(DirListData->ModifyTime), &(DirListData->Mode));
-
-        (*FilesTillSleep)--;
     }
-    else
+    else if ((Status == OS_SUCCESS) && (SameFile == false))
     {
-        DirListData->EntrySize  = 0;
-        DirListData->ModifyTime = 0;
-        DirListData->Mode       = 0;
+        FileDescSrc = open(LocalSource, O_RDONLY);
+
+        /* Not truncated here, an existing target keeps its data until the clone replaces it */
+        if (FileDescSrc >= 0)
+        {
+            FileDescTgt = open(LocalTarget, O_WRONLY | O_CREAT, 0666);
+        }
+
+        /* Fails across volumes or on file systems without reflink support */
+        if ((FileDescTgt < 0) || (ioctl(FileDescTgt, FICLONE, FileDescSrc) != 0))
+        {
+            Status = OS_ERROR;
+        }
+        else if (ftruncate(FileDescTgt, SourceStat.st_size) != 0)
+        {
+            /* A longer existing target keeps data past the end of the clone */
+            Status = OS_ERROR;
+        }
+
+        if (FileDescTgt >= 0)
+        {
+            close(FileDescTgt);
+
+            /* The copy that follows creates the target file again */
+            if ((Status != OS_SUCCESS) && (TargetExists == false))
+            {
+                unlink(LocalTarget);
+            }
+        }
+
+        if (FileDescSrc >= 0)
+        {
+            close(FileDescSrc);
+        }
     }
-} /* FM_ChildSleepStat */
+#else
+    (void)Source;
+    (void)Target;
+    (void)Link;
+#endif
+
+    return (Status);
+
+} /* End of FM_ChildLinkFile */
 
 /************************/
 /*  End of File Comment */
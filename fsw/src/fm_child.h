@@ -47,6 +47,8 @@
  *       the main task.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       #FM_CHILD_WORKER_COUNT child tasks are created.  All of the workers pend
+ *       on the same handshake semaphore and take commands from the same queue.
  *
  *  \return Execution status, see \ref CFEReturnCodes
  *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
@@ -95,16 +97,194 @@ void FM_ChildLoop(void);
  *  \brief Child Task Command Queue Processor Function
  *
  *  \par Description
- *       This function routes control to the appropriate child task command
- *       handler.  After the command handler has finished, this function then
- *       updates the queue access variables to point to the next queue entry.
+ *       This function removes the next queue entry from the interactive
+ *       lane (or from the bulk lane when the interactive lane is empty),
+ *       unpacks the entry into the calling worker's data and then routes
+ *       control to the appropriate child task command handler.  When both
+ *       lanes are empty, the next command is read from the pending commands
+ *       file instead.  After the command handler has finished, this function
+ *       decrements the queue count for commands taken from the queue.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       The queue count includes commands that are still executing, so a
+ *       queue entry is not reused until its command has completed.
  *
- *  \sa #FM_ChildQueueEntry_t, #FM_ChildTask
+ *  \sa #FM_ChildQueueEntry_t, #FM_QueueLanePop, #FM_QueuePendingPop, #FM_ChildTask
  */
 void FM_ChildProcess(void);
 
+/**
+ *  \brief Child Task Get Worker Data Function
+ *
+ *  \par Description
+ *       This function returns the worker data (file I/O buffer, telemetry
+ *       packets and status) that belongs to the calling child task.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       If the caller is not one of the child task workers, the data for
+ *       the first worker is returned.
+ *
+ *  \return Pointer to the worker data for the calling task
+ *
+ *  \sa #FM_ChildWorker_t, #FM_ChildInit
+ */
+FM_ChildWorker_t *FM_ChildGetWorker(void);
+
+/**
+ *  \brief Child Task Job Aborted Function
+ *
+ *  \par Description
+ *       This function searches the list of abort requests for a job ID.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Job ID #FM_CHILD_JOB_ID_NONE is never aborted.
+ *
+ *  \param [in]  JobID Job ID of a child task command
+ *
+ *  \return Boolean job aborted response
+ *  \retval true  Abort has been requested for the job ID
+ *  \retval false Abort has not been requested for the job ID
+ *
+ *  \sa #FM_AbortCmd, #FM_ChildCheckAbort
+ */
+bool FM_ChildIsAborted(uint32 JobID);
+
+/**
+ *  \brief Child Task Check Abort Function
+ *
+ *  \par Description
+ *       This function is called by the child task between blocks of work
+ *       to test whether the command the worker is executing has been
+ *       aborted, either while it was queued or from the abort list.
+ *       The first time the abort is seen the child task warning counter
+ *       is incremented and an event is sent.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The worker abort state is cleared as each command is dequeued.
+ *       The caller must stop the command and remove any partially written
+ *       target file when this function returns true.
+ *
+ *  \param [in]  Worker  Pointer to the worker data for the calling task
+ *  \param [in]  CmdText Text identifying the command being executed
+ *
+ *  \return Boolean command aborted response
+ *  \retval true  Command has been aborted
+ *  \retval false Command has not been aborted
+ *
+ *  \sa #FM_ChildIsAborted, #FM_ChildProcess
+ */
+bool FM_ChildCheckAbort(FM_ChildWorker_t *Worker, const char *CmdText);
+
+/**
+ *  \brief Child Task Report Status Function
+ *
+ *  \par Description
+ *       This function is called by the child task command handlers for
+ *       each error or warning.  The child task error or warning counter is
+ *       incremented, and the job completion status of the calling worker
+ *       is raised to the reported status.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Aborts are counted as warnings.
+ *
+ *  \param [in]  Status Job status, see #FM_JOB_STATUS_WARNING and related
+ *
+ *  \sa #FM_ChildJobComplete
+ */
+void FM_ChildReportStatus(uint8 Status);
+
+/**
+ *  \brief Child Task Job Start Function
+ *
+ *  \par Description
+ *       This function is called as each command is dequeued.  The job
+ *       completion telemetry packet is initialized for the command and
+ *       the time the command waited in the queue is recorded.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]  Worker Pointer to the worker data for the calling task
+ *
+ *  \sa #FM_ChildJobComplete, #FM_JobCompletePkt_t
+ */
+void FM_ChildJobStart(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Child Task Job Complete Function
+ *
+ *  \par Description
+ *       This function is called after each dequeued command has completed,
+ *       been aborted or been rejected.  The command wall time is recorded
+ *       and the job completion telemetry packet is sent.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]  Worker Pointer to the worker data for the calling task
+ *
+ *  \sa #FM_ChildJobStart, #FM_JobCompletePkt_t
+ */
+void FM_ChildJobComplete(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Child Task Job Total Function
+ *
+ *  \par Description
+ *       This function adds the size of a source file to the bytes of file
+ *       data the command being executed is expected to read or write, as
+ *       reported in the job progress telemetry packet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The total is left unchanged if the file size cannot be read.
+ *
+ *  \param [in]  Worker   Pointer to the worker data for the calling task
+ *  \param [in]  Filename Pointer to the source filename
+ *
+ *  \sa #FM_ChildJobProgress, #FM_JobProgressPkt_t
+ */
+void FM_ChildJobTotal(FM_ChildWorker_t *Worker, const char *Filename);
+
+/**
+ *  \brief Child Task Job Bytes Function
+ *
+ *  \par Description
+ *       This function is called for each block of file data read or
+ *       written by the command being executed.  The bytes are added to the
+ *       job completion telemetry, and the job progress telemetry packet is
+ *       sent when the progress interval has passed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called from the same block loops as #FM_ThrottleBytes, or by the
+ *       worker transfer pipeline after a block has been written or CRC'd.
+ *
+ *  \param [in]  Worker Pointer to the worker data for the calling task
+ *  \param [in]  Bytes  Number of bytes in the block
+ *
+ *  \sa #FM_ChildJobProgress, #FM_CHILD_PROGRESS_INTERVAL_MS
+ */
+void FM_ChildJobBytes(FM_ChildWorker_t *Worker, uint32 Bytes);
+
+/**
+ *  \brief Child Task Job Progress Function
+ *
+ *  \par Description
+ *       This function sends the job progress telemetry packet for the
+ *       command being executed.  The throughput is measured since the
+ *       previous progress packet, and the time remaining is estimated from
+ *       the throughput and the expected job total.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The time remaining is #FM_JOB_TIME_UNKNOWN when the job total is
+ *       not known or no data has moved since the previous packet.
+ *
+ *  \param [in]  Worker  Pointer to the worker data for the calling task
+ *  \param [in]  Elapsed Time since the previous progress packet (msec)
+ *
+ *  \sa #FM_ChildJobBytes, #FM_JobProgressPkt_t
+ */
+void FM_ChildJobProgress(FM_ChildWorker_t *Worker, int64 Elapsed);
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM child task command handlers                                  */
@@ -185,9 +365,15 @@ void FM_ChildDeleteCmd(const FM_ChildQueueEntry_t *CmdArgs);
  *  \par Description
  *       This function is invoked when the FM child task has been granted the child
  *       task handshake semaphore and the child task command queue contains arguments
- *       that signal a delete all files from a directory command.
+ *       that signal a delete all files from a directory command.  The names in
+ *       the directory are listed into the worker buffer in batches, then each
+ *       batch is deleted.  Open files are found in one list of open files made
+ *       when the command starts.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       The directory is read once and is not rewound after each delete.  A
+ *       file opened after the command starts is not found in the open file
+ *       list, and its delete is left to the file system.
  *
  *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
  *       queue which contains the arguments necessary to process this command.
@@ -336,6 +522,156 @@ void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs);
  */
 void FM_ChildSetPermissionsCmd(const FM_ChildQueueEntry_t *CmdArgs);
 
+/**
+ *  \brief Child Task Copy Directory Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a copy directory command.  The source directory tree is walked
+ *       one level at a time, creating each target directory and copying each closed
+ *       file, down to #FM_CHILD_DIR_TREE_DEPTH levels.  Open files, entries with names
+ *       too long for the target and deeper subdirectories are skipped and counted.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The copy stops at the first failure or abort, directories and files
+ *       already copied are kept.
+ *
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_CopyDirCmd_t
+ */
+void FM_ChildCopyDirCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Delete Directory Tree Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a delete directory tree command.  The directory tree is walked
+ *       one level at a time, down to #FM_CHILD_DIR_TREE_DEPTH levels, removing each
+ *       closed file and then each directory once all of its entries have been read.
+ *       Open files, entries that cannot be removed and deeper subdirectories are
+ *       skipped and counted.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Directories are not re-read after each removal.  A directory that still
+ *       holds an entry, skipped or not, fails to be removed and is counted as
+ *       skipped.  An abort leaves the directories that were being walked.
+ *
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_DeleteTreeCmd_t
+ */
+void FM_ChildDeleteTreeCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Delete Filtered Files Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a delete filtered files command.  The directory is read once.
+ *       Each name that matches the pattern is checked against the age and size
+ *       ranges, if any, and each selected closed file is deleted.  Selected open
+ *       files, subdirectories and files that cannot be deleted are skipped and
+ *       counted.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The directory is not re-read after each delete.  Ages are measured
+ *       against the local time when the command starts.
+ *
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_DeleteFilterCmd_t, #FM_ChildPatternMatch
+ */
+void FM_ChildDeleteFilterCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Concatenate File List Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a concatenate file list command.  The list is read once to
+ *       check every source, then again while each source is appended to the
+ *       target file in list order.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The target file is written once, sequentially.  A resumed command skips
+ *       the list entries before the checkpoint entry.
+ *
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_ConcatListCmd_t, #FM_ChildConcatListCheck
+ */
+void FM_ChildConcatListCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Split File Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a split file command.  The source file is read once, and each
+ *       block is written to the segment file that holds its offset.  The manifest
+ *       file lists the offset, size and CRC of every segment.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Every segment filename is checked before the first segment is written.
+ *       After an error or abort the segment files and the manifest are removed.
+ *
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_SplitCmd_t, #FM_ChildSplitSegment
+ */
+void FM_ChildSplitCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Preallocate File Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a preallocate file command.  The file is created if needed and
+ *       extended to the commanded size, with fallocate if it is available or by
+ *       writing zero blocks otherwise.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A file that is already at least the commanded size is not changed.
+ *
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_PreallocateCmd_t, #FM_ChildPreallocateWrite
+ */
+void FM_ChildPreallocateCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Truncate File Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a truncate file command.  The file is shortened in place to the
+ *       commanded size.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The commanded size may not be greater than the current file size.
+ *
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_TruncateCmd_t, #FM_ChildTruncateFile
+ */
+void FM_ChildTruncateCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM child task utility functions                                 */
@@ -382,6 +718,179 @@ bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, co
 void FM_ChildDirListFileLoop(osal_id_t DirId, osal_id_t FileHandle, const char *Directory, const char *DirWithSep,
                              const char *Filename, uint8 GetSizeTimeMode);
 
+/**
+ *  \brief Child Task Copy Directory Open Level Utility Function
+ *
+ *  \par Description
+ *       This function creates the target directory, unless it already exists,
+ *       and opens the source directory for the next level of a copy directory
+ *       command.  A path separator is then appended to both directory names.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Failures increment the child task command error counter and send
+ *       #FM_COPY_DIR_OS_ERR_EID.  The caller closes the source directory.
+ *
+ *  \param [in]     CmdText  Text identifying the command being executed
+ *  \param [in,out] Source   Source directory name, #OS_MAX_PATH_LEN bytes
+ *  \param [in,out] Target   Target directory name, #OS_MAX_PATH_LEN bytes
+ *  \param [out]    DirIdPtr Set to the handle of the open source directory
+ *
+ *  \return Boolean open response
+ *  \retval true  Target directory exists and source directory is open
+ *  \retval false Create or open failed
+ *
+ *  \sa #FM_ChildCopyDirCmd
+ */
+bool FM_ChildCopyDirOpen(const char *CmdText, char *Source, char *Target, osal_id_t *DirIdPtr);
+
+/**
+ *  \brief Child Task Copy Directory File Utility Function
+ *
+ *  \par Description
+ *       This function copies one file of a copy directory command with the
+ *       copy engine, without a CRC or read back.  The worker copy checkpoint
+ *       describes the file as a Copy File command of the same job, so that a
+ *       processor reset resumes the copy of that file only.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The partial target file is removed after a failure or abort.
+ *
+ *  \param [in] Worker  Pointer to the worker data for the calling task
+ *  \param [in] CmdText Text identifying the command being executed
+ *  \param [in] Source  Source filename
+ *  \param [in] Target  Target filename
+ *
+ *  \return Boolean copy response
+ *  \retval true  Source file copied to the target file
+ *  \retval false Copy failed or was aborted
+ *
+ *  \sa #FM_ChildCopyDirCmd, #FM_ChildCopySegment
+ */
+bool FM_ChildCopyDirFile(FM_ChildWorker_t *Worker, const char *CmdText, const char *Source, const char *Target);
+
+/**
+ *  \brief Child Task Copy Resume Utility Function
+ *
+ *  \par Description
+ *       This function is invoked by the copy and concatenate command handlers
+ *       after #FM_CheckpointStart.  When the worker copy checkpoint has target
+ *       data from before a processor reset, the partial target file is read
+ *       back and its CRC compared with the checkpoint, and the current source
+ *       file size and time are compared with the values recorded when its copy
+ *       started.  If either test fails the checkpoint is reset so that the copy
+ *       starts over from the beginning.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A new command has a zero checkpoint and this function has no effect.
+ *
+ *  \param [in] Worker  Pointer to the worker data for the calling task
+ *  \param [in] CmdText Text identifying the command being executed
+ *
+ *  \sa #FM_ChildCopySegment
+ */
+void FM_ChildCopyResume(FM_ChildWorker_t *Worker, const char *CmdText);
+
+/**
+ *  \brief Child Task Copy Segment Utility Function
+ *
+ *  \par Description
+ *       This function is the chunked copy engine used by the copy and
+ *       concatenate command handlers.  The current source file of the worker
+ *       copy checkpoint (Source1 or Source2, per the checkpoint segment) is
+ *       copied to the checkpoint target file in blocks of the worker block
+ *       size, starting at the checkpoint source and target offsets.  The
+ *       target file is created when the target offset is zero.  The checkpoint
+ *       is advanced after every block and saved every
+ *       #FM_CHILD_CHECKPOINT_INTERVAL * #FM_CHILD_FILE_BLOCK_SIZE bytes.  The
+ *       copy stops early if the command is aborted, and each block is paced
+ *       by the child task I/O throttle.  Blocks are written by the worker transfer pipeline, so the
+ *       next block is read while the previous one is written.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Failures increment the child task command error counter and send the
+ *       matching event from the caller's event table.  The caller removes the
+ *       target file after a failure if the target file was opened.
+ *
+ *  \param [in]  Worker        Pointer to the worker data for the calling task
+ *  \param [in]  CmdText       Text identifying the command being executed
+ *  \param [in]  Events        Event ID's to report for each failure
+ *  \param [out] OpenedTgtFile Set to true if the target file was opened
+ *
+ *  \return Boolean copy success response
+ *  \retval true  Source file copied to the target file
+ *  \retval false Copy failed or was aborted
+ *
+ *  \sa #FM_ChildCopyResume, #FM_CheckpointUpdate, #FM_PipelineSubmit
+ */
+bool FM_ChildCopySegment(FM_ChildWorker_t *Worker, const char *CmdText, const FM_ChildCopyEvents_t *Events,
+                         bool *OpenedTgtFile);
+
+/**
+ *  \brief Child Task Copy Read Back Utility Function
+ *
+ *  \par Description
+ *       This function reads back the target file of the worker copy
+ *       checkpoint through the worker transfer pipeline and computes its
+ *       CRC, using the checkpoint CRC type.  The target file CRC is compared
+ *       with the CRC of the copied data in the job completion telemetry
+ *       packet, and both are reported there.  The read back stops early if
+ *       the command is aborted, and each block is paced by the child task
+ *       I/O throttle.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called after #FM_ChildCopySegment has copied the whole file with a
+ *       CRC type other than #FM_IGNORE_CRC.  Failures increment the child
+ *       task command error counter and send the read back event from the
+ *       caller's event table.
+ *
+ *  \param [in]  Worker  Pointer to the worker data for the calling task
+ *  \param [in]  CmdText Text identifying the command being executed
+ *  \param [in]  Events  Event ID's to report for each failure
+ *
+ *  \return Boolean read back response
+ *  \retval true  Target file CRC matches the copied data CRC
+ *  \retval false Read back failed, was aborted or the CRC's do not match
+ *
+ *  \sa #FM_ChildCopyCmd, #FM_ChildMoveCmd, #FM_PipelineSubmit
+ */
+bool FM_ChildVerifyTarget(FM_ChildWorker_t *Worker, const char *CmdText, const FM_ChildCopyEvents_t *Events);
+
+#ifdef FM_INCLUDE_KERNEL_COPY
+
+/**
+ *  \brief Child Task Kernel Copy Utility Function
+ *
+ *  \par Description
+ *       This function is the Linux kernel copy backend of #FM_ChildCopySegment.
+ *       The source and target files are opened again by local path, and the
+ *       source file is copied to the target file starting at the checkpoint
+ *       offsets with copy_file_range, or with sendfile if copy_file_range is
+ *       not supported.  Each chunk of #FM_CHILD_KERNEL_COPY_SIZE bytes is
+ *       added to the checkpoint and the job progress, checked for an abort
+ *       and paced by the child task I/O throttle.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller has opened the source and target files and verified the
+ *       checkpoint offsets.  If neither call copies any data, nothing has
+ *       been changed and the caller copies the file with the portable loop.
+ *
+ *  \param [in]  Worker     Pointer to the worker data for the calling task
+ *  \param [in]  CmdText    Text identifying the command being executed
+ *  \param [in]  Events     Event ID's to report for each failure
+ *  \param [in]  Source     Source filename
+ *  \param [out] CopyResult Set to true if the source file was copied to the target file
+ *
+ *  \return Boolean kernel copy response
+ *  \retval true  Copy completed, failed or aborted in the kernel, see CopyResult
+ *  \retval false Kernel copy not available, nothing was copied
+ *
+ *  \sa #FM_ChildCopySegment
+ */
+bool FM_ChildKernelCopy(FM_ChildWorker_t *Worker, const char *CmdText, const FM_ChildCopyEvents_t *Events,
+                        const char *Source, bool *CopyResult);
+
+#endif
+
 /**
  *  \brief Child Task File Size Time and Mode Utility Function
  *
@@ -402,6 +911,24 @@ void FM_ChildDirListFileLoop(osal_id_t DirId, osal_id_t FileHandle, const char *
  */
 int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileTime, uint32 *FileMode);
 
+/**
+ *  \brief Child Task File Allocated Size Utility Function
+ *
+ *  \par Description
+ *       This function is invoked to query the number of bytes allocated to a
+ *       file on its file system when processing the Get File Information
+ *       command.  A sparse file has fewer bytes allocated than its size.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only available when #FM_INCLUDE_ALLOCATED_SIZE is defined.
+ *
+ *  \param [in] Filename Pointer to the file name.
+ *
+ *  \return Allocated size in bytes
+ *  \retval #FM_FILE_SIZE_UNKNOWN Not available, or too large to report
+ */
+uint32 FM_ChildAllocatedSize(const char *Filename);
+
 /**
  *  \brief Child Task Sleep and Stat Utility Function
  *
@@ -409,21 +936,292 @@ int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileT
  *       This function is invoked to query the last modify time, current size and mode (permissions) for
  *       each directory entry when processing either the Get Directory List to File
  *       or Get Directory List to Packet commands.
- *       However it only will sleep if FM_CHILD_STAT_SLEEP_FILECOUNT reaches zero and call FM_ChildSizeTimeMode if
- *       getSizeTimeMode is TRUE, otherwise this function has no effect
+ *       It only calls FM_ChildSizeTimeMode if getSizeTimeMode is TRUE, after taking
+ *       an OS_stat token from the child task I/O throttle, otherwise this function
+ *       zeroes the entry size, time and mode
  *
  *  \par Assumptions, External Events, and Notes:
+ *       The throttle sleeps when the OS_stat rate limit has been reached.
  *
  *  \param [in] Filename        Pointer to the combined directory and entry names.
  *  \param [out] DirListData    Pointer to the data containing the current entry size, last modify time, and mode
- *  \param [out] FilesTillSleep If this is zero the function will sleep for #FM_CHILD_STAT_SLEEP_MS and reset it to
- *                              #FM_CHILD_STAT_SLEEP_FILECOUNT. Otherwise it will subtract 1
  *  \param [in] GetSizeTimeMode Whether this function should call FM_ChildSizeTimeMode
  *
- *  \return Execution status, see \ref CFEReturnCodes and \ref OSReturnCodes
- *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ *  \sa #FM_ThrottleStats
+ */
+void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, bool GetSizeTimeMode);
+
+/**
+ *  \brief Child Task Pattern Match Utility Function
+ *
+ *  \par Description
+ *       This function tests a directory entry name against a filename pattern.
+ *       In the pattern '*' matches any sequence of characters, including none,
+ *       and '?' matches any single character.  Every other character matches
+ *       itself.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Both strings are terminated.  A failed match after a '*' retries from
+ *       that star only, so no name is compared more than once per star.
+ *
+ *  \param [in] Pattern Pointer to the filename pattern
+ *  \param [in] Name    Pointer to the directory entry name
+ *
+ *  \return Match result
+ *  \retval true  Name matches the pattern
+ *  \retval false Name does not match the pattern
+ *
+ *  \sa #FM_ChildDeleteFilterCmd
+ */
+bool FM_ChildPatternMatch(const char *Pattern, const char *Name);
+
+/**
+ *  \brief Child Task Concatenate Source List Check Utility Function
+ *
+ *  \par Description
+ *       This function reads the source list named by the worker checkpoint and
+ *       checks that every listed source is a closed file other than the target.
+ *       The size of each source is added to the expected job total.  When the
+ *       command is resumed, the checkpoint entry must still name the source
+ *       that was being appended.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Each source status query is paced by the child task I/O throttle.
+ *
+ *  \param [in]  Worker     Pointer to the worker executing the command
+ *  \param [in]  CmdText    Command name used in event text
+ *  \param [out] EntryCount Number of sources named by the list
+ *
+ *  \return Check result
+ *  \retval true  Every listed source may be appended
+ *  \retval false List cannot be used, an error event has been sent
+ *
+ *  \sa #FM_ChildConcatListCmd
+ */
+bool FM_ChildConcatListCheck(FM_ChildWorker_t *Worker, const char *CmdText, uint32 *EntryCount);
+
+/**
+ *  \brief Child Task List File Open Utility Function
+ *
+ *  \par Description
+ *       This function opens a text file that names one file per line, and
+ *       resets the list reader.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller closes the list file handle after a successful open.
+ *
+ *  \param [out] ListFile Pointer to the list reader
+ *  \param [in]  Filename Pointer to the list filename
+ *
+ *  \return OS_OpenCreate result, see \ref OSReturnCodes
+ *
+ *  \sa #FM_ChildListNext
+ */
+int32 FM_ChildListOpen(FM_ChildListFile_t *ListFile, const char *Filename);
+
+/**
+ *  \brief Child Task List File Read Utility Function
+ *
+ *  \par Description
+ *       This function returns the next name in a list file.  The file is read
+ *       ahead in buffer sized pieces, so most names need no OS_read.  Empty
+ *       lines are skipped, and a carriage return before the newline is not
+ *       part of the name.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The name buffer holds at least OS_MAX_PATH_LEN bytes.
+ *
+ *  \param [in]  ListFile Pointer to the list reader
+ *  \param [out] Name     Pointer to the buffer for the next name
+ *
+ *  \return Length of the name, 0 at the end of the list, or a negative error
+ *  \retval #OS_FS_ERR_PATH_TOO_LONG Line does not fit in a filename
+ *
+ *  \sa #FM_ChildListOpen
+ */
+int32 FM_ChildListNext(FM_ChildListFile_t *ListFile, char *Name);
+
+/**
+ *  \brief Child Task Split Segment Check Utility Function
+ *
+ *  \par Description
+ *       This function computes the number of segments needed to split the
+ *       source file, and checks that the count is within the limit and that
+ *       every segment filename is a valid path that is not in use.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Each segment filename status query is paced by the child task I/O
+ *       throttle.
+ *
+ *  \param [in]  CmdText      Command name used in event text
+ *  \param [in]  Target       Pointer to the manifest filename
+ *  \param [in]  SourceSize   Size of the source file (bytes)
+ *  \param [in]  SegmentSize  Size of each segment file (bytes)
+ *  \param [out] SegmentCount Number of segment files needed
+ *
+ *  \return Check result
+ *  \retval true  Every segment file may be created
+ *  \retval false Segments cannot be created, an error event has been sent
+ *
+ *  \sa #FM_ChildSplitCmd, #FM_CHILD_SPLIT_MAX_SEGMENTS
+ */
+bool FM_ChildSplitCheck(const char *CmdText, const char *Target, uint32 SourceSize, uint32 SegmentSize,
+                        uint32 *SegmentCount);
+
+/**
+ *  \brief Child Task Split Segment Write Utility Function
+ *
+ *  \par Description
+ *       This function creates one segment file and writes the next segment
+ *       entry size bytes of the source file to it through the transfer
+ *       pipeline.  The CRC of the segment, using the checkpoint CRC type, is
+ *       stored in the segment entry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The source file position is the segment entry offset.  A partial
+ *       segment file is removed after an error or abort.
+ *
+ *  \param [in]     Worker        Pointer to the worker executing the command
+ *  \param [in]     CmdText       Command name used in event text
+ *  \param [in]     FileHandleSrc Source file handle
+ *  \param [in]     Name          Pointer to the segment filename
+ *  \param [in,out] Entry         Pointer to the manifest entry of the segment
+ *
+ *  \return Write result
+ *  \retval true  Segment file is complete
+ *  \retval false Segment failed or was aborted, an error event may have been sent
+ *
+ *  \sa #FM_ChildSplitCmd
+ */
+bool FM_ChildSplitSegment(FM_ChildWorker_t *Worker, const char *CmdText, osal_id_t FileHandleSrc, const char *Name,
+                          FM_SplitManifestEntry_t *Entry);
+
+/**
+ *  \brief Child Task Split Segment Filename Utility Function
+ *
+ *  \par Description
+ *       This function builds the filename of a segment by adding the segment
+ *       number, as ".NNN", to the manifest filename.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The name buffer holds at least OS_MAX_PATH_LEN bytes.
+ *
+ *  \param [out] Name    Pointer to the buffer for the segment filename
+ *  \param [in]  Target  Pointer to the manifest filename
+ *  \param [in]  Segment Segment number, starting at zero
+ *
+ *  \return Filename result
+ *  \retval true  Segment filename fits in a path
+ *  \retval false Segment filename was truncated
+ *
+ *  \sa #FM_ChildSplitCheck
+ */
+bool FM_ChildSplitName(char *Name, const char *Target, uint32 Segment);
+
+/**
+ *  \brief Child Task Preallocate Zero Block Write Utility Function
+ *
+ *  \par Description
+ *       This function extends an open file from its current size to the
+ *       commanded size by writing zero blocks through the transfer pipeline.
+ *       Blocks are paced by the child task I/O throttle and the command may
+ *       be aborted between blocks.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Zero blocks already written are left in the file after an error or
+ *       abort.
+ *
+ *  \param [in] Worker     Pointer to the worker executing the command
+ *  \param [in] CmdText    Command name used in event text
+ *  \param [in] FileHandle File handle, opened for writing
+ *  \param [in] Filename   Pointer to the filename
+ *  \param [in] Offset     Current file size (bytes)
+ *  \param [in] FileSize   Commanded file size (bytes), greater than the offset
+ *
+ *  \return Write result
+ *  \retval true  File has been extended to the commanded size
+ *  \retval false Write failed or was aborted, an error event may have been sent
+ *
+ *  \sa #FM_ChildPreallocateCmd
+ */
+bool FM_ChildPreallocateWrite(FM_ChildWorker_t *Worker, const char *CmdText, osal_id_t FileHandle,
+                              const char *Filename, uint32 Offset, uint32 FileSize);
+
+#ifdef FM_INCLUDE_FILE_ALLOCATE
+
+/**
+ *  \brief Child Task File Allocate Utility Function
+ *
+ *  \par Description
+ *       This function is the Linux backend of #FM_ChildPreallocateCmd.  The
+ *       file is opened again by local path and its space, up to the commanded
+ *       size, is reserved with fallocate without writing file data.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller has created the file.  If the file system does not support
+ *       fallocate, nothing has been changed and the caller writes zero blocks.
+ *
+ *  \param [in]  Worker         Pointer to the worker executing the command
+ *  \param [in]  CmdText        Command name used in event text
+ *  \param [in]  Filename       Pointer to the filename
+ *  \param [in]  Offset         Current file size (bytes)
+ *  \param [in]  FileSize       Commanded file size (bytes)
+ *  \param [out] AllocateResult Set to true if the file space was reserved
+ *
+ *  \return Boolean file allocate response
+ *  \retval true  Space was reserved or fallocate failed, see AllocateResult
+ *  \retval false fallocate not available, nothing was changed
+ *
+ *  \sa #FM_ChildPreallocateCmd
+ */
+bool FM_ChildFileAllocate(FM_ChildWorker_t *Worker, const char *CmdText, const char *Filename, uint32 Offset,
+                          uint32 FileSize, bool *AllocateResult);
+
+#endif
+
+/**
+ *  \brief Child Task Truncate File Utility Function
+ *
+ *  \par Description
+ *       This function shortens a closed file in place to the commanded size.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only performed when #FM_INCLUDE_FILE_TRUNCATE is defined, OSAL has no
+ *       truncate call.
+ *
+ *  \param [in] Filename Pointer to the filename
+ *  \param [in] FileSize File size after truncation (bytes)
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS             \copybrief OS_SUCCESS
+ *  \retval #OS_ERR_NOT_IMPLEMENTED Built without #FM_INCLUDE_FILE_TRUNCATE
+ */
+int32 FM_ChildTruncateFile(const char *Filename, uint32 FileSize);
+
+/**
+ *  \brief Child Task Link File Utility Function
+ *
+ *  \par Description
+ *       This function makes the target file share the source file data,
+ *       either as a hard link to the source file or as a copy-on-write
+ *       clone of its data.  An existing target file is replaced, unless it
+ *       is already the source file under another name, which is left as is.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only performed when #FM_INCLUDE_FILE_LINK is defined, OSAL has no
+ *       link or clone call.  No event is sent, the caller copies the file
+ *       data when the link cannot be made.
+ *
+ *  \param [in] Source Pointer to the source filename
+ *  \param [in] Target Pointer to the target filename
+ *  \param [in] Link   #FM_COPY_LINK_HARD or #FM_COPY_LINK_CLONE
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS             \copybrief OS_SUCCESS
+ *  \retval #OS_ERR_NOT_IMPLEMENTED Built without #FM_INCLUDE_FILE_LINK
+ *
+ *  \sa #FM_ChildCopyCmd
  */
-void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep,
-                       bool GetSizeTimeMode);
+int32 FM_ChildLinkFile(const char *Source, const char *Target, uint8 Link);
 
 #endif
@@ -27,6 +27,8 @@
 
 #include "cfe.h"
 #include "fm_msg.h"
+#include "fm_msgdefs.h"
+#include "fm_queue.h"
 #include "fm_cmd_utils.h"
 #include "fm_child.h"
 #include "fm_perfids.h"
@@ -35,8 +37,26 @@
 #include <string.h>
 #include <ctype.h>
 
-static uint32 OpenFileCount = 0;
-static bool   FileIsOpen    = false;
+/*
+** Open file list passed to the OSAL object callback, a worker lists the
+**  open files while the FM main task counts them for housekeeping
+*/
+typedef struct
+{
+    FM_OpenFilesEntry_t *List;  /**< \brief List to fill, NULL to count the open files only */
+    uint32               Count; /**< \brief Number of open files found */
+    uint32               Max;   /**< \brief Number of entries the list holds */
+} FM_OpenFilesSearch_t;
+
+/*
+** Filename search passed to the OSAL object callback, several workers and
+**  the FM main task may search at the same time
+*/
+typedef struct
+{
+    const char *Filename; /**< \brief Filename to look for */
+    bool        IsOpen;   /**< \brief Set when an open file has the filename */
+} FM_FilenameSearch_t;
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -87,6 +107,29 @@ bool FM_VerifyOverwrite(uint16 Overwrite, uint32 EventID, const char *CmdText)
 
 } /* End FM_VerifyOverwrite */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- verify CRC type is not invalid           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_VerifyCRCType(uint32 CRCType, uint32 EventID, const char *CmdText)
+{
+    bool FunctionResult = true;
+
+    /* Acceptable values are ignore and the cFE CRC algorithms */
+    if ((CRCType != FM_IGNORE_CRC) && (CRCType != CFE_MISSION_ES_CRC_8) && (CRCType != CFE_MISSION_ES_CRC_16) &&
+        (CRCType != CFE_MISSION_ES_CRC_32))
+    {
+        CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_ERROR, "%s error: invalid CRC type = %d", CmdText, (int)CRCType);
+
+        FunctionResult = false;
+    }
+
+    return (FunctionResult);
+
+} /* End FM_VerifyCRCType */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM utility function -- get open files data                      */
@@ -95,42 +138,50 @@ bool FM_VerifyOverwrite(uint16 Overwrite, uint32 EventID, const char *CmdText)
 
 static void LoadOpenFileData(osal_id_t ObjId, void *CallbackArg)
 {
-    FM_OpenFilesEntry_t *OpenFilesData = (FM_OpenFilesEntry_t *)CallbackArg;
-    OS_task_prop_t       TaskInfo;
-    OS_file_prop_t       FdProp;
+    FM_OpenFilesSearch_t *Search = (FM_OpenFilesSearch_t *)CallbackArg;
+    OS_task_prop_t        TaskInfo;
+    OS_file_prop_t        FdProp;
 
     memset(&FdProp, 0, sizeof(FdProp));
 
     if (OS_IdentifyObject(ObjId) == OS_OBJECT_TYPE_OS_STREAM)
     {
-        if (OpenFilesData != (FM_OpenFilesEntry_t *)NULL)
+        if (Search->List == (FM_OpenFilesEntry_t *)NULL)
+        {
+            Search->Count++;
+        }
+        else if (Search->Count < Search->Max)
         {
             if (OS_FDGetInfo(ObjId, &FdProp) == OS_SUCCESS)
             {
-                strncpy(OpenFilesData[OpenFileCount].LogicalName, FdProp.Path, OS_MAX_PATH_LEN);
+                strncpy(Search->List[Search->Count].LogicalName, FdProp.Path, OS_MAX_PATH_LEN);
 
                 /* Get the name of the application that opened the file */
                 memset(&TaskInfo, 0, sizeof(TaskInfo));
 
                 if (OS_TaskGetInfo(FdProp.User, &TaskInfo) == OS_SUCCESS)
                 {
-                    strncpy(OpenFilesData[OpenFileCount].AppName, (char *)TaskInfo.name, OS_MAX_API_NAME);
+                    strncpy(Search->List[Search->Count].AppName, (char *)TaskInfo.name, OS_MAX_API_NAME);
                 }
             }
-        }
 
-        OpenFileCount++;
+            Search->Count++;
+        }
     }
 
 } /* End LoadOpenFileData() */
 
 uint32 FM_GetOpenFilesData(const FM_OpenFilesEntry_t *OpenFilesData)
 {
-    OpenFileCount = 0;
+    FM_OpenFilesSearch_t Search;
+
+    Search.List  = (FM_OpenFilesEntry_t *)OpenFilesData;
+    Search.Count = 0;
+    Search.Max   = OS_MAX_NUM_OPEN_FILES;
 
-    OS_ForEachObject(OS_OBJECT_CREATOR_ANY, LoadOpenFileData, (void *)OpenFilesData);
+    OS_ForEachObject(OS_OBJECT_CREATOR_ANY, LoadOpenFileData, &Search);
 
-    return (OpenFileCount);
+    return (Search.Count);
 
 } /* End FM_GetOpenFilesData */
 
@@ -142,8 +193,8 @@ uint32 FM_GetOpenFilesData(const FM_OpenFilesEntry_t *OpenFilesData)
 
 static void SearchOpenFileData(osal_id_t ObjId, void *CallbackArg)
 {
-    char *         Fname = (char *)CallbackArg;
-    OS_file_prop_t FdProp;
+    FM_FilenameSearch_t *Search = (FM_FilenameSearch_t *)CallbackArg;
+    OS_file_prop_t       FdProp;
 
     memset(&FdProp, 0, sizeof(FdProp));
 
@@ -154,9 +205,9 @@ static void SearchOpenFileData(osal_id_t ObjId, void *CallbackArg)
         /* If the FD table entry is valid - then the file is open */
         if (OS_FDGetInfo(ObjId, &FdProp) == OS_SUCCESS)
         {
-            if (strcmp(Fname, FdProp.Path) == 0)
+            if (strcmp(Search->Filename, FdProp.Path) == 0)
             {
-                FileIsOpen = true;
+                Search->IsOpen = true;
             }
         }
     }
@@ -165,12 +216,14 @@ static void SearchOpenFileData(osal_id_t ObjId, void *CallbackArg)
 
 uint32 FM_GetFilenameState(char *Filename, uint32 BufferSize, bool FileInfoCmd)
 {
-    os_fstat_t FileStatus;
-    uint32     FilenameState   = FM_NAME_IS_INVALID;
-    bool       FilenameIsValid = false;
-    int32      StringLength    = 0;
+    os_fstat_t          FileStatus;
+    FM_FilenameSearch_t Search;
+    uint32              FilenameState   = FM_NAME_IS_INVALID;
+    bool                FilenameIsValid = false;
+    int32               StringLength    = 0;
 
     memset(&FileStatus, 0, sizeof(FileStatus));
+    memset(&Search, 0, sizeof(Search));
 
     if (Filename != NULL)
     {
@@ -205,12 +258,13 @@ uint32 FM_GetFilenameState(char *Filename, uint32 BufferSize, bool FileInfoCmd)
             else
             {
                 /* Filename is a file, but is it open? */
-                FilenameState = FM_NAME_IS_FILE_CLOSED;
-                FileIsOpen    = false;
+                FilenameState   = FM_NAME_IS_FILE_CLOSED;
+                Search.Filename = Filename;
+                Search.IsOpen   = false;
 
-                OS_ForEachObject(OS_OBJECT_CREATOR_ANY, SearchOpenFileData, Filename);
+                OS_ForEachObject(OS_OBJECT_CREATOR_ANY, SearchOpenFileData, &Search);
 
-                if (FileIsOpen == true)
+                if (Search.IsOpen == true)
                 {
                     FilenameState = FM_NAME_IS_FILE_OPEN;
                 }
@@ -243,6 +297,52 @@ uint32 FM_GetFilenameState(char *Filename, uint32 BufferSize, bool FileInfoCmd)
 
 } /* End FM_GetFilenameState */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- query filename state from open file list */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_GetFilenameStateFromList(const char *Filename, uint32 BufferSize, const FM_OpenFilesEntry_t *OpenFiles,
+                                   uint32 OpenCount)
+{
+    os_fstat_t FileStatus;
+    uint32     FilenameState = FM_NAME_IS_INVALID;
+    uint32     OpenIndex     = 0;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+
+    /* Verify that Filename is not empty and has a terminator */
+    if ((Filename != NULL) && (BufferSize > 0) && (Filename[0] != '\0') &&
+        (memchr(Filename, '\0', BufferSize) != NULL))
+    {
+        if (OS_stat(Filename, &FileStatus) != OS_SUCCESS)
+        {
+            FilenameState = FM_NAME_IS_NOT_IN_USE;
+        }
+        else if (OS_FILESTAT_ISDIR(FileStatus))
+        {
+            FilenameState = FM_NAME_IS_DIRECTORY;
+        }
+        else
+        {
+            FilenameState = FM_NAME_IS_FILE_CLOSED;
+
+            /* The caller's list replaces a search of every OSAL object */
+            for (OpenIndex = 0; (OpenIndex < OpenCount) && (FilenameState == FM_NAME_IS_FILE_CLOSED); OpenIndex++)
+            {
+                if (strncmp(Filename, OpenFiles[OpenIndex].LogicalName, OS_MAX_PATH_LEN) == 0)
+                {
+                    FilenameState = FM_NAME_IS_FILE_OPEN;
+                }
+            }
+        }
+    }
+
+    return (FilenameState);
+
+} /* End FM_GetFilenameStateFromList */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM utility function -- verify state is not invalid              */
@@ -524,10 +624,39 @@ bool FM_VerifyDirNoExist(char *Name, uint32 BufferSize, uint32 EventID, const ch
 
 bool FM_VerifyChildTask(uint32 EventID, const char *CmdText)
 {
-    bool Result = false;
+    bool  Result         = false;
+    bool  QueueAvailable = false;
+    uint8 QueueIndex     = 0;
+    uint8 i              = 0;
 
     /* Copy of child queue count that child task cannot change */
-    uint8 LocalQueueCount = FM_GlobalData.ChildQueueCount;
+    uint8 LocalQueueCount = FM_ATOMIC_LOAD(&FM_GlobalData.ChildQueueCount);
+
+    /*
+    ** Commands leave the queue in lane order rather than in queue order,
+    **  so search for a queue entry that is not waiting in a lane...
+    */
+    if (FM_GlobalData.ChildWriteIndex < FM_CHILD_QUEUE_DEPTH)
+    {
+        for (i = 0; i < FM_CHILD_QUEUE_DEPTH; i++)
+        {
+            QueueIndex = (FM_GlobalData.ChildWriteIndex + i) % FM_CHILD_QUEUE_DEPTH;
+
+            if (FM_ATOMIC_LOAD(&FM_GlobalData.ChildQueueBusy[QueueIndex]) == false)
+            {
+                FM_GlobalData.ChildWriteIndex = QueueIndex;
+                break;
+            }
+        }
+    }
+
+    /*
+    ** Bulk commands go to the pending commands file while any commands are
+    **  waiting there.  The command lane is not known yet, so the queue is
+    **  only counted as available when nothing is waiting in the file...
+    */
+    QueueAvailable = (LocalQueueCount < FM_CHILD_QUEUE_DEPTH) && (FM_QueuePendingCount() == 0) &&
+                     (FM_QueueArenaHasRoom() == true);
 
     /* Verify child task is active and queue interface is healthy */
     if (!OS_ObjectIdDefined(FM_GlobalData.ChildSemaphore))
@@ -538,15 +667,9 @@ bool FM_VerifyChildTask(uint32 EventID, const char *CmdText)
         /* Child task disabled - cannot add another command */
         Result = false;
     }
-    else if (LocalQueueCount == FM_CHILD_QUEUE_DEPTH)
-    {
-        CFE_EVS_SendEvent((EventID + FM_CHILD_Q_FULL_EID_OFFSET), CFE_EVS_EventType_ERROR,
-                          "%s error: child task queue is full", CmdText);
-
-        /* Queue full - cannot add another command */
-        Result = false;
-    }
-    else if ((LocalQueueCount > FM_CHILD_QUEUE_DEPTH) || (FM_GlobalData.ChildWriteIndex >= FM_CHILD_QUEUE_DEPTH))
+    else if ((LocalQueueCount > FM_CHILD_QUEUE_DEPTH) || (FM_GlobalData.ChildWriteIndex >= FM_CHILD_QUEUE_DEPTH) ||
+             ((LocalQueueCount < FM_CHILD_QUEUE_DEPTH) &&
+              (FM_ATOMIC_LOAD(&FM_GlobalData.ChildQueueBusy[FM_GlobalData.ChildWriteIndex]) == true)))
     {
         CFE_EVS_SendEvent((EventID + FM_CHILD_BROKEN_EID_OFFSET), CFE_EVS_EventType_ERROR,
                           "%s error: child task interface is broken: count = %d, index = %d", CmdText, LocalQueueCount,
@@ -555,9 +678,17 @@ bool FM_VerifyChildTask(uint32 EventID, const char *CmdText)
         /* Queue broken - cannot add another command */
         Result = false;
     }
+    else if ((QueueAvailable == false) && (FM_QueuePendingHasRoom() == false))
+    {
+        CFE_EVS_SendEvent((EventID + FM_CHILD_Q_FULL_EID_OFFSET), CFE_EVS_EventType_ERROR,
+                          "%s error: child task queue is full", CmdText);
+
+        /* Queue and pending commands file full - cannot add another command */
+        Result = false;
+    }
     else
     {
-        memset(&FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex], 0, sizeof(FM_GlobalData.ChildQueue[0]));
+        memset(&FM_GlobalData.ChildQueueEntry, 0, sizeof(FM_GlobalData.ChildQueueEntry));
 
         /* OK to add another command to the queue */
         Result = true;
@@ -567,6 +698,43 @@ bool FM_VerifyChildTask(uint32 EventID, const char *CmdText)
 
 } /* End FM_VerifyChildTask */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- select child task command queue lane     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint8 FM_GetChildQueueLane(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    uint8 Lane = FM_CHILD_LANE_BULK;
+
+    switch (CmdArgs->CommandCode)
+    {
+        case FM_RENAME_CC:
+        case FM_DELETE_CC:
+        case FM_CREATE_DIR_CC:
+        case FM_DELETE_DIR_CC:
+        case FM_SET_FILE_PERM_CC:
+            Lane = FM_CHILD_LANE_INTERACTIVE;
+            break;
+
+        case FM_GET_FILE_INFO_CC:
+            /* Computing a CRC reads the entire file */
+            if (CmdArgs->FileInfoCRC == FM_IGNORE_CRC)
+            {
+                Lane = FM_CHILD_LANE_INTERACTIVE;
+            }
+            break;
+
+        default:
+            Lane = FM_CHILD_LANE_BULK;
+            break;
+    }
+
+    return (Lane);
+
+} /* End of FM_GetChildQueueLane */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM utility function -- invoke child task command processor      */
@@ -575,21 +743,84 @@ bool FM_VerifyChildTask(uint32 EventID, const char *CmdText)
 
 void FM_InvokeChildTask(void)
 {
-    /* Update callers queue index */
-    FM_GlobalData.ChildWriteIndex++;
+    uint8           QueueIndex = FM_GlobalData.ChildWriteIndex;
+    uint8           LaneIndex  = FM_GetChildQueueLane(&FM_GlobalData.ChildQueueEntry);
+    FM_ChildLane_t *Lane       = &FM_GlobalData.ChildLane[LaneIndex];
+    bool            Bypass     = false;
+    bool            Queued     = false;
+
+    /* Assign the next job ID, the abort command uses it to identify this command */
+    FM_GlobalData.ChildLastJobID++;
+    if (FM_GlobalData.ChildLastJobID == FM_CHILD_JOB_ID_NONE)
+    {
+        FM_GlobalData.ChildLastJobID++;
+    }
+    FM_GlobalData.ChildQueueEntry.JobID = FM_GlobalData.ChildLastJobID;
+
+    /* Queue wait time is reported when the command completes */
+    OS_GetLocalTime(&FM_GlobalData.ChildQueueEntry.QueueTime);
+
+    /*
+    ** Bulk commands may not pass commands waiting in the pending commands
+    **  file.  Interactive commands may pass waiting bulk commands, but not
+    **  a waiting interactive command, so each lane keeps its own order...
+    */
+    if (LaneIndex == FM_CHILD_LANE_INTERACTIVE)
+    {
+        Bypass = (FM_QueuePendingHasInteractive() == false);
+    }
+    else
+    {
+        Bypass = (FM_QueuePendingCount() == 0);
+    }
 
-    if (FM_GlobalData.ChildWriteIndex >= FM_CHILD_QUEUE_DEPTH)
+    if ((Bypass == true) && (FM_ATOMIC_LOAD(&FM_GlobalData.ChildQueueCount) < FM_CHILD_QUEUE_DEPTH) &&
+        (QueueIndex < FM_CHILD_QUEUE_DEPTH) && (FM_ATOMIC_LOAD(&FM_GlobalData.ChildQueueBusy[QueueIndex]) == false) &&
+        (FM_QueueEntryPack(QueueIndex, &FM_GlobalData.ChildQueueEntry) == true))
     {
-        FM_GlobalData.ChildWriteIndex = 0;
+        /*
+        ** The queue count includes the new entry before the entry is visible
+        **  to the child task, so the count can never be decremented below zero...
+        */
+        FM_ATOMIC_STORE(&FM_GlobalData.ChildQueueBusy[QueueIndex], true);
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildQueueCount);
+
+        /* Append the queue entry to the selected lane without taking a semaphore */
+        if (FM_QueueLanePush(Lane, QueueIndex) == true)
+        {
+            /* Update callers queue index */
+            FM_GlobalData.ChildWriteIndex++;
+
+            if (FM_GlobalData.ChildWriteIndex >= FM_CHILD_QUEUE_DEPTH)
+            {
+                FM_GlobalData.ChildWriteIndex = 0;
+            }
+
+            Queued = true;
+        }
+        else
+        {
+            /* Cannot happen unless the handshake is broken - try the pending commands file */
+            FM_ATOMIC_STORE(&FM_GlobalData.ChildQueueBusy[QueueIndex], false);
+            FM_ATOMIC_DECREMENT(&FM_GlobalData.ChildQueueCount);
+            FM_QueueEntryRelease(QueueIndex);
+        }
     }
 
-    /* Prevent parent/child updating queue counter at same time */
-    OS_MutSemTake(FM_GlobalData.ChildQueueCountSem);
-    FM_GlobalData.ChildQueueCount++;
-    OS_MutSemGive(FM_GlobalData.ChildQueueCountSem);
+    if (Queued == false)
+    {
+        Queued = FM_QueuePendingPush(&FM_GlobalData.ChildQueueEntry, LaneIndex);
+
+        if (Queued == false)
+        {
+            CFE_EVS_SendEvent(FM_CHILD_PENDING_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Child Task command lost: pending commands file write failed: cc = %d, count = %d",
+                              FM_GlobalData.ChildQueueEntry.CommandCode, (int)FM_QueuePendingCount());
+        }
+    }
 
     /* Does the child task still have a semaphore? */
-    if (OS_ObjectIdDefined(FM_GlobalData.ChildSemaphore))
+    if ((Queued == true) && OS_ObjectIdDefined(FM_GlobalData.ChildSemaphore))
     {
         /* Signal child task to call command handler */
         OS_CountSemGive(FM_GlobalData.ChildSemaphore);
@@ -630,6 +861,47 @@ void FM_AppendPathSep(char *Directory, uint32 BufferSize)
 
 } /* End of FM_AppendPathSep */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- get file system table index for a file   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_GetVolumeIndex(const char *Filename)
+{
+    const FM_TableEntry_t *Entry       = NULL;
+    uint32                 VolumeIndex = FM_TABLE_ENTRY_COUNT;
+    uint32                 MatchLength = 0;
+    uint32                 NameLength  = 0;
+    uint32                 i           = 0;
+
+    if (FM_GlobalData.FreeSpaceTablePtr != (FM_FreeSpaceTable_t *)NULL)
+    {
+        for (i = 0; i < FM_TABLE_ENTRY_COUNT; i++)
+        {
+            Entry = &FM_GlobalData.FreeSpaceTablePtr->FileSys[i];
+
+            /* Table verification ensures in-use names are terminated */
+            if ((Entry->State == FM_TABLE_ENTRY_ENABLED) || (Entry->State == FM_TABLE_ENTRY_DISABLED))
+            {
+                NameLength = strlen(Entry->Name);
+
+                /* Mount point must match whole path components, the most specific one wins */
+                if ((NameLength > MatchLength) && (strncmp(Filename, Entry->Name, NameLength) == 0) &&
+                    ((Filename[NameLength] == '/') || (Filename[NameLength] == '\0') ||
+                     (Entry->Name[NameLength - 1] == '/')))
+                {
+                    VolumeIndex = i;
+                    MatchLength = NameLength;
+                }
+            }
+        }
+    }
+
+    return (VolumeIndex);
+
+} /* End of FM_GetVolumeIndex */
+
 /************************/
 /*  End of File Comment */
 /************************/
@@ -77,6 +77,28 @@ bool FM_IsValidCmdPktLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLeng
  */
 bool FM_VerifyOverwrite(uint16 Overwrite, uint32 EventID, const char *CmdText);
 
+/**
+ *  \brief Verify CRC Type Function
+ *
+ *  \par Description
+ *       This function is invoked from the copy and concatenate command
+ *       handlers to verify the CRC type argument.  Acceptable values are
+ *       #FM_IGNORE_CRC and the cFE CRC types.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in]  CRCType Value being tested
+ *  \param [in]  EventID Error event ID (command specific)
+ *  \param [in]  CmdText Error event text (command specific)
+ *
+ *  \return Boolean valid CRC type response
+ *  \retval true  CRC type argument valid
+ *  \retval false CRC type argument invalid
+ *
+ *  \sa #FM_COPY_CC, #FM_CONCAT_CC
+ */
+bool FM_VerifyCRCType(uint32 CRCType, uint32 EventID, const char *CmdText);
+
 /**
  *  \brief Get Open Files Data Function
  *
@@ -84,6 +106,9 @@ bool FM_VerifyOverwrite(uint16 Overwrite, uint32 EventID, const char *CmdText);
  *       This function creates a list of open files
  *
  *  \par Assumptions, External Events, and Notes:
+ *       The list holds #OS_MAX_NUM_OPEN_FILES entries, open files past
+ *       that are neither listed nor counted.  If the list is NULL the open
+ *       files are only counted.
  *
  *  \param [in]  OpenFilesData pointer to open files data
  *
@@ -120,6 +145,37 @@ uint32 FM_GetOpenFilesData(const FM_OpenFilesEntry_t *OpenFilesData);
  */
 uint32 FM_GetFilenameState(char *Filename, uint32 BufferSize, bool FileInfoCmd);
 
+/**
+ *  \brief Get Filename State From Open File List Function
+ *
+ *  \par Description
+ *       This function determines the state of the input filename in the same
+ *       way as #FM_GetFilenameState, except that open files are found in a
+ *       list made earlier by #FM_GetOpenFilesData rather than by searching
+ *       every OSAL object.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Used by commands that query many files, so that the open files are
+ *       listed once per command.  Files opened after the list was made are
+ *       reported as closed.
+ *
+ *  \param [in]  Filename   Pointer to buffer containing filename
+ *  \param [in]  BufferSize Size of filename character buffer
+ *  \param [in]  OpenFiles  Pointer to the open file list
+ *  \param [in]  OpenCount  Number of entries in the open file list
+ *
+ *  \return File state
+ *  \retval #FM_NAME_IS_INVALID     \copydoc FM_NAME_IS_INVALID
+ *  \retval #FM_NAME_IS_NOT_IN_USE  \copydoc FM_NAME_IS_NOT_IN_USE
+ *  \retval #FM_NAME_IS_FILE_OPEN   \copydoc FM_NAME_IS_FILE_OPEN
+ *  \retval #FM_NAME_IS_FILE_CLOSED \copydoc FM_NAME_IS_FILE_CLOSED
+ *  \retval #FM_NAME_IS_DIRECTORY   \copydoc FM_NAME_IS_DIRECTORY
+ *
+ *  \sa #FM_GetFilenameState, #FM_GetOpenFilesData
+ */
+uint32 FM_GetFilenameStateFromList(const char *Filename, uint32 BufferSize, const FM_OpenFilesEntry_t *OpenFiles,
+                                   uint32 OpenCount);
+
 /**
  *  \brief Verify Name Function
  *
@@ -283,8 +339,12 @@ bool FM_VerifyDirNoExist(char *Name, uint32 BufferSize, uint32 EventID, const ch
  *  \brief Verify Child Task Interface Function
  *
  *  \par Description
- *       This function verifies that the child task interface queue is
- *       not full and that the queue index values are within bounds.
+ *       This function verifies that the child task interface queue (or
+ *       failing that, the pending commands file) has room for another
+ *       command and that the queue index values are within bounds.
+ *       On success the queue write index selects a queue entry that is
+ *       not waiting in a lane, and the command argument staging entry
+ *       (#FM_GlobalData_t.ChildQueueEntry) is cleared.
  *
  *  \par Assumptions, External Events, and Notes:
  *
@@ -297,14 +357,40 @@ bool FM_VerifyDirNoExist(char *Name, uint32 BufferSize, uint32 EventID, const ch
  */
 bool FM_VerifyChildTask(uint32 EventID, const char *CmdText);
 
+/**
+ *  \brief Get Child Task Queue Lane Function
+ *
+ *  \par Description
+ *       This function selects the child task queue lane for a command.
+ *       Commands that only access file system metadata use the interactive
+ *       lane, which the child task always processes first.  Commands that
+ *       read or write file data use the bulk lane.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in]  CmdArgs Child task queue entry for the command
+ *
+ *  \return Queue lane for the command
+ *  \retval #FM_CHILD_LANE_INTERACTIVE Metadata command
+ *  \retval #FM_CHILD_LANE_BULK        File data command
+ *
+ *  \sa #FM_InvokeChildTask, #FM_ChildProcess
+ */
+uint8 FM_GetChildQueueLane(const FM_ChildQueueEntry_t *CmdArgs);
+
 /**
  *  \brief Invoke Child Task Function
  *
  *  \par Description
- *       This function is called after the caller has loaded the next
- *       available entry in the child task queue with the arguments for
- *       the current command.  The function updates the queue access
- *       index and then verifies that the Child Task is operational.
+ *       This function is called after the caller has loaded the command
+ *       argument staging entry with the arguments for the current command.
+ *       The function packs the arguments into the next available entry in
+ *       the child task queue and appends the entry to the lane selected by
+ *       #FM_GetChildQueueLane, updates the queue access index and then
+ *       verifies that the Child Task is operational.  When the queue or
+ *       the path arena is full, or commands are already waiting in the
+ *       pending commands file, the arguments are appended to the pending
+ *       commands file instead.
  *       If the Child Task is operational then it is signaled via
  *       handshake semaphore to process the next command from the queue.
  *       If instead, the Child Task is not operational, the Child Task
@@ -313,8 +399,10 @@ bool FM_VerifyChildTask(uint32 EventID, const char *CmdText);
  *       which execution thread is active when the command is processed.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       The FM main task does not take a semaphore to add the entry,
+ *       the semaphore given to the Child Task is only a wakeup signal.
  *
- *  \sa #OS_CountSemGive, #FM_ChildProcess
+ *  \sa #OS_CountSemGive, #FM_QueueLanePush, #FM_QueuePendingPush, #FM_ChildProcess
  */
 void FM_InvokeChildTask(void);
 
@@ -337,4 +425,27 @@ void FM_InvokeChildTask(void);
  */
 void FM_AppendPathSep(char *Directory, uint32 BufferSize);
 
+/**
+ *  \brief Get Volume Index Function
+ *
+ *  \par Description
+ *       This function finds the file system that holds a file, using the
+ *       file system names (logical mount points) in the free space table.
+ *       The longest enabled or disabled table entry name that is the file
+ *       name or a directory above it is the file system of the file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the FM main task, while the table pointer is acquired.
+ *       File systems that are not in the table are unknown, so a file
+ *       that maps to no table entry may be on any file system.
+ *
+ *  \param [in]  Filename Pointer to the filename
+ *
+ *  \return Free space table index of the file system
+ *  \retval #FM_TABLE_ENTRY_COUNT File system unknown, or the table is not loaded
+ *
+ *  \sa #FM_MOVE_CC
+ */
+uint32 FM_GetVolumeIndex(const char *Filename);
+
 #endif
@@ -32,6 +32,8 @@
 #include "fm_app.h"
 #include "fm_cmds.h"
 #include "fm_cmd_utils.h"
+#include "fm_queue.h"
+#include "fm_throttle.h"
 #include "fm_perfids.h"
 #include "fm_platform_cfg.h"
 #include "fm_version.h"
@@ -84,9 +86,10 @@ bool FM_ResetCountersCmd(const CFE_SB_Buffer_t *BufPtr)
         FM_GlobalData.CommandCounter    = 0;
         FM_GlobalData.CommandErrCounter = 0;
 
-        FM_GlobalData.ChildCmdCounter     = 0;
-        FM_GlobalData.ChildCmdErrCounter  = 0;
-        FM_GlobalData.ChildCmdWarnCounter = 0;
+        /* Child task workers increment these counters while commands execute */
+        FM_ATOMIC_STORE(&FM_GlobalData.ChildCmdCounter, 0);
+        FM_ATOMIC_STORE(&FM_GlobalData.ChildCmdErrCounter, 0);
+        FM_ATOMIC_STORE(&FM_GlobalData.ChildCmdWarnCounter, 0);
 
         /* Send command completion event (debug) */
         CFE_EVS_SendEvent(FM_RESET_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command", CmdText);
@@ -108,6 +111,8 @@ bool FM_CopyFileCmd(const CFE_SB_Buffer_t *BufPtr)
     FM_ChildQueueEntry_t *CmdArgs       = NULL;
     const char *          CmdText       = "Copy File";
     bool                  CommandResult = false;
+    uint32                SourceVolume  = FM_TABLE_ENTRY_COUNT;
+    uint32                TargetVolume  = FM_TABLE_ENTRY_COUNT;
 
     /* Verify command packet length */
     CommandResult = FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_CopyFileCmd_t), FM_COPY_PKT_ERR_EID, CmdText);
@@ -118,6 +123,64 @@ bool FM_CopyFileCmd(const CFE_SB_Buffer_t *BufPtr)
         CommandResult = FM_VerifyOverwrite(CmdPtr->Overwrite, FM_COPY_OVR_ERR_EID, CmdText);
     }
 
+    /* Verify that CRC type argument is valid */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyCRCType(CmdPtr->CRCType, FM_COPY_CRC_ERR_EID, CmdText);
+    }
+
+    /* Verify that read back argument is valid, the target file CRC is compared with the copied data CRC */
+    if (CommandResult == true)
+    {
+        if ((CmdPtr->Verify > 1) || ((CmdPtr->Verify == 1) && (CmdPtr->CRCType == FM_IGNORE_CRC)))
+        {
+            CommandResult = false;
+
+            CFE_EVS_SendEvent(FM_COPY_VERIFY_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: invalid verify = %d, CRC type = %d", CmdText, (int)CmdPtr->Verify,
+                              (int)CmdPtr->CRCType);
+        }
+    }
+
+    /* Verify that sparse argument is valid */
+    if (CommandResult == true)
+    {
+        if (CmdPtr->Sparse > 1)
+        {
+            CommandResult = false;
+
+            CFE_EVS_SendEvent(FM_COPY_SPARSE_ERR_EID, CFE_EVS_EventType_ERROR, "%s error: invalid sparse = %d",
+                              CmdText, (int)CmdPtr->Sparse);
+        }
+    }
+
+    /* Verify that link argument is valid, no CRC can be computed for shared data */
+    if (CommandResult == true)
+    {
+        if ((CmdPtr->Link > FM_COPY_LINK_CLONE) ||
+            ((CmdPtr->Link != FM_COPY_LINK_NONE) && (CmdPtr->CRCType != FM_IGNORE_CRC)))
+        {
+            CommandResult = false;
+
+            CFE_EVS_SendEvent(FM_COPY_LINK_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: invalid link = %d, CRC type = %d", CmdText, (int)CmdPtr->Link,
+                              (int)CmdPtr->CRCType);
+        }
+    }
+
+    /* Verify that a linked copy does not replace its own source, overwrite would delete the file */
+    if (CommandResult == true)
+    {
+        if ((CmdPtr->Link != FM_COPY_LINK_NONE) &&
+            (strncmp(CmdPtr->Source, CmdPtr->Target, sizeof(CmdPtr->Source)) == 0))
+        {
+            CommandResult = false;
+
+            CFE_EVS_SendEvent(FM_COPY_LINK_SAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: link source and target are the same file", CmdText);
+        }
+    }
+
     /* Verify that source file exists and is not a directory */
     if (CommandResult == true)
     {
@@ -146,7 +209,7 @@ bool FM_CopyFileCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_COPY_CC;
@@ -156,6 +219,17 @@ bool FM_CopyFileCmd(const CFE_SB_Buffer_t *BufPtr)
         strncpy(CmdArgs->Target, CmdPtr->Target, OS_MAX_PATH_LEN - 1);
         CmdArgs->Target[OS_MAX_PATH_LEN - 1] = '\0';
 
+        /* Known different volumes skip the link, the file data is copied */
+        SourceVolume = FM_GetVolumeIndex(CmdArgs->Source1);
+        TargetVolume = FM_GetVolumeIndex(CmdArgs->Target);
+
+        CmdArgs->CrossVolume = (SourceVolume != TargetVolume) && (SourceVolume != FM_TABLE_ENTRY_COUNT) &&
+                               (TargetVolume != FM_TABLE_ENTRY_COUNT);
+        CmdArgs->FileInfoCRC = CmdPtr->CRCType;
+        CmdArgs->Verify      = (uint8)CmdPtr->Verify;
+        CmdArgs->Sparse      = (uint8)CmdPtr->Sparse;
+        CmdArgs->Link        = (uint8)CmdPtr->Link;
+
         /* Invoke lower priority child task */
         FM_InvokeChildTask();
     }
@@ -176,6 +250,8 @@ bool FM_MoveFileCmd(const CFE_SB_Buffer_t *BufPtr)
     FM_ChildQueueEntry_t *CmdArgs       = NULL;
     const char *          CmdText       = "Move File";
     bool                  CommandResult = false;
+    uint32                SourceVolume  = FM_TABLE_ENTRY_COUNT;
+    uint32                TargetVolume  = FM_TABLE_ENTRY_COUNT;
 
     /* Verify command packet length */
     CommandResult = FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_MoveFileCmd_t), FM_MOVE_PKT_ERR_EID, CmdText);
@@ -214,7 +290,7 @@ bool FM_MoveFileCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_MOVE_CC;
@@ -225,6 +301,16 @@ bool FM_MoveFileCmd(const CFE_SB_Buffer_t *BufPtr)
         strncpy(CmdArgs->Target, CmdPtr->Target, OS_MAX_PATH_LEN - 1);
         CmdArgs->Target[OS_MAX_PATH_LEN - 1] = '\0';
 
+        /* Known different volumes skip the rename, data streamed across is verified by CRC */
+        SourceVolume = FM_GetVolumeIndex(CmdArgs->Source1);
+        TargetVolume = FM_GetVolumeIndex(CmdArgs->Target);
+
+        CmdArgs->CrossVolume = (SourceVolume != TargetVolume) && (SourceVolume != FM_TABLE_ENTRY_COUNT) &&
+                               (TargetVolume != FM_TABLE_ENTRY_COUNT);
+        CmdArgs->FileInfoCRC = CFE_MISSION_ES_DEFAULT_CRC;
+        CmdArgs->Verify      = true;
+        CmdArgs->Sparse      = false;
+
         /* Invoke lower priority child task */
         FM_InvokeChildTask();
     }
@@ -270,7 +356,7 @@ bool FM_RenameFileCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_RENAME_CC;
@@ -321,7 +407,7 @@ bool FM_DeleteFileCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
 
         /* Set handshake queue command args - might be global or internal CC */
         CFE_MSG_GetFcnCode(&BufPtr->Msg, &CmdArgs->CommandCode);
@@ -374,7 +460,7 @@ bool FM_DeleteAllFilesCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_DELETE_ALL_CC;
@@ -430,7 +516,7 @@ bool FM_DecompressFileCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_DECOMPRESS_CC;
@@ -465,6 +551,12 @@ bool FM_ConcatFilesCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Verify command packet length */
     CommandResult = FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_ConcatCmd_t), FM_CONCAT_PKT_ERR_EID, CmdText);
 
+    /* Verify that CRC type argument is valid */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyCRCType(CmdPtr->CRCType, FM_CONCAT_CRC_ERR_EID, CmdText);
+    }
+
     /* Verify that source file #1 exists, is not a directory and is not open */
     if (CommandResult == true)
     {
@@ -492,7 +584,7 @@ bool FM_ConcatFilesCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_CONCAT_CC;
@@ -502,6 +594,8 @@ bool FM_ConcatFilesCmd(const CFE_SB_Buffer_t *BufPtr)
         CmdArgs->Source2[OS_MAX_PATH_LEN - 1] = '\0';
         strncpy(CmdArgs->Target, CmdPtr->Target, OS_MAX_PATH_LEN - 1);
         CmdArgs->Target[OS_MAX_PATH_LEN - 1] = '\0';
+        CmdArgs->FileInfoCRC = CmdPtr->CRCType;
+        CmdArgs->Sparse      = false;
 
         /* Invoke lower priority child task */
         FM_InvokeChildTask();
@@ -550,7 +644,7 @@ bool FM_GetFileInfoCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_GET_FILE_INFO_CC;
@@ -642,7 +736,7 @@ bool FM_CreateDirectoryCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_CREATE_DIR_CC;
@@ -689,7 +783,7 @@ bool FM_DeleteDirectoryCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_DELETE_DIR_CC;
@@ -757,7 +851,7 @@ bool FM_GetDirListFileCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
 
         /* Append a path separator to the end of the directory name */
         strncpy(DirWithSep, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
@@ -818,7 +912,7 @@ bool FM_GetDirListPktCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
 
         /* Append a path separator to the end of the directory name */
         strncpy(DirWithSep, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
@@ -1024,7 +1118,7 @@ bool FM_SetPermissionsCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_SET_FILE_PERM_CC;
         strncpy(CmdArgs->Source1, CmdPtr->FileName, OS_MAX_PATH_LEN - 1);
@@ -1039,6 +1133,664 @@ bool FM_SetPermissionsCmd(const CFE_SB_Buffer_t *BufPtr)
 
 } /* End of FM_SetPermissionsCmd() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Abort child task command                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_AbortCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    FM_AbortCmd_t *CmdPtr        = (FM_AbortCmd_t *)BufPtr;
+    const char *   CmdText       = "Abort";
+    bool           CommandResult = false;
+    bool           Queued        = false;
+    bool           Active        = false;
+    uint32         WorkerIndex   = 0;
+
+    /* Verify command packet length */
+    CommandResult = FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_AbortCmd_t), FM_ABORT_PKT_ERR_EID, CmdText);
+
+    if (CommandResult == true)
+    {
+        if ((CmdPtr->JobID == FM_CHILD_JOB_ID_NONE) || (CmdPtr->JobID > FM_GlobalData.ChildLastJobID))
+        {
+            /* Job ID has not been assigned to a command */
+            CommandResult = false;
+
+            CFE_EVS_SendEvent(FM_ABORT_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: invalid command argument: job = %lu", CmdText, (unsigned long)CmdPtr->JobID);
+        }
+        else
+        {
+            /* Child task workers may not dequeue while the queue is searched */
+            OS_MutSemTake(FM_GlobalData.ChildQueueCountSem);
+
+            /* A waiting command is marked in place and skipped when it is dequeued */
+            Queued = (FM_QueueLaneAbort(&FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE], CmdPtr->JobID) == true) ||
+                     (FM_QueueLaneAbort(&FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK], CmdPtr->JobID) == true) ||
+                     (FM_QueuePendingAbort(CmdPtr->JobID) == true);
+
+            if (Queued == false)
+            {
+                for (WorkerIndex = 0; WorkerIndex < FM_CHILD_WORKER_COUNT; WorkerIndex++)
+                {
+                    if (FM_ATOMIC_LOAD(&FM_GlobalData.ChildWorker[WorkerIndex].Status.CurrentJobID) == CmdPtr->JobID)
+                    {
+                        Active = true;
+                        break;
+                    }
+                }
+            }
+
+            if (Active == true)
+            {
+                /* Child task workers check the abort list between blocks of work */
+                FM_ATOMIC_STORE(&FM_GlobalData.ChildAbortJobID[FM_GlobalData.ChildAbortIndex], CmdPtr->JobID);
+
+                FM_GlobalData.ChildAbortIndex++;
+                if (FM_GlobalData.ChildAbortIndex >= FM_CHILD_ABORT_COUNT)
+                {
+                    FM_GlobalData.ChildAbortIndex = 0;
+                }
+            }
+
+            OS_MutSemGive(FM_GlobalData.ChildQueueCountSem);
+
+            if ((Queued == false) && (Active == false))
+            {
+                /* Job has already completed, or its command could not be marked */
+                CommandResult = false;
+
+                CFE_EVS_SendEvent(FM_ABORT_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: job is not queued or active: job = %lu", CmdText,
+                                  (unsigned long)CmdPtr->JobID);
+            }
+            else
+            {
+                /* Send command completion event (info) */
+                CFE_EVS_SendEvent(FM_ABORT_CMD_EID, CFE_EVS_EventType_INFORMATION, "%s command: job = %lu", CmdText,
+                                  (unsigned long)CmdPtr->JobID);
+            }
+        }
+    }
+
+    return (CommandResult);
+
+} /* End of FM_AbortCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Set child task I/O throttle command       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SetThrottleCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    FM_SetThrottleCmd_t *CmdPtr        = (FM_SetThrottleCmd_t *)BufPtr;
+    const char *         CmdText       = "Set Throttle";
+    bool                 CommandResult = false;
+    uint32               BlockSize     = FM_ATOMIC_LOAD(&FM_GlobalData.ChildBlockSize);
+
+    /* Verify command packet length */
+    CommandResult =
+        FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_SetThrottleCmd_t), FM_SET_THROTTLE_PKT_ERR_EID, CmdText);
+
+    if (CommandResult == true)
+    {
+        if ((CmdPtr->BytesPerSec != 0) && (CmdPtr->BytesPerSec < BlockSize))
+        {
+            /* The throttle sleeps at most about a second for each block */
+            CommandResult = false;
+
+            CFE_EVS_SendEvent(FM_SET_THROTTLE_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: invalid command argument: bytes/sec = %lu, minimum = %lu", CmdText,
+                              (unsigned long)CmdPtr->BytesPerSec, (unsigned long)BlockSize);
+        }
+        else
+        {
+            FM_ThrottleSet(CmdPtr->BytesPerSec, CmdPtr->StatsPerSec, CmdPtr->LatencyLimit);
+
+            /* Send command completion event (info) */
+            CFE_EVS_SendEvent(FM_SET_THROTTLE_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s command: bytes/sec = %lu, stats/sec = %lu, latency = %lu usec", CmdText,
+                              (unsigned long)CmdPtr->BytesPerSec, (unsigned long)CmdPtr->StatsPerSec,
+                              (unsigned long)CmdPtr->LatencyLimit);
+        }
+    }
+
+    return (CommandResult);
+
+} /* End of FM_SetThrottleCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Set child task file I/O block size        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SetBlockSizeCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    FM_SetBlockSizeCmd_t *CmdPtr        = (FM_SetBlockSizeCmd_t *)BufPtr;
+    const char *          CmdText       = "Set Block Size";
+    bool                  CommandResult = false;
+    uint32                BytesPerSec   = FM_GlobalData.ChildThrottle.Bytes.Rate;
+
+    /* Verify command packet length */
+    CommandResult =
+        FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_SetBlockSizeCmd_t), FM_SET_BLOCK_SIZE_PKT_ERR_EID, CmdText);
+
+    if (CommandResult == true)
+    {
+        /* Blocks must fit in the buffers, and keep file offsets aligned */
+        if ((CmdPtr->BlockSize < FM_CHILD_MIN_BLOCK_SIZE) || (CmdPtr->BlockSize > FM_CHILD_MAX_BLOCK_SIZE) ||
+            ((CmdPtr->BlockSize % FM_CHILD_BUFFER_ALIGNMENT) != 0))
+        {
+            CommandResult = false;
+
+            CFE_EVS_SendEvent(FM_SET_BLOCK_SIZE_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: invalid command argument: block size = %lu, maximum = %d, alignment = %d",
+                              CmdText, (unsigned long)CmdPtr->BlockSize, FM_CHILD_MAX_BLOCK_SIZE,
+                              FM_CHILD_BUFFER_ALIGNMENT);
+        }
+        else if ((BytesPerSec != 0) && (CmdPtr->BlockSize > BytesPerSec))
+        {
+            /* The throttle sleeps at most about a second for each block */
+            CommandResult = false;
+
+            CFE_EVS_SendEvent(FM_SET_BLOCK_SIZE_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: invalid command argument: block size = %lu, throttle bytes/sec = %lu",
+                              CmdText, (unsigned long)CmdPtr->BlockSize, (unsigned long)BytesPerSec);
+        }
+        else
+        {
+            FM_ATOMIC_STORE(&FM_GlobalData.ChildBlockSize, CmdPtr->BlockSize);
+
+            /* Send command completion event (info) */
+            CFE_EVS_SendEvent(FM_SET_BLOCK_SIZE_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s command: block size = %lu", CmdText, (unsigned long)CmdPtr->BlockSize);
+        }
+    }
+
+    return (CommandResult);
+
+} /* End of FM_SetBlockSizeCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Copy Directory                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_CopyDirCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    FM_CopyDirCmd_t *     CmdPtr                         = (FM_CopyDirCmd_t *)BufPtr;
+    FM_ChildQueueEntry_t *CmdArgs                        = NULL;
+    const char *          CmdText                        = "Copy Directory";
+    char                  SourceWithSep[OS_MAX_PATH_LEN] = "\0";
+    char                  TargetWithSep[OS_MAX_PATH_LEN] = "\0";
+    bool                  CommandResult                  = false;
+
+    /* Verify command packet length */
+    CommandResult = FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_CopyDirCmd_t), FM_COPY_DIR_PKT_ERR_EID, CmdText);
+
+    /* Verify that overwrite argument is valid */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyOverwrite(CmdPtr->Overwrite, FM_COPY_DIR_OVR_ERR_EID, CmdText);
+    }
+
+    /* Verify that the source directory exists */
+    if (CommandResult == true)
+    {
+        CommandResult =
+            FM_VerifyDirExists(CmdPtr->Source, sizeof(CmdPtr->Source), FM_COPY_DIR_SRC_BASE_EID, CmdText);
+    }
+
+    /* Verify target directory per the overwrite argument, an existing directory is only reused with overwrite */
+    if ((CommandResult == true) &&
+        ((CmdPtr->Overwrite == 0) ||
+         (FM_GetFilenameState(CmdPtr->Target, sizeof(CmdPtr->Target), false) != FM_NAME_IS_DIRECTORY)))
+    {
+        CommandResult =
+            FM_VerifyDirNoExist(CmdPtr->Target, sizeof(CmdPtr->Target), FM_COPY_DIR_TGT_BASE_EID, CmdText);
+    }
+
+    /* Verify that the walk of the source tree cannot reach the target */
+    if (CommandResult == true)
+    {
+        strncpy(SourceWithSep, CmdPtr->Source, OS_MAX_PATH_LEN - 1);
+        SourceWithSep[OS_MAX_PATH_LEN - 1] = '\0';
+        FM_AppendPathSep(SourceWithSep, OS_MAX_PATH_LEN);
+
+        strncpy(TargetWithSep, CmdPtr->Target, OS_MAX_PATH_LEN - 1);
+        TargetWithSep[OS_MAX_PATH_LEN - 1] = '\0';
+        FM_AppendPathSep(TargetWithSep, OS_MAX_PATH_LEN);
+
+        if (strncmp(TargetWithSep, SourceWithSep, strlen(SourceWithSep)) == 0)
+        {
+            CommandResult = false;
+
+            CFE_EVS_SendEvent(FM_COPY_DIR_TGT_NESTED_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: target directory is inside source directory: src = %s, tgt = %s", CmdText,
+                              CmdPtr->Source, CmdPtr->Target);
+        }
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_COPY_DIR_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = FM_COPY_DIR_CC;
+
+        strncpy(CmdArgs->Source1, CmdPtr->Source, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+        strncpy(CmdArgs->Target, CmdPtr->Target, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Target[OS_MAX_PATH_LEN - 1] = '\0';
+
+        /* Each file is copied without a CRC, read back or holes */
+        CmdArgs->FileInfoCRC = FM_IGNORE_CRC;
+        CmdArgs->Verify      = false;
+        CmdArgs->Sparse      = false;
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return (CommandResult);
+
+} /* End of FM_CopyDirCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Delete Directory Tree                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DeleteTreeCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    FM_DeleteTreeCmd_t *  CmdPtr        = (FM_DeleteTreeCmd_t *)BufPtr;
+    FM_ChildQueueEntry_t *CmdArgs       = NULL;
+    const char *          CmdText       = "Delete Tree";
+    bool                  CommandResult = false;
+
+    /* Verify command packet length */
+    CommandResult =
+        FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_DeleteTreeCmd_t), FM_DELETE_TREE_PKT_ERR_EID, CmdText);
+
+    /* Verify that the directory exists */
+    if (CommandResult == true)
+    {
+        CommandResult =
+            FM_VerifyDirExists(CmdPtr->Directory, sizeof(CmdPtr->Directory), FM_DELETE_TREE_SRC_BASE_EID, CmdText);
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_DELETE_TREE_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = FM_DELETE_TREE_CC;
+        strncpy(CmdArgs->Source1, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return (CommandResult);
+
+} /* End of FM_DeleteTreeCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Delete Filtered Files                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DeleteFilterCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    FM_DeleteFilterCmd_t *CmdPtr        = (FM_DeleteFilterCmd_t *)BufPtr;
+    FM_ChildQueueEntry_t *CmdArgs       = NULL;
+    const char *          CmdText       = "Delete Filtered Files";
+    bool                  CommandResult = false;
+
+    /* Verify command packet length */
+    CommandResult =
+        FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_DeleteFilterCmd_t), FM_DELETE_FILTER_PKT_ERR_EID, CmdText);
+
+    /* Verify that the directory exists */
+    if (CommandResult == true)
+    {
+        CommandResult =
+            FM_VerifyDirExists(CmdPtr->Directory, sizeof(CmdPtr->Directory), FM_DELETE_FILTER_SRC_BASE_EID, CmdText);
+    }
+
+    /* The pattern only matches names within the directory */
+    if (CommandResult == true)
+    {
+        if ((CmdPtr->Pattern[0] == '\0') || (memchr(CmdPtr->Pattern, '\0', sizeof(CmdPtr->Pattern)) == NULL) ||
+            (strchr(CmdPtr->Pattern, '/') != NULL))
+        {
+            CommandResult = false;
+
+            CFE_EVS_SendEvent(FM_DELETE_FILTER_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: invalid pattern: dir = %s", CmdText, CmdPtr->Directory);
+        }
+        else if (((CmdPtr->MaxAge != 0) && (CmdPtr->MinAge > CmdPtr->MaxAge)) ||
+                 ((CmdPtr->MaxSize != 0) && (CmdPtr->MinSize > CmdPtr->MaxSize)))
+        {
+            CommandResult = false;
+
+            CFE_EVS_SendEvent(FM_DELETE_FILTER_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: invalid range: age = %lu..%lu, size = %lu..%lu", CmdText,
+                              (unsigned long)CmdPtr->MinAge, (unsigned long)CmdPtr->MaxAge,
+                              (unsigned long)CmdPtr->MinSize, (unsigned long)CmdPtr->MaxSize);
+        }
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_DELETE_FILTER_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = FM_DELETE_FILTER_CC;
+        strncpy(CmdArgs->Source1, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+        strncpy(CmdArgs->Target, CmdPtr->Pattern, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Target[OS_MAX_PATH_LEN - 1] = '\0';
+
+        CmdArgs->MinAge  = CmdPtr->MinAge;
+        CmdArgs->MaxAge  = CmdPtr->MaxAge;
+        CmdArgs->MinSize = CmdPtr->MinSize;
+        CmdArgs->MaxSize = CmdPtr->MaxSize;
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return (CommandResult);
+
+} /* End of FM_DeleteFilterCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Concatenate File List                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ConcatListCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    FM_ConcatListCmd_t *  CmdPtr        = (FM_ConcatListCmd_t *)BufPtr;
+    const char *          CmdText       = "Concat File List";
+    FM_ChildQueueEntry_t *CmdArgs       = NULL;
+    bool                  CommandResult = false;
+
+    /* Verify command packet length */
+    CommandResult =
+        FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_ConcatListCmd_t), FM_CONCAT_LIST_PKT_ERR_EID, CmdText);
+
+    /* Verify that CRC type argument is valid */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyCRCType(CmdPtr->CRCType, FM_CONCAT_LIST_CRC_ERR_EID, CmdText);
+    }
+
+    /* Verify that the source list file exists, is not a directory and is not open */
+    if (CommandResult == true)
+    {
+        CommandResult =
+            FM_VerifyFileClosed(CmdPtr->ListFile, sizeof(CmdPtr->ListFile), FM_CONCAT_LIST_SRC_BASE_EID, CmdText);
+    }
+
+    /* Verify that target file does not exist */
+    if (CommandResult == true)
+    {
+        CommandResult =
+            FM_VerifyFileNoExist(CmdPtr->Target, sizeof(CmdPtr->Target), FM_CONCAT_LIST_TGT_BASE_EID, CmdText);
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_CONCAT_LIST_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
+
+        /* Set handshake queue command args, the listed sources are read by the child task */
+        CmdArgs->CommandCode = FM_CONCAT_LIST_CC;
+        strncpy(CmdArgs->Source1, CmdPtr->ListFile, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+        CmdArgs->Source2[0]                   = '\0';
+        strncpy(CmdArgs->Target, CmdPtr->Target, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Target[OS_MAX_PATH_LEN - 1] = '\0';
+        CmdArgs->FileInfoCRC                 = CmdPtr->CRCType;
+        CmdArgs->Verify                      = false;
+        CmdArgs->Sparse                      = false;
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return (CommandResult);
+
+} /* End of FM_ConcatListCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Split File                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SplitCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    FM_SplitCmd_t *       CmdPtr        = (FM_SplitCmd_t *)BufPtr;
+    const char *          CmdText       = "Split File";
+    FM_ChildQueueEntry_t *CmdArgs       = NULL;
+    bool                  CommandResult = false;
+
+    /* Verify command packet length */
+    CommandResult = FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_SplitCmd_t), FM_SPLIT_PKT_ERR_EID, CmdText);
+
+    /* The segment count is checked against the source size by the child task */
+    if ((CommandResult == true) && (CmdPtr->SegmentSize == 0))
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_SPLIT_SIZE_ERR_EID, CFE_EVS_EventType_ERROR, "%s error: invalid segment size = %lu",
+                          CmdText, (unsigned long)CmdPtr->SegmentSize);
+    }
+
+    /* Verify that CRC type argument is valid */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyCRCType(CmdPtr->CRCType, FM_SPLIT_CRC_ERR_EID, CmdText);
+    }
+
+    /* Verify that the source file exists, is not a directory and is not open */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyFileClosed(CmdPtr->Source, sizeof(CmdPtr->Source), FM_SPLIT_SRC_BASE_EID, CmdText);
+    }
+
+    /* Verify that the manifest file does not exist */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyFileNoExist(CmdPtr->Target, sizeof(CmdPtr->Target), FM_SPLIT_TGT_BASE_EID, CmdText);
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_SPLIT_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = FM_SPLIT_CC;
+        strncpy(CmdArgs->Source1, CmdPtr->Source, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+        strncpy(CmdArgs->Target, CmdPtr->Target, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Target[OS_MAX_PATH_LEN - 1] = '\0';
+        CmdArgs->SegmentSize                 = CmdPtr->SegmentSize;
+        CmdArgs->FileInfoCRC                 = CmdPtr->CRCType;
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return (CommandResult);
+
+} /* End of FM_SplitCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Preallocate File                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_PreallocateCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    FM_PreallocateCmd_t * CmdPtr        = (FM_PreallocateCmd_t *)BufPtr;
+    const char *          CmdText       = "Preallocate File";
+    FM_ChildQueueEntry_t *CmdArgs       = NULL;
+    bool                  CommandResult = false;
+
+    /* Verify command packet length */
+    CommandResult =
+        FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_PreallocateCmd_t), FM_PREALLOCATE_PKT_ERR_EID, CmdText);
+
+    if ((CommandResult == true) && (CmdPtr->Size == 0))
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_PREALLOCATE_SIZE_ERR_EID, CFE_EVS_EventType_ERROR, "%s error: invalid file size = %lu",
+                          CmdText, (unsigned long)CmdPtr->Size);
+    }
+
+    /* Verify that the file is not a directory and is not open, it is created if it does not exist */
+    if (CommandResult == true)
+    {
+        CommandResult =
+            FM_VerifyFileNotOpen(CmdPtr->Filename, sizeof(CmdPtr->Filename), FM_PREALLOCATE_SRC_BASE_EID, CmdText);
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_PREALLOCATE_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = FM_PREALLOCATE_CC;
+        strncpy(CmdArgs->Source1, CmdPtr->Filename, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+        CmdArgs->FileSize                     = CmdPtr->Size;
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return (CommandResult);
+
+} /* End of FM_PreallocateCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Truncate File                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_TruncateCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    FM_TruncateCmd_t *    CmdPtr        = (FM_TruncateCmd_t *)BufPtr;
+    const char *          CmdText       = "Truncate File";
+    FM_ChildQueueEntry_t *CmdArgs       = NULL;
+    bool                  CommandResult = false;
+
+    /* Verify command packet length */
+    CommandResult = FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_TruncateCmd_t), FM_TRUNCATE_PKT_ERR_EID, CmdText);
+
+#ifndef FM_INCLUDE_FILE_TRUNCATE
+    /* Truncating a file needs the POSIX truncate call */
+    if (CommandResult == true)
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_TRUNCATE_UNSUPPORTED_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: not supported in this build", CmdText);
+    }
+#endif
+
+    /* Verify that the file exists, is not a directory and is not open */
+    if (CommandResult == true)
+    {
+        CommandResult =
+            FM_VerifyFileClosed(CmdPtr->Filename, sizeof(CmdPtr->Filename), FM_TRUNCATE_SRC_BASE_EID, CmdText);
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_TRUNCATE_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution, the size is checked against the file by the child task */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildQueueEntry;
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = FM_TRUNCATE_CC;
+        strncpy(CmdArgs->Source1, CmdPtr->Filename, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+        CmdArgs->FileSize                     = CmdPtr->Size;
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return (CommandResult);
+
+} /* End of FM_TruncateCmd() */
+
 /************************/
 /*  End of File Comment */
 /************************/
@@ -429,4 +429,227 @@ bool FM_SetTableStateCmd(const CFE_SB_Buffer_t *BufPtr);
  */
 bool FM_SetPermissionsCmd(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ *  \brief Abort Child Task Command Handler Function
+ *
+ *  \par Description
+ *       This function records a request to abort the child task command
+ *       with the commanded job ID.  A command still waiting in the queue or
+ *       the pending commands file is marked and skipped by the child task,
+ *       a command already executing is stopped at the next abort check.
+ *       Job ID's that are neither waiting nor executing are rejected.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The queue is searched holding the child task dequeue mutex, so that
+ *       a command cannot move to a worker during the search.  The abort
+ *       list holds the most recent #FM_CHILD_ABORT_COUNT requests for
+ *       executing commands, the child task reads it with atomic loads.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_ABORT_CC, #FM_AbortCmd_t, #FM_ChildIsAborted, #FM_QueueLaneAbort, #FM_QueuePendingAbort
+ */
+bool FM_AbortCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Set Child Task I/O Throttle Command Handler Function
+ *
+ *  \par Description
+ *       This function sets the file data and OS_stat call rate limits of
+ *       the I/O throttle shared by the child task workers, and the file
+ *       block latency above which the file data rate backs off.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A non-zero file data rate must be at least #FM_CHILD_FILE_BLOCK_SIZE
+ *       bytes per second.  The new limits apply from the next block of file
+ *       data or OS_stat call of each worker.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_SET_THROTTLE_CC, #FM_SetThrottleCmd_t, #FM_ThrottleSet
+ */
+bool FM_SetThrottleCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Set Child Task File I/O Block Size Command Handler Function
+ *
+ *  \par Description
+ *       This function sets the size of each block of file data that the
+ *       child task workers read or write.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The block size must be at least 256 bytes, no greater than
+ *       #FM_CHILD_MAX_BLOCK_SIZE and a multiple of
+ *       #FM_CHILD_BUFFER_ALIGNMENT.  The new size applies to commands that
+ *       a worker starts afterwards, commands already executing keep their
+ *       block size.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_SET_BLOCK_SIZE_CC, #FM_SetBlockSizeCmd_t
+ */
+bool FM_SetBlockSizeCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Copy Directory Command Handler Function
+ *
+ *  \par Description
+ *       This function copies the source directory tree to the target
+ *       directory, after verifying that the source is a directory and that
+ *       the target is usable.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The target must not exist unless the overwrite argument is set, in
+ *       which case it may also be an existing directory.  A target that is
+ *       the source or below it is rejected, because the copy would walk
+ *       into its own output.  The tree is walked and copied by the child
+ *       task.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_COPY_DIR_CC, #FM_CopyDirCmd_t, #FM_ChildCopyDirCmd
+ */
+bool FM_CopyDirCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Delete Directory Tree Command Handler Function
+ *
+ *  \par Description
+ *       This function deletes a directory with every file and subdirectory
+ *       below it, after verifying that the directory exists.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The tree is walked and removed by the child task.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_DELETE_TREE_CC, #FM_DeleteTreeCmd_t, #FM_ChildDeleteTreeCmd
+ */
+bool FM_DeleteTreeCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Delete Filtered Files Command Handler Function
+ *
+ *  \par Description
+ *       This function deletes the files in a directory that match a filename
+ *       pattern and the optional age and size ranges, after verifying that
+ *       the directory exists and that the pattern and ranges are valid.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Files are selected and deleted by the child task.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_DELETE_FILTER_CC, #FM_DeleteFilterCmd_t, #FM_ChildDeleteFilterCmd
+ */
+bool FM_DeleteFilterCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Concatenate File List Command Handler Function
+ *
+ *  \par Description
+ *       This function concatenates the files named in a source list file into
+ *       the target file, after verifying that the list file is a closed file
+ *       and that the target file does not exist.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The list file is read, and the listed sources checked, by the child task.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_CONCAT_LIST_CC, #FM_ConcatListCmd_t, #FM_ChildConcatListCmd
+ */
+bool FM_ConcatListCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Split File Command Handler Function
+ *
+ *  \par Description
+ *       This function splits the source file into numbered segment files and
+ *       a manifest file, after verifying that the segment size is not zero,
+ *       that the source file is a closed file and that the manifest file does
+ *       not exist.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The segment count and segment filenames are checked by the child task.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_SPLIT_CC, #FM_SplitCmd_t, #FM_ChildSplitCmd
+ */
+bool FM_SplitCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Preallocate File Command Handler Function
+ *
+ *  \par Description
+ *       This function reserves file system space for a file, after verifying
+ *       that the file size is not zero and that the filename is unused or a
+ *       closed file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file is created and extended by the child task.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_PREALLOCATE_CC, #FM_PreallocateCmd_t, #FM_ChildPreallocateCmd
+ */
+bool FM_PreallocateCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Truncate File Command Handler Function
+ *
+ *  \par Description
+ *       This function shortens a file in place, after verifying that the file
+ *       is a closed file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file size is checked against the current file size by the child task.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_TRUNCATE_CC, #FM_TruncateCmd_t, #FM_ChildTruncateCmd
+ */
+bool FM_TruncateCmd(const CFE_SB_Buffer_t *BufPtr);
+
 #endif
@@ -0,0 +1,317 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task CRC Functions
+ *
+ *  The cFE CRC-16 is a bit reflected CRC with the polynomial 0x8005,
+ *  computed by cFE one byte at a time from a 256 entry table.  FM computes
+ *  the same CRC eight bytes at a time from eight tables (slicing-by-8).
+ *  On x86-64 CPUs with the PCLMULQDQ instruction, 64 bytes at a time are
+ *  folded into four 128-bit remainders with carry-less multiplies, and
+ *  the tables finish the last remainder.  The kernel is selected once at
+ *  startup from the CPU features.
+ *
+ *  Every kernel returns the cFE result bit for bit.  The CRC-8 and CRC-32
+ *  types are passed through to cFE, which defines those algorithms.
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_defs.h"
+#include "fm_crc.h"
+#include "fm_platform_cfg.h"
+
+#ifdef FM_CRC_INCLUDE_PCLMUL
+#include <immintrin.h>
+#endif
+
+#define FM_CRC_POLYNOMIAL 0x18005 /* x^16 + x^15 + x^2 + 1 */
+#define FM_CRC_REFLECTED  0xA001  /* Polynomial bit reflected, without the x^16 term */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- carry-less multiply fold constant            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint64 FM_CrcFoldConstant(uint32 Power)
+{
+    uint32 Remainder = 1;
+    uint64 Constant  = 0;
+    uint32 Step      = 0;
+
+    /* x^Power mod P */
+    for (Step = 0; Step < Power; Step++)
+    {
+        Remainder <<= 1;
+
+        if ((Remainder & 0x10000) != 0)
+        {
+            Remainder ^= FM_CRC_POLYNOMIAL;
+        }
+    }
+
+    /* Bit reflected into the upper bits, the same order as the data bits */
+    for (Step = 0; Step < 16; Step++)
+    {
+        if ((Remainder & (1 << Step)) != 0)
+        {
+            Constant |= (uint64)1 << (63 - Step);
+        }
+    }
+
+    return (Constant);
+
+} /* End of FM_CrcFoldConstant() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- startup initialization                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CrcInit(void)
+{
+    FM_ChildCrc_t *Engine = &FM_GlobalData.ChildCrc;
+    uint16         Crc    = 0;
+    uint32         Index  = 0;
+    uint32         Slice  = 0;
+    uint32         Bit    = 0;
+
+    /* Table 0 is the cFE table, the CRC of each byte value */
+    for (Index = 0; Index < FM_CRC_TABLE_SIZE; Index++)
+    {
+        Crc = (uint16)Index;
+
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            if ((Crc & 1) != 0)
+            {
+                Crc = (Crc >> 1) ^ FM_CRC_REFLECTED;
+            }
+            else
+            {
+                Crc = Crc >> 1;
+            }
+        }
+
+        Engine->Table[0][Index] = Crc;
+    }
+
+    /* Table N is the CRC of each byte value followed by N zero bytes */
+    for (Slice = 1; Slice < FM_CRC_SLICE_COUNT; Slice++)
+    {
+        for (Index = 0; Index < FM_CRC_TABLE_SIZE; Index++)
+        {
+            Crc = Engine->Table[Slice - 1][Index];
+
+            Engine->Table[Slice][Index] = (Crc >> 8) ^ Engine->Table[0][Crc & 0xFF];
+        }
+    }
+
+    /*
+    ** Folding moves 128 bits of data 512 (or 128) bits further along, the
+    ** first 64 bits by x^(N+63) mod P and the last 64 bits by x^(N-1) mod P.
+    ** The bit reflected product is one bit short, which the -1 makes up.
+    */
+    Engine->Fold512[0] = FM_CrcFoldConstant(512 + 63);
+    Engine->Fold512[1] = FM_CrcFoldConstant(512 - 1);
+    Engine->Fold128[0] = FM_CrcFoldConstant(128 + 63);
+    Engine->Fold128[1] = FM_CrcFoldConstant(128 - 1);
+
+    Engine->Kernel = FM_CRC_KERNEL_SLICE;
+
+#ifdef FM_CRC_INCLUDE_PCLMUL
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("pclmul"))
+    {
+        Engine->Kernel = FM_CRC_KERNEL_PCLMUL;
+    }
+#endif
+
+} /* End of FM_CrcInit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- calculate CRC of a block of data             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_CrcCalculate(const void *DataPtr, size_t DataLength, uint32 InputCRC, uint32 TypeCRC)
+{
+    uint32 Result = InputCRC;
+    uint16 Crc    = 0;
+
+    if (TypeCRC != CFE_MISSION_ES_CRC_16)
+    {
+        /* Only the cFE CRC-16 is accelerated */
+        Result = CFE_ES_CalculateCRC(DataPtr, DataLength, InputCRC, TypeCRC);
+    }
+    else if ((DataPtr != NULL) && (DataLength != 0))
+    {
+        Crc = (uint16)(InputCRC & 0xFFFF);
+
+        if (FM_GlobalData.ChildCrc.Kernel == FM_CRC_KERNEL_PCLMUL)
+        {
+#ifdef FM_CRC_INCLUDE_PCLMUL
+            Crc = FM_CrcFold16(Crc, DataPtr, DataLength);
+#endif
+        }
+        else
+        {
+            Crc = FM_CrcSlice16(Crc, DataPtr, DataLength);
+        }
+
+        /* cFE keeps the CRC in a signed 16-bit variable, so the result is sign extended */
+        Result = Crc;
+
+        if ((Crc & 0x8000) != 0)
+        {
+            Result |= 0xFFFF0000;
+        }
+    }
+
+    return (Result);
+
+} /* End of FM_CrcCalculate() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- CRC-16 slicing-by-8 kernel                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint16 FM_CrcSlice16(uint16 Crc, const uint8 *Buffer, size_t Length)
+{
+    const FM_ChildCrc_t *Engine = &FM_GlobalData.ChildCrc;
+
+    /* Bytes are read one at a time, so the data may have any alignment and byte order */
+    while (Length >= FM_CRC_SLICE_COUNT)
+    {
+        Crc ^= (uint16)(Buffer[0] | (Buffer[1] << 8));
+
+        Crc = Engine->Table[7][Crc & 0xFF] ^ Engine->Table[6][Crc >> 8] ^ Engine->Table[5][Buffer[2]] ^
+              Engine->Table[4][Buffer[3]] ^ Engine->Table[3][Buffer[4]] ^ Engine->Table[2][Buffer[5]] ^
+              Engine->Table[1][Buffer[6]] ^ Engine->Table[0][Buffer[7]];
+
+        Buffer += FM_CRC_SLICE_COUNT;
+        Length -= FM_CRC_SLICE_COUNT;
+    }
+
+    while (Length > 0)
+    {
+        Crc = (Crc >> 8) ^ Engine->Table[0][(Crc ^ *Buffer) & 0xFF];
+
+        Buffer++;
+        Length--;
+    }
+
+    return (Crc);
+
+} /* End of FM_CrcSlice16() */
+
+#ifdef FM_CRC_INCLUDE_PCLMUL
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- fold 128 bits of data further along          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+__attribute__((target("pclmul"))) static inline __m128i FM_CrcFold(__m128i Data, __m128i Constants)
+{
+    return (_mm_xor_si128(_mm_clmulepi64_si128(Data, Constants, 0x00), _mm_clmulepi64_si128(Data, Constants, 0x11)));
+
+} /* End of FM_CrcFold() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- CRC-16 carry-less multiply kernel            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+__attribute__((target("pclmul"))) uint16 FM_CrcFold16(uint16 Crc, const uint8 *Buffer, size_t Length)
+{
+    const FM_ChildCrc_t *Engine = &FM_GlobalData.ChildCrc;
+    __m128i              Constants;
+    __m128i              Fold0;
+    __m128i              Fold1;
+    __m128i              Fold2;
+    __m128i              Fold3;
+    uint8                Remainder[16];
+
+    if (Length < FM_CRC_FOLD_MIN_SIZE)
+    {
+        Crc = FM_CrcSlice16(Crc, Buffer, Length);
+    }
+    else
+    {
+        /* A reflected CRC continues from the CRC before it by adding it to the first two bytes */
+        Fold0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)Buffer), _mm_cvtsi32_si128(Crc));
+        Fold1 = _mm_loadu_si128((const __m128i *)(Buffer + 16));
+        Fold2 = _mm_loadu_si128((const __m128i *)(Buffer + 32));
+        Fold3 = _mm_loadu_si128((const __m128i *)(Buffer + 48));
+
+        Buffer += 64;
+        Length -= 64;
+
+        /* Four independent remainders keep the multipliers busy */
+        Constants = _mm_set_epi64x((long long)Engine->Fold512[1], (long long)Engine->Fold512[0]);
+
+        while (Length >= 64)
+        {
+            Fold0 = _mm_xor_si128(FM_CrcFold(Fold0, Constants), _mm_loadu_si128((const __m128i *)Buffer));
+            Fold1 = _mm_xor_si128(FM_CrcFold(Fold1, Constants), _mm_loadu_si128((const __m128i *)(Buffer + 16)));
+            Fold2 = _mm_xor_si128(FM_CrcFold(Fold2, Constants), _mm_loadu_si128((const __m128i *)(Buffer + 32)));
+            Fold3 = _mm_xor_si128(FM_CrcFold(Fold3, Constants), _mm_loadu_si128((const __m128i *)(Buffer + 48)));
+
+            Buffer += 64;
+            Length -= 64;
+        }
+
+        /* Combine the four remainders, then fold in the last whole 16 byte blocks */
+        Constants = _mm_set_epi64x((long long)Engine->Fold128[1], (long long)Engine->Fold128[0]);
+
+        Fold0 = _mm_xor_si128(FM_CrcFold(Fold0, Constants), Fold1);
+        Fold0 = _mm_xor_si128(FM_CrcFold(Fold0, Constants), Fold2);
+        Fold0 = _mm_xor_si128(FM_CrcFold(Fold0, Constants), Fold3);
+
+        while (Length >= 16)
+        {
+            Fold0 = _mm_xor_si128(FM_CrcFold(Fold0, Constants), _mm_loadu_si128((const __m128i *)Buffer));
+
+            Buffer += 16;
+            Length -= 16;
+        }
+
+        /* The remainder has the same CRC as all of the data folded into it */
+        _mm_storeu_si128((__m128i *)Remainder, Fold0);
+
+        Crc = FM_CrcSlice16(0, Remainder, sizeof(Remainder));
+        Crc = FM_CrcSlice16(Crc, Buffer, Length);
+    }
+
+    return (Crc);
+
+} /* End of FM_CrcFold16() */
+
+#endif
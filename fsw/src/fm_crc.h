@@ -0,0 +1,126 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS File Manager child task CRC functions.
+ */
+#ifndef FM_CRC_H
+#define FM_CRC_H
+
+#include "cfe.h"
+#include "fm_msg.h"
+
+/*
+** The carry-less multiply kernel needs an x86-64 compiler that can enable
+** PCLMULQDQ for one function, the CPU is checked at startup
+*/
+#if defined(__x86_64__) && defined(__GNUC__)
+#define FM_CRC_INCLUDE_PCLMUL
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function prototypes                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief CRC Engine Initialization Function
+ *
+ *  \par Description
+ *       Builds the CRC-16 slicing tables and carry-less multiply constants,
+ *       and selects the fastest CRC-16 kernel that the CPU supports.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called before the child task workers are created.
+ *
+ *  \sa #FM_ChildInit
+ */
+void FM_CrcInit(void);
+
+/**
+ *  \brief CRC Calculate Function
+ *
+ *  \par Description
+ *       Computes the CRC of a block of data, continuing from the CRC of the
+ *       data before it.  Same arguments and result as CFE_ES_CalculateCRC.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The cFE CRC-16 is computed by the kernel selected at startup.  Other
+ *       CRC types are passed through to CFE_ES_CalculateCRC.
+ *
+ *  \param [in]  DataPtr    Pointer to the data
+ *  \param [in]  DataLength Number of bytes of data
+ *  \param [in]  InputCRC   CRC of the data before this block, 0 to start
+ *  \param [in]  TypeCRC    cFE CRC type, see #CFE_MISSION_ES_CRC_16
+ *
+ *  \return CRC of the data, InputCRC if there is no data
+ *
+ *  \sa #FM_PipelineProcess, #FM_CheckpointUpdate
+ */
+uint32 FM_CrcCalculate(const void *DataPtr, size_t DataLength, uint32 InputCRC, uint32 TypeCRC);
+
+/**
+ *  \brief CRC-16 Slicing Kernel Function
+ *
+ *  \par Description
+ *       Computes the cFE CRC-16 eight bytes at a time with the slicing
+ *       tables, then one byte at a time for the rest.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Runs on any CPU.
+ *
+ *  \param [in]  Crc    CRC-16 of the data before this block
+ *  \param [in]  Buffer Pointer to the data
+ *  \param [in]  Length Number of bytes of data
+ *
+ *  \return CRC-16 of the data
+ *
+ *  \sa #FM_CrcCalculate
+ */
+uint16 FM_CrcSlice16(uint16 Crc, const uint8 *Buffer, size_t Length);
+
+#ifdef FM_CRC_INCLUDE_PCLMUL
+
+/**
+ *  \brief CRC-16 Carry-less Multiply Kernel Function
+ *
+ *  \par Description
+ *       Computes the cFE CRC-16 by folding the data 64 bytes at a time with
+ *       the PCLMULQDQ instruction, then finishes the folded remainder and
+ *       the last bytes with the slicing tables.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must only be called on a CPU with PCLMULQDQ.  Data shorter than
+ *       #FM_CRC_FOLD_MIN_SIZE is passed to the slicing kernel.
+ *
+ *  \param [in]  Crc    CRC-16 of the data before this block
+ *  \param [in]  Buffer Pointer to the data
+ *  \param [in]  Length Number of bytes of data
+ *
+ *  \return CRC-16 of the data
+ *
+ *  \sa #FM_CrcCalculate, #FM_CrcSlice16
+ */
+uint16 FM_CrcFold16(uint16 Crc, const uint8 *Buffer, size_t Length);
+
+#endif
+
+#endif
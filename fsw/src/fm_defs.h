@@ -53,6 +53,115 @@
 #define FM_NAME_IS_FILE_CLOSED 3
 #define FM_NAME_IS_DIRECTORY   4
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command queue lane definitions                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_CHILD_LANE_INTERACTIVE 0 /**< \brief Short metadata commands, always processed first */
+#define FM_CHILD_LANE_BULK        1 /**< \brief Commands that read or write file data */
+#define FM_CHILD_LANE_COUNT       2
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command queue path arena definitions              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_CHILD_PATH_SOURCE1     0 /**< \brief Queue entry path index for Source1 */
+#define FM_CHILD_PATH_SOURCE2     1 /**< \brief Queue entry path index for Source2 */
+#define FM_CHILD_PATH_TARGET      2 /**< \brief Queue entry path index for Target */
+#define FM_CHILD_PATH_COUNT       3
+#define FM_CHILD_PATH_BLOCK_COUNT (FM_CHILD_PATH_ARENA_SIZE / FM_CHILD_PATH_BLOCK_SIZE)
+#define FM_CHILD_PATH_BLOCK_MAX   ((OS_MAX_PATH_LEN + FM_CHILD_PATH_BLOCK_SIZE - 1) / FM_CHILD_PATH_BLOCK_SIZE)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task job abort definitions                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_CHILD_JOB_ID_NONE  0 /**< \brief Job ID never assigned to a command */
+#define FM_CHILD_ABORT_COUNT  8 /**< \brief Number of executing job abort requests remembered */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task copy checkpoint definitions                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/** \brief Checkpoint target CRC after the kernel copied data, never a valid 16 bit CRC */
+#define FM_CHECKPOINT_CRC_UNKNOWN 0xFFFFFFFF
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task job completion status                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_JOB_STATUS_SUCCESS 0 /**< \brief Command completed without warnings */
+#define FM_JOB_STATUS_WARNING 1 /**< \brief Command completed with warnings */
+#define FM_JOB_STATUS_ERROR   2 /**< \brief Command failed */
+#define FM_JOB_STATUS_ABORTED 3 /**< \brief Command was stopped by an abort command */
+
+#define FM_JOB_VERIFY_NONE     0 /**< \brief Target file was not read back */
+#define FM_JOB_VERIFY_MATCH    1 /**< \brief Target file read back, CRC matches the copied data */
+#define FM_JOB_VERIFY_MISMATCH 2 /**< \brief Target file read back, CRC does not match the copied data */
+
+#define FM_JOB_TIME_UNKNOWN 0xFFFFFFFF /**< \brief Job progress time remaining cannot be estimated */
+
+#define FM_FILE_SIZE_UNKNOWN 0xFFFFFFFF /**< \brief File info allocated size is not available */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM copy file link argument definitions                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_COPY_LINK_NONE  0 /**< \brief Copy the file data */
+#define FM_COPY_LINK_HARD  1 /**< \brief Hard link the target to the source file, falls back to a copy */
+#define FM_COPY_LINK_CLONE 2 /**< \brief Clone the source data copy-on-write, falls back to a copy */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task I/O throttle definitions                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_THROTTLE_ADJUST_MS      100 /**< \brief Minimum time between latency backoff adjustments */
+#define FM_THROTTLE_BACKOFF_DIV    16  /**< \brief Backoff floor and recovery step, fraction of the commanded rate */
+#define FM_THROTTLE_LATENCY_WEIGHT 8   /**< \brief Number of file blocks in the smoothed latency average */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task transfer pipeline definitions                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_PIPELINE_MODE_WRITE  0 /**< \brief Helper writes each block to the target file */
+#define FM_PIPELINE_MODE_CRC    1 /**< \brief Helper adds each block to the pipeline CRC */
+#define FM_PIPELINE_MODE_SPARSE 2 /**< \brief Helper writes each block, seeking over all-zero blocks */
+
+#define FM_CHILD_MIN_BLOCK_SIZE  256 /**< \brief Smallest commanded file I/O block size */
+#define FM_CHILD_BUFFER_COUNT    (FM_CHILD_WORKER_COUNT * (FM_CHILD_PIPELINE_DEPTH + 1))
+#define FM_CHILD_POOL_BLOCK_SIZE (FM_CHILD_MAX_BLOCK_SIZE + FM_CHILD_BUFFER_ALIGNMENT)
+#define FM_CHILD_POOL_OVERHEAD   64 /**< \brief Memory pool bytes used to track each buffer */
+#define FM_CHILD_POOL_SIZE       (FM_CHILD_BUFFER_COUNT * (FM_CHILD_POOL_BLOCK_SIZE + FM_CHILD_POOL_OVERHEAD))
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task CRC engine definitions                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_CRC_KERNEL_SLICE  0 /**< \brief Table-driven slicing-by-8, any CPU */
+#define FM_CRC_KERNEL_PCLMUL 1 /**< \brief Carry-less multiply folding, x86-64 with PCLMULQDQ */
+
+#define FM_CRC_TABLE_SIZE    256 /**< \brief Entries in each CRC table, one per byte value */
+#define FM_CRC_SLICE_COUNT   8   /**< \brief CRC tables, bytes processed by each slicing step */
+#define FM_CRC_FOLD_MIN_SIZE 128 /**< \brief Shorter data is not worth folding */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM free space table entry state definitions                     */
@@ -350,7 +350,9 @@
  *  is unused and appears to be valid. Verify that the target
  *  filename is reasonable.  Also, verify that the file system has
  *  sufficient free space for this operation. Then refer to the OS
- *  specific return value.
+ *  specific return value.  When the file is copied across file
+ *  systems, it is also sent when the target file read back CRC does
+ *  not match the copied data.
  */
 #define FM_MOVE_OS_ERR_EID 23
 
@@ -1510,518 +1512,1360 @@
  */
 #define FM_OS_SYS_STAT_ERR_EID 103
 
-/** -------------------------------------------------------------
- *  NOTE: From here on, the event IDs will take the form of a
- *  "base" EID + an offset.  This is done to allow unique event
- *  IDs to be sent from utility functions.
- ** --------------------------------------------------------------*/
-
-#define FM_FNAME_INVALID_EID_OFFSET  0
-#define FM_FNAME_DNE_EID_OFFSET      1
-#define FM_FNAME_EXIST_EID_OFFSET    1 /* mutually exclusive with DNE */
-#define FM_FNAME_ISDIR_EID_OFFSET    2
-#define FM_FNAME_ISFILE_EID_OFFSET   2 /* mutually exclusive with ISDIR */
-#define FM_FNAME_ISOPEN_EID_OFFSET   3
-#define FM_FNAME_ISCLOSED_EID_OFFSET 4
-/* Unused EID offset 5 */
-#define FM_FNAME_NUM_OFFSETS 6
-
-#define FM_CHILD_DISABLED_EID_OFFSET 0
-#define FM_CHILD_Q_FULL_EID_OFFSET   1
-#define FM_CHILD_BROKEN_EID_OFFSET   2
-#define FM_CHILD_NUM_OFFSETS         3
-
 /**
- * \brief FM Child Task Copy File Source Filename Error Base ID
+ * \brief FM Child Task Pending Commands File Disabled Event ID
  *
  *  \par Type: ERROR
  *
- *  \par Cause
+ *  \par Cause:
  *
- *  This is the base for a number of error events generated when the
- *  /FM_Copy is received with an unusable source filename.
+ *  This event message occurs if the child task pending commands file cannot
+ *  be created during child task initialization.  The application continues to
+ *  run with the pending commands file disabled, so commands are rejected when
+ *  the child task command queue is full.
  */
-#define FM_COPY_SRC_BASE_EID 151
+#define FM_CHILD_PENDING_INIT_ERR_EID 104
 
 /**
- * \brief FM Child Task Copy File Source Name Invalid Event ID
+ * \brief FM Child Task Pending Commands File Write Failed Event ID
  *
  *  \par Type: ERROR
  *
- *  \par Cause
- *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with an invalid source filename.
+ *  \par Cause:
  *
- *  Value: 151
+ *  This event message occurs if a command cannot be added to the child task
+ *  command queue or written to the child task pending commands file after it
+ *  has passed command verification.  The command is not executed.
  */
-#define FM_COPY_SRC_INVALID_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_CHILD_PENDING_WRITE_ERR_EID 105
 
 /**
- * \brief FM Child Task Copy File Source File Does Not Exist Event ID
+ * \brief FM Abort Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a source filename that does not exist.
- *
- *  Value: 152
+ *  This event message signals the successful completion of a
+ *  /FM_Abort command.  The child task stops the command with the
+ *  matching job ID when the command is next dequeued or, if it is
+ *  already executing, at the next abort check in the command loop.
  */
-#define FM_COPY_SRC_DNE_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_ABORT_CMD_EID 106
 
 /**
- * \brief FM Child Task Copy File Source File Name Is Directory Event ID
+ * \brief FM Abort Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a source filename that is a directory.
- *
- *  Value: 153
+ *  This event message is generated upon receipt of a /FM_Abort
+ *  command packet with an invalid length.
  */
-#define FM_COPY_SRC_ISDIR_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_ABORT_PKT_ERR_EID 107
 
 /**
- * \brief FM Child Task Copy File Target Filename Error Base ID
+ * \brief FM Abort Command Job ID Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base EID for a number of error events related to the
- *  target file in an /FM_COPY command.
- *
- *  Value: 157
+ *  This event message is generated upon receipt of a /FM_Abort
+ *  command packet with a job ID that has not been assigned to a
+ *  child task command, or whose command is neither waiting in the
+ *  child task queue nor executing.
  */
-#define FM_COPY_TGT_BASE_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_ABORT_ARG_ERR_EID 108
 
 /**
- * \brief FM Child Task Copy File Target Filename Invalid Event ID
+ * \brief FM Child Task Command Aborted Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with an invalid target filename.
- *
- *  Value: 157
+ *  This event message is generated when the child task stops a
+ *  command because of a /FM_Abort command.  A command aborted while
+ *  waiting in the queue is not started.  A command aborted while
+ *  executing stops at the next abort check and removes any partially
+ *  written target file.
  */
-#define FM_COPY_TGT_INVALID_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_CHILD_ABORT_EID 109
 
 /**
- * \brief FM Child Task Copy File Target File Already Exists Event ID
+ * \brief FM Copy Checkpoint CDS Error Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a target filename that already exists.
- *
- *  Value: 158
+ *  This event message is generated during FM application startup when a
+ *  child task worker copy checkpoint block cannot be registered in, or
+ *  restored from, the cFE Critical Data Store.  Copy and concatenate
+ *  commands executed by that worker still complete, but cannot be resumed
+ *  after a processor reset.
  */
-#define FM_COPY_TGT_EXIST_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_CHECKPOINT_CDS_ERR_EID 110
 
 /**
- * \brief FM Child Task Copy File Target Filename Is A Directory Event ID
+ * \brief FM Copy Checkpoint Save Error Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a target filename that is a directory.
- *
- *  Value: 159
+ *  This event message is generated when a child task worker cannot save a
+ *  copy checkpoint to the cFE Critical Data Store.  Checkpoints are disabled
+ *  for that worker until the FM application is restarted.
  */
-#define FM_COPY_TGT_ISDIR_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_CHECKPOINT_SAVE_ERR_EID 111
 
 /**
- * \brief FM Child Task Copy File Target Filename Exists As Open File Event ID
+ * \brief FM Copy Checkpoint Resume Queued Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a target filename that is open.
- *
- *  Value: 160
+ *  This event message is generated during FM application startup when a
+ *  copy or concatenate command that was executing at the time of a
+ *  processor reset is queued to resume from its most recent checkpoint.
+ *  The resumed command is assigned a new job ID.
  */
-#define FM_COPY_TGT_ISOPEN_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_CHECKPOINT_RESUME_EID 112
 
 /**
- * \brief FM Child Task Copy File Child Task Error Base ID
+ * \brief FM Child Task Copy Resumed Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
- *  the FM child task command queue interface cannot be used.
- *
- *  Value: 163
+ *  This event message is generated when the child task verifies a copy
+ *  checkpoint against the partial target file and the source file, and
+ *  continues the copy from the checkpoint offset.
  */
-#define FM_COPY_CHILD_BASE_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_CHILD_RESUME_EID 113
 
 /**
- * \brief FM Child Task Copy File Child Task Disabled Event ID
+ * \brief FM Child Task Copy Resume Restarted Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
- *
- *  Value: 163
+ *  This event message is generated when a copy checkpoint does not match
+ *  the partial target file (CRC mismatch or file too short) or the source
+ *  file has been modified since the checkpoint was saved.  The copy is
+ *  restarted from the beginning of the first source file.
  */
-#define FM_COPY_CHILD_DISABLED_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_CHILD_RESUME_RESTART_EID 114
 
 /**
- * \brief FM Child Task Copy File Child Task Queue Full Event ID
+ * \brief FM Set Throttle Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
- *
- *  Value: 164
+ *  This event message signals the successful completion of a
+ *  /FM_SetThrottle command.  The new rate limits apply to the next
+ *  block of file data or OS_stat call of every child task worker.
  */
-#define FM_COPY_CHILD_FULL_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_SET_THROTTLE_CMD_EID 115
 
 /**
- * \brief FM Child Task Copy File Child Task Interface Broken Event ID
+ * \brief FM Set Throttle Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 165
- *
+ *  This event message is generated upon receipt of a /FM_SetThrottle
+ *  command packet with an invalid length.
  */
-#define FM_COPY_CHILD_BROKEN_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_SET_THROTTLE_PKT_ERR_EID 116
 
 /**
- * \brief FM Child Task Move File Source Filename Error Base ID
+ * \brief FM Set Throttle Command Rate Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a source filename that is unusable for one
- *  of several reasons.
- *
- *  Value: 166
+ *  This event message is generated upon receipt of a /FM_SetThrottle
+ *  command packet with a file data rate that is not zero (unlimited)
+ *  and is less than one block per second of the current file I/O block
+ *  size.
  */
-#define FM_MOVE_SRC_BASE_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_SET_THROTTLE_ARG_ERR_EID 117
 
 /**
- * \brief FM Child Task Move File Source Filename Invalid Event ID
+ * \brief FM Child Task Initialization Create Throttle Semaphore Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with an invalid source filename.
- *
- *  Value: 166
+ *  This event message indicates an unsuccessful attempt to create the I/O
+ *  throttle semaphore for the FM child task.  Commands which would have otherwise
+ *  been handed off to the child task for execution, will now be processed by the
+ *  main FM application.
  */
-#define FM_MOVE_SRC_INVALID_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_CHILD_INIT_TSEM_ERR_EID 118
 
 /**
- * \brief FM Child Task Move File Source File Does Not Exist Event ID
+ * \brief FM Copy File Command CRC Type Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a source filename that does not exist.
- *
- *  Value: 167
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with an invalid CRC type argument.  The CRC type
+ *  must be #FM_IGNORE_CRC or one of the cFE CRC types.
  */
-#define FM_MOVE_SRC_DNE_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_COPY_CRC_ERR_EID 119
 
 /**
- * \brief FM Child Task Move File Source Filename Is A Directory Event ID
+ * \brief FM Concat Files Command CRC Type Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a source filename that is a directory.
- *
- *  Value: 168
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with an invalid CRC type argument.  The CRC type
+ *  must be #FM_IGNORE_CRC or one of the cFE CRC types.
  */
-#define FM_MOVE_SRC_ISDIR_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_CONCAT_CRC_ERR_EID 120
 
 /**
- * \brief FM Child Task Move File Target Filename Error Base ID
+ * \brief FM Child Task Initialization Create Pipeline Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
- *
- *  Value: 172
+ *  This event message indicates an unsuccessful attempt to create the
+ *  semaphores or the helper task of a child task worker transfer pipeline.
+ *  The worker continues to execute commands, reading and then writing each
+ *  file block itself.
  */
-#define FM_MOVE_TGT_BASE_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_CHILD_INIT_PIPE_ERR_EID 121
 
 /**
- * \brief FM Child Task Move File Target Filename Invalid Event ID
+ * \brief FM Copy File Command Verify Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with an invalid target filename.
- *
- *  Value: 172
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with an invalid verify argument.  The verify argument
+ *  must be zero or one, and one requires a CRC type other than
+ *  #FM_IGNORE_CRC.
  */
-#define FM_MOVE_TGT_INVALID_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_COPY_VERIFY_ERR_EID 122
 
 /**
- * \brief FM Child Task Move File Target File Already Exists Event ID
+ * \brief FM Child Task Copy File Read Back Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a target filename that already exists
- *
- *  Value: 173
+ *  This event message is generated when the target file of a /FM_Copy
+ *  command with the verify argument set cannot be read back, or when
+ *  the CRC of the target file does not match the CRC of the copied data.
+ *  The target file is removed.
  */
-#define FM_MOVE_TGT_EXIST_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_COPY_VERIFY_READ_ERR_EID 123
 
 /**
- * \brief FM Child Task Move File Target Filename Is A Directory Event ID
+ * \brief FM Copy File Command Sparse Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a target filename that is a directory.
- *
- *  Value: 174
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with an invalid sparse argument.  The sparse
+ *  argument must be zero or one.
  */
-#define FM_MOVE_TGT_ISDIR_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_COPY_SPARSE_ERR_EID 124
 
 /**
- * \brief FM Child Task Move File Target File Exists As An Open File Event ID
+ * \brief FM Child Task Initialization Create Buffer Pool Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a target filename that is open.
- *
- *  Value: 175
+ *  This event message indicates an unsuccessful attempt to create the
+ *  child task file I/O buffer memory pool, or to allocate a buffer from it.
+ *  Commands which would have otherwise been handed off to the child task
+ *  for execution, will now be processed by the main FM application.
  */
-#define FM_MOVE_TGT_ISOPEN_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_CHILD_INIT_POOL_ERR_EID 125
 
 /**
- * \brief FM Child Task Move File Child Task Error Base ID
+ * \brief FM Set Block Size Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
- *  the FM child task command queue interface cannot be used.
- *
- *  Value: 178
+ *  This event message signals the successful completion of a
+ *  /FM_SetBlockSize command.  The new block size applies to commands
+ *  that a child task worker starts after this event.
  */
-#define FM_MOVE_CHILD_BASE_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_SET_BLOCK_SIZE_CMD_EID 126
 
 /**
- * \brief FM Child Task Move File Child Task Disabled Event ID
+ * \brief FM Set Block Size Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
- *
- *  Value: 178
+ *  This event message is generated upon receipt of a /FM_SetBlockSize
+ *  command packet with an invalid length.
  */
-#define FM_MOVE_CHILD_DISABLED_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_SET_BLOCK_SIZE_PKT_ERR_EID 127
 
 /**
- * \brief FM Child Task Move File Child Task Queue Full Event ID
+ * \brief FM Set Block Size Command Size Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
- *
- *  Value: 179
+ *  This event message is generated upon receipt of a /FM_SetBlockSize
+ *  command packet with a block size that is less than 256 bytes, greater
+ *  than #FM_CHILD_MAX_BLOCK_SIZE, not a multiple of
+ *  #FM_CHILD_BUFFER_ALIGNMENT, or greater than the throttle file data
+ *  rate per second.
  */
-#define FM_MOVE_CHILD_FULL_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_SET_BLOCK_SIZE_ARG_ERR_EID 128
 
 /**
- * \brief FM Child Task Move File Child Task Inteface Broken Event ID
+ * \brief FM Copy Directory Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: DEBUG
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 180
- *
+ *  This event message signals the successful completion of a
+ *  /FM_CopyDir command.  The event reports the number of directories
+ *  created or reused and the number of files copied.
  */
-#define FM_MOVE_CHILD_BROKEN_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_COPY_DIR_CMD_EID 129
 
 /**
- * \brief FM Child Task Rename File Source Filename Error Base ID
+ * \brief FM Copy Directory Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a source filename that is unusable for one
- *  of several reasons.
- *
- *  Value: 181
+ *  This event message is generated upon receipt of a /FM_CopyDir
+ *  command packet with an invalid length.
  */
-#define FM_RENAME_SRC_BASE_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_COPY_DIR_PKT_ERR_EID 130
 
 /**
- * \brief FM Child Task Rename File Source Filename Invalid Event ID
+ * \brief FM Copy Directory Command Overwrite Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with an invalid source filename.
- *
- *  Value: 181
+ *  This event message is generated upon receipt of a /FM_CopyDir
+ *  command packet with an invalid overwrite argument.  Overwrite
+ *  must be set to TRUE (one) or FALSE (zero).
  */
-#define FM_RENAME_SRC_INVALID_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_COPY_DIR_OVR_ERR_EID 131
 
 /**
- * \brief FM Child Task Rename File Source File Does Not Exist Event ID
+ * \brief FM Copy Directory Command Target Inside Source Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a source filename that does not exist.
- *
- *  Value: 182
+ *  This event message is generated upon receipt of a /FM_CopyDir
+ *  command packet with a target directory that is the source directory
+ *  or a directory below it, which the copy would never finish walking.
  */
-#define FM_RENAME_SRC_DNE_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_COPY_DIR_TGT_NESTED_ERR_EID 132
 
 /**
- * \brief FM Child Task Rename File Source Filename Is Directory Event ID
+ * \brief FM Child Task Copy Directory OS Error Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a source filename that is a directory.
- *
- *  Value: 183
+ *  This event message is generated when the child task cannot create
+ *  a target directory, open or read a source directory, or copy a file
+ *  while executing a /FM_CopyDir command.  The copy stops, directories
+ *  and files already copied are kept.
  */
-#define FM_RENAME_SRC_ISDIR_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_COPY_DIR_OS_ERR_EID 133
 
 /**
- * \brief FM Child Task Rename File Target Filename Error Base ID
+ * \brief FM Child Task Copy Directory Entries Skipped Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
- *
- *  Value: 187
+ *  This event message is generated at the end of a /FM_CopyDir command
+ *  that skipped open files, or entries with a name too long for the
+ *  target, or subdirectories below #FM_CHILD_DIR_TREE_DEPTH levels, or
+ *  files whose target name is a directory.
  */
-#define FM_RENAME_TGT_BASE_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_COPY_DIR_SKIP_WARNING_EID 134
 
 /**
- * \brief FM Child Task Rename File Target Filename Invalid Event ID
+ * \brief FM Delete Directory Tree Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: DEBUG
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with an invalid target filename.
- *
- *  Value: 187
+ *  This event message signals the successful completion of a
+ *  /FM_DeleteTree command.  The event reports the number of files
+ *  and directories removed.
  */
-#define FM_RENAME_TGT_INVALID_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_DELETE_TREE_CMD_EID 135
 
 /**
- * \brief FM Child Task Rename File Target File Already Exists Event ID
+ * \brief FM Delete Directory Tree Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a target filename that already exists.
- *
- *  Value: 188
+ *  This event message is generated upon receipt of a /FM_DeleteTree
+ *  command packet with an invalid length.
  */
-#define FM_RENAME_TGT_EXIST_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_DELETE_TREE_PKT_ERR_EID 136
+
+/**
+ * \brief FM Child Task Delete Directory Tree OS Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the child task cannot open
+ *  the directory named in a /FM_DeleteTree command.  Nothing is
+ *  removed.
+ */
+#define FM_DELETE_TREE_OS_ERR_EID 137
+
+/**
+ * \brief FM Child Task Delete Directory Tree Entries Skipped Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause
+ *
+ *  This event message is generated at the end of a /FM_DeleteTree
+ *  command that skipped open files, or entries that could not be
+ *  removed, or subdirectories below #FM_CHILD_DIR_TREE_DEPTH levels.
+ *  Directories that still hold a skipped entry are not removed.
+ */
+#define FM_DELETE_TREE_SKIP_WARNING_EID 138
+
+/**
+ * \brief FM Delete Filtered Files Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause
+ *
+ *  This event message signals the successful completion of a
+ *  /FM_DeleteFilter command.  The event reports the number of files
+ *  deleted.
+ */
+#define FM_DELETE_FILTER_CMD_EID 139
+
+/**
+ * \brief FM Delete Filtered Files Command Length Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteFilter
+ *  command packet with an invalid length.
+ */
+#define FM_DELETE_FILTER_PKT_ERR_EID 140
+
+/**
+ * \brief FM Delete Filtered Files Command Argument Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteFilter
+ *  command packet with a pattern that is empty, unterminated or holds a
+ *  path separator, or with a minimum age or size that is greater than
+ *  the non-zero maximum.
+ */
+#define FM_DELETE_FILTER_ARG_ERR_EID 141
+
+/**
+ * \brief FM Child Task Delete Filtered Files OS Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the child task cannot open
+ *  the directory named in a /FM_DeleteFilter command.  Nothing is
+ *  deleted.
+ */
+#define FM_DELETE_FILTER_OS_ERR_EID 142
+
+/**
+ * \brief FM Child Task Delete Filtered Files Entries Skipped Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause
+ *
+ *  This event message is generated at the end of a /FM_DeleteFilter
+ *  command that selected open files, subdirectories, or files that
+ *  could not be deleted.
+ */
+#define FM_DELETE_FILTER_SKIP_WARNING_EID 143
+
+/**
+ * \brief FM Concat File List Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause
+ *
+ *  This event message signals the successful completion of a
+ *  /FM_ConcatList command.  The event reports the number of source
+ *  files appended to the target file.
+ *
+ *  Note that the execution of this command generally occurs within the
+ *  context of the FM low priority child task.  Thus this event may not
+ *  occur until some time after the command was invoked.  However, this
+ *  event message does signal the actual completion of the command.
+ */
+#define FM_CONCAT_LIST_CMD_EID 144
+
+/**
+ * \brief FM Concat File List Command Length Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with an invalid length.
+ */
+#define FM_CONCAT_LIST_PKT_ERR_EID 145
+
+/**
+ * \brief FM Concat File List Command CRC Type Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with an invalid CRC type argument.  The CRC type
+ *  must be #FM_IGNORE_CRC or one of the cFE CRC types.
+ */
+#define FM_CONCAT_LIST_CRC_ERR_EID 146
+
+/**
+ * \brief FM Child Task Concat File List Invalid List Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the source list named in a
+ *  /FM_ConcatList command cannot be used.  The list file cannot be
+ *  read, names no source files, holds a line that is too long for a
+ *  path, or names a source that is not a closed file or that is the
+ *  target file.  A resumed command also fails when the list no longer
+ *  names the source that was being appended.
+ */
+#define FM_CONCAT_LIST_ERR_EID 147
+
+/**
+ * \brief FM Child Task Concat File List OS Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when a source file cannot be opened
+ *  or read, or the target file cannot be opened or written, while a
+ *  /FM_ConcatList command is executing.  The partial target file is
+ *  removed.
+ */
+#define FM_CONCAT_LIST_OS_ERR_EID 148
+
+/**
+ * \brief FM Split File Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause
+ *
+ *  This event message signals the successful completion of a
+ *  /FM_Split command.  The event reports the number of segment files
+ *  written.
+ *
+ *  Note that the execution of this command generally occurs within the
+ *  context of the FM low priority child task.  Thus this event may not
+ *  occur until some time after the command was invoked.  However, this
+ *  event message does signal the actual completion of the command.
+ */
+#define FM_SPLIT_CMD_EID 149
+
+/**
+ * \brief FM Split File Command Length Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Split
+ *  command packet with an invalid length.
+ */
+#define FM_SPLIT_PKT_ERR_EID 150
+
+/**
+ * \brief FM Split File Command Segment Size Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Split
+ *  command packet with a segment size of zero.
+ */
+#define FM_SPLIT_SIZE_ERR_EID 151
+
+/**
+ * \brief FM Split File Command CRC Type Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Split
+ *  command packet with an invalid CRC type argument.  The CRC type
+ *  must be #FM_IGNORE_CRC or one of the cFE CRC types.
+ */
+#define FM_SPLIT_CRC_ERR_EID 152
+
+/**
+ * \brief FM Child Task Split File Invalid Segment Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when a /FM_Split command cannot
+ *  create its segment files.  The source file needs more than
+ *  #FM_CHILD_SPLIT_MAX_SEGMENTS segments, a segment filename is too
+ *  long for a path, or a segment file already exists.  No segment
+ *  file has been written.
+ */
+#define FM_SPLIT_SEGMENT_ERR_EID 153
+
+/**
+ * \brief FM Child Task Split File OS Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the source file cannot be
+ *  opened or read, or a segment file or the manifest file cannot be
+ *  opened or written, while a /FM_Split command is executing.  The
+ *  segment files already written and the manifest file are removed.
+ */
+#define FM_SPLIT_OS_ERR_EID 154
+
+/**
+ * \brief FM Preallocate File Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause
+ *
+ *  This event message signals the successful completion of a
+ *  /FM_Preallocate command.  The event reports whether the space was
+ *  reserved by fallocate or by writing zero blocks.
+ *
+ *  Note that the execution of this command generally occurs within the
+ *  context of the FM low priority child task.  Thus this event may not
+ *  occur until some time after the command was invoked.  However, this
+ *  event message does signal the actual completion of the command.
+ */
+#define FM_PREALLOCATE_CMD_EID 155
+
+/**
+ * \brief FM Preallocate File Command Length Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Preallocate
+ *  command packet with an invalid length.
+ */
+#define FM_PREALLOCATE_PKT_ERR_EID 156
+
+/**
+ * \brief FM Preallocate File Command Size Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Preallocate
+ *  command packet with a file size of zero.
+ */
+#define FM_PREALLOCATE_SIZE_ERR_EID 157
+
+/**
+ * \brief FM Child Task Preallocate File OS Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the file cannot be opened,
+ *  sized or written while a /FM_Preallocate command is executing.  Any
+ *  zero blocks already written are left in the file.
+ */
+#define FM_PREALLOCATE_OS_ERR_EID 158
+
+/**
+ * \brief FM Truncate File Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause
+ *
+ *  This event message signals the successful completion of a
+ *  /FM_Truncate command.
+ *
+ *  Note that the execution of this command generally occurs within the
+ *  context of the FM low priority child task.  Thus this event may not
+ *  occur until some time after the command was invoked.  However, this
+ *  event message does signal the actual completion of the command.
+ */
+#define FM_TRUNCATE_CMD_EID 159
+
+/**
+ * \brief FM Truncate File Command Length Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Truncate
+ *  command packet with an invalid length.
+ */
+#define FM_TRUNCATE_PKT_ERR_EID 160
+
+/**
+ * \brief FM Child Task Truncate File Size Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the commanded size of a
+ *  /FM_Truncate command is greater than the current file size.  The
+ *  file is not changed.
+ */
+#define FM_TRUNCATE_SIZE_ERR_EID 161
+
+/**
+ * \brief FM Child Task Truncate File OS Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the file cannot be sized or
+ *  truncated while a /FM_Truncate command is executing.
+ */
+#define FM_TRUNCATE_OS_ERR_EID 162
+
+/**
+ * \brief FM Truncate File Command Not Supported Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Truncate
+ *  command packet when FM was built without #FM_INCLUDE_FILE_TRUNCATE.
+ */
+#define FM_TRUNCATE_UNSUPPORTED_ERR_EID 163
+
+/**
+ * \brief FM Copy File Command Link Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with an invalid link argument.  The link argument
+ *  must be one of the #FM_COPY_LINK_NONE values, and a linked copy
+ *  cannot have a CRC type since no data passes through FM.
+ */
+#define FM_COPY_LINK_ERR_EID 164
+
+/**
+ * \brief FM Copy File Command Link Target Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet that requests a linked copy with the same source
+ *  and target filename.  The existing target is removed before the
+ *  link is made, so the copy would delete the source file.
+ */
+#define FM_COPY_LINK_SAME_ERR_EID 165
+
+/** -------------------------------------------------------------
+ *  NOTE: From here on, the event IDs will take the form of a
+ *  "base" EID + an offset.  This is done to allow unique event
+ *  IDs to be sent from utility functions.  The event IDs above
+ *  must stay below #FM_COPY_SRC_BASE_EID.
+ ** --------------------------------------------------------------*/
+
+#define FM_FNAME_INVALID_EID_OFFSET  0
+#define FM_FNAME_DNE_EID_OFFSET      1
+#define FM_FNAME_EXIST_EID_OFFSET    1 /* mutually exclusive with DNE */
+#define FM_FNAME_ISDIR_EID_OFFSET    2
+#define FM_FNAME_ISFILE_EID_OFFSET   2 /* mutually exclusive with ISDIR */
+#define FM_FNAME_ISOPEN_EID_OFFSET   3
+#define FM_FNAME_ISCLOSED_EID_OFFSET 4
+/* Unused EID offset 5 */
+#define FM_FNAME_NUM_OFFSETS 6
+
+#define FM_CHILD_DISABLED_EID_OFFSET 0
+#define FM_CHILD_Q_FULL_EID_OFFSET   1
+#define FM_CHILD_BROKEN_EID_OFFSET   2
+#define FM_CHILD_NUM_OFFSETS         3
+
+/**
+ * \brief FM Child Task Copy File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for a number of error events generated when the
+ *  /FM_Copy is received with an unusable source filename.
+ */
+#define FM_COPY_SRC_BASE_EID 201
+
+/**
+ * \brief FM Child Task Copy File Source Name Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 201
+ */
+#define FM_COPY_SRC_INVALID_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Source File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with a source filename that does not exist.
+ *
+ *  Value: 202
+ */
+#define FM_COPY_SRC_DNE_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Source File Name Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 203
+ */
+#define FM_COPY_SRC_ISDIR_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base EID for a number of error events related to the
+ *  target file in an /FM_COPY command.
+ *
+ *  Value: 207
+ */
+#define FM_COPY_TGT_BASE_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Copy File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with an invalid target filename.
+ *
+ *  Value: 207
+ */
+#define FM_COPY_TGT_INVALID_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Target File Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with a target filename that already exists.
+ *
+ *  Value: 208
+ */
+#define FM_COPY_TGT_EXIST_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Target Filename Is A Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 209
+ */
+#define FM_COPY_TGT_ISDIR_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Target Filename Exists As Open File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with a target filename that is open.
+ *
+ *  Value: 210
+ */
+#define FM_COPY_TGT_ISOPEN_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 213
+ */
+#define FM_COPY_CHILD_BASE_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Copy File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 213
+ */
+#define FM_COPY_CHILD_DISABLED_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 214
+ */
+#define FM_COPY_CHILD_FULL_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Child Task Interface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 215
+ *
+ */
+#define FM_COPY_CHILD_BROKEN_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a source filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 216
+ */
+#define FM_MOVE_SRC_BASE_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Move File Source Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 216
+ */
+#define FM_MOVE_SRC_INVALID_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Source File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a source filename that does not exist.
+ *
+ *  Value: 217
+ */
+#define FM_MOVE_SRC_DNE_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Source Filename Is A Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 218
+ */
+#define FM_MOVE_SRC_ISDIR_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 222
+ */
+#define FM_MOVE_TGT_BASE_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Move File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with an invalid target filename.
+ *
+ *  Value: 222
+ */
+#define FM_MOVE_TGT_INVALID_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Target File Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a target filename that already exists
+ *
+ *  Value: 223
+ */
+#define FM_MOVE_TGT_EXIST_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Target Filename Is A Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 224
+ */
+#define FM_MOVE_TGT_ISDIR_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Target File Exists As An Open File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a target filename that is open.
+ *
+ *  Value: 225
+ */
+#define FM_MOVE_TGT_ISOPEN_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 228
+ */
+#define FM_MOVE_CHILD_BASE_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Move File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 228
+ */
+#define FM_MOVE_CHILD_DISABLED_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 229
+ */
+#define FM_MOVE_CHILD_FULL_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 230
+ *
+ */
+#define FM_MOVE_CHILD_BROKEN_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a source filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 231
+ */
+#define FM_RENAME_SRC_BASE_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Rename File Source Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 231
+ */
+#define FM_RENAME_SRC_INVALID_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Source File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a source filename that does not exist.
+ *
+ *  Value: 232
+ */
+#define FM_RENAME_SRC_DNE_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Source Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 233
+ */
+#define FM_RENAME_SRC_ISDIR_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 237
+ */
+#define FM_RENAME_TGT_BASE_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Rename File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with an invalid target filename.
+ *
+ *  Value: 237
+ */
+#define FM_RENAME_TGT_INVALID_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Target File Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a target filename that already exists.
+ *
+ *  Value: 238
+ */
+#define FM_RENAME_TGT_EXIST_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
 
 /**
  * \brief FM Child Task Rename File Target Filename Is Directory Event ID
@@ -2030,43 +2874,1088 @@
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a target filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 239
+ */
+#define FM_RENAME_TGT_ISDIR_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Target Filename Exists As Open File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a target filename that is open.
+ *
+ *  Value: 240
+ */
+#define FM_RENAME_TGT_ISOPEN_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 243
+ */
+#define FM_RENAME_CHILD_BASE_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Rename File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 243
+ */
+#define FM_RENAME_CHILD_DISABLED_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 244
+ */
+#define FM_RENAME_CHILD_FULL_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 245
+ *
+ */
+#define FM_RENAME_CHILD_BROKEN_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a source filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 246
+ */
+#define FM_DELETE_SRC_BASE_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete File Source Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 246
+ */
+#define FM_DELETE_SRC_INVALID_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Source File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a source filename that does not exist.
+ *
+ *  Value: 247
+ */
+#define FM_DELETE_SRC_DNE_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Source Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 248
+ */
+#define FM_DELETE_SRC_ISDIR_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File File Is Open Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a source filename that is already open.
+ *
+ *  Value: 249
+ */
+#define FM_DELETE_SRC_OPEN_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 252
+ */
+#define FM_DELETE_CHILD_BASE_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 252
+ */
+#define FM_DELETE_CHILD_DISABLED_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 253
+ */
+#define FM_DELETE_CHILD_FULL_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 254
+ *
+ */
+#define FM_DELETE_CHILD_BROKEN_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Directory Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteAll
+ *  command packet with a directory name that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 255
+ */
+#define FM_DELETE_ALL_SRC_BASE_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete All Files Directory Name Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 255
+ */
+#define FM_DELETE_ALL_SRC_INVALID_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Directory Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteAll
+ *  command packet with a directory name that does not exist.
+ *
+ *  Value: 256
+ */
+#define FM_DELETE_ALL_SRC_DNE_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Directory Name Is A File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a directory name that is a file.
+ *
+ *  Value: 257
+ */
+#define FM_DELETE_ALL_SRC_FILE_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 261
+ */
+#define FM_DELETE_ALL_CHILD_BASE_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete All Files Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 261
+ */
+#define FM_DELETE_ALL_CHILD_DISABLED_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 262
+ */
+#define FM_DELETE_ALL_CHILD_FULL_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 263
+ *
+ */
+#define FM_DELETE_ALL_CHILD_BROKEN_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a source filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 264
+ */
+#define FM_DECOM_SRC_BASE_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Decompress File Source Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 264
+ */
+#define FM_DECOM_SRC_INVALID_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Source Filename Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a source filename that does not exist.
+ *
+ *  Value: 265
+ */
+#define FM_DECOM_SRC_DNE_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Source Filename Is A Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 266
+ */
+#define FM_DECOM_SRC_ISDIR_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Source File Is Open Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a source filename that is already open.
+ *
+ *  Value: 267
+ */
+#define FM_DECOM_SRC_OPEN_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 270
+ */
+#define FM_DECOM_TGT_BASE_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Decompress File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with an invalid target filename.
+ *
+ *  Value: 270
+ */
+#define FM_DECOM_TGT_INVALID_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Target File Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a target filename that already exists.
+ *
+ *  Value: 271
+ */
+#define FM_DECOM_TGT_EXIST_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Target Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 272
+ */
+#define FM_DECOM_TGT_ISDIR_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 276
+ */
+#define FM_DECOM_CHILD_BASE_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Decompress File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 276
+ */
+#define FM_DECOM_CHILD_DISABLED_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 277
+ */
+#define FM_DECOM_CHILD_FULL_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 278
+ *
+ */
+#define FM_DECOM_CHILD_BROKEN_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source 1 filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 279
+ */
+#define FM_CONCAT_SRC1_BASE_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with an invalid source 1 filename.
+ *
+ *  Value: 279
+ */
+#define FM_CONCAT_SRC1_INVALID_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source 1 filename that does not exist.
+ *
+ *  Value: 280
+ */
+#define FM_CONCAT_SRC1_DNE_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 281
+ */
+#define FM_CONCAT_SRC1_ISDIR_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 File Already Open Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source filename that is already open.
+ *
+ *  Value: 282
+ */
+#define FM_CONCAT_SRC1_OPEN_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source 2 filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 285
+ */
+#define FM_CONCAT_SRC2_BASE_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with an invalid source 2 filename.
+ *
+ *  Value: 285
+ */
+#define FM_CONCAT_SRC2_INVALID_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source 2 filename that does not exist.
+ *
+ *  Value: 286
+ */
+#define FM_CONCAT_SRC2_DNE_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 287
+ */
+#define FM_CONCAT_SRC2_ISDIR_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 File Already Open Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source filename that is already open.
+ *
+ *  Value: 288
+ */
+#define FM_CONCAT_SRC2_OPEN_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 291
+ */
+#define FM_CONCAT_TGT_BASE_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Concat Files Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with an invalid target filename.
+ *
+ *  Value: 291
+ */
+#define FM_CONCAT_TGT_INVALID_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Target Filename Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a target filename that already exists.
+ *
+ *  Value: 292
+ */
+#define FM_CONCAT_TGT_EXIST_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Target Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 293
+ */
+#define FM_CONCAT_TGT_ISDIR_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 297
+ */
+#define FM_CONCAT_CHILD_BASE_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Concat Files Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 297
+ */
+#define FM_CONCAT_CHILD_DISABLED_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 298
+ */
+#define FM_CONCAT_CHILD_FULL_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 299
+ *
+ */
+#define FM_CONCAT_CHILD_BROKEN_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Get File Info Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 300
+ */
+#define FM_FILE_INFO_CHILD_BASE_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Get File Info Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 300
+ */
+#define FM_FILE_INFO_CHILD_DISABLED_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Get File Info Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 301
+ */
+#define FM_FILE_INFO_CHILD_FULL_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Get File Info Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 302
+ *
+ */
+#define FM_FILE_INFO_CHILD_BROKEN_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory, Directory Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Create
+ *  command packet with a directory name that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 303
+ */
+#define FM_CREATE_DIR_SRC_BASE_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Create Directory Name Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Create
+ *  command packet with an invalid directory name.
+ *
+ *  Value: 303
+ */
+#define FM_CREATE_DIR_SRC_INVALID_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Name Exists As File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Create
+ *  command packet with a directory name that exists as a file.
+ *
+ *  Value: 304
+ */
+#define FM_CREATE_DIR_SRC_DNE_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Create
+ *  command pasket with a directory that already exists.
  *
- *  Value: 189
+ *  Value: 305
  */
-#define FM_RENAME_TGT_ISDIR_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_CREATE_DIR_SRC_ISDIR_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Rename File Target Filename Exists As Open File Event ID
+ * \brief FM Child Task Create Directory Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a target filename that is open.
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
  *
- *  Value: 190
+ *  Value: 309
  */
-#define FM_RENAME_TGT_ISOPEN_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_CREATE_DIR_CHILD_BASE_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Rename File Child Task Error Base ID
+ * \brief FM Child Task Create Directory Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 309
+ */
+#define FM_CREATE_DIR_CHILD_DISABLED_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 310
+ */
+#define FM_CREATE_DIR_CHILD_FULL_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 311
+ *
+ */
+#define FM_CREATE_DIR_CHILD_BROKEN_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete Directory, Directory Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteDir
+ *  command packet with a directory name that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 312
+ */
+#define FM_DELETE_DIR_SRC_BASE_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete Directory Name Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteDir
+ *  command packet with an invalid directory name.
+ *
+ *  Value: 312
+ */
+#define FM_DELETE_DIR_SRC_INVALID_ERR_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete Directory Name Exists As File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteDir
+ *  command packet with a directory name that exists as a file.
+ *
+ *  Value: 313
+ */
+#define FM_DELETE_DIR_SRC_DNE_ERR_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete Directory Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 193
+ *  Value: 318
  */
-#define FM_RENAME_CHILD_BASE_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_DELETE_DIR_CHILD_BASE_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Rename File Child Task Disabled Event ID
+ * \brief FM Child Task Delete Directory Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -2075,12 +3964,12 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 193
+ *  Value: 318
  */
-#define FM_RENAME_CHILD_DISABLED_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_DELETE_DIR_CHILD_DISABLED_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Rename File Child Task Queue Full Event ID
+ * \brief FM Child Task Delete Directory Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
@@ -2096,12 +3985,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 194
+ *  Value: 319
  */
-#define FM_RENAME_CHILD_FULL_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_DELETE_DIR_CHILD_FULL_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Rename File Child Task Inteface Broken Event ID
+ * \brief FM Child Task Delete Directory Child Task Inteface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -2116,84 +4005,113 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 195
+ *  Value: 320
  *
  */
-#define FM_RENAME_CHILD_BROKEN_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_DELETE_DIR_CHILD_BROKEN_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Source Filename Error Base ID
+ * \brief FM Child Task Directory List to File Source Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a source filename that is unusable for one
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a source directory name that is unusable for one
  *  of several reasons.
  *
- *  Value: 196
+ *  Value: 321
  */
-#define FM_DELETE_SRC_BASE_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_GET_DIR_FILE_SRC_BASE_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete File Source Filename Invalid Event ID
+ * \brief FM Child Task Directory List to File Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with an invalid source filename.
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with an invalid source directory name.
  *
- *  Value: 196
+ *  Value: 321
  */
-#define FM_DELETE_SRC_INVALID_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_DIR_FILE_SRC_INVALID_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Source File Does Not Exist Event ID
+ * \brief FM Child Task Directory List to File Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a source filename that does not exist.
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a source directory name that does not exist.
  *
- *  Value: 197
+ *  Value: 322
  */
-#define FM_DELETE_SRC_DNE_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_GET_DIR_FILE_SRC_DNE_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Source Filename Is Directory Event ID
+ * \brief FM Child Task Directory List to File Directory Name Is File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a source filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a source directory name that is a file.
  *
- *  Value: 198
+ *  Value: 323
  */
-#define FM_DELETE_SRC_ISDIR_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_GET_DIR_FILE_SRC_ISDIR_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File File Is Open Event ID
+ * \brief FM Child Task Directory List to File Target Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a source filename that is already open.
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
  *
- *  Value: 199
+ *  Value: 327
  */
-#define FM_DELETE_SRC_OPEN_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_GET_DIR_FILE_TGT_BASE_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete File Child Task Error Base ID
+ * \brief FM Child Task Directory List to File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with an invalid target file name.
+ *
+ *  Value: 327
+ */
+#define FM_GET_DIR_FILE_TGT_INVALID_ERR_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Directory List to File Target Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 329
+ */
+#define FM_GET_DIR_FILE_TGT_ISDIR_ERR_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Directory List to File Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
@@ -2202,12 +4120,12 @@
  *  This is the base for any of several messages that are  generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 202
+ *  Value: 333
  */
-#define FM_DELETE_CHILD_BASE_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_GET_DIR_FILE_CHILD_BASE_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete File Child Task Disabled Event ID
+ * \brief FM Child Task Directory List to File Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -2216,12 +4134,12 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 202
+ *  Value: 333
  */
-#define FM_DELETE_CHILD_DISABLED_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_GET_DIR_FILE_CHILD_DISABLED_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Child Task Queue Full Event ID
+ * \brief FM Child Task Directory List to File Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
@@ -2237,12 +4155,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 203
+ *  Value: 334
  */
-#define FM_DELETE_CHILD_FULL_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_GET_DIR_FILE_CHILD_FULL_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Child Task Inteface Broken Event ID
+ * \brief FM Child Task Directory List to File Child Task Inteface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -2257,70 +4175,70 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 204
+ *  Value: 335
  *
  */
-#define FM_DELETE_CHILD_BROKEN_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_GET_DIR_FILE_CHILD_BROKEN_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Directory Error Base ID
+ * \brief FM Child Task Directory List to Packet Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteAll
- *  command packet with a directory name that is unusable for one
+ *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  command packet with a source directory name that is unusable for one
  *  of several reasons.
  *
- *  Value: 205
+ *  Value: 336
  */
-#define FM_DELETE_ALL_SRC_BASE_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_GET_DIR_PKT_SRC_BASE_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete All Files Directory Name Invalid Event ID
+ * \brief FM Child Task Directory List to Packet Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with an invalid source filename.
+ *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  command packet with an invalid source directory name.
  *
- *  Value: 205
+ *  Value: 336
  */
-#define FM_DELETE_ALL_SRC_INVALID_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_DIR_PKT_SRC_INVALID_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Directory Does Not Exist Event ID
+ * \brief FM Child Task Directory List to Packet Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteAll
- *  command packet with a directory name that does not exist.
+ *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  command packet with a source directory name that does not exist.
  *
- *  Value: 206
+ *  Value: 337
  */
-#define FM_DELETE_ALL_SRC_DNE_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_GET_DIR_PKT_SRC_DNE_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Directory Name Is A File Event ID
+ * \brief FM Child Task Directory List to Packet Directory Is File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a directory name that is a file.
+ *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  command packet with a source directory name that is a file.
  *
- *  Value: 207
+ *  Value: 338
  */
-#define FM_DELETE_ALL_SRC_FILE_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+#define FM_GET_DIR_PKT_SRC_ISDIR_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Child Task Error Base ID
+ * \brief FM Child Task Directory List to Packet Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
@@ -2329,12 +4247,12 @@
  *  This is the base for any of several messages that are  generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 211
+ *  Value: 342
  */
-#define FM_DELETE_ALL_CHILD_BASE_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_GET_DIR_PKT_CHILD_BASE_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete All Files Child Task Disabled Event ID
+ * \brief FM Child Task Directory List to Packet Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -2343,12 +4261,12 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 211
+ *  Value: 342
  */
-#define FM_DELETE_ALL_CHILD_DISABLED_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_GET_DIR_PKT_CHILD_DISABLED_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Child Task Queue Full Event ID
+ * \brief FM Child Task Directory List to Packet Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
@@ -2364,12 +4282,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 212
+ *  Value: 343
  */
-#define FM_DELETE_ALL_CHILD_FULL_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_GET_DIR_PKT_CHILD_FULL_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Child Task Inteface Broken Event ID
+ * \brief FM Child Task Directory List to Packet Child Task Inteface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -2384,141 +4302,186 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 213
+ *  Value: 344
  *
  */
-#define FM_DELETE_ALL_CHILD_BROKEN_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_GET_DIR_PKT_CHILD_BROKEN_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Source Filename Error Base ID
+ * \brief FM Copy Checkpoint Resume Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a source filename that is unusable for one
- *  of several reasons.
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used to resume a
+ *  checkpointed copy during FM application startup.
  *
- *  Value: 214
+ *  Value: 345
  */
-#define FM_DECOM_SRC_BASE_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_CHECKPOINT_CHILD_BASE_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Decompress File Source Filename Invalid Event ID
+ * \brief FM Copy Checkpoint Resume Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with an invalid source filename.
+ *  This event message is generated when a checkpointed copy cannot be
+ *  resumed because the child task is disabled.
  *
- *  Value: 214
+ *  Value: 345
  */
-#define FM_DECOM_SRC_INVALID_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_CHECKPOINT_CHILD_DISABLED_ERR_EID (FM_CHECKPOINT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Source Filename Does Not Exist Event ID
+ * \brief FM Copy Checkpoint Resume Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a source filename that does not exist.
+ *  This event message is generated when a checkpointed copy cannot be
+ *  resumed because the child task command queue is full.
  *
- *  Value: 215
+ *  Value: 346
  */
-#define FM_DECOM_SRC_DNE_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_CHECKPOINT_CHILD_FULL_ERR_EID (FM_CHECKPOINT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Source Filename Is A Directory Event ID
+ * \brief FM Copy Checkpoint Resume Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a source filename that is a directory.
+ *  This event message is generated when a checkpointed copy cannot be
+ *  resumed because the interface between the main task and child task
+ *  is broken.
  *
- *  Value: 216
+ *  Value: 347
  */
-#define FM_DECOM_SRC_ISDIR_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_CHECKPOINT_CHILD_BROKEN_ERR_EID (FM_CHECKPOINT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Source File Is Open Event ID
+ * \brief FM Copy Directory Source Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a source filename that is already open.
+ *  This event message is generated upon receipt of a /FM_CopyDir
+ *  command packet with a source directory name that is unusable for
+ *  one of several reasons.
  *
- *  Value: 217
+ *  Value: 348
  */
-#define FM_DECOM_SRC_OPEN_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_COPY_DIR_SRC_BASE_EID (FM_CHECKPOINT_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Decompress File Target Filename Error Base ID
+ * \brief FM Copy Directory Source Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
+ *  This event message is generated upon receipt of a /FM_CopyDir
+ *  command packet with an invalid source directory name.
  *
- *  Value: 220
+ *  Value: 348
  */
-#define FM_DECOM_TGT_BASE_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_COPY_DIR_SRC_INVALID_ERR_EID (FM_COPY_DIR_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Target Filename Invalid Event ID
+ * \brief FM Copy Directory Source Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with an invalid target filename.
+ *  This event message is generated upon receipt of a /FM_CopyDir
+ *  command packet with a source directory name that does not exist.
  *
- *  Value: 220
+ *  Value: 349
  */
-#define FM_DECOM_TGT_INVALID_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_COPY_DIR_SRC_DNE_ERR_EID (FM_COPY_DIR_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Target File Already Exists Event ID
+ * \brief FM Copy Directory Source Directory Name Is A File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a target filename that already exists.
+ *  This event message is generated upon receipt of a /FM_CopyDir
+ *  command packet with a source directory name that is a file.
  *
- *  Value: 221
+ *  Value: 350
  */
-#define FM_DECOM_TGT_EXIST_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_COPY_DIR_SRC_FILE_ERR_EID (FM_COPY_DIR_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Target Filename Is Directory Event ID
+ * \brief FM Copy Directory Target Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a target filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_CopyDir
+ *  command packet with a target directory name that is unusable for
+ *  one of several reasons.
  *
- *  Value: 222
+ *  Value: 354
  */
-#define FM_DECOM_TGT_ISDIR_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_COPY_DIR_TGT_BASE_EID (FM_COPY_DIR_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Decompress File Child Task Error Base ID
+ * \brief FM Copy Directory Target Directory Name Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_CopyDir
+ *  command packet with an invalid target directory name.
+ *
+ *  Value: 354
+ */
+#define FM_COPY_DIR_TGT_INVALID_ERR_EID (FM_COPY_DIR_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Copy Directory Target Directory Name Is A File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_CopyDir
+ *  command packet with a target directory name that is a file.
+ *
+ *  Value: 355
+ */
+#define FM_COPY_DIR_TGT_FILE_ERR_EID (FM_COPY_DIR_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+
+/**
+ * \brief FM Copy Directory Target Directory Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_CopyDir
+ *  command packet with the overwrite argument set to FALSE and a
+ *  target directory that already exists.
+ *
+ *  Value: 356
+ */
+#define FM_COPY_DIR_TGT_EXIST_ERR_EID (FM_COPY_DIR_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Copy Directory Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
@@ -2527,12 +4490,12 @@
  *  This is the base for any of several messages that are  generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 226
+ *  Value: 360
  */
-#define FM_DECOM_CHILD_BASE_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_COPY_DIR_CHILD_BASE_EID (FM_COPY_DIR_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Decompress File Child Task Disabled Event ID
+ * \brief FM Copy Directory Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -2541,33 +4504,26 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 226
+ *  Value: 360
  */
-#define FM_DECOM_CHILD_DISABLED_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_COPY_DIR_CHILD_DISABLED_ERR_EID (FM_COPY_DIR_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Child Task Queue Full Event ID
+ * \brief FM Copy Directory Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
  *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
+ *  interface cannot be used because the child task command queue is full.
  *
- *  Value: 227
+ *  Value: 361
  */
-#define FM_DECOM_CHILD_FULL_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_COPY_DIR_CHILD_FULL_ERR_EID (FM_COPY_DIR_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Child Task Inteface Broken Event ID
+ * \brief FM Copy Directory Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -2577,891 +4533,853 @@
  *  interface cannot be used because the interface between the main task
  *  and child task is broken.
  *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
+ *  Value: 362
+ */
+#define FM_COPY_DIR_CHILD_BROKEN_ERR_EID (FM_COPY_DIR_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Delete Directory Tree Directory Error Base ID
  *
- *  Value: 228
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteTree
+ *  command packet with a directory name that is unusable for one of
+ *  several reasons.
  *
+ *  Value: 363
  */
-#define FM_DECOM_CHILD_BROKEN_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_DELETE_TREE_SRC_BASE_EID (FM_COPY_DIR_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Source 1 Filename Error Base ID
+ * \brief FM Delete Directory Tree Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source 1 filename that is unusable for one
- *  of several reasons.
+ *  This event message is generated upon receipt of a /FM_DeleteTree
+ *  command packet with an invalid directory name.
  *
- *  Value: 229
+ *  Value: 363
  */
-#define FM_CONCAT_SRC1_BASE_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_DELETE_TREE_SRC_INVALID_ERR_EID (FM_DELETE_TREE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 1 Filename Invalid Event ID
+ * \brief FM Delete Directory Tree Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with an invalid source 1 filename.
+ *  This event message is generated upon receipt of a /FM_DeleteTree
+ *  command packet with a directory name that does not exist.
  *
- *  Value: 229
+ *  Value: 364
  */
-#define FM_CONCAT_SRC1_INVALID_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_DELETE_TREE_SRC_DNE_ERR_EID (FM_DELETE_TREE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 1 File Does Not Exist Event ID
+ * \brief FM Delete Directory Tree Directory Name Is A File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source 1 filename that does not exist.
+ *  This event message is generated upon receipt of a /FM_DeleteTree
+ *  command packet with a directory name that is a file.
  *
- *  Value: 230
+ *  Value: 365
  */
-#define FM_CONCAT_SRC1_DNE_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_DELETE_TREE_SRC_FILE_ERR_EID (FM_DELETE_TREE_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 1 Filename Is Directory Event ID
+ * \brief FM Delete Directory Tree Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source filename that is a directory.
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
  *
- *  Value: 231
+ *  Value: 369
  */
-#define FM_CONCAT_SRC1_ISDIR_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_DELETE_TREE_CHILD_BASE_EID (FM_DELETE_TREE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Source 1 File Already Open Event ID
+ * \brief FM Delete Directory Tree Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source filename that is already open.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
  *
- *  Value: 232
+ *  Value: 369
  */
-#define FM_CONCAT_SRC1_OPEN_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_DELETE_TREE_CHILD_DISABLED_ERR_EID (FM_DELETE_TREE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 2 Filename Error Base ID
+ * \brief FM Delete Directory Tree Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source 2 filename that is unusable for one
- *  of several reasons.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task command queue is full.
  *
- *  Value: 235
+ *  Value: 370
  */
-#define FM_CONCAT_SRC2_BASE_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_DELETE_TREE_CHILD_FULL_ERR_EID (FM_DELETE_TREE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 2 Filename Invalid Event ID
+ * \brief FM Delete Directory Tree Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with an invalid source 2 filename.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
  *
- *  Value: 235
+ *  Value: 371
  */
-#define FM_CONCAT_SRC2_INVALID_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_DELETE_TREE_CHILD_BROKEN_ERR_EID (FM_DELETE_TREE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 2 File Does Not Exist Event ID
+ * \brief FM Delete Filtered Files Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source 2 filename that does not exist.
+ *  This event message is generated upon receipt of a /FM_DeleteFilter
+ *  command packet with a directory name that is unusable for one of
+ *  several reasons.
  *
- *  Value: 236
+ *  Value: 372
  */
-#define FM_CONCAT_SRC2_DNE_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_DELETE_FILTER_SRC_BASE_EID (FM_DELETE_TREE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Source 2 Filename Is Directory Event ID
+ * \brief FM Delete Filtered Files Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_DeleteFilter
+ *  command packet with an invalid directory name.
  *
- *  Value: 237
+ *  Value: 372
  */
-#define FM_CONCAT_SRC2_ISDIR_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_DELETE_FILTER_SRC_INVALID_ERR_EID (FM_DELETE_FILTER_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 2 File Already Open Event ID
+ * \brief FM Delete Filtered Files Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source filename that is already open.
+ *  This event message is generated upon receipt of a /FM_DeleteFilter
+ *  command packet with a directory name that does not exist.
  *
- *  Value: 238
+ *  Value: 373
  */
-#define FM_CONCAT_SRC2_OPEN_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_DELETE_FILTER_SRC_DNE_ERR_EID (FM_DELETE_FILTER_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Target Filename Error Base ID
+ * \brief FM Delete Filtered Files Directory Name Is A File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
+ *  This event message is generated upon receipt of a /FM_DeleteFilter
+ *  command packet with a directory name that is a file.
  *
- *  Value: 241
+ *  Value: 374
  */
-#define FM_CONCAT_TGT_BASE_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_DELETE_FILTER_SRC_FILE_ERR_EID (FM_DELETE_FILTER_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Target Filename Invalid Event ID
+ * \brief FM Delete Filtered Files Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with an invalid target filename.
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
  *
- *  Value: 241
+ *  Value: 378
  */
-#define FM_CONCAT_TGT_INVALID_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_DELETE_FILTER_CHILD_BASE_EID (FM_DELETE_FILTER_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Target Filename Already Exists Event ID
+ * \brief FM Delete Filtered Files Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a target filename that already exists.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
  *
- *  Value: 242
+ *  Value: 378
  */
-#define FM_CONCAT_TGT_EXIST_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_DELETE_FILTER_CHILD_DISABLED_ERR_EID (FM_DELETE_FILTER_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Target Filename Is Directory Event ID
+ * \brief FM Delete Filtered Files Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a target filename that is a directory.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task command queue is full.
  *
- *  Value: 243
+ *  Value: 379
  */
-#define FM_CONCAT_TGT_ISDIR_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_DELETE_FILTER_CHILD_FULL_ERR_EID (FM_DELETE_FILTER_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Child Task Error Base ID
+ * \brief FM Delete Filtered Files Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are generated when
- *  the FM child task command queue interface cannot be used.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
  *
- *  Value: 247
+ *  Value: 380
  */
-#define FM_CONCAT_CHILD_BASE_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_DELETE_FILTER_CHILD_BROKEN_ERR_EID (FM_DELETE_FILTER_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Child Task Disabled Event ID
+ * \brief FM Concat File List Source List Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a source list filename that is unusable for
+ *  one of several reasons.
  *
- *  Value: 247
+ *  Value: 381
  */
-#define FM_CONCAT_CHILD_DISABLED_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_CONCAT_LIST_SRC_BASE_EID (FM_DELETE_FILTER_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Child Task Queue Full Event ID
+ * \brief FM Concat File List Source List Filename Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with an invalid source list filename.
  *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
+ *  Value: 381
+ */
+#define FM_CONCAT_LIST_SRC_INVALID_ERR_EID (FM_CONCAT_LIST_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Concat File List Source List File Does Not Exist Event ID
  *
- *  Value: 248
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a source list filename that does not exist.
+ *
+ *  Value: 382
  */
-#define FM_CONCAT_CHILD_FULL_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_CONCAT_LIST_SRC_DNE_ERR_EID (FM_CONCAT_LIST_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Child Task Inteface Broken Event ID
+ * \brief FM Concat File List Source List Filename Is Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a source list filename that is a directory.
  *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
+ *  Value: 383
+ */
+#define FM_CONCAT_LIST_SRC_ISDIR_ERR_EID (FM_CONCAT_LIST_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Concat File List Source List File Already Open Event ID
  *
- *  Value: 249
+ *  \par Type: ERROR
  *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a source list filename that is already open.
+ *
+ *  Value: 384
  */
-#define FM_CONCAT_CHILD_BROKEN_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_CONCAT_LIST_SRC_OPEN_ERR_EID (FM_CONCAT_LIST_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Get File Info Child Task Error Base ID
+ * \brief FM Concat File List Target Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are generated when
- *  the FM child task command queue interface cannot be used.
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a target filename that is unusable for one of
+ *  several reasons.
  *
- *  Value: 250
+ *  Value: 387
  */
-#define FM_FILE_INFO_CHILD_BASE_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_CONCAT_LIST_TGT_BASE_EID (FM_CONCAT_LIST_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Get File Info Child Task Disabled Event ID
+ * \brief FM Concat File List Target Filename Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with an invalid target filename.
  *
- *  Value: 250
+ *  Value: 387
  */
-#define FM_FILE_INFO_CHILD_DISABLED_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_CONCAT_LIST_TGT_INVALID_ERR_EID (FM_CONCAT_LIST_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Get File Info Child Task Queue Full Event ID
+ * \brief FM Concat File List Target Filename Already Exists Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a target filename that already exists.
  *
- *  Value: 251
+ *  Value: 388
  */
-#define FM_FILE_INFO_CHILD_FULL_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_CONCAT_LIST_TGT_EXIST_ERR_EID (FM_CONCAT_LIST_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
 
 /**
- * \brief FM Child Task Get File Info Child Task Inteface Broken Event ID
+ * \brief FM Concat File List Target Filename Is Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 252
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a target filename that is a directory.
  *
+ *  Value: 389
  */
-#define FM_FILE_INFO_CHILD_BROKEN_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_CONCAT_LIST_TGT_ISDIR_ERR_EID (FM_CONCAT_LIST_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory, Directory Error Base ID
+ * \brief FM Concat File List Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Create
- *  command packet with a directory name that is unusable for one
- *  of several reasons.
+ *  This is the base for any of several messages that are generated
+ *  when the FM child task command queue interface cannot be used.
  *
- *  Value: 253
+ *  Value: 393
  */
-#define FM_CREATE_DIR_SRC_BASE_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_CONCAT_LIST_CHILD_BASE_EID (FM_CONCAT_LIST_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Create Directory Name Invalid Event ID
+ * \brief FM Concat File List Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Create
- *  command packet with an invalid directory name.
+ *  This event message is generated when the FM child task command
+ *  queue interface cannot be used because the child task is disabled.
  *
- *  Value: 253
+ *  Value: 393
  */
-#define FM_CREATE_DIR_SRC_INVALID_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_CONCAT_LIST_CHILD_DISABLED_ERR_EID (FM_CONCAT_LIST_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory Name Exists As File Event ID
+ * \brief FM Concat File List Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Create
- *  command packet with a directory name that exists as a file.
+ *  This event message is generated when the FM child task command
+ *  queue interface cannot be used because the child task command
+ *  queue is full.
  *
- *  Value: 254
+ *  Value: 394
  */
-#define FM_CREATE_DIR_SRC_DNE_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_CONCAT_LIST_CHILD_FULL_ERR_EID (FM_CONCAT_LIST_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory Already Exists Event ID
+ * \brief FM Concat File List Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Create
- *  command pasket with a directory that already exists.
+ *  This event message is generated when the FM child task command
+ *  queue interface cannot be used because the interface between the
+ *  main task and child task is broken.
  *
- *  Value: 255
+ *  Value: 395
  */
-#define FM_CREATE_DIR_SRC_ISDIR_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_CONCAT_LIST_CHILD_BROKEN_ERR_EID (FM_CONCAT_LIST_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory Child Task Error Base ID
+ * \brief FM Split File Source Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are generated when
- *  the FM child task command queue interface cannot be used.
+ *  This event message is generated upon receipt of a /FM_Split
+ *  command packet with a source filename that is unusable for one of
+ *  several reasons.
  *
- *  Value: 259
+ *  Value: 396
  */
-#define FM_CREATE_DIR_CHILD_BASE_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_SPLIT_SRC_BASE_EID (FM_CONCAT_LIST_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Create Directory Child Task Disabled Event ID
+ * \brief FM Split File Source Filename Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
+ *  This event message is generated upon receipt of a /FM_Split
+ *  command packet with an invalid source filename.
  *
- *  Value: 259
+ *  Value: 396
  */
-#define FM_CREATE_DIR_CHILD_DISABLED_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_SPLIT_SRC_INVALID_ERR_EID (FM_SPLIT_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory Child Task Queue Full Event ID
+ * \brief FM Split File Source File Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
+ *  This event message is generated upon receipt of a /FM_Split
+ *  command packet with a source filename that does not exist.
  *
- *  Value: 260
+ *  Value: 397
  */
-#define FM_CREATE_DIR_CHILD_FULL_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_SPLIT_SRC_DNE_ERR_EID (FM_SPLIT_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory Child Task Inteface Broken Event ID
+ * \brief FM Split File Source Filename Is Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 261
+ *  This event message is generated upon receipt of a /FM_Split
+ *  command packet with a source filename that is a directory.
  *
+ *  Value: 398
  */
-#define FM_CREATE_DIR_CHILD_BROKEN_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_SPLIT_SRC_ISDIR_ERR_EID (FM_SPLIT_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete Directory, Directory Error Base ID
+ * \brief FM Split File Source File Is Open Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteDir
- *  command packet with a directory name that is unusable for one
- *  of several reasons.
+ *  This event message is generated upon receipt of a /FM_Split
+ *  command packet with a source file that is open.
  *
- *  Value: 262
+ *  Value: 399
  */
-#define FM_DELETE_DIR_SRC_BASE_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_SPLIT_SRC_OPEN_ERR_EID (FM_SPLIT_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete Directory Name Invalid Event ID
+ * \brief FM Split File Manifest Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteDir
- *  command packet with an invalid directory name.
+ *  This event message is generated upon receipt of a /FM_Split
+ *  command packet with a manifest filename that is unusable for one
+ *  of several reasons.
  *
- *  Value: 262
+ *  Value: 402
  */
-#define FM_DELETE_DIR_SRC_INVALID_ERR_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_SPLIT_TGT_BASE_EID (FM_SPLIT_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete Directory Name Exists As File Event ID
+ * \brief FM Split File Manifest Filename Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteDir
- *  command packet with a directory name that exists as a file.
+ *  This event message is generated upon receipt of a /FM_Split
+ *  command packet with an invalid manifest filename.
  *
- *  Value: 263
+ *  Value: 402
  */
-#define FM_DELETE_DIR_SRC_DNE_ERR_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_SPLIT_TGT_INVALID_ERR_EID (FM_SPLIT_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete Directory Child Task Error Base ID
+ * \brief FM Split File Manifest Filename Already Exists Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are generated when
- *  the FM child task command queue interface cannot be used.
+ *  This event message is generated upon receipt of a /FM_Split
+ *  command packet with a manifest filename that already exists.
  *
- *  Value: 268
+ *  Value: 403
  */
-#define FM_DELETE_DIR_CHILD_BASE_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_SPLIT_TGT_EXIST_ERR_EID (FM_SPLIT_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete Directory Child Task Disabled Event ID
+ * \brief FM Split File Manifest Filename Is Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
+ *  This event message is generated upon receipt of a /FM_Split
+ *  command packet with a manifest filename that is a directory.
  *
- *  Value: 268
+ *  Value: 404
  */
-#define FM_DELETE_DIR_CHILD_DISABLED_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_SPLIT_TGT_ISDIR_ERR_EID (FM_SPLIT_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete Directory Child Task Queue Full Event ID
+ * \brief FM Split File Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
+ *  This is the base for any of several messages that are generated
+ *  when the FM child task command queue interface cannot be used.
  *
- *  Value: 269
+ *  Value: 408
  */
-#define FM_DELETE_DIR_CHILD_FULL_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_SPLIT_CHILD_BASE_EID (FM_SPLIT_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete Directory Child Task Inteface Broken Event ID
+ * \brief FM Split File Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 270
+ *  This event message is generated when the FM child task command
+ *  queue interface cannot be used because the child task is disabled.
  *
+ *  Value: 408
  */
-#define FM_DELETE_DIR_CHILD_BROKEN_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_SPLIT_CHILD_DISABLED_ERR_EID (FM_SPLIT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Source Filename Error Base ID
+ * \brief FM Split File Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with a source directory name that is unusable for one
- *  of several reasons.
+ *  This event message is generated when the FM child task command
+ *  queue interface cannot be used because the child task command
+ *  queue is full.
  *
- *  Value: 271
+ *  Value: 409
  */
-#define FM_GET_DIR_FILE_SRC_BASE_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_SPLIT_CHILD_FULL_ERR_EID (FM_SPLIT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Directory Name Invalid Event ID
+ * \brief FM Split File Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with an invalid source directory name.
+ *  This event message is generated when the FM child task command
+ *  queue interface cannot be used because the interface between the
+ *  main task and child task is broken.
  *
- *  Value: 271
+ *  Value: 410
  */
-#define FM_GET_DIR_FILE_SRC_INVALID_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_SPLIT_CHILD_BROKEN_ERR_EID (FM_SPLIT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Directory Does Not Exist Event ID
+ * \brief FM Preallocate File Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with a source directory name that does not exist.
+ *  This event message is generated upon receipt of a /FM_Preallocate
+ *  command packet with a filename that is unusable for one of several
+ *  reasons.
  *
- *  Value: 272
+ *  Value: 411
  */
-#define FM_GET_DIR_FILE_SRC_DNE_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_PREALLOCATE_SRC_BASE_EID (FM_SPLIT_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Directory List to File Directory Name Is File Event ID
+ * \brief FM Preallocate File Filename Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with a source directory name that is a file.
+ *  This event message is generated upon receipt of a /FM_Preallocate
+ *  command packet with an invalid filename.
  *
- *  Value: 273
+ *  Value: 411
  */
-#define FM_GET_DIR_FILE_SRC_ISDIR_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+#define FM_PREALLOCATE_SRC_INVALID_ERR_EID (FM_PREALLOCATE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Target Error Base ID
+ * \brief FM Preallocate File Filename Is Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
+ *  This event message is generated upon receipt of a /FM_Preallocate
+ *  command packet with a filename that is a directory.
  *
- *  Value: 277
+ *  Value: 413
  */
-#define FM_GET_DIR_FILE_TGT_BASE_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_PREALLOCATE_SRC_ISDIR_ERR_EID (FM_PREALLOCATE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Target Filename Invalid Event ID
+ * \brief FM Preallocate File Is Open Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with an invalid target file name.
+ *  This event message is generated upon receipt of a /FM_Preallocate
+ *  command packet with a file that is open.
  *
- *  Value: 277
+ *  Value: 414
  */
-#define FM_GET_DIR_FILE_TGT_INVALID_ERR_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_PREALLOCATE_SRC_OPEN_ERR_EID (FM_PREALLOCATE_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Target Filename Is Directory Event ID
+ * \brief FM Preallocate File Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with a target filename that is a directory.
+ *  This is the base for any of several messages that are generated
+ *  when the FM child task command queue interface cannot be used.
  *
- *  Value: 279
+ *  Value: 417
  */
-#define FM_GET_DIR_FILE_TGT_ISDIR_ERR_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_PREALLOCATE_CHILD_BASE_EID (FM_PREALLOCATE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Directory List to File Child Task Error Base ID
+ * \brief FM Preallocate File Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
- *  the FM child task command queue interface cannot be used.
+ *  This event message is generated when the FM child task command
+ *  queue interface cannot be used because the child task is disabled.
  *
- *  Value: 283
+ *  Value: 417
  */
-#define FM_GET_DIR_FILE_CHILD_BASE_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_PREALLOCATE_CHILD_DISABLED_ERR_EID (FM_PREALLOCATE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Child Task Disabled Event ID
+ * \brief FM Preallocate File Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
+ *  This event message is generated when the FM child task command
+ *  queue interface cannot be used because the child task command
+ *  queue is full.
  *
- *  Value: 283
+ *  Value: 418
  */
-#define FM_GET_DIR_FILE_CHILD_DISABLED_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_PREALLOCATE_CHILD_FULL_ERR_EID (FM_PREALLOCATE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Child Task Queue Full Event ID
+ * \brief FM Preallocate File Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
+ *  This event message is generated when the FM child task command
+ *  queue interface cannot be used because the interface between the
+ *  main task and child task is broken.
  *
- *  Value: 284
+ *  Value: 419
  */
-#define FM_GET_DIR_FILE_CHILD_FULL_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_PREALLOCATE_CHILD_BROKEN_ERR_EID (FM_PREALLOCATE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Child Task Inteface Broken Event ID
+ * \brief FM Truncate File Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 285
+ *  This event message is generated upon receipt of a /FM_Truncate
+ *  command packet with a filename that is unusable for one of several
+ *  reasons.
  *
+ *  Value: 420
  */
-#define FM_GET_DIR_FILE_CHILD_BROKEN_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_TRUNCATE_SRC_BASE_EID (FM_PREALLOCATE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Directory List to Packet Directory Error Base ID
+ * \brief FM Truncate File Filename Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirPkt
- *  command packet with a source directory name that is unusable for one
- *  of several reasons.
+ *  This event message is generated upon receipt of a /FM_Truncate
+ *  command packet with an invalid filename.
  *
- *  Value: 286
+ *  Value: 420
  */
-#define FM_GET_DIR_PKT_SRC_BASE_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_TRUNCATE_SRC_INVALID_ERR_EID (FM_TRUNCATE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Directory Name Invalid Event ID
+ * \brief FM Truncate File Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirPkt
- *  command packet with an invalid source directory name.
+ *  This event message is generated upon receipt of a /FM_Truncate
+ *  command packet with a filename that does not exist.
  *
- *  Value: 286
+ *  Value: 421
  */
-#define FM_GET_DIR_PKT_SRC_INVALID_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_TRUNCATE_SRC_DNE_ERR_EID (FM_TRUNCATE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Directory Does Not Exist Event ID
+ * \brief FM Truncate File Filename Is Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirPkt
- *  command packet with a source directory name that does not exist.
+ *  This event message is generated upon receipt of a /FM_Truncate
+ *  command packet with a filename that is a directory.
  *
- *  Value: 287
+ *  Value: 422
  */
-#define FM_GET_DIR_PKT_SRC_DNE_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_TRUNCATE_SRC_ISDIR_ERR_EID (FM_TRUNCATE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Directory Is File Event ID
+ * \brief FM Truncate File Is Open Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirPkt
- *  command packet with a source directory name that is a file.
+ *  This event message is generated upon receipt of a /FM_Truncate
+ *  command packet with a file that is open.
  *
- *  Value: 288
+ *  Value: 423
  */
-#define FM_GET_DIR_PKT_SRC_ISDIR_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+#define FM_TRUNCATE_SRC_OPEN_ERR_EID (FM_TRUNCATE_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Child Task Error Base ID
+ * \brief FM Truncate File Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
- *  the FM child task command queue interface cannot be used.
+ *  This is the base for any of several messages that are generated
+ *  when the FM child task command queue interface cannot be used.
  *
- *  Value: 292
+ *  Value: 426
  */
-#define FM_GET_DIR_PKT_CHILD_BASE_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_TRUNCATE_CHILD_BASE_EID (FM_TRUNCATE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Directory List to Packet Child Task Disabled Event ID
+ * \brief FM Truncate File Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
+ *  This event message is generated when the FM child task command
+ *  queue interface cannot be used because the child task is disabled.
  *
- *  Value: 292
+ *  Value: 426
  */
-#define FM_GET_DIR_PKT_CHILD_DISABLED_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_TRUNCATE_CHILD_DISABLED_ERR_EID (FM_TRUNCATE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Child Task Queue Full Event ID
+ * \brief FM Truncate File Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
+ *  This event message is generated when the FM child task command
+ *  queue interface cannot be used because the child task command
+ *  queue is full.
  *
- *  Value: 293
+ *  Value: 427
  */
-#define FM_GET_DIR_PKT_CHILD_FULL_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_TRUNCATE_CHILD_FULL_ERR_EID (FM_TRUNCATE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Child Task Inteface Broken Event ID
+ * \brief FM Truncate File Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 294
+ *  This event message is generated when the FM child task command
+ *  queue interface cannot be used because the interface between the
+ *  main task and child task is broken.
  *
+ *  Value: 428
  */
-#define FM_GET_DIR_PKT_CHILD_BROKEN_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_TRUNCATE_CHILD_BROKEN_ERR_EID (FM_TRUNCATE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**\}*/
 
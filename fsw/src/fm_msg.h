@@ -89,6 +89,10 @@ typedef struct
     uint16 Overwrite;               /**< \brief Allow overwrite */
     char   Source[OS_MAX_PATH_LEN]; /**< \brief Source filename */
     char   Target[OS_MAX_PATH_LEN]; /**< \brief Target filename */
+    uint32 CRCType;                 /**< \brief CRC method for the copied data, #FM_IGNORE_CRC for none */
+    uint32 Verify;                  /**< \brief Read back the target file and compare CRC's (requires CRC type) */
+    uint32 Sparse;                  /**< \brief Seek over all-zero blocks rather than writing them */
+    uint32 Link;                    /**< \brief Share the source data on the same volume, see #FM_COPY_LINK_NONE */
 
 } FM_CopyFileCmd_t;
 
@@ -167,9 +171,10 @@ typedef struct
 {
     CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
 
-    char Source1[OS_MAX_PATH_LEN]; /**< \brief Source 1 filename */
-    char Source2[OS_MAX_PATH_LEN]; /**< \brief Source 2 filename */
-    char Target[OS_MAX_PATH_LEN];  /**< \brief Target filename */
+    char   Source1[OS_MAX_PATH_LEN]; /**< \brief Source 1 filename */
+    char   Source2[OS_MAX_PATH_LEN]; /**< \brief Source 2 filename */
+    char   Target[OS_MAX_PATH_LEN];  /**< \brief Target filename */
+    uint32 CRCType;                  /**< \brief CRC method for the concatenated data, #FM_IGNORE_CRC for none */
 
 } FM_ConcatCmd_t;
 
@@ -298,6 +303,152 @@ typedef struct
 
 } FM_SetPermCmd_t;
 
+/**
+ *  \brief Abort child task job command packet structure
+ *
+ *  For command details see #FM_ABORT_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    uint32 JobID; /**< \brief Job ID of the queued or executing command to abort */
+
+} FM_AbortCmd_t;
+
+/**
+ *  \brief Set child task I/O throttle command packet structure
+ *
+ *  For command details see #FM_SET_THROTTLE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    uint32 BytesPerSec;  /**< \brief File data rate limit (bytes/sec), 0 = unlimited */
+    uint32 StatsPerSec;  /**< \brief OS_stat call rate limit (calls/sec), 0 = unlimited */
+    uint32 LatencyLimit; /**< \brief File block latency (usec) above which the rate backs off, 0 = disabled */
+
+} FM_SetThrottleCmd_t;
+
+/**
+ *  \brief Set child task file I/O block size command packet structure
+ *
+ *  For command details see #FM_SET_BLOCK_SIZE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    uint32 BlockSize; /**< \brief File I/O block size (bytes) */
+
+} FM_SetBlockSizeCmd_t;
+
+/**
+ *  \brief Copy Directory command packet structure
+ *
+ *  For command details see #FM_COPY_DIR_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    uint16 Overwrite;               /**< \brief Allow the target directory to exist, closed files are replaced */
+    char   Source[OS_MAX_PATH_LEN]; /**< \brief Source directory name */
+    char   Target[OS_MAX_PATH_LEN]; /**< \brief Target directory name */
+
+} FM_CopyDirCmd_t;
+
+/**
+ *  \brief Delete Directory Tree command packet structure
+ *
+ *  For command details see #FM_DELETE_TREE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    char Directory[OS_MAX_PATH_LEN]; /**< \brief Directory name */
+
+} FM_DeleteTreeCmd_t;
+
+/**
+ *  \brief Delete Filtered Files command packet structure
+ *
+ *  For command details see #FM_DELETE_FILTER_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    char   Directory[OS_MAX_PATH_LEN]; /**< \brief Directory name */
+    char   Pattern[OS_MAX_FILE_NAME];  /**< \brief Filename pattern, '*' matches any characters, '?' matches one */
+    uint32 MinAge;                     /**< \brief Minimum seconds since last modified, 0 for no minimum */
+    uint32 MaxAge;                     /**< \brief Maximum seconds since last modified, 0 for no maximum */
+    uint32 MinSize;                    /**< \brief Minimum file size (bytes), 0 for no minimum */
+    uint32 MaxSize;                    /**< \brief Maximum file size (bytes), 0 for no maximum */
+
+} FM_DeleteFilterCmd_t;
+
+/**
+ *  \brief Concatenate File List command packet structure
+ *
+ *  For command details see #FM_CONCAT_LIST_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    char   ListFile[OS_MAX_PATH_LEN]; /**< \brief Text file naming the source files, one per line */
+    char   Target[OS_MAX_PATH_LEN];   /**< \brief Target filename */
+    uint32 CRCType;                   /**< \brief CRC method for the concatenated data, #FM_IGNORE_CRC for none */
+
+} FM_ConcatListCmd_t;
+
+/**
+ *  \brief Split File command packet structure
+ *
+ *  For command details see #FM_SPLIT_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    char   Source[OS_MAX_PATH_LEN]; /**< \brief Source filename */
+    char   Target[OS_MAX_PATH_LEN]; /**< \brief Manifest filename, segment filenames add ".NNN" */
+    uint32 SegmentSize;             /**< \brief Size of each segment file (bytes), the last may be smaller */
+    uint32 CRCType;                 /**< \brief CRC method for each segment, #FM_IGNORE_CRC for none */
+
+} FM_SplitCmd_t;
+
+/**
+ *  \brief Preallocate File command packet structure
+ *
+ *  For command details see #FM_PREALLOCATE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    char   Filename[OS_MAX_PATH_LEN]; /**< \brief Filename */
+    uint32 Size;                      /**< \brief File size to reserve (bytes) */
+
+} FM_PreallocateCmd_t;
+
+/**
+ *  \brief Truncate File command packet structure
+ *
+ *  For command details see #FM_TRUNCATE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    char   Filename[OS_MAX_PATH_LEN]; /**< \brief Filename */
+    uint32 Size;                      /**< \brief File size after truncation (bytes) */
+
+} FM_TruncateCmd_t;
+
 /**\}*/
 
 /**
@@ -353,6 +504,39 @@ typedef struct
 
 } FM_DirListFileStats_t;
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- split file manifest structures                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Split File manifest statistics structure
+ *
+ *  Follows the cFE file header, and is followed by one
+ *  #FM_SplitManifestEntry_t for each segment.
+ */
+typedef struct
+{
+    char   Source[OS_MAX_PATH_LEN]; /**< \brief Source filename */
+    uint32 SourceSize;              /**< \brief Source file size (bytes) */
+    uint32 SegmentSize;             /**< \brief Size of each segment file (bytes), the last may be smaller */
+    uint32 SegmentCount;            /**< \brief Number of segment files */
+    uint32 CRCType;                 /**< \brief CRC method for each segment, #FM_IGNORE_CRC for none */
+
+} FM_SplitManifestStats_t;
+
+/**
+ *  \brief Split File manifest segment entry structure
+ */
+typedef struct
+{
+    uint32 Offset; /**< \brief Offset of the segment data in the source file */
+    uint32 Size;   /**< \brief Segment file size (bytes) */
+    uint32 CRC;    /**< \brief CRC of the segment file, zero if #FM_IGNORE_CRC */
+
+} FM_SplitManifestEntry_t;
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM -- get file information telemetry structure                  */
@@ -371,6 +555,7 @@ typedef struct
     uint8  Spare[2];                  /**< \brief Structure padding */
     uint32 CRC;                       /**< \brief CRC value if computed */
     uint32 FileSize;                  /**< \brief File Size */
+    uint32 AllocatedSize;             /**< \brief Bytes allocated on the file system, see #FM_FILE_SIZE_UNKNOWN */
     uint32 LastModifiedTime;          /**< \brief Last Modification Time of File */
     uint32 Mode;                      /**< \brief Mode of the file (Permissions) */
     char   Filename[OS_MAX_PATH_LEN]; /**< \brief Name of File */
@@ -428,12 +613,80 @@ typedef struct
     FM_FreeSpacePktEntry_t FileSys[FM_TABLE_ENTRY_COUNT]; /**< \brief Array of file system free space entries */
 } FM_FreeSpacePkt_t;
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- child task job completion telemetry structure             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Child task job completion telemetry packet
+ *
+ *  Sent by the child task when each queued command completes, including
+ *  commands aborted before they started.  Job ID's are assigned in the
+ *  order that commands are accepted by the FM main task, the most recent
+ *  is reported in #FM_HousekeepingPkt_t.ChildLastJobID.
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief Telemetry Header */
+
+    uint32 JobID;       /**< \brief Job ID assigned when the command was queued */
+    uint8  CommandCode; /**< \brief Command code of the completed command */
+    uint8  Status;      /**< \brief Completion status, see #FM_JOB_STATUS_SUCCESS and related */
+    uint8  CRCType;     /**< \brief CRC method of the data written by the command, #FM_IGNORE_CRC if none */
+    uint8  Verified;    /**< \brief Target file read back result, see #FM_JOB_VERIFY_NONE and related */
+
+    uint32 BytesProcessed; /**< \brief Bytes of file data read or written by the command */
+    uint32 WallTime;       /**< \brief Time from start to completion of the command (msec) */
+    uint32 QueueTime;      /**< \brief Time the command waited in the queue before it started (msec) */
+    uint32 CRC;            /**< \brief CRC of the data written by the command, valid unless CRCType is ignore */
+    uint32 TargetCRC;      /**< \brief CRC of the target file read back, valid unless Verified is none */
+
+} FM_JobCompletePkt_t;
+
+/**
+ *  \brief Child task job progress telemetry packet
+ *
+ *  Sent periodically by each child task worker while the command it is
+ *  executing reads or writes file data, see #FM_CHILD_PROGRESS_INTERVAL_MS.
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief Telemetry Header */
+
+    uint32 JobID;       /**< \brief Job ID assigned when the command was queued */
+    uint8  CommandCode; /**< \brief Command code of the command being executed */
+    uint8  Spare8;      /**< \brief Structure alignment spare */
+    uint16 Spare16;     /**< \brief Structure alignment spare */
+
+    uint32 BytesDone;     /**< \brief Bytes of file data read or written so far */
+    uint32 BytesTotal;    /**< \brief Bytes of file data expected, 0 if not known */
+    uint32 Throughput;    /**< \brief Bytes/sec since the previous progress packet */
+    uint32 TimeRemaining; /**< \brief Estimated secs to completion, #FM_JOB_TIME_UNKNOWN if not known */
+
+} FM_JobProgressPkt_t;
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM -- housekeeping telemetry structure                          */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+/**
+ * \brief Child task worker housekeeping entry
+ */
+typedef struct
+{
+    uint8 CmdCounter; /**< \brief Number of commands executed by this worker */
+    uint8 CurrentCC;  /**< \brief Command code currently executing in this worker */
+    uint8 PreviousCC; /**< \brief Command code previously executed by this worker */
+    uint8 Spare;      /**< \brief Structure alignment spare */
+
+    uint32 CurrentJobID; /**< \brief Job ID of the command currently executing in this worker */
+
+} FM_ChildWorkerHk_t;
+
 /**
  * \brief Housekeeping telemetry packet
  */
@@ -453,8 +706,23 @@ typedef struct
 
     uint8 ChildQueueCount; /**< \brief Number of pending commands in queue */
 
-    uint8 ChildCurrentCC;  /**< \brief Command code currently executing */
-    uint8 ChildPreviousCC; /**< \brief Command code previously executed */
+    uint8 ChildCurrentCC;  /**< \brief Command code executing in the first busy worker */
+    uint8 ChildPreviousCC; /**< \brief Command code last completed by any worker */
+
+    uint8 ChildInteractiveQueueCount; /**< \brief Number of commands waiting in the interactive lane */
+    uint8 ChildBulkQueueCount;        /**< \brief Number of commands waiting in the bulk lane */
+
+    uint16 ChildPendingCount; /**< \brief Number of commands waiting in the pending commands file */
+    uint16 Spare16;           /**< \brief Structure alignment spare */
+
+    uint32 ChildLastJobID; /**< \brief Job ID assigned to the most recent child task command */
+
+    uint32 ChildThrottleRate;    /**< \brief File data rate limit in effect (bytes/sec), 0 = unlimited */
+    uint32 ChildThrottleLatency; /**< \brief Smoothed child task file block latency (usec) */
+
+    uint32 ChildBlockSize; /**< \brief File I/O block size of commands not yet started */
+
+    FM_ChildWorkerHk_t ChildWorker[FM_CHILD_WORKER_COUNT]; /**< \brief Per-worker child task status */
 
 } FM_HousekeepingPkt_t;
 
@@ -501,14 +769,292 @@ typedef struct
     uint32            FileInfoState;            /**< \brief File info state */
     uint32            FileInfoSize;             /**< \brief File info size */
     uint32            FileInfoTime;             /**< \brief File info time */
-    uint32            FileInfoCRC;              /**< \brief File info CRC method */
+    uint32            FileInfoCRC;              /**< \brief File info, copy or concatenate CRC method */
     char              Source1[OS_MAX_PATH_LEN]; /**< \brief First source file or directory name command argument */
     char              Source2[OS_MAX_PATH_LEN]; /**< \brief Second source filename command argument */
     char              Target[OS_MAX_PATH_LEN];  /**< \brief Target filename command argument */
     uint8             GetSizeTimeMode; /**< \brief Whether to invoke stat call for size and time (CPU intensive) */
     uint32            Mode;            /**< \brief File Mode */
+    uint32            JobID;           /**< \brief Job ID assigned when the command was queued */
+    uint8             Aborted;         /**< \brief Aborted while waiting in the queue or the pending commands file */
+    uint8             Resume;          /**< \brief Restored checkpoint number to resume (index + 1), 0 if none */
+    uint8             Verify;          /**< \brief Read back the copy target file after it is written */
+    uint8             Sparse;          /**< \brief Seek over all-zero blocks of the copy target file */
+    uint8             CrossVolume;     /**< \brief Source and target are known to be on different volumes */
+    uint8             Link;            /**< \brief Copy shares the source data, see #FM_COPY_LINK_NONE */
+    uint32            MinAge;          /**< \brief Delete filter minimum age (seconds), 0 for none */
+    uint32            MaxAge;          /**< \brief Delete filter maximum age (seconds), 0 for none */
+    uint32            MinSize;         /**< \brief Delete filter minimum file size (bytes), 0 for none */
+    uint32            MaxSize;         /**< \brief Delete filter maximum file size (bytes), 0 for none */
+    uint32            SegmentSize;     /**< \brief Split segment file size (bytes) */
+    uint32            FileSize;        /**< \brief Preallocate or truncate file size (bytes) */
+    OS_time_t         QueueTime;       /**< \brief Time the command was queued */
 } FM_ChildQueueEntry_t;
 
+/**
+ *  \brief Child Task Interface command queue record structure
+ *
+ *  Compact form of #FM_ChildQueueEntry_t held in the command queue.  The
+ *  path arguments are stored in the command queue path arena.
+ */
+typedef struct
+{
+    uint32            DirListOffset;   /**< \brief Starting entry for dir list commands */
+    uint32            FileInfoState;   /**< \brief File info state */
+    uint32            FileInfoSize;    /**< \brief File info size */
+    uint32            FileInfoTime;    /**< \brief File info time */
+    uint32            FileInfoCRC;     /**< \brief File info, copy or concatenate CRC method */
+    uint32            Mode;            /**< \brief File Mode */
+    uint32            JobID;           /**< \brief Job ID assigned when the command was queued */
+    uint32            MinAge;          /**< \brief Delete filter minimum age (seconds), 0 for none */
+    uint32            MaxAge;          /**< \brief Delete filter maximum age (seconds), 0 for none */
+    uint32            MinSize;         /**< \brief Delete filter minimum file size (bytes), 0 for none */
+    uint32            MaxSize;         /**< \brief Delete filter maximum file size (bytes), 0 for none */
+    uint32            SegmentSize;     /**< \brief Split segment file size (bytes) */
+    uint32            FileSize;        /**< \brief Preallocate or truncate file size (bytes) */
+    OS_time_t         QueueTime;       /**< \brief Time the command was queued */
+    CFE_MSG_FcnCode_t CommandCode;     /**< \brief Command code - identifies the command */
+    uint8             GetSizeTimeMode; /**< \brief Whether to invoke stat call for size and time (CPU intensive) */
+    uint8             Aborted;         /**< \brief Aborted while waiting in the queue */
+    uint8             Resume;          /**< \brief Restored checkpoint number to resume (index + 1), 0 if none */
+    uint8             Verify;          /**< \brief Read back the copy target file after it is written */
+    uint8             Sparse;          /**< \brief Seek over all-zero blocks of the copy target file */
+    uint8             CrossVolume;     /**< \brief Source and target are known to be on different volumes */
+    uint8             Link;            /**< \brief Copy shares the source data, see #FM_COPY_LINK_NONE */
+
+    uint16 PathBlock[FM_CHILD_PATH_COUNT];      /**< \brief First path arena block of each path argument */
+    uint8  PathBlockCount[FM_CHILD_PATH_COUNT]; /**< \brief Number of path arena blocks (0 for empty path) */
+
+} FM_ChildQueueRecord_t;
+
+/**
+ *  \brief Child Task Interface command queue lane structure
+ *
+ *  Each lane is a single producer, single consumer FIFO of indexes into
+ *  the child task command queue.  The write index is only updated by the
+ *  FM main task and the read index is only updated by the child task, see
+ *  #FM_QueueLanePush and #FM_QueueLanePop.
+ */
+typedef struct
+{
+    uint8 Slot[FM_CHILD_QUEUE_DEPTH]; /**< \brief Command queue entry index for each waiting command */
+    uint8 WriteIndex;                 /**< \brief Ring index for next write to lane (FM main task) */
+    uint8 ReadIndex;                  /**< \brief Ring index for next read from lane (child task) */
+
+} FM_ChildLane_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- child task copy checkpoint                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Child task copy checkpoint structure
+ *
+ *  Progress of a copy, move or concatenate command, saved in the Critical
+ *  Data Store so that the command may be resumed after a processor reset.
+ *  The CRC covers the target file bytes written before the checkpoint.
+ */
+typedef struct
+{
+    uint32 JobID;        /**< \brief Job ID of the checkpointed command, 0 if the checkpoint is not in use */
+    uint32 CommandCode;  /**< \brief Command code of the checkpointed command */
+    uint32 Segment;      /**< \brief Source file being copied (0 = Source1, 1 = Source2, list entry number) */
+    uint32 SourceOffset; /**< \brief Bytes of the current source file written to the target file */
+    uint32 TargetOffset; /**< \brief Bytes written to the target file */
+    uint32 TargetCRC;    /**< \brief CRC of the bytes written to the target file */
+    uint32 SourceSize;   /**< \brief Size of the current source file when its copy started */
+    uint32 SourceTime;   /**< \brief Modify time of the current source file when its copy started */
+    uint32 CRCType;      /**< \brief CRC method for the copied data reported at completion, 0 = none */
+    uint32 Verify;       /**< \brief Read back the target file after the copy completes */
+    uint32 Sparse;       /**< \brief Seek over all-zero blocks of a target file created by the copy */
+
+    char Source1[OS_MAX_PATH_LEN]; /**< \brief First source filename, or source list filename */
+    char Source2[OS_MAX_PATH_LEN]; /**< \brief Second or current listed source filename (concatenate only) */
+    char Target[OS_MAX_PATH_LEN];  /**< \brief Target filename */
+
+} FM_ChildCheckpoint_t;
+
+/**
+ *  \brief Child task copy event ID structure
+ *
+ *  Event ID's reported by the chunked copy engine for each failure, so
+ *  that copy, move and concatenate keep their existing command events.
+ */
+typedef struct
+{
+    uint16 OpenSrcEID; /**< \brief Source file open failure event ID */
+    uint16 OpenTgtEID; /**< \brief Target file open failure event ID */
+    uint16 ReadEID;    /**< \brief Source file read failure event ID */
+    uint16 WriteEID;   /**< \brief Target file write failure event ID */
+    uint16 VerifyEID;  /**< \brief Target file read back failure event ID */
+
+} FM_ChildCopyEvents_t;
+
+/**
+ *  \brief Child task list file reader structure
+ *
+ *  Read-ahead state for a text file that names one file per line.  The
+ *  buffer holds the longest line that names a valid path.
+ */
+typedef struct
+{
+    osal_id_t FileHandle;              /**< \brief List file handle */
+    uint32    Line;                    /**< \brief Number of lines read so far */
+    uint32    Length;                  /**< \brief Bytes read ahead into the buffer */
+    bool      Ended;                   /**< \brief End of the list file has been read */
+    char      Buffer[OS_MAX_PATH_LEN]; /**< \brief Bytes read ahead from the list file */
+
+} FM_ChildListFile_t;
+
+/**
+ *  \brief Child task I/O throttle token bucket structure
+ *
+ *  Tokens are bytes for the file data bucket and OS_stat calls for the
+ *  stat bucket.  A worker that takes more tokens than are available puts
+ *  the bucket in debt, and sleeps until the debt has been repaid.
+ */
+typedef struct
+{
+    uint32    Rate;     /**< \brief Commanded rate (tokens/sec), 0 = unlimited */
+    uint32    Current;  /**< \brief Rate in effect after latency backoff (tokens/sec) */
+    int64     Tokens;   /**< \brief Tokens available, negative while in debt */
+    OS_time_t LastFill; /**< \brief Time up to which tokens have been added */
+
+} FM_ThrottleBucket_t;
+
+/**
+ *  \brief Child task I/O throttle structure
+ *
+ *  Shared by every child task worker, so the rate limits apply to the
+ *  child task as a whole rather than to each worker.
+ */
+typedef struct
+{
+    osal_id_t Mutex; /**< \brief Mutex semaphore, one worker at a time updates the buckets */
+
+    FM_ThrottleBucket_t Bytes; /**< \brief File data token bucket */
+    FM_ThrottleBucket_t Stats; /**< \brief OS_stat call token bucket */
+
+    uint32    LatencyLimit; /**< \brief File block latency (usec) above which the rate backs off, 0 = disabled */
+    uint32    Latency;      /**< \brief Smoothed file block latency (usec) */
+    OS_time_t LastAdjust;   /**< \brief Time the file data rate was last adjusted */
+
+} FM_ChildThrottle_t;
+
+/**
+ *  \brief Child task transfer pipeline structure
+ *
+ *  The worker reads file data into the pipeline buffers while a helper
+ *  task writes or CRCs the blocks already read.  Buffers are handed over
+ *  in order, the empty semaphore counts buffers the worker may fill and
+ *  the full semaphore counts blocks waiting for the helper.
+ */
+typedef struct
+{
+    osal_id_t FullSem;  /**< \brief Counting semaphore, blocks waiting for the helper */
+    osal_id_t EmptySem; /**< \brief Counting semaphore, buffers free for the worker */
+
+    CFE_ES_TaskId_t TaskID;  /**< \brief Helper child task ID */
+    bool            Running; /**< \brief Helper task is waiting for blocks (atomic access) */
+    bool            Async;   /**< \brief Blocks of the current transfer are passed to the helper */
+
+    uint8 Mode;       /**< \brief Block processing, see #FM_PIPELINE_MODE_WRITE and related */
+    uint8 ReadIndex;  /**< \brief Ring index of the next block for the helper */
+    uint8 WriteIndex; /**< \brief Ring index of the next buffer for the worker */
+    uint8 Reserved;   /**< \brief Buffers taken by the worker and not yet submitted */
+
+    osal_id_t FileHandle; /**< \brief Target file handle (write mode) */
+    uint32    CRCType;    /**< \brief CRC computed over the blocks, #FM_IGNORE_CRC for none */
+    uint32    CRC;        /**< \brief CRC of the blocks processed so far */
+    bool      Hole;       /**< \brief Last block was seeked over, the target file must be extended */
+
+    bool  Failed;   /**< \brief A target file write failed, later blocks are dropped (atomic access) */
+    int32 Result;   /**< \brief OS_write or OS_lseek result of the failed write */
+    int32 Expected; /**< \brief Size of the block that failed to write */
+
+    int32 Size[FM_CHILD_PIPELINE_DEPTH];    /**< \brief Bytes in each buffer */
+    char *Buffer[FM_CHILD_PIPELINE_DEPTH]; /**< \brief Transfer buffers, allocated from the child task memory pool */
+
+} FM_ChildPipeline_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- child task CRC engine                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Child task CRC engine structure
+ *
+ *  Built once at startup and then only read, so the workers and pipeline
+ *  helper tasks share it without a semaphore.
+ */
+typedef struct
+{
+    uint16 Table[FM_CRC_SLICE_COUNT][FM_CRC_TABLE_SIZE]; /**< \brief CRC-16 slicing tables, table 0 is the cFE table */
+    uint64 Fold512[2]; /**< \brief Carry-less multiply constants that fold data 64 bytes ahead */
+    uint64 Fold128[2]; /**< \brief Carry-less multiply constants that fold data 16 bytes ahead */
+    uint8  Kernel;     /**< \brief CRC-16 kernel selected at startup, see #FM_CRC_KERNEL_SLICE */
+
+} FM_ChildCrc_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- child task worker data                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Child task worker data structure
+ *
+ *  Each child task worker owns a copy of the command it is executing and
+ *  the buffers and telemetry packets that the command handlers fill in,
+ *  so that workers may execute commands concurrently.
+ */
+typedef struct
+{
+    CFE_ES_TaskId_t TaskID; /**< \brief Worker child task ID */
+
+    FM_ChildWorkerHk_t Status;           /**< \brief Worker status reported in housekeeping telemetry */
+    uint32             CompleteSequence; /**< \brief Last completion sequence number (atomic access) */
+
+    FM_ChildQueueEntry_t CmdArgs; /**< \brief Command arguments taken from the child task queue */
+
+    bool Aborted; /**< \brief Command being executed has been aborted */
+
+    OS_time_t           JobStartTime;   /**< \brief Time the command being executed was dequeued */
+    FM_JobCompletePkt_t JobCompletePkt; /**< \brief Job completion telemetry packet */
+    FM_JobProgressPkt_t JobProgressPkt; /**< \brief Job progress telemetry packet */
+    OS_time_t           ProgressTime;   /**< \brief Time the job progress was last reported */
+    uint32              ProgressBytes;  /**< \brief Bytes done when the job progress was last reported */
+
+    CFE_ES_CDSHandle_t   CheckpointHandle; /**< \brief Copy checkpoint CDS handle, undefined if disabled */
+    FM_ChildCheckpoint_t Checkpoint;       /**< \brief Copy checkpoint of the command being executed */
+    uint32               CheckpointBlocks; /**< \brief Blocks copied since the checkpoint was saved */
+    uint32               CheckpointResume; /**< \brief Restored checkpoint held by the command (index + 1), 0 if none */
+
+    OS_time_t ThrottleTime; /**< \brief Time the worker last left the file data throttle */
+
+    FM_DirListFileStats_t DirListFileStats; /**< \brief Get dir list to file statistics structure */
+
+    FM_DirListPkt_t DirListPkt; /**< \brief Get dir list to packet telemetry packet */
+
+    FM_FileInfoPkt_t FileInfoPkt; /**< \brief Get file info telemetry packet */
+
+    char * ChildBuffer; /**< \brief Child task file I/O buffer, allocated from the child task memory pool */
+    uint32 BlockSize;   /**< \brief File I/O block size of the command being executed */
+
+    FM_ChildPipeline_t Pipeline; /**< \brief Copy and CRC transfer pipeline */
+
+#ifdef FM_INCLUDE_DECOMPRESS
+    FS_LIB_Decompress_State_t DecompressState;
+
+#endif
+
+} FM_ChildWorker_t;
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM -- application global data structure                         */
@@ -525,54 +1071,91 @@ typedef struct
 
     CFE_SB_PipeId_t CmdPipe; /**< \brief cFE software bus command pipe */
 
-    CFE_ES_TaskId_t ChildTaskID;        /**< \brief Child task ID */
-    osal_id_t       ChildSemaphore;     /**< \brief Child task wakeup counting semaphore */
-    osal_id_t       ChildQueueCountSem; /**< \brief Child queue counter mutex semaphore */
+    osal_id_t ChildSemaphore;     /**< \brief Child task wakeup counting semaphore */
+    osal_id_t ChildQueueCountSem; /**< \brief Child task worker dequeue mutex semaphore */
 
-    uint8 ChildCmdCounter;     /**< \brief Child task command success counter */
-    uint8 ChildCmdErrCounter;  /**< \brief Child task command error counter */
-    uint8 ChildCmdWarnCounter; /**< \brief Child task command warning counter */
+    uint8 ChildCmdCounter;     /**< \brief Child task command success counter (atomic access) */
+    uint8 ChildCmdErrCounter;  /**< \brief Child task command error counter (atomic access) */
+    uint8 ChildCmdWarnCounter; /**< \brief Child task command warning counter (atomic access) */
 
     uint8 ChildWriteIndex; /**< \brief Array index for next write to command args */
-    uint8 ChildReadIndex;  /**< \brief Array index for next read from command args */
-    uint8 ChildQueueCount; /**< \brief Number of pending commands in queue */
+    uint8 ChildQueueCount; /**< \brief Number of pending commands in queue (atomic access) */
+
+    osal_id_t ChildPendingWriteFd;     /**< \brief Pending commands file handle (FM main task) */
+    osal_id_t ChildPendingReadFd;      /**< \brief Pending commands file handle (child task) */
+    uint16    ChildPendingWriteIndex;  /**< \brief Ring index for next write to pending file (FM main task) */
+    uint16    ChildPendingReadIndex;   /**< \brief Ring index for next read from pending file (child task) */
+    uint16    ChildPendingInteractive; /**< \brief Ring index after the last interactive command in the file */
+
+    uint32 ChildLastJobID;                        /**< \brief Job ID assigned to the most recent command */
+    uint32 ChildAbortJobID[FM_CHILD_ABORT_COUNT]; /**< \brief Executing job ID's with abort requests (atomic access) */
+    uint8  ChildAbortIndex;                       /**< \brief Array index for next abort request */
 
     uint8 CommandCounter;    /**< \brief Application command success counter */
     uint8 CommandErrCounter; /**< \brief Application command error counter */
     uint8 Spare8a;           /**< \brief Placeholder for unused command warning counter */
 
-    uint8 ChildCurrentCC;  /**< \brief Command code currently executing */
-    uint8 ChildPreviousCC; /**< \brief Command code previously executed */
-    uint8 Spare8b;         /**< \brief Structure alignment spare */
+    uint32 ChildCompleteCount; /**< \brief Commands completed by all workers (atomic access) */
 
     uint32 FileStatTime; /**< \brief Modify time from most recent OS_stat */
     uint32 FileStatSize; /**< \brief File size from most recent OS_stat */
     uint32 FileStatMode; /**< \brief File mode from most recent OS_stat (OS_FILESTAT_MODE) */
 
-    FM_DirListFileStats_t DirListFileStats; /**< \brief Get dir list to file statistics structure */
-
-    FM_DirListPkt_t DirListPkt; /**< \brief Get dir list to packet telemetry packet */
-
     FM_FreeSpacePkt_t FreeSpacePkt; /**< \brief Get free space telemetry packet */
 
-    FM_FileInfoPkt_t FileInfoPkt; /**< \brief Get file info telemetry packet */
-
     FM_OpenFilesPkt_t OpenFilesPkt; /**< \brief Get open files telemetry packet */
 
     FM_HousekeepingPkt_t HousekeepingPkt; /**< \brief Application housekeeping telemetry packet */
 
-    char ChildBuffer[FM_CHILD_FILE_BLOCK_SIZE]; /**< \brief Child task file I/O buffer */
+    FM_ChildQueueEntry_t ChildQueueEntry; /**< \brief Command arguments being prepared by the FM main task */
 
-    FM_ChildQueueEntry_t ChildQueue[FM_CHILD_QUEUE_DEPTH]; /**< \brief Child task command queue */
+    FM_ChildQueueRecord_t ChildQueue[FM_CHILD_QUEUE_DEPTH]; /**< \brief Child task command queue */
 
-#ifdef FM_INCLUDE_DECOMPRESS
-    FS_LIB_Decompress_State_t DecompressState;
+    bool ChildPathBlockBusy[FM_CHILD_PATH_BLOCK_COUNT]; /**< \brief Path arena block in use (atomic access) */
+    char ChildPathArena[FM_CHILD_PATH_ARENA_SIZE];      /**< \brief Path arena for queued command arguments */
 
-#endif
+    bool ChildQueueBusy[FM_CHILD_QUEUE_DEPTH]; /**< \brief Command queue entry is waiting in a lane (atomic access) */
+
+    FM_ChildLane_t ChildLane[FM_CHILD_LANE_COUNT]; /**< \brief Child task command queue lanes */
+
+    FM_ChildWorker_t ChildWorker[FM_CHILD_WORKER_COUNT]; /**< \brief Child task worker data */
+
+    FM_ChildCheckpoint_t ChildCheckpoint[FM_CHILD_WORKER_COUNT]; /**< \brief Copy checkpoints restored at startup, held until resumed */
+
+    FM_ChildThrottle_t ChildThrottle; /**< \brief Child task I/O throttle shared by the workers */
+
+    FM_ChildCrc_t ChildCrc; /**< \brief Child task CRC engine shared by the workers */
+
+    uint8 ChildPipelineCount; /**< \brief Pipeline helper tasks started (atomic access) */
+
+    uint32                                      ChildBlockSize;  /**< \brief File I/O block size (atomic access) */
+    CFE_ES_MemHandle_t                          ChildPoolHandle; /**< \brief File I/O buffer memory pool handle */
+    CFE_ES_STATIC_POOL_TYPE(FM_CHILD_POOL_SIZE) ChildPool;       /**< \brief File I/O buffer memory pool */
 
 } FM_GlobalData_t;
 
 /** \brief File Manager global */
 extern FM_GlobalData_t FM_GlobalData;
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- application global data atomic access macros              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+** Global data shared between the FM main task and the child task workers
+**  without a semaphore must be accessed with these macros.  A store
+**  publishes every write that preceded it to the task that loads the same
+**  variable.
+*/
+#if defined(__GNUC__) || defined(__clang__)
+#define FM_ATOMIC_LOAD(Ptr)       __atomic_load_n((Ptr), __ATOMIC_ACQUIRE)
+#define FM_ATOMIC_STORE(Ptr, Val) __atomic_store_n((Ptr), (Val), __ATOMIC_RELEASE)
+#define FM_ATOMIC_INCREMENT(Ptr)  __atomic_add_fetch((Ptr), 1, __ATOMIC_ACQ_REL)
+#define FM_ATOMIC_DECREMENT(Ptr)  __atomic_sub_fetch((Ptr), 1, __ATOMIC_ACQ_REL)
+#else
+#error FM child task workers require compiler atomic builtins
+#endif
+
 #endif
@@ -101,6 +101,24 @@
  *       an existing file, provided that the file is closed.
  *       If the Overwrite command argument is FALSE, then the target must not exist.
  *       The source and target may be on different file systems.
+ *       If the CRC type command argument is not #FM_IGNORE_CRC, the CRC of
+ *       the copied data is computed as it is written and is reported in the
+ *       job completion telemetry packet.  If the verify command argument is
+ *       TRUE, the target file is then read back and its CRC is compared with
+ *       the CRC of the copied data.  Both CRC's and the comparison result are
+ *       reported in the job completion telemetry packet, and a target file
+ *       that does not match is removed.  If the sparse command argument is
+ *       TRUE, blocks of the source file that hold only zeros are not written
+ *       but are left as holes in the target file, so that the target uses
+ *       less file space.  Holes are only left in a copy that starts from an
+ *       empty target file, a resumed copy writes every block.  If the link
+ *       command argument is not #FM_COPY_LINK_NONE and the source and target
+ *       are on the same volume, the target shares the source data with a
+ *       hard link (#FM_COPY_LINK_HARD) or a copy-on-write clone
+ *       (#FM_COPY_LINK_CLONE) rather than a copy of every byte.  A hard
+ *       linked target is the same file as the source, so it is only suited
+ *       to read-only files.  The file data is copied when the link cannot be
+ *       made.
  *
  *       Because of the possibility that this command might take a very long time
  *       to complete, command argument validation will be done immediately but
@@ -120,6 +138,11 @@
  *  \par Command Error Conditions
  *       - Invalid command packet length
  *       - Overwrite is not TRUE (one) or FALSE (zero)
+ *       - CRC type is not ignore or a cFE CRC type
+ *       - Verify is not TRUE (one) or FALSE (zero), or is TRUE without a CRC type
+ *       - Sparse is not TRUE (one) or FALSE (zero)
+ *       - Link is not a link type, or is a link type with a CRC type
+ *       - Link is a link type and the target filename is the source filename
  *       - Source filename is invalid
  *       - Source file does not exist
  *       - Source filename is a directory
@@ -128,13 +151,19 @@
  *       - Target filename is a directory
  *       - Child task interface queue is full
  *       - Child task interface logic is broken
- *       - Failure of OS copy function
+ *       - Failure of OS function (open, read, write, etc.)
+ *       - Target file read back CRC does not match the copied data
  *
  *  \par Command Failure Verification
  *       - #FM_HousekeepingPkt_t.CommandErrCounter may increment
  *       - #FM_HousekeepingPkt_t.ChildCmdErrCounter may increment
  *       - Error event #FM_COPY_PKT_ERR_EID may be sent
  *       - Error event #FM_COPY_OVR_ERR_EID may be sent
+ *       - Error event #FM_COPY_CRC_ERR_EID may be sent
+ *       - Error event #FM_COPY_VERIFY_ERR_EID may be sent
+ *       - Error event #FM_COPY_SPARSE_ERR_EID may be sent
+ *       - Error event #FM_COPY_LINK_ERR_EID may be sent
+ *       - Error event #FM_COPY_LINK_SAME_ERR_EID may be sent
  *       - Error event #FM_COPY_SRC_INVALID_ERR_EID may be sent
  *       - Error event #FM_COPY_SRC_DNE_ERR_EID may be sent
  *       - Error event #FM_COPY_SRC_ISDIR_ERR_EID may be sent
@@ -145,6 +174,7 @@
  *       - Error event #FM_COPY_CHILD_FULL_ERR_EID may be sent
  *       - Error event #FM_COPY_CHILD_BROKEN_ERR_EID may be sent
  *       - Error event #FM_COPY_OS_ERR_EID may be sent
+ *       - Error event #FM_COPY_VERIFY_READ_ERR_EID may be sent
  *
  *  \par Criticality
  *       Copying files may consume file space needed by other
@@ -165,12 +195,18 @@
  *       If the Overwrite command argument is TRUE, then the target may be
  *       an existing file, provided that the file is closed.
  *       If the Overwrite command argument is FALSE, then the target must not exist.
- *       Source and target must both be on the same file system.
- *       The move command does not actually move any file data.
- *       The command modifies the file system directory structure to
- *       create a different file entry for the same file data.
- *       If the user wishes to move a file across file systems, he
- *       must first copy the file and then delete the original.
+ *       When source and target are on the same file system, the move
+ *       command does not actually move any file data.  The command
+ *       modifies the file system directory structure to create a
+ *       different file entry for the same file data.
+ *       The file system of each file is found from the file system
+ *       names in the free space table.  When they differ, or when the
+ *       directory entry cannot be moved, the file data is copied to the
+ *       target in the same way as the copy command, paced by the child
+ *       task I/O throttle and saved in checkpoints.  The target file is
+ *       then read back and its CRC compared with the copied data, and
+ *       the source file is deleted only after they match.  The CRC's
+ *       are reported in the job completion telemetry packet.
  *
  *       Because of the possibility that this command might take a very long time
  *       to complete, command argument validation will be done immediately but
@@ -198,7 +234,9 @@
  *       - Target filename is invalid
  *       - Target file already exists
  *       - Target filename is a directory
- *       - Failure of OS move function
+ *       - Failure of OS rename function, and of the copy across file systems
+ *       - Target file read back CRC does not match the copied data
+ *       - Failure of OS remove function for the source file
  *
  *  \par Command Failure Verification
  *       - #FM_HousekeepingPkt_t.CommandErrCounter may increment
@@ -334,6 +372,53 @@
  */
 #define FM_DELETE_CC 5
 
+/**
+ * \brief Abort Child Task Command
+ *
+ *  \par Description
+ *       This command aborts a child task command identified by the job ID
+ *       assigned to it when it was placed on the child task queue.  Each
+ *       queued command is assigned the next job ID, the most recent job ID
+ *       is reported in #FM_HousekeepingPkt_t.ChildLastJobID and the job ID
+ *       of each executing command in #FM_HousekeepingPkt_t.ChildWorker.
+ *
+ *       A command that is still waiting in the child task queue or the
+ *       pending commands file is marked as aborted and is not started when
+ *       the child task removes it from the queue.  A command
+ *       that is already executing stops at the next abort check between
+ *       blocks of work and removes any partially written target file.
+ *       Copy and move commands execute as a single OS call and cannot be
+ *       stopped once started.
+ *
+ *       The abort request is recorded immediately, the child task reports
+ *       the aborted command when it is stopped.  A job that is neither
+ *       waiting nor executing is rejected.
+ *
+ *  \par Command Packet Structure
+ *       #FM_AbortCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_t.CommandCounter will increment
+ *       - Informational event #FM_ABORT_CMD_EID will be sent
+ *       - #FM_HousekeepingPkt_t.ChildCmdWarnCounter will increment when the command is stopped
+ *       - Informational event #FM_CHILD_ABORT_EID will be sent when the command is stopped
+ *
+ *  \par Error Conditions
+ *       - Invalid command packet length
+ *       - Invalid command argument, job ID has not been assigned
+ *       - Job has already completed and is not queued or executing
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #FM_HousekeepingPkt_t.CommandErrCounter will increment
+ *       - Error event #FM_ABORT_PKT_ERR_EID may be sent
+ *       - Error event #FM_ABORT_ARG_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Aborting a concatenate or directory listing command leaves no
+ *       target file.  Aborting a job ID that is aborted again has no effect.
+ */
+#define FM_ABORT_CC 6
+
 /**
  * \brief Delete All Files
  *
@@ -461,6 +546,9 @@
  *       file.
  *       Sources must both be existing files and target must not exist.
  *       Sources and target may be on different file systems.
+ *       If the CRC type command argument is not #FM_IGNORE_CRC, the CRC of
+ *       the concatenated data is computed as it is written and is reported
+ *       in the job completion telemetry packet.
  *
  *       Because of the possibility that this command might take a very long time
  *       to complete, command argument validation will be done immediately but
@@ -481,6 +569,7 @@
  *
  *  \par Command Error Conditions
  *       - Invalid command packet length
+ *       - CRC type is not ignore or a cFE CRC type
  *       - Invalid source filename
  *       - Source file does not exist
  *       - Invalid target filename
@@ -491,6 +580,7 @@
  *       - #FM_HousekeepingPkt_t.CommandErrCounter may increment
  *       - #FM_HousekeepingPkt_t.ChildCmdErrCounter may increment
  *       - Error event #FM_CONCAT_PKT_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_CRC_ERR_EID may be sent
  *       - Error event #FM_CONCAT_OSCPY_ERR_EID may be sent
  *       - Error event #FM_CONCAT_OPEN_SRC2_ERR_EID may be sent
  *       - Error event #FM_CONCAT_OPEN_TGT_ERR_EID may be sent
@@ -529,7 +619,8 @@
  *       whether source is a file that is open or closed, a directory,
  *       or does not exist.
  *       The file information data also includes a CRC, file size,
- *       last modify time and the source name.
+ *       allocated size, last modify time and the source name.  The
+ *       allocated size is less than the file size for a sparse file.
  *
  *       Because of the possibility that this command might take a very long time
  *       to complete, command argument validation will be done immediately but
@@ -920,6 +1011,49 @@
  */
 #define FM_SET_TABLE_STATE_CC 17
 
+/**
+ * \brief Set Child Task I/O Throttle
+ *
+ *  \par Description
+ *       This command sets the rate limits of the token bucket throttle shared
+ *       by every child task worker.  File data read or written by the copy,
+ *       concatenate and file info CRC loops is limited to the commanded
+ *       bytes per second, and the OS_stat calls made by the
+ *       directory listing commands to the commanded calls per second.  A rate
+ *       of zero is unlimited.
+ *
+ *       When the latency limit is not zero, the file data rate backs off while
+ *       the smoothed time to process a block of file data is above the limit,
+ *       and recovers while it is below.  The rate in effect and the smoothed
+ *       latency are reported in housekeeping telemetry.
+ *
+ *       The startup settings are defined by #FM_CHILD_THROTTLE_BYTES_PER_SEC,
+ *       #FM_CHILD_THROTTLE_STATS_PER_SEC and #FM_CHILD_THROTTLE_LATENCY_US.
+ *
+ *  \par Command Packet Structure
+ *       #FM_SetThrottleCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_t.CommandCounter will increment
+ *       - #FM_HousekeepingPkt_t.ChildThrottleRate will report the new rate
+ *       - Informational event #FM_SET_THROTTLE_CMD_EID will be sent
+ *
+ *  \par Error Conditions
+ *       - Invalid command packet length
+ *       - File data rate less than one block per second of the file I/O
+ *         block size set by #FM_SET_BLOCK_SIZE_CC
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #FM_HousekeepingPkt_t.CommandErrCounter will increment
+ *       - Error event #FM_SET_THROTTLE_PKT_ERR_EID may be sent
+ *       - Error event #FM_SET_THROTTLE_ARG_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       An unlimited rate allows the child task to use all of the CPU time
+ *       not used by higher priority tasks.
+ */
+#define FM_SET_THROTTLE_CC 18
+
 /**
  * \brief Set Permissions of a file
  *
@@ -963,6 +1097,549 @@
  */
 #define FM_SET_FILE_PERM_CC 19
 
+/**
+ * \brief Set Child Task File I/O Block Size
+ *
+ *  \par Description
+ *       This command sets the size of each block of file data that the child
+ *       task workers read or write for the copy, move, concatenate and file
+ *       info CRC commands.  Larger blocks reduce the number of OS calls per
+ *       file and suit devices with a large optimal transfer size, smaller
+ *       blocks let the throttle, job progress and abort checks act sooner.
+ *
+ *       The child task file I/O buffers are allocated from a cFE memory pool
+ *       at startup, #FM_CHILD_MAX_BLOCK_SIZE bytes each and aligned to
+ *       #FM_CHILD_BUFFER_ALIGNMENT bytes, so the command only selects how much
+ *       of each buffer is used.  The new size applies to commands that a
+ *       worker starts afterwards.  The startup size is defined by
+ *       #FM_CHILD_FILE_BLOCK_SIZE.
+ *
+ *  \par Command Packet Structure
+ *       #FM_SetBlockSizeCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_t.CommandCounter will increment
+ *       - #FM_HousekeepingPkt_t.ChildBlockSize will report the new size
+ *       - Informational event #FM_SET_BLOCK_SIZE_CMD_EID will be sent
+ *
+ *  \par Error Conditions
+ *       - Invalid command packet length
+ *       - Block size less than 256 bytes
+ *       - Block size greater than #FM_CHILD_MAX_BLOCK_SIZE
+ *       - Block size not a multiple of #FM_CHILD_BUFFER_ALIGNMENT
+ *       - Block size greater than the file data rate set by
+ *         #FM_SET_THROTTLE_CC, in bytes per second
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #FM_HousekeepingPkt_t.CommandErrCounter will increment
+ *       - Error event #FM_SET_BLOCK_SIZE_PKT_ERR_EID may be sent
+ *       - Error event #FM_SET_BLOCK_SIZE_ARG_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Larger blocks hold the file system for longer between throttle
+ *       checks.
+ */
+#define FM_SET_BLOCK_SIZE_CC 20
+
+/**
+ * \brief Copy Directory
+ *
+ *  \par Description
+ *       This command copies the source directory, with every file and
+ *       subdirectory below it, to the target directory.  The source must be
+ *       an existing directory and the target must not be the source or a
+ *       directory below it.
+ *       If the Overwrite command argument is TRUE, then the target may be an
+ *       existing directory, and existing closed files below it are replaced.
+ *       If the Overwrite command argument is FALSE, then the target must not exist.
+ *       The source and target may be on different file systems.
+ *
+ *       The child task walks the source directory tree, creating each
+ *       directory and copying each file in the same way as the #FM_COPY_CC
+ *       command, with the same throttle, job progress telemetry and abort.
+ *       Source files that are open, and files that would replace an open
+ *       target file, are skipped rather than copied.  So are entries whose
+ *       name does not fit in OS_MAX_PATH_LEN and subdirectories more than
+ *       #FM_CHILD_DIR_TREE_DEPTH levels deep.  The number of entries skipped
+ *       is reported in a summary event, and the job completes with a warning.
+ *       The copy stops at the first directory or file that cannot be copied.
+ *       A copy that is interrupted by a processor reset resumes the file that
+ *       was being copied, but not the rest of the directory tree.
+ *
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       copying the directory will be performed by a lower priority child task.
+ *       As such, the command result for this function only refers to the result
+ *       of command argument verification and being able to place the command on
+ *       the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_CopyDirCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_t.ChildCmdCounter will increment after completion
+ *       - Debug event #FM_COPY_DIR_CMD_EID will be sent
+ *       - Informational event #FM_COPY_DIR_SKIP_WARNING_EID may be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Overwrite is not TRUE (one) or FALSE (zero)
+ *       - Source directory name is invalid
+ *       - Source directory does not exist
+ *       - Source directory name is a file
+ *       - Target directory name is invalid
+ *       - Target directory already exists
+ *       - Target directory name is a file
+ *       - Target directory is the source directory or below it
+ *       - Child task interface queue is full
+ *       - Child task interface logic is broken
+ *       - Failure of OS function (mkdir, open, read, write, etc.)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_COPY_DIR_PKT_ERR_EID may be sent
+ *       - Error event #FM_COPY_DIR_OVR_ERR_EID may be sent
+ *       - Error event #FM_COPY_DIR_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_COPY_DIR_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_COPY_DIR_SRC_FILE_ERR_EID may be sent
+ *       - Error event #FM_COPY_DIR_TGT_INVALID_ERR_EID may be sent
+ *       - Error event #FM_COPY_DIR_TGT_FILE_ERR_EID may be sent
+ *       - Error event #FM_COPY_DIR_TGT_EXIST_ERR_EID may be sent
+ *       - Error event #FM_COPY_DIR_TGT_NESTED_ERR_EID may be sent
+ *       - Error event #FM_COPY_DIR_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_COPY_DIR_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_COPY_DIR_CHILD_BROKEN_ERR_EID may be sent
+ *       - Error event #FM_COPY_DIR_OS_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Copying a directory tree may consume file space needed by other
+ *       critical tasks, and may take a long time to complete.  Commands
+ *       queued behind it in the bulk lane wait until it completes.
+ *
+ *  \sa #FM_COPY_CC, #FM_CREATE_DIR_CC
+ */
+#define FM_COPY_DIR_CC 21
+
+/**
+ * \brief Delete Directory Tree
+ *
+ *  \par Description
+ *       This command deletes the directory, with every file and subdirectory
+ *       below it.  Directory must be a valid directory name that exists.
+ *
+ *       The child task walks the directory tree, removing the files in each
+ *       directory and then the directory itself, so that the tree is removed
+ *       from the bottom up.  Open files are not deleted, and neither are the
+ *       directories that contain them.  Entries whose name does not fit in
+ *       OS_MAX_PATH_LEN, subdirectories more than #FM_CHILD_DIR_TREE_DEPTH
+ *       levels deep, and files or directories that cannot be removed are
+ *       skipped as well.  The number of files removed, directories removed
+ *       and entries skipped is reported in a summary event, and the job
+ *       completes with a warning if any entry was skipped.  Directory state
+ *       queries are paced by the child task I/O throttle, and the command may
+ *       be aborted between entries.
+ *
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       removal of the directory tree will be performed by a lower priority child
+ *       task.  As such, the command result for this function only refers to the
+ *       result of command argument verification and being able to place the
+ *       command on the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_DeleteTreeCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_t.ChildCmdCounter will increment after completion
+ *       - Debug event #FM_DELETE_TREE_CMD_EID will be sent
+ *       - Informational event #FM_DELETE_TREE_SKIP_WARNING_EID may be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Invalid directory name
+ *       - Directory does not exist
+ *       - Directory name is a file
+ *       - Child task interface queue is full
+ *       - Child task interface logic is broken
+ *       - Failure of OS function (OS_DirectoryOpen)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_DELETE_TREE_PKT_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_SRC_FILE_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_CHILD_BROKEN_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_OS_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       The unexpected loss of a directory tree may affect a critical
+ *       tasks ability to store data.  Deleted files cannot be recovered.
+ *
+ *  \sa #FM_DELETE_DIR_CC, #FM_DELETE_ALL_CC
+ */
+#define FM_DELETE_TREE_CC 22
+
+/**
+ * \brief Delete Filtered Files
+ *
+ *  \par Description
+ *       This command deletes the files in a directory that match a filename
+ *       pattern, and optionally lie within an age range and a size range.
+ *       Directory must be a valid directory name that exists.  In the pattern
+ *       '*' matches any sequence of characters and '?' matches any single
+ *       character, every other character matches itself.  The age of a file
+ *       is the number of seconds since it was last modified, measured against
+ *       the local time when the command starts.  A zero maximum age or size
+ *       leaves that range without an upper bound.
+ *
+ *       The child task reads the directory once.  Names are matched against
+ *       the pattern before any file status is read, and the age and size of
+ *       a matching file are only read when a range is given.  Open files are
+ *       not deleted, and subdirectories are skipped.  The number of files
+ *       deleted is reported in a completion event, and the job completes with
+ *       a warning if any selected entry was skipped.  File status queries are
+ *       paced by the child task I/O throttle, and the command may be aborted
+ *       between entries.
+ *
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       deleting the files will be performed by a lower priority child task.
+ *       As such, the command result for this function only refers to the result
+ *       of command argument verification and being able to place the command on
+ *       the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_DeleteFilterCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_t.ChildCmdCounter will increment after completion
+ *       - Debug event #FM_DELETE_FILTER_CMD_EID will be sent
+ *       - Informational event #FM_DELETE_FILTER_SKIP_WARNING_EID may be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Invalid directory name
+ *       - Directory does not exist
+ *       - Directory name is a file
+ *       - Pattern is empty, unterminated or holds a path separator
+ *       - Minimum age or size is greater than the non-zero maximum
+ *       - Child task interface queue is full
+ *       - Child task interface logic is broken
+ *       - Failure of OS function (OS_DirectoryOpen)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_DELETE_FILTER_PKT_ERR_EID may be sent
+ *       - Error event #FM_DELETE_FILTER_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_DELETE_FILTER_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_DELETE_FILTER_SRC_FILE_ERR_EID may be sent
+ *       - Error event #FM_DELETE_FILTER_ARG_ERR_EID may be sent
+ *       - Error event #FM_DELETE_FILTER_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_DELETE_FILTER_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_DELETE_FILTER_CHILD_BROKEN_ERR_EID may be sent
+ *       - Error event #FM_DELETE_FILTER_OS_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       A loosely written pattern may select files that a critical task
+ *       still needs.  Deleted files cannot be recovered.
+ *
+ *  \sa #FM_DELETE_ALL_CC, #FM_DELETE_CC
+ */
+#define FM_DELETE_FILTER_CC 23
+
+/**
+ * \brief Concatenate File List
+ *
+ *  \par Description
+ *       This command concatenates the files named in a source list file into
+ *       the target file.  The list file is a text file that names one source
+ *       file per line; empty lines are skipped and a trailing carriage return
+ *       is ignored.  The list file must be an existing file and the target
+ *       must not exist.  Every listed source must be a closed file other than
+ *       the target.  If the CRC type command argument is not #FM_IGNORE_CRC,
+ *       the CRC of the concatenated data is computed as it is written and is
+ *       reported in the job completion telemetry packet.
+ *
+ *       The child task reads the list once to check every source before the
+ *       target file is created, then writes the target file once, appending
+ *       each source in list order.  Unlike a chain of #FM_CONCAT_CC commands,
+ *       data already in the target file is never copied again.  File data is
+ *       paced by the child task I/O throttle, checkpoints name the list entry
+ *       being appended, and the command may be aborted between blocks.
+ *
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the list and writing the target file will be performed by a
+ *       lower priority child task.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command on
+ *       the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_ConcatListCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_t.ChildCmdCounter will increment after completion
+ *       - Debug event #FM_CONCAT_LIST_CMD_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - CRC type is not ignore or a cFE CRC type
+ *       - Invalid source list filename
+ *       - Source list file does not exist, is a directory or is open
+ *       - Invalid target filename
+ *       - Target file does exist
+ *       - Source list names no files, or names a file that is missing, open,
+ *         a directory or the target
+ *       - Source list line is too long for a filename
+ *       - Child task interface queue is full
+ *       - Child task interface logic is broken
+ *       - Failure of OS function (open, read, write, etc.)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_CONCAT_LIST_PKT_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_CRC_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_SRC_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_SRC_OPEN_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_TGT_INVALID_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_TGT_EXIST_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_TGT_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_CHILD_BROKEN_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_OS_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Concatenating very large files may consume more CPU resource
+ *       than anticipated.
+ *
+ *  \sa #FM_CONCAT_CC
+ */
+#define FM_CONCAT_LIST_CC 24
+
+/**
+ * \brief Split File
+ *
+ *  \par Description
+ *       This command splits the source file into numbered segment files of
+ *       the commanded size, for downlink or storage in pieces.  The target
+ *       command argument names the manifest file, and segment N is written
+ *       to the manifest filename followed by ".NNN" (starting at ".000").
+ *       The last segment holds the remainder of the source file.  The source
+ *       must be a closed file, the manifest file must not exist, and the
+ *       source may need no more than #FM_CHILD_SPLIT_MAX_SEGMENTS segments.
+ *
+ *       The manifest file has a cFE file header (sub-type
+ *       #FM_SPLIT_MANIFEST_SUBTYPE), a #FM_SplitManifestStats_t structure
+ *       and one #FM_SplitManifestEntry_t structure per segment.  If the CRC
+ *       type command argument is not #FM_IGNORE_CRC, each entry holds the
+ *       CRC of its segment, computed as the segment is written, so that a
+ *       segment may be checked and downlinked again on its own.
+ *
+ *       The source file is read once.  File data is paced by the child task
+ *       I/O throttle and the command may be aborted between blocks.  After
+ *       an error or abort every segment file and the manifest are removed.
+ *       The command is not checkpointed, a reset restarts it from the first
+ *       segment.
+ *
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the source file and writing the segment files will be performed
+ *       by a lower priority child task.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command on
+ *       the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_SplitCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_t.ChildCmdCounter will increment after completion
+ *       - Debug event #FM_SPLIT_CMD_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Segment size is zero
+ *       - CRC type is not ignore or a cFE CRC type
+ *       - Invalid source filename
+ *       - Source file does not exist, is a directory or is open
+ *       - Invalid manifest filename
+ *       - Manifest file does exist
+ *       - Source file needs too many segments
+ *       - Segment filename is too long, or segment file does exist
+ *       - Child task interface queue is full
+ *       - Child task interface logic is broken
+ *       - Failure of OS function (open, read, write, etc.)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_SPLIT_PKT_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_SIZE_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_CRC_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_SRC_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_SRC_OPEN_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_TGT_INVALID_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_TGT_EXIST_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_TGT_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_CHILD_BROKEN_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_SEGMENT_ERR_EID may be sent
+ *       - Error event #FM_SPLIT_OS_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Splitting very large files may consume more CPU resource than
+ *       anticipated.  A small segment size creates many files.
+ *
+ *  \sa #FM_CONCAT_LIST_CC
+ */
+#define FM_SPLIT_CC 25
+
+/**
+ * \brief Preallocate File
+ *
+ *  \par Description
+ *       This command reserves file system space for a file ahead of the
+ *       application that will write it, so that the file is given large
+ *       contiguous extents rather than the fragments left by many small
+ *       appends.  The file is created if it does not exist.  If the file is
+ *       smaller than the commanded size, it is extended to that size and the
+ *       new bytes read as zero.  A file that is already at least the
+ *       commanded size is not changed.
+ *
+ *       If #FM_INCLUDE_FILE_ALLOCATE is defined, the space is reserved with
+ *       fallocate, which allocates the extents without writing them.
+ *       Otherwise, or if the file system does not support fallocate, the
+ *       file is extended by writing zero blocks, which are paced by the
+ *       child task I/O throttle and may be aborted between blocks.  Data
+ *       written before an error or abort is left in place.
+ *
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       extending the file will be performed by a lower priority child task.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command on
+ *       the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_PreallocateCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_t.ChildCmdCounter will increment after completion
+ *       - Debug event #FM_PREALLOCATE_CMD_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - File size is zero
+ *       - Invalid filename
+ *       - Filename is a directory or an open file
+ *       - Child task interface queue is full
+ *       - Child task interface logic is broken
+ *       - Failure of OS function (open, write, fallocate, etc.)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_PREALLOCATE_PKT_ERR_EID may be sent
+ *       - Error event #FM_PREALLOCATE_SIZE_ERR_EID may be sent
+ *       - Error event #FM_PREALLOCATE_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_PREALLOCATE_SRC_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_PREALLOCATE_SRC_OPEN_ERR_EID may be sent
+ *       - Error event #FM_PREALLOCATE_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_PREALLOCATE_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_PREALLOCATE_CHILD_BROKEN_ERR_EID may be sent
+ *       - Error event #FM_PREALLOCATE_OS_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Preallocating a large file consumes the free space of the file
+ *       system immediately.  Without fallocate, writing the zero blocks
+ *       may take as long as copying a file of the same size.
+ *
+ *  \sa #FM_TRUNCATE_CC, #FM_GET_FREE_SPACE_CC
+ */
+#define FM_PREALLOCATE_CC 26
+
+/**
+ * \brief Truncate File
+ *
+ *  \par Description
+ *       This command shortens a closed file in place to the commanded size,
+ *       discarding the data after that offset and releasing its space, so
+ *       that trimming a log file does not need a copy and a delete.  The
+ *       commanded size may be zero, and may not be greater than the current
+ *       file size.  Use #FM_PREALLOCATE_CC to extend a file.
+ *
+ *       Truncating a file needs the POSIX truncate call, so the command is
+ *       only performed if #FM_INCLUDE_FILE_TRUNCATE is defined.  Otherwise
+ *       the command is rejected before it reaches the child task.
+ *
+ *       Command argument validation will be done immediately but the file
+ *       will be truncated by a lower priority child task, after any file
+ *       commands queued before it.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command on
+ *       the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_TruncateCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_t.ChildCmdCounter will increment after completion
+ *       - Debug event #FM_TRUNCATE_CMD_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - FM built without #FM_INCLUDE_FILE_TRUNCATE
+ *       - Invalid filename
+ *       - File does not exist, is a directory or is open
+ *       - File size is greater than the current file size
+ *       - Child task interface queue is full
+ *       - Child task interface logic is broken
+ *       - Failure of OS function (stat, truncate, etc.)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_TRUNCATE_PKT_ERR_EID may be sent
+ *       - Error event #FM_TRUNCATE_UNSUPPORTED_ERR_EID may be sent
+ *       - Error event #FM_TRUNCATE_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_TRUNCATE_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_TRUNCATE_SRC_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_TRUNCATE_SRC_OPEN_ERR_EID may be sent
+ *       - Error event #FM_TRUNCATE_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_TRUNCATE_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_TRUNCATE_CHILD_BROKEN_ERR_EID may be sent
+ *       - Error event #FM_TRUNCATE_SIZE_ERR_EID may be sent
+ *       - Error event #FM_TRUNCATE_OS_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       The data after the commanded size is lost.
+ *
+ *  \sa #FM_PREALLOCATE_CC
+ */
+#define FM_TRUNCATE_CC 27
+
 /**\}*/
 
 #endif
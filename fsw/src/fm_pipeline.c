@@ -0,0 +1,450 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task Transfer Pipeline Functions
+ *
+ *  Each child task worker has a ring of file block buffers and a helper
+ *  task.  The worker reads a block into the next free buffer and submits
+ *  it, the helper writes or CRCs the submitted blocks in order.  Reading
+ *  block N+1 then overlaps with writing block N, so a transfer runs near
+ *  the speed of the slower device.
+ *
+ *  Everything done with a block after it is read (target write, data CRC,
+ *  checkpoint and job progress) belongs to the helper until the worker
+ *  finishes the transfer.  A pipeline without a helper task processes each
+ *  block as it is submitted, in the same order.
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_msgdefs.h"
+#include "fm_defs.h"
+#include "fm_events.h"
+#include "fm_child.h"
+#include "fm_checkpoint.h"
+#include "fm_pipeline.h"
+#include "fm_queue.h"
+#include "fm_crc.h"
+#include "fm_perfids.h"
+#include "fm_platform_cfg.h"
+
+#include <string.h>
+
+#define FM_PIPELINE_FULL_SEM_NAME  "FM_PIPE_FULL"
+#define FM_PIPELINE_EMPTY_SEM_NAME "FM_PIPE_EMPTY"
+
+/* Every buffer is the same size, so the memory pool needs a single block size */
+static const size_t FM_PipelinePoolBlockSizes[1] = {FM_CHILD_POOL_BLOCK_SIZE};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- allocate the file I/O buffers           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_PipelineBufferInit(void)
+{
+    FM_ChildWorker_t *  Worker      = NULL;
+    CFE_ES_MemPoolBuf_t PoolBuf     = NULL;
+    char *              Buffer      = NULL;
+    int32               Result      = CFE_SUCCESS;
+    uint32              WorkerIndex = 0;
+    uint32              BufferIndex = 0;
+
+    FM_ATOMIC_STORE(&FM_GlobalData.ChildBlockSize, FM_CHILD_FILE_BLOCK_SIZE);
+
+    /* Only the FM main task allocates from the pool, so it needs no mutex */
+    Result = CFE_ES_PoolCreateEx(&FM_GlobalData.ChildPoolHandle, &FM_GlobalData.ChildPool,
+                                 sizeof(FM_GlobalData.ChildPool), 1, FM_PipelinePoolBlockSizes, false);
+
+    for (WorkerIndex = 0; (WorkerIndex < FM_CHILD_WORKER_COUNT) && (Result == CFE_SUCCESS); WorkerIndex++)
+    {
+        Worker = &FM_GlobalData.ChildWorker[WorkerIndex];
+
+        for (BufferIndex = 0; (BufferIndex <= FM_CHILD_PIPELINE_DEPTH) && (Result == CFE_SUCCESS); BufferIndex++)
+        {
+            /* Returns the size of the buffer on success */
+            Result = CFE_ES_GetPoolBuf(&PoolBuf, FM_GlobalData.ChildPoolHandle, FM_CHILD_POOL_BLOCK_SIZE);
+
+            if (Result >= 0)
+            {
+                Result = CFE_SUCCESS;
+
+                /* Each buffer has room to round its start up to the alignment */
+                Buffer = (char *)(((cpuaddr)PoolBuf + FM_CHILD_BUFFER_ALIGNMENT - 1) &
+                                  ~((cpuaddr)FM_CHILD_BUFFER_ALIGNMENT - 1));
+
+                if (BufferIndex == 0)
+                {
+                    Worker->ChildBuffer = Buffer;
+                }
+                else
+                {
+                    Worker->Pipeline.Buffer[BufferIndex - 1] = Buffer;
+                }
+            }
+        }
+
+        Worker->BlockSize = FM_CHILD_FILE_BLOCK_SIZE;
+    }
+
+    return (Result);
+
+} /* End of FM_PipelineBufferInit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- startup initialization                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_PipelineInit(void)
+{
+#if FM_CHILD_PIPELINE_DEPTH > 1
+    FM_ChildPipeline_t *Pipeline                 = NULL;
+    char                ObjName[OS_MAX_API_NAME] = "\0";
+    int32               Result                   = CFE_SUCCESS;
+    uint32              WorkerIndex              = 0;
+    CFE_ES_TaskId_t     TaskID                   = CFE_ES_TASKID_UNDEFINED;
+
+    /* Every pipeline has its semaphores before any helper task claims one */
+    for (WorkerIndex = 0; (WorkerIndex < FM_CHILD_WORKER_COUNT) && (Result == CFE_SUCCESS); WorkerIndex++)
+    {
+        Pipeline = &FM_GlobalData.ChildWorker[WorkerIndex].Pipeline;
+
+        snprintf(ObjName, sizeof(ObjName), "%s_%u", FM_PIPELINE_FULL_SEM_NAME, (unsigned int)WorkerIndex);
+        Result = OS_CountSemCreate(&Pipeline->FullSem, ObjName, 0, 0);
+
+        if (Result == CFE_SUCCESS)
+        {
+            snprintf(ObjName, sizeof(ObjName), "%s_%u", FM_PIPELINE_EMPTY_SEM_NAME, (unsigned int)WorkerIndex);
+            Result = OS_CountSemCreate(&Pipeline->EmptySem, ObjName, FM_CHILD_PIPELINE_DEPTH, 0);
+        }
+    }
+
+    /* Workers left without a helper task transfer each block themselves */
+    for (WorkerIndex = 0; (WorkerIndex < FM_CHILD_WORKER_COUNT) && (Result == CFE_SUCCESS); WorkerIndex++)
+    {
+        snprintf(ObjName, sizeof(ObjName), "%s_P%u", FM_CHILD_TASK_NAME, (unsigned int)WorkerIndex);
+
+        Result = CFE_ES_CreateChildTask(&TaskID, ObjName, FM_PipelineTask, 0, FM_CHILD_TASK_STACK_SIZE,
+                                        FM_CHILD_TASK_PRIORITY, 0);
+    }
+
+    if (Result != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(FM_CHILD_INIT_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Child Task initialization error: create %s failed: result = %d", ObjName, (int)Result);
+    }
+#endif
+
+} /* End of FM_PipelineInit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- helper task entry point                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_PipelineTask(void)
+{
+    FM_ChildWorker_t *Worker      = NULL;
+    int32             Result      = CFE_SUCCESS;
+    uint32            WorkerIndex = 0;
+
+    /* Helper tasks are identical, each claims the pipeline of the next worker */
+    WorkerIndex = FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildPipelineCount) - 1;
+
+    if (WorkerIndex < FM_CHILD_WORKER_COUNT)
+    {
+        Worker = &FM_GlobalData.ChildWorker[WorkerIndex];
+
+        FM_ATOMIC_STORE(&Worker->Pipeline.Running, true);
+
+        while (Result == CFE_SUCCESS)
+        {
+            /* Pend on the next submitted block */
+            Result = OS_CountSemTake(Worker->Pipeline.FullSem);
+
+            if (Result == CFE_SUCCESS)
+            {
+                CFE_ES_PerfLogEntry(FM_CHILD_PIPELINE_PERF_ID);
+
+                FM_PipelineProcess(Worker);
+
+                /* The buffer may be filled with the next block */
+                OS_CountSemGive(Worker->Pipeline.EmptySem);
+
+                CFE_ES_PerfLogExit(FM_CHILD_PIPELINE_PERF_ID);
+            }
+            else
+            {
+                CFE_EVS_SendEvent(FM_CHILD_TERM_SEM_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Child Task pipeline termination error: semaphore take failed: result = %d",
+                                  (int)Result);
+            }
+        }
+
+        /* Transfers started from now on do not wait for this helper */
+        FM_ATOMIC_STORE(&Worker->Pipeline.Running, false);
+    }
+
+    /* This call allows cFE to clean-up system resources */
+    CFE_ES_ExitChildTask();
+
+} /* End of FM_PipelineTask() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- write or CRC the oldest block           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_PipelineProcess(FM_ChildWorker_t *Worker)
+{
+    FM_ChildPipeline_t *Pipeline     = &Worker->Pipeline;
+    const char *        Buffer       = Pipeline->Buffer[Pipeline->ReadIndex];
+    int32               Size         = Pipeline->Size[Pipeline->ReadIndex];
+    int32               BytesWritten = 0;
+    int32               Offset       = 0;
+
+    /* Blocks that follow a failed write are dropped */
+    if (FM_ATOMIC_LOAD(&Pipeline->Failed) == false)
+    {
+        if ((Pipeline->Mode == FM_PIPELINE_MODE_SPARSE) && (FM_PipelineIsZero(Buffer, Size) == true))
+        {
+            /* Bytes seeked over in a new target file read back as zero */
+            Offset         = OS_lseek(Pipeline->FileHandle, Size, OS_SEEK_CUR);
+            Pipeline->Hole = true;
+
+            if (Offset < 0)
+            {
+                Pipeline->Result   = Offset;
+                Pipeline->Expected = Size;
+                FM_ATOMIC_STORE(&Pipeline->Failed, true);
+            }
+        }
+        else if (Pipeline->Mode != FM_PIPELINE_MODE_CRC)
+        {
+            BytesWritten   = OS_write(Pipeline->FileHandle, Buffer, Size);
+            Pipeline->Hole = false;
+
+            if (BytesWritten != Size)
+            {
+                /* The worker reports the failure when it finishes the transfer */
+                Pipeline->Result   = BytesWritten;
+                Pipeline->Expected = Size;
+                FM_ATOMIC_STORE(&Pipeline->Failed, true);
+            }
+        }
+
+        if (FM_ATOMIC_LOAD(&Pipeline->Failed) == false)
+        {
+            if (Pipeline->CRCType != FM_IGNORE_CRC)
+            {
+                Pipeline->CRC = FM_CrcCalculate(Buffer, Size, Pipeline->CRC, Pipeline->CRCType);
+            }
+
+            /* Checkpoints only describe data that has reached the target file */
+            if (Pipeline->Mode != FM_PIPELINE_MODE_CRC)
+            {
+                FM_CheckpointUpdate(Worker, Buffer, Size);
+            }
+
+            FM_ChildJobBytes(Worker, Size);
+        }
+    }
+
+    Pipeline->ReadIndex = (Pipeline->ReadIndex + 1) % FM_CHILD_PIPELINE_DEPTH;
+
+} /* End of FM_PipelineProcess() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- start of a transfer                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_PipelineStart(FM_ChildWorker_t *Worker, uint8 Mode, osal_id_t FileHandle, uint32 CRCType, uint32 CRC)
+{
+    FM_ChildPipeline_t *Pipeline = &Worker->Pipeline;
+
+    /* A helper that starts during the transfer waits for the next one */
+    Pipeline->Async = (FM_CHILD_PIPELINE_DEPTH > 1) && (FM_ATOMIC_LOAD(&Pipeline->Running) == true);
+
+    Pipeline->Mode       = Mode;
+    Pipeline->FileHandle = FileHandle;
+    Pipeline->CRCType    = CRCType;
+    Pipeline->CRC        = CRC;
+    Pipeline->Result     = OS_SUCCESS;
+    Pipeline->Expected   = 0;
+    Pipeline->Failed     = false;
+    Pipeline->Hole       = false;
+
+    /* Every buffer is free between transfers */
+    Pipeline->ReadIndex  = 0;
+    Pipeline->WriteIndex = 0;
+    Pipeline->Reserved   = 0;
+
+} /* End of FM_PipelineStart() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- get the buffer for the next block       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+char *FM_PipelineBuffer(FM_ChildWorker_t *Worker)
+{
+    FM_ChildPipeline_t *Pipeline = &Worker->Pipeline;
+    char *              Buffer   = Pipeline->Buffer[Pipeline->WriteIndex];
+    int32               Result   = CFE_SUCCESS;
+
+    /* The worker keeps a buffer it has not submitted yet */
+    if ((Pipeline->Async == true) && (Pipeline->Reserved == 0))
+    {
+        Result = OS_CountSemTake(Pipeline->EmptySem);
+
+        if (Result == CFE_SUCCESS)
+        {
+            Pipeline->Reserved = 1;
+        }
+        else
+        {
+            Pipeline->Result   = Result;
+            Pipeline->Expected = 0;
+            FM_ATOMIC_STORE(&Pipeline->Failed, true);
+
+            /* The ring buffer may still be in use by the helper */
+            Buffer = Worker->ChildBuffer;
+        }
+    }
+
+    return (Buffer);
+
+} /* End of FM_PipelineBuffer() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- submit the most recent block            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_PipelineSubmit(FM_ChildWorker_t *Worker, int32 Size)
+{
+    FM_ChildPipeline_t *Pipeline = &Worker->Pipeline;
+
+    if (FM_ATOMIC_LOAD(&Pipeline->Failed) == false)
+    {
+        Pipeline->Size[Pipeline->WriteIndex] = Size;
+        Pipeline->WriteIndex                 = (Pipeline->WriteIndex + 1) % FM_CHILD_PIPELINE_DEPTH;
+
+        if (Pipeline->Async == true)
+        {
+            /* The helper owns the buffer until it gives the empty semaphore */
+            Pipeline->Reserved = 0;
+            OS_CountSemGive(Pipeline->FullSem);
+        }
+        else
+        {
+            FM_PipelineProcess(Worker);
+        }
+    }
+
+    return (FM_ATOMIC_LOAD(&Pipeline->Failed) == false);
+
+} /* End of FM_PipelineSubmit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- wait for the end of a transfer          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_PipelineFinish(FM_ChildWorker_t *Worker)
+{
+    FM_ChildPipeline_t *Pipeline = &Worker->Pipeline;
+    int32               Result   = CFE_SUCCESS;
+    uint32              Taken    = 0;
+    uint32              Count    = 0;
+    char                Zero     = 0;
+
+    if (Pipeline->Async == true)
+    {
+        /* The helper is done when the worker holds every buffer */
+        for (Taken = Pipeline->Reserved; (Taken < FM_CHILD_PIPELINE_DEPTH) && (Result == CFE_SUCCESS); Taken++)
+        {
+            Result = OS_CountSemTake(Pipeline->EmptySem);
+        }
+
+        if (Result != CFE_SUCCESS)
+        {
+            Taken--;
+
+            Pipeline->Result   = Result;
+            Pipeline->Expected = 0;
+            FM_ATOMIC_STORE(&Pipeline->Failed, true);
+        }
+
+        /* Leave every buffer free for the next transfer */
+        for (Count = 0; Count < Taken; Count++)
+        {
+            OS_CountSemGive(Pipeline->EmptySem);
+        }
+
+        Pipeline->Reserved = 0;
+    }
+
+    /* A target file that ends in a hole is extended by writing its last byte */
+    if ((Pipeline->Hole == true) && (FM_ATOMIC_LOAD(&Pipeline->Failed) == false))
+    {
+        Pipeline->Hole = false;
+        Result         = OS_lseek(Pipeline->FileHandle, -1, OS_SEEK_CUR);
+
+        if (Result >= 0)
+        {
+            Result = OS_write(Pipeline->FileHandle, &Zero, 1);
+        }
+
+        if (Result != 1)
+        {
+            Pipeline->Result   = Result;
+            Pipeline->Expected = 1;
+            FM_ATOMIC_STORE(&Pipeline->Failed, true);
+        }
+    }
+
+    return (FM_ATOMIC_LOAD(&Pipeline->Failed) == false);
+
+} /* End of FM_PipelineFinish() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- test for an all-zero block              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_PipelineIsZero(const char *Buffer, int32 Size)
+{
+    /* Every byte equals the next and the first is zero, memcmp is vectorized by the C library */
+    return ((Size > 0) && (Buffer[0] == 0) && (memcmp(Buffer, &Buffer[1], Size - 1) == 0));
+
+} /* End of FM_PipelineIsZero() */
@@ -0,0 +1,226 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS File Manager child task transfer
+ *   pipeline functions.
+ */
+#ifndef FM_PIPELINE_H
+#define FM_PIPELINE_H
+
+#include "cfe.h"
+#include "fm_msg.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM transfer pipeline function prototypes (FM main task)         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Transfer Pipeline Buffer Initialization Function
+ *
+ *  \par Description
+ *       Creates the child task file I/O buffer memory pool, then allocates
+ *       the I/O buffer and the pipeline buffers of each child task worker.
+ *       Buffers are #FM_CHILD_MAX_BLOCK_SIZE bytes, and start on a multiple
+ *       of #FM_CHILD_BUFFER_ALIGNMENT bytes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called before the child task workers are created.  The buffers are
+ *       never freed.  Also sets the startup file I/O block size.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ *
+ *  \sa #FM_ChildInit
+ */
+int32 FM_PipelineBufferInit(void);
+
+/**
+ *  \brief Transfer Pipeline Initialization Function
+ *
+ *  \par Description
+ *       Creates the semaphores of each child task worker transfer pipeline,
+ *       and one helper task for each worker.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called after the child task workers are created.  Failure is not
+ *       fatal, workers without a helper task read and then write each block
+ *       themselves.  Does nothing when #FM_CHILD_PIPELINE_DEPTH is 1.
+ *
+ *  \sa #FM_ChildInit
+ */
+void FM_PipelineInit(void);
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM transfer pipeline function prototypes (helper task)          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Transfer Pipeline Helper Task Entry Point
+ *
+ *  \par Description
+ *       Claims the pipeline of the next child task worker, then processes
+ *       the blocks submitted by the worker until a semaphore error.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \sa #FM_PipelineProcess
+ */
+void FM_PipelineTask(void);
+
+/**
+ *  \brief Transfer Pipeline Process Block Function
+ *
+ *  \par Description
+ *       Processes the oldest block in the pipeline.  In write mode the
+ *       block is written to the target file, then added to the CRC, the
+ *       copy checkpoint and the job progress.  Sparse mode is the same,
+ *       except that all-zero blocks are seeked over rather than written.
+ *       In CRC mode the block is added to the CRC and the job progress.
+ *       After a failed write the remaining blocks of the transfer are
+ *       dropped.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the helper task, or by the worker when the pipeline has
+ *       no helper task.
+ *
+ *  \param [in]  Worker Pointer to the child task worker that owns the pipeline
+ *
+ *  \sa #FM_PipelineSubmit
+ */
+void FM_PipelineProcess(FM_ChildWorker_t *Worker);
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM transfer pipeline function prototypes (child task)           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Transfer Pipeline Start Function
+ *
+ *  \par Description
+ *       Prepares the pipeline for a transfer.  Blocks are passed to the
+ *       helper task when there is one, otherwise they are processed as
+ *       they are submitted.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The previous transfer must have been finished.
+ *
+ *  \param [in]  Worker     Pointer to the child task worker
+ *  \param [in]  Mode       #FM_PIPELINE_MODE_WRITE, #FM_PIPELINE_MODE_SPARSE or #FM_PIPELINE_MODE_CRC
+ *  \param [in]  FileHandle Target file handle, unused in CRC mode
+ *  \param [in]  CRCType    CRC computed over the blocks, #FM_IGNORE_CRC for none
+ *  \param [in]  CRC        Initial CRC value
+ *
+ *  \sa #FM_PipelineFinish
+ */
+void FM_PipelineStart(FM_ChildWorker_t *Worker, uint8 Mode, osal_id_t FileHandle, uint32 CRCType, uint32 CRC);
+
+/**
+ *  \brief Transfer Pipeline Get Buffer Function
+ *
+ *  \par Description
+ *       Returns the buffer for the next block, waiting until the helper
+ *       task has processed the block previously read into it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Buffers are #FM_CHILD_MAX_BLOCK_SIZE bytes.  If the wait fails the
+ *       transfer fails, and the worker private buffer is returned so that
+ *       no block held by the helper task is overwritten.
+ *
+ *  \param [in]  Worker Pointer to the child task worker
+ *
+ *  \return Pointer to the buffer to read the next block into
+ *
+ *  \sa #FM_PipelineSubmit
+ */
+char *FM_PipelineBuffer(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Transfer Pipeline Submit Block Function
+ *
+ *  \par Description
+ *       Hands the block read into the most recent buffer to the helper
+ *       task, or processes it now when the pipeline has no helper task.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Blocks from a failed transfer are dropped.
+ *
+ *  \param [in]  Worker Pointer to the child task worker
+ *  \param [in]  Size   Number of bytes in the block, greater than zero
+ *
+ *  \return Transfer status
+ *  \retval true  No block of the transfer has failed so far
+ *  \retval false The transfer has failed, stop reading
+ *
+ *  \sa #FM_PipelineBuffer, #FM_PipelineFinish
+ */
+bool FM_PipelineSubmit(FM_ChildWorker_t *Worker, int32 Size);
+
+/**
+ *  \brief Transfer Pipeline Finish Function
+ *
+ *  \par Description
+ *       Waits until the helper task has processed every submitted block.
+ *       A sparse target file that ends in a hole is then extended to its
+ *       full size by writing its last byte.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called at the end of every transfer, before the target file
+ *       is closed.  The final CRC and the failed write result are then
+ *       available in the worker pipeline data.
+ *
+ *  \param [in]  Worker Pointer to the child task worker
+ *
+ *  \return Transfer status
+ *  \retval true  Every submitted block was processed
+ *  \retval false The transfer failed
+ *
+ *  \sa #FM_PipelineStart
+ */
+bool FM_PipelineFinish(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Transfer Pipeline All-Zero Block Function
+ *
+ *  \par Description
+ *       Tests whether every byte of a block is zero.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]  Buffer Pointer to the block
+ *  \param [in]  Size   Number of bytes in the block
+ *
+ *  \return Block contents
+ *  \retval true  Block is not empty and every byte is zero
+ *  \retval false Block is empty or holds a non-zero byte
+ *
+ *  \sa #FM_PipelineProcess
+ */
+bool FM_PipelineIsZero(const char *Buffer, int32 Size);
+
+#endif
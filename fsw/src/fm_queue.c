@@ -0,0 +1,704 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task Command Queue Functions
+ *
+ *  Each command queue lane is a single producer, single consumer ring
+ *  of command queue entry indexes.  The FM main task owns the write
+ *  index and the child task owns the read index, so neither task takes
+ *  a semaphore to update a lane.
+ *
+ *  Both indexes run from zero to twice the lane depth before wrapping,
+ *  which lets a full lane be told apart from an empty lane without a
+ *  shared counter that both tasks would have to update.  The pending
+ *  commands file ring uses the same scheme.
+ *
+ *  Queue entries keep their path arguments in a shared arena of fixed
+ *  size blocks, so a queue entry only holds as much path storage as the
+ *  command arguments actually use.
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_queue.h"
+#include "fm_events.h"
+
+#include <string.h>
+
+/* Lane read and write indexes wrap at twice the lane depth */
+#define FM_QUEUE_INDEX_LIMIT (FM_CHILD_QUEUE_DEPTH * 2)
+
+/* Pending file read and write indexes wrap at twice the pending file depth */
+#define FM_QUEUE_PENDING_LIMIT (FM_CHILD_PENDING_DEPTH * 2)
+
+/* Pending file slot count, never zero so that a disabled pending file still compiles */
+#define FM_QUEUE_PENDING_SLOTS ((FM_CHILD_PENDING_DEPTH > 0) ? FM_CHILD_PENDING_DEPTH : 1)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- number of entries between lane indexes     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint8 FM_QueueLaneDistance(uint8 WriteIndex, uint8 ReadIndex)
+{
+    return ((uint8)((WriteIndex + FM_QUEUE_INDEX_LIMIT - ReadIndex) % FM_QUEUE_INDEX_LIMIT));
+
+} /* End of FM_QueueLaneDistance() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- append entry to lane (FM main task only)   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueueLanePush(FM_ChildLane_t *Lane, uint8 QueueIndex)
+{
+    bool  Result     = false;
+    uint8 WriteIndex = Lane->WriteIndex;
+    uint8 ReadIndex  = FM_ATOMIC_LOAD(&Lane->ReadIndex);
+
+    if ((QueueIndex < FM_CHILD_QUEUE_DEPTH) && (WriteIndex < FM_QUEUE_INDEX_LIMIT) &&
+        (FM_QueueLaneDistance(WriteIndex, ReadIndex) < FM_CHILD_QUEUE_DEPTH))
+    {
+        Lane->Slot[WriteIndex % FM_CHILD_QUEUE_DEPTH] = QueueIndex;
+
+        WriteIndex++;
+
+        if (WriteIndex >= FM_QUEUE_INDEX_LIMIT)
+        {
+            WriteIndex = 0;
+        }
+
+        /* Publish the slot (and the queue entry it refers to) to the child task */
+        FM_ATOMIC_STORE(&Lane->WriteIndex, WriteIndex);
+
+        Result = true;
+    }
+
+    return (Result);
+
+} /* End of FM_QueueLanePush() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- remove entry from lane (child task only)   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueueLanePop(FM_ChildLane_t *Lane, uint8 *QueueIndex)
+{
+    bool  Result     = false;
+    uint8 ReadIndex  = FM_ATOMIC_LOAD(&Lane->ReadIndex);
+    uint8 WriteIndex = FM_ATOMIC_LOAD(&Lane->WriteIndex);
+
+    if ((ReadIndex < FM_QUEUE_INDEX_LIMIT) && (FM_QueueLaneDistance(WriteIndex, ReadIndex) != 0))
+    {
+        *QueueIndex = Lane->Slot[ReadIndex % FM_CHILD_QUEUE_DEPTH];
+
+        ReadIndex++;
+
+        if (ReadIndex >= FM_QUEUE_INDEX_LIMIT)
+        {
+            ReadIndex = 0;
+        }
+
+        /* Return the slot to the FM main task */
+        FM_ATOMIC_STORE(&Lane->ReadIndex, ReadIndex);
+
+        Result = true;
+    }
+
+    return (Result);
+
+} /* End of FM_QueueLanePop() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- mark waiting lane entry as aborted         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueueLaneAbort(const FM_ChildLane_t *Lane, uint32 JobID)
+{
+    bool   Result     = false;
+    uint8  ReadIndex  = FM_ATOMIC_LOAD(&Lane->ReadIndex);
+    uint8  WriteIndex = Lane->WriteIndex;
+    uint8  Count      = 0;
+    uint8  QueueIndex = 0;
+    uint8  i;
+
+    if ((ReadIndex < FM_QUEUE_INDEX_LIMIT) && (WriteIndex < FM_QUEUE_INDEX_LIMIT))
+    {
+        Count = FM_QueueLaneDistance(WriteIndex, ReadIndex);
+    }
+
+    /* The ring is left as is, the child task skips the marked entry when it is popped */
+    for (i = 0; (i < Count) && (i < FM_CHILD_QUEUE_DEPTH) && (Result == false); i++)
+    {
+        QueueIndex = Lane->Slot[(ReadIndex + i) % FM_CHILD_QUEUE_DEPTH];
+
+        if ((QueueIndex < FM_CHILD_QUEUE_DEPTH) && (FM_GlobalData.ChildQueue[QueueIndex].JobID == JobID))
+        {
+            FM_GlobalData.ChildQueue[QueueIndex].Aborted = true;
+
+            Result = true;
+        }
+    }
+
+    return (Result);
+
+} /* End of FM_QueueLaneAbort() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- number of entries waiting in lane          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint8 FM_QueueLaneCount(const FM_ChildLane_t *Lane)
+{
+    uint8 ReadIndex  = FM_ATOMIC_LOAD(&Lane->ReadIndex);
+    uint8 WriteIndex = FM_ATOMIC_LOAD(&Lane->WriteIndex);
+
+    return (FM_QueueLaneDistance(WriteIndex, ReadIndex));
+
+} /* End of FM_QueueLaneCount() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- verify lane indexes                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueueLaneIsValid(const FM_ChildLane_t *Lane)
+{
+    bool  Result     = false;
+    uint8 ReadIndex  = FM_ATOMIC_LOAD(&Lane->ReadIndex);
+    uint8 WriteIndex = FM_ATOMIC_LOAD(&Lane->WriteIndex);
+
+    if ((ReadIndex < FM_QUEUE_INDEX_LIMIT) && (WriteIndex < FM_QUEUE_INDEX_LIMIT) &&
+        (FM_QueueLaneDistance(WriteIndex, ReadIndex) <= FM_CHILD_QUEUE_DEPTH))
+    {
+        Result = true;
+    }
+
+    return (Result);
+
+} /* End of FM_QueueLaneIsValid() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- allocate contiguous path arena blocks      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static bool FM_QueueArenaAlloc(uint8 BlockCount, uint16 *FirstBlock)
+{
+    bool   Result    = false;
+    uint16 RunStart  = 0;
+    uint16 RunLength = 0;
+    uint16 i;
+
+    /* First fit, the arena is small enough that a linear scan is cheap */
+    for (i = 0; (i < FM_CHILD_PATH_BLOCK_COUNT) && (Result == false); i++)
+    {
+        if (FM_ATOMIC_LOAD(&FM_GlobalData.ChildPathBlockBusy[i]) == true)
+        {
+            RunLength = 0;
+        }
+        else
+        {
+            if (RunLength == 0)
+            {
+                RunStart = i;
+            }
+
+            RunLength++;
+
+            if (RunLength == BlockCount)
+            {
+                Result = true;
+            }
+        }
+    }
+
+    if (Result == true)
+    {
+        for (i = RunStart; i < (RunStart + BlockCount); i++)
+        {
+            FM_ATOMIC_STORE(&FM_GlobalData.ChildPathBlockBusy[i], true);
+        }
+
+        *FirstBlock = RunStart;
+    }
+
+    return (Result);
+
+} /* End of FM_QueueArenaAlloc() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- free contiguous path arena blocks          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_QueueArenaFree(uint16 FirstBlock, uint8 BlockCount)
+{
+    uint16 i;
+
+    for (i = FirstBlock; (i < (FirstBlock + BlockCount)) && (i < FM_CHILD_PATH_BLOCK_COUNT); i++)
+    {
+        FM_ATOMIC_STORE(&FM_GlobalData.ChildPathBlockBusy[i], false);
+    }
+
+} /* End of FM_QueueArenaFree() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- verify arena room for one more command     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueueArenaHasRoom(void)
+{
+    uint16 RunCount  = 0;
+    uint16 RunLength = 0;
+    uint16 i;
+
+    /*
+    ** Count disjoint runs of free blocks that would each hold a path of
+    **  the maximum length.  First fit allocation always starts at the
+    **  beginning of a free run, so each path allocated can use up at
+    **  most one of the runs counted here.
+    */
+    for (i = 0; (i < FM_CHILD_PATH_BLOCK_COUNT) && (RunCount < FM_CHILD_PATH_COUNT); i++)
+    {
+        if (FM_ATOMIC_LOAD(&FM_GlobalData.ChildPathBlockBusy[i]) == true)
+        {
+            RunLength = 0;
+        }
+        else
+        {
+            RunLength++;
+
+            if (RunLength == FM_CHILD_PATH_BLOCK_MAX)
+            {
+                RunCount++;
+                RunLength = 0;
+            }
+        }
+    }
+
+    return (RunCount >= FM_CHILD_PATH_COUNT);
+
+} /* End of FM_QueueArenaHasRoom() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- store command args in queue entry          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueueEntryPack(uint8 QueueIndex, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildQueueRecord_t *Record = &FM_GlobalData.ChildQueue[QueueIndex];
+    const char *           Path[FM_CHILD_PATH_COUNT];
+    bool                   Result = true;
+    size_t                 PathLength;
+    uint8                  i;
+
+    Path[FM_CHILD_PATH_SOURCE1] = CmdArgs->Source1;
+    Path[FM_CHILD_PATH_SOURCE2] = CmdArgs->Source2;
+    Path[FM_CHILD_PATH_TARGET]  = CmdArgs->Target;
+
+    for (i = 0; i < FM_CHILD_PATH_COUNT; i++)
+    {
+        Record->PathBlock[i]      = 0;
+        Record->PathBlockCount[i] = 0;
+    }
+
+    for (i = 0; (i < FM_CHILD_PATH_COUNT) && (Result == true); i++)
+    {
+        PathLength = strnlen(Path[i], OS_MAX_PATH_LEN - 1);
+
+        if (PathLength != 0)
+        {
+            Record->PathBlockCount[i] =
+                (uint8)((PathLength + 1 + FM_CHILD_PATH_BLOCK_SIZE - 1) / FM_CHILD_PATH_BLOCK_SIZE);
+
+            if (FM_QueueArenaAlloc(Record->PathBlockCount[i], &Record->PathBlock[i]) == true)
+            {
+                memcpy(&FM_GlobalData.ChildPathArena[Record->PathBlock[i] * FM_CHILD_PATH_BLOCK_SIZE], Path[i],
+                       PathLength);
+                FM_GlobalData.ChildPathArena[(Record->PathBlock[i] * FM_CHILD_PATH_BLOCK_SIZE) + PathLength] = '\0';
+            }
+            else
+            {
+                /* Give back the blocks allocated for the preceding paths */
+                Record->PathBlockCount[i] = 0;
+                FM_QueueEntryRelease(QueueIndex);
+                Result = false;
+            }
+        }
+    }
+
+    if (Result == true)
+    {
+        Record->CommandCode     = CmdArgs->CommandCode;
+        Record->DirListOffset   = CmdArgs->DirListOffset;
+        Record->GetSizeTimeMode = CmdArgs->GetSizeTimeMode;
+        Record->FileInfoState   = CmdArgs->FileInfoState;
+        Record->FileInfoSize    = CmdArgs->FileInfoSize;
+        Record->FileInfoTime    = CmdArgs->FileInfoTime;
+        Record->FileInfoCRC     = CmdArgs->FileInfoCRC;
+        Record->Mode            = CmdArgs->Mode;
+        Record->JobID           = CmdArgs->JobID;
+        Record->Aborted         = CmdArgs->Aborted;
+        Record->MinAge          = CmdArgs->MinAge;
+        Record->MaxAge          = CmdArgs->MaxAge;
+        Record->MinSize         = CmdArgs->MinSize;
+        Record->MaxSize         = CmdArgs->MaxSize;
+        Record->SegmentSize     = CmdArgs->SegmentSize;
+        Record->FileSize        = CmdArgs->FileSize;
+        Record->QueueTime       = CmdArgs->QueueTime;
+        Record->Resume          = CmdArgs->Resume;
+        Record->Verify          = CmdArgs->Verify;
+        Record->Sparse          = CmdArgs->Sparse;
+        Record->CrossVolume     = CmdArgs->CrossVolume;
+        Record->Link            = CmdArgs->Link;
+    }
+
+    return (Result);
+
+} /* End of FM_QueueEntryPack() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- copy command args out of queue entry       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_QueueEntryUnpack(uint8 QueueIndex, FM_ChildQueueEntry_t *CmdArgs)
+{
+    const FM_ChildQueueRecord_t *Record = &FM_GlobalData.ChildQueue[QueueIndex];
+    char *                       Path[FM_CHILD_PATH_COUNT];
+    uint8                        i;
+
+    Path[FM_CHILD_PATH_SOURCE1] = CmdArgs->Source1;
+    Path[FM_CHILD_PATH_SOURCE2] = CmdArgs->Source2;
+    Path[FM_CHILD_PATH_TARGET]  = CmdArgs->Target;
+
+    CmdArgs->CommandCode     = Record->CommandCode;
+    CmdArgs->DirListOffset   = Record->DirListOffset;
+    CmdArgs->GetSizeTimeMode = Record->GetSizeTimeMode;
+    CmdArgs->FileInfoState   = Record->FileInfoState;
+    CmdArgs->FileInfoSize    = Record->FileInfoSize;
+    CmdArgs->FileInfoTime    = Record->FileInfoTime;
+    CmdArgs->FileInfoCRC     = Record->FileInfoCRC;
+    CmdArgs->Mode            = Record->Mode;
+    CmdArgs->JobID           = Record->JobID;
+    CmdArgs->Aborted         = Record->Aborted;
+    CmdArgs->MinAge          = Record->MinAge;
+    CmdArgs->MaxAge          = Record->MaxAge;
+    CmdArgs->MinSize         = Record->MinSize;
+    CmdArgs->MaxSize         = Record->MaxSize;
+    CmdArgs->SegmentSize     = Record->SegmentSize;
+    CmdArgs->FileSize        = Record->FileSize;
+    CmdArgs->QueueTime       = Record->QueueTime;
+    CmdArgs->Resume          = Record->Resume;
+    CmdArgs->Verify          = Record->Verify;
+    CmdArgs->Sparse          = Record->Sparse;
+    CmdArgs->CrossVolume     = Record->CrossVolume;
+    CmdArgs->Link            = Record->Link;
+
+    for (i = 0; i < FM_CHILD_PATH_COUNT; i++)
+    {
+        if ((Record->PathBlockCount[i] != 0) &&
+            ((Record->PathBlock[i] + Record->PathBlockCount[i]) <= FM_CHILD_PATH_BLOCK_COUNT))
+        {
+            strncpy(Path[i], &FM_GlobalData.ChildPathArena[Record->PathBlock[i] * FM_CHILD_PATH_BLOCK_SIZE],
+                    OS_MAX_PATH_LEN - 1);
+            Path[i][OS_MAX_PATH_LEN - 1] = '\0';
+        }
+        else
+        {
+            Path[i][0] = '\0';
+        }
+    }
+
+    FM_QueueEntryRelease(QueueIndex);
+
+} /* End of FM_QueueEntryUnpack() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- release queue entry path arena blocks      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_QueueEntryRelease(uint8 QueueIndex)
+{
+    FM_ChildQueueRecord_t *Record = &FM_GlobalData.ChildQueue[QueueIndex];
+    uint8                  i;
+
+    for (i = 0; i < FM_CHILD_PATH_COUNT; i++)
+    {
+        FM_QueueArenaFree(Record->PathBlock[i], Record->PathBlockCount[i]);
+
+        Record->PathBlockCount[i] = 0;
+    }
+
+} /* End of FM_QueueEntryRelease() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- number of entries between pending indexes  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint16 FM_QueuePendingDistance(uint16 WriteIndex, uint16 ReadIndex)
+{
+    return ((uint16)((WriteIndex + (FM_QUEUE_PENDING_SLOTS * 2) - ReadIndex) % (FM_QUEUE_PENDING_SLOTS * 2)));
+
+} /* End of FM_QueuePendingDistance() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- open the pending commands file             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_QueuePendingInit(void)
+{
+    int32 Status = OS_SUCCESS;
+
+    FM_GlobalData.ChildPendingWriteFd     = OS_OBJECT_ID_UNDEFINED;
+    FM_GlobalData.ChildPendingReadFd      = OS_OBJECT_ID_UNDEFINED;
+    FM_GlobalData.ChildPendingWriteIndex  = 0;
+    FM_GlobalData.ChildPendingReadIndex   = 0;
+    FM_GlobalData.ChildPendingInteractive = 0;
+
+    if (FM_CHILD_PENDING_DEPTH > 0)
+    {
+        /* Commands left in the file by a previous run are discarded */
+        Status = OS_OpenCreate(&FM_GlobalData.ChildPendingWriteFd, FM_CHILD_PENDING_FILE,
+                               OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+
+        if (Status == OS_SUCCESS)
+        {
+            Status = OS_OpenCreate(&FM_GlobalData.ChildPendingReadFd, FM_CHILD_PENDING_FILE, OS_FILE_FLAG_NONE,
+                                   OS_READ_ONLY);
+
+            if (Status != OS_SUCCESS)
+            {
+                OS_close(FM_GlobalData.ChildPendingWriteFd);
+            }
+        }
+
+        if (Status != OS_SUCCESS)
+        {
+            FM_GlobalData.ChildPendingWriteFd = OS_OBJECT_ID_UNDEFINED;
+            FM_GlobalData.ChildPendingReadFd  = OS_OBJECT_ID_UNDEFINED;
+
+            CFE_EVS_SendEvent(FM_CHILD_PENDING_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Child Task pending commands file disabled: OS_OpenCreate failed: result = %d, file = %s",
+                              (int)Status, FM_CHILD_PENDING_FILE);
+        }
+    }
+
+} /* End of FM_QueuePendingInit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- verify pending file room for one command   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueuePendingHasRoom(void)
+{
+    return ((OS_ObjectIdDefined(FM_GlobalData.ChildPendingWriteFd) == true) &&
+            (FM_QueuePendingCount() < FM_CHILD_PENDING_DEPTH));
+
+} /* End of FM_QueuePendingHasRoom() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- append command to pending file (main task) */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueuePendingPush(const FM_ChildQueueEntry_t *CmdArgs, uint8 Lane)
+{
+    bool   Result     = false;
+    uint16 WriteIndex = FM_GlobalData.ChildPendingWriteIndex;
+    int32  Offset     = (int32)((WriteIndex % FM_QUEUE_PENDING_SLOTS) * sizeof(FM_ChildQueueEntry_t));
+
+    if ((FM_QueuePendingHasRoom() == true) && (WriteIndex < FM_QUEUE_PENDING_LIMIT) &&
+        (OS_lseek(FM_GlobalData.ChildPendingWriteFd, Offset, OS_SEEK_SET) == Offset) &&
+        (OS_write(FM_GlobalData.ChildPendingWriteFd, CmdArgs, sizeof(FM_ChildQueueEntry_t)) ==
+         sizeof(FM_ChildQueueEntry_t)))
+    {
+        WriteIndex++;
+
+        if (WriteIndex >= FM_QUEUE_PENDING_LIMIT)
+        {
+            WriteIndex = 0;
+        }
+
+        /*
+        ** Interactive commands wait until the read index reaches the mark.
+        **  The mark follows the read index while no interactive command is
+        **  waiting, so that it is never lapped by the ring indexes...
+        */
+        if (Lane == FM_CHILD_LANE_INTERACTIVE)
+        {
+            FM_GlobalData.ChildPendingInteractive = WriteIndex;
+        }
+        else if (FM_QueuePendingHasInteractive() == false)
+        {
+            FM_GlobalData.ChildPendingInteractive = FM_ATOMIC_LOAD(&FM_GlobalData.ChildPendingReadIndex);
+        }
+
+        /* Publish the command to the child task */
+        FM_ATOMIC_STORE(&FM_GlobalData.ChildPendingWriteIndex, WriteIndex);
+
+        Result = true;
+    }
+
+    return (Result);
+
+} /* End of FM_QueuePendingPush() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- remove command from pending file (child)   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueuePendingPop(FM_ChildQueueEntry_t *CmdArgs)
+{
+    bool   Result    = false;
+    uint16 ReadIndex = FM_ATOMIC_LOAD(&FM_GlobalData.ChildPendingReadIndex);
+    int32  Offset    = (int32)((ReadIndex % FM_QUEUE_PENDING_SLOTS) * sizeof(FM_ChildQueueEntry_t));
+
+    if ((ReadIndex < FM_QUEUE_PENDING_LIMIT) && (FM_QueuePendingCount() != 0))
+    {
+        if ((OS_lseek(FM_GlobalData.ChildPendingReadFd, Offset, OS_SEEK_SET) == Offset) &&
+            (OS_read(FM_GlobalData.ChildPendingReadFd, CmdArgs, sizeof(FM_ChildQueueEntry_t)) ==
+             sizeof(FM_ChildQueueEntry_t)))
+        {
+            Result = true;
+        }
+
+        /* An unreadable command is dropped so that later commands still run */
+        ReadIndex++;
+
+        if (ReadIndex >= FM_QUEUE_PENDING_LIMIT)
+        {
+            ReadIndex = 0;
+        }
+
+        /* Return the slot to the FM main task */
+        FM_ATOMIC_STORE(&FM_GlobalData.ChildPendingReadIndex, ReadIndex);
+    }
+
+    return (Result);
+
+} /* End of FM_QueuePendingPop() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- mark pending file command as aborted       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueuePendingAbort(uint32 JobID)
+{
+    FM_ChildQueueEntry_t Entry;
+    bool                 Result    = false;
+    bool                 Found     = false;
+    uint16               ReadIndex = FM_ATOMIC_LOAD(&FM_GlobalData.ChildPendingReadIndex);
+    uint16               Count     = 0;
+    uint16               i;
+    int32                Offset;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    if ((OS_ObjectIdDefined(FM_GlobalData.ChildPendingWriteFd) == true) && (ReadIndex < FM_QUEUE_PENDING_LIMIT))
+    {
+        Count = FM_QueuePendingCount();
+    }
+
+    /* The FM main task file handle may read as well as write */
+    for (i = 0; (i < Count) && (i < FM_QUEUE_PENDING_SLOTS) && (Found == false); i++)
+    {
+        Offset = (int32)(((ReadIndex + i) % FM_QUEUE_PENDING_SLOTS) * sizeof(FM_ChildQueueEntry_t));
+
+        if ((OS_lseek(FM_GlobalData.ChildPendingWriteFd, Offset, OS_SEEK_SET) == Offset) &&
+            (OS_read(FM_GlobalData.ChildPendingWriteFd, &Entry, sizeof(Entry)) == sizeof(Entry)) &&
+            (Entry.JobID == JobID))
+        {
+            Found         = true;
+            Entry.Aborted = true;
+
+            if ((OS_lseek(FM_GlobalData.ChildPendingWriteFd, Offset, OS_SEEK_SET) == Offset) &&
+                (OS_write(FM_GlobalData.ChildPendingWriteFd, &Entry, sizeof(Entry)) == sizeof(Entry)))
+            {
+                Result = true;
+            }
+        }
+    }
+
+    return (Result);
+
+} /* End of FM_QueuePendingAbort() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- number of commands in pending file         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint16 FM_QueuePendingCount(void)
+{
+    uint16 ReadIndex  = FM_ATOMIC_LOAD(&FM_GlobalData.ChildPendingReadIndex);
+    uint16 WriteIndex = FM_ATOMIC_LOAD(&FM_GlobalData.ChildPendingWriteIndex);
+
+    return (FM_QueuePendingDistance(WriteIndex, ReadIndex));
+
+} /* End of FM_QueuePendingCount() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- interactive command in pending file        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueuePendingHasInteractive(void)
+{
+    uint16 ReadIndex = FM_ATOMIC_LOAD(&FM_GlobalData.ChildPendingReadIndex);
+    uint16 Waiting   = FM_QueuePendingDistance(FM_GlobalData.ChildPendingInteractive, ReadIndex);
+
+    /* Once the read index passes the mark the distance wraps beyond the pending count */
+    return ((Waiting != 0) && (Waiting <= FM_QueuePendingDistance(FM_GlobalData.ChildPendingWriteIndex, ReadIndex)));
+
+} /* End of FM_QueuePendingHasInteractive() */
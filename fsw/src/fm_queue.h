@@ -0,0 +1,369 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS File Manager child task command
+ *   queue functions.
+ */
+#ifndef FM_QUEUE_H
+#define FM_QUEUE_H
+
+#include "cfe.h"
+#include "fm_msg.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command queue lane function prototypes            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Child Queue Lane Push Function
+ *
+ *  \par Description
+ *       Appends a command queue entry index to the end of a command
+ *       queue lane.  The queue entry must be complete before calling
+ *       this function, as the child task may read the entry as soon
+ *       as the updated lane write index is visible.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Each lane is a single producer, single consumer ring.  Only
+ *       the FM main task may push to a lane and no semaphore is taken.
+ *
+ *  \param [in]  Lane       Pointer to the command queue lane
+ *  \param [in]  QueueIndex Index of the command queue entry
+ *
+ *  \return Boolean push success response
+ *  \retval true  Queue entry index appended to the lane
+ *  \retval false Lane is full or queue entry index is invalid
+ *
+ *  \sa #FM_QueueLanePop
+ */
+bool FM_QueueLanePush(FM_ChildLane_t *Lane, uint8 QueueIndex);
+
+/**
+ *  \brief Child Queue Lane Pop Function
+ *
+ *  \par Description
+ *       Removes the command queue entry index at the front of a
+ *       command queue lane.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only the child task may pop from a lane.  When there is more
+ *       than one child task worker, the caller must hold the child
+ *       task dequeue mutex so that only one worker pops at a time.
+ *
+ *  \param [in]  Lane       Pointer to the command queue lane
+ *  \param [out] QueueIndex Index of the command queue entry
+ *
+ *  \return Boolean pop success response
+ *  \retval true  Queue entry index removed from the lane
+ *  \retval false Lane is empty
+ *
+ *  \sa #FM_QueueLanePush
+ */
+bool FM_QueueLanePop(FM_ChildLane_t *Lane, uint8 *QueueIndex);
+
+/**
+ *  \brief Child Queue Lane Abort Function
+ *
+ *  \par Description
+ *       Marks the command with the job ID as aborted, if it is waiting in
+ *       the command queue lane.  The child task skips a marked command when
+ *       it is dequeued.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only the FM main task may call this function, holding the child
+ *       task dequeue mutex so that no worker pops from the lane meanwhile.
+ *
+ *  \param [in]  Lane  Pointer to the command queue lane
+ *  \param [in]  JobID Job ID of the command to abort
+ *
+ *  \return Boolean abort response
+ *  \retval true  Command found in the lane and marked as aborted
+ *  \retval false Command is not waiting in the lane
+ *
+ *  \sa #FM_AbortCmd, #FM_QueuePendingAbort
+ */
+bool FM_QueueLaneAbort(const FM_ChildLane_t *Lane, uint32 JobID);
+
+/**
+ *  \brief Child Queue Lane Count Function
+ *
+ *  \par Description
+ *       Returns the number of command queue entry indexes waiting in a
+ *       command queue lane.  May be called from any task, the result is
+ *       a snapshot that may be stale by the time the caller uses it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]  Lane Pointer to the command queue lane
+ *
+ *  \return Number of entries waiting in the lane
+ *
+ *  \sa #FM_QueueLaneIsValid
+ */
+uint8 FM_QueueLaneCount(const FM_ChildLane_t *Lane);
+
+/**
+ *  \brief Child Queue Lane Validation Function
+ *
+ *  \par Description
+ *       Verifies that the lane read and write indexes are within the
+ *       range used by the lane ring.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]  Lane Pointer to the command queue lane
+ *
+ *  \return Boolean lane valid response
+ *  \retval true  Lane indexes are valid
+ *  \retval false Lane indexes are corrupt
+ *
+ *  \sa #FM_QueueLaneCount
+ */
+bool FM_QueueLaneIsValid(const FM_ChildLane_t *Lane);
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command queue entry function prototypes           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Child Queue Path Arena Room Function
+ *
+ *  \par Description
+ *       Verifies that the path arena has room for the longest possible
+ *       path arguments of one more command.  When this function returns
+ *       true, the next call to #FM_QueueEntryPack cannot fail for lack of
+ *       arena space.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only the FM main task allocates arena blocks, the child task may
+ *       free blocks at any time which only adds room.
+ *
+ *  \return Boolean arena room response
+ *  \retval true  Arena has room for another command
+ *  \retval false Arena is full
+ *
+ *  \sa #FM_QueueEntryPack
+ */
+bool FM_QueueArenaHasRoom(void);
+
+/**
+ *  \brief Child Queue Entry Pack Function
+ *
+ *  \par Description
+ *       Stores the command arguments in a command queue record, copying
+ *       each non-empty path argument into blocks allocated from the path
+ *       arena.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called only by the FM main task.  The queue entry must not be in
+ *       use (see #FM_GlobalData_t.ChildQueueBusy).
+ *
+ *  \param [in]  QueueIndex Index of the command queue entry
+ *  \param [in]  CmdArgs    Pointer to the command arguments
+ *
+ *  \return Boolean pack success response
+ *  \retval true  Command arguments stored in the queue entry
+ *  \retval false Path arena is full, no arena blocks are allocated
+ *
+ *  \sa #FM_QueueEntryUnpack, #FM_QueueEntryRelease
+ */
+bool FM_QueueEntryPack(uint8 QueueIndex, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Queue Entry Unpack Function
+ *
+ *  \par Description
+ *       Copies a command queue record and its path arguments into the
+ *       caller's command arguments, then releases the path arena blocks.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called only by the child task, after removing the queue entry
+ *       index from a command queue lane.
+ *
+ *  \param [in]  QueueIndex Index of the command queue entry
+ *  \param [out] CmdArgs    Pointer to the command arguments
+ *
+ *  \sa #FM_QueueEntryPack
+ */
+void FM_QueueEntryUnpack(uint8 QueueIndex, FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Queue Entry Release Function
+ *
+ *  \par Description
+ *       Releases the path arena blocks held by a command queue record.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The FM main task may only release a queue entry that it has not
+ *       yet added to a command queue lane.
+ *
+ *  \param [in]  QueueIndex Index of the command queue entry
+ *
+ *  \sa #FM_QueueEntryPack, #FM_QueueEntryUnpack
+ */
+void FM_QueueEntryRelease(uint8 QueueIndex);
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task pending commands file function prototypes         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Child Pending Commands File Initialization Function
+ *
+ *  \par Description
+ *       Creates (or empties) the pending commands file and opens one file
+ *       handle for the FM main task to write and one file handle for the
+ *       child task to read.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Failure is not fatal, the pending commands file is disabled and
+ *       commands are rejected when the command queue is full.
+ *
+ *  \sa #FM_QueuePendingPush, #FM_QueuePendingPop
+ */
+void FM_QueuePendingInit(void);
+
+/**
+ *  \brief Child Pending Commands File Room Function
+ *
+ *  \par Description
+ *       Verifies that the pending commands file is enabled and has room
+ *       for another command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \return Boolean pending file room response
+ *  \retval true  Pending commands file has room for another command
+ *  \retval false Pending commands file is full or disabled
+ *
+ *  \sa #FM_QueuePendingPush
+ */
+bool FM_QueuePendingHasRoom(void);
+
+/**
+ *  \brief Child Pending Commands File Push Function
+ *
+ *  \par Description
+ *       Appends the command arguments to the pending commands file, and
+ *       remembers where the last interactive lane command was written.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The pending commands file is a single producer, single consumer
+ *       ring of command entries.  Only the FM main task may push.
+ *
+ *  \param [in]  CmdArgs Pointer to the command arguments
+ *  \param [in]  Lane    Queue lane the command would have used, see #FM_CHILD_LANE_INTERACTIVE
+ *
+ *  \return Boolean push success response
+ *  \retval true  Command arguments written to the pending commands file
+ *  \retval false Pending commands file is full, disabled or not writable
+ *
+ *  \sa #FM_QueuePendingPop
+ */
+bool FM_QueuePendingPush(const FM_ChildQueueEntry_t *CmdArgs, uint8 Lane);
+
+/**
+ *  \brief Child Pending Commands File Pop Function
+ *
+ *  \par Description
+ *       Removes the oldest command from the pending commands file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only the child task may pop, holding the child task dequeue mutex
+ *       when there is more than one child task worker.  A command that
+ *       cannot be read is removed from the file and false is returned.
+ *
+ *  \param [out] CmdArgs Pointer to the command arguments
+ *
+ *  \return Boolean pop success response
+ *  \retval true  Command arguments read from the pending commands file
+ *  \retval false Pending commands file is empty or not readable
+ *
+ *  \sa #FM_QueuePendingPush
+ */
+bool FM_QueuePendingPop(FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Pending Commands File Abort Function
+ *
+ *  \par Description
+ *       Marks the command with the job ID as aborted, if it is waiting in
+ *       the pending commands file.  The child task skips a marked command
+ *       when it is dequeued.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only the FM main task may call this function, holding the child
+ *       task dequeue mutex so that no worker pops from the file meanwhile.
+ *
+ *  \param [in]  JobID Job ID of the command to abort
+ *
+ *  \return Boolean abort response
+ *  \retval true  Command found in the pending commands file and marked as aborted
+ *  \retval false Command is not waiting in the file, or the file could not be updated
+ *
+ *  \sa #FM_AbortCmd, #FM_QueueLaneAbort
+ */
+bool FM_QueuePendingAbort(uint32 JobID);
+
+/**
+ *  \brief Child Pending Commands File Count Function
+ *
+ *  \par Description
+ *       Returns the number of commands waiting in the pending commands
+ *       file.  May be called from any task.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \return Number of commands waiting in the pending commands file
+ */
+uint16 FM_QueuePendingCount(void);
+
+/**
+ *  \brief Child Pending Commands File Interactive Function
+ *
+ *  \par Description
+ *       Reports whether an interactive lane command is still waiting in
+ *       the pending commands file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only the FM main task may call this function.  A new interactive
+ *       command may pass the bulk commands in the pending commands file,
+ *       but not an interactive command.
+ *
+ *  \return Boolean interactive command waiting response
+ *  \retval true  An interactive command is waiting in the pending commands file
+ *  \retval false No interactive command is waiting in the pending commands file
+ *
+ *  \sa #FM_QueuePendingPush
+ */
+bool FM_QueuePendingHasInteractive(void);
+
+#endif
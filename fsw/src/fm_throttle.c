@@ -0,0 +1,340 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task I/O Throttle Functions
+ *
+ *  Every child task worker takes tokens from the same two token buckets,
+ *  one in bytes of file data and one in OS_stat calls, so the rate limits
+ *  apply to the child task as a whole.  A worker that takes more tokens
+ *  than are available leaves the bucket in debt and sleeps for the whole
+ *  milli-secs of debt, the remainder is repaid by the next block.
+ *
+ *  The time between two blocks of file data from the same worker is the
+ *  block latency.  When the smoothed latency rises above the commanded
+ *  limit the file data rate is halved, and when it falls back below the
+ *  limit the rate recovers in steps to the commanded rate.
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_defs.h"
+#include "fm_throttle.h"
+#include "fm_perfids.h"
+#include "fm_platform_cfg.h"
+
+#include <string.h>
+
+#define FM_THROTTLE_SEM_NAME "FM_THROTTLE_SEM"
+
+#define FM_THROTTLE_USEC_PER_SEC 1000000
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- add tokens for the time elapsed         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_ThrottleFill(FM_ThrottleBucket_t *Bucket, OS_time_t Now, uint32 MinBurst)
+{
+    int64 Burst   = 0;
+    int64 Elapsed = 0;
+    int64 Added   = 0;
+
+    /* Tokens accumulated while idle, at least enough for one unit of work */
+    Burst = ((int64)Bucket->Current * FM_CHILD_THROTTLE_BURST_MS) / 1000;
+    if (Burst < MinBurst)
+    {
+        Burst = MinBurst;
+    }
+
+    Elapsed = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, Bucket->LastFill));
+
+    if (Elapsed < 0)
+    {
+        /* Local time was set backwards, restart the fill interval */
+        Bucket->LastFill = Now;
+    }
+    else if (Elapsed >= FM_THROTTLE_USEC_PER_SEC)
+    {
+        /* Idle for longer than the largest burst */
+        Bucket->Tokens   = Burst;
+        Bucket->LastFill = Now;
+    }
+    else
+    {
+        Added = ((int64)Bucket->Current * Elapsed) / FM_THROTTLE_USEC_PER_SEC;
+
+        Bucket->Tokens += Added;
+
+        if (Bucket->Tokens >= Burst)
+        {
+            Bucket->Tokens   = Burst;
+            Bucket->LastFill = Now;
+        }
+        else
+        {
+            /* Advance only by the time of whole tokens, so slow rates are not lost to rounding */
+            Elapsed          = (Added * FM_THROTTLE_USEC_PER_SEC) / Bucket->Current;
+            Bucket->LastFill = OS_TimeAdd(Bucket->LastFill, OS_TimeAssembleFromMicroseconds(0, (uint32)Elapsed));
+        }
+    }
+
+} /* End of FM_ThrottleFill() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- take tokens, return delay in milli-secs */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint32 FM_ThrottleTake(FM_ThrottleBucket_t *Bucket, OS_time_t Now, uint32 Cost, uint32 MinBurst)
+{
+    uint32 Delay = 0;
+
+    /* Zero rate is unlimited */
+    if (Bucket->Current > 0)
+    {
+        FM_ThrottleFill(Bucket, Now, MinBurst);
+
+        Bucket->Tokens -= Cost;
+
+        if (Bucket->Tokens < 0)
+        {
+            Delay = (uint32)((-Bucket->Tokens * 1000) / Bucket->Current);
+        }
+    }
+
+    return (Delay);
+
+} /* End of FM_ThrottleTake() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- adjust file data rate for latency       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_ThrottleBackoff(FM_ChildThrottle_t *Throttle, int64 Latency, OS_time_t Now, uint32 BlockSize)
+{
+    FM_ThrottleBucket_t *Bytes       = &Throttle->Bytes;
+    int64                SinceAdjust = 0;
+    uint32               Step        = 0;
+
+    if (Latency < 0)
+    {
+        Latency = 0;
+    }
+    else if (Latency > 0xFFFFFFFF)
+    {
+        Latency = 0xFFFFFFFF;
+    }
+
+    /* Moving average over the most recent blocks */
+    Latency += (int64)Throttle->Latency * (FM_THROTTLE_LATENCY_WEIGHT - 1);
+
+    Throttle->Latency = (uint32)(Latency / FM_THROTTLE_LATENCY_WEIGHT);
+
+    SinceAdjust = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(Now, Throttle->LastAdjust));
+
+    /* The backoff needs a commanded rate to back off from */
+    if ((Throttle->LatencyLimit > 0) && (Bytes->Rate > 0) &&
+        ((SinceAdjust < 0) || (SinceAdjust >= FM_THROTTLE_ADJUST_MS)))
+    {
+        /* Step is also the floor, never less than one block per second */
+        Step = Bytes->Rate / FM_THROTTLE_BACKOFF_DIV;
+        if (Step < BlockSize)
+        {
+            Step = BlockSize;
+        }
+
+        /* A worker may still use a block size from before the rate was set */
+        if (Step > Bytes->Rate)
+        {
+            Step = Bytes->Rate;
+        }
+
+        if (Throttle->Latency > Throttle->LatencyLimit)
+        {
+            Bytes->Current /= 2;
+            if (Bytes->Current < Step)
+            {
+                Bytes->Current = Step;
+            }
+        }
+        else if ((Bytes->Rate - Bytes->Current) > Step)
+        {
+            Bytes->Current += Step;
+        }
+        else
+        {
+            Bytes->Current = Bytes->Rate;
+        }
+
+        Throttle->LastAdjust = Now;
+    }
+
+} /* End of FM_ThrottleBackoff() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- give up the CPU                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_ThrottleDelay(uint32 Delay)
+{
+    if (Delay > 0)
+    {
+        CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
+        OS_TaskDelay(Delay);
+        CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
+    }
+
+} /* End of FM_ThrottleDelay() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- startup initialization                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ThrottleInit(void)
+{
+    int32 Result = OS_SUCCESS;
+
+    memset(&FM_GlobalData.ChildThrottle, 0, sizeof(FM_ChildThrottle_t));
+
+    /* Create mutex semaphore (one child task worker at a time takes tokens) */
+    Result = OS_MutSemCreate(&FM_GlobalData.ChildThrottle.Mutex, FM_THROTTLE_SEM_NAME, 0);
+
+    if (Result == OS_SUCCESS)
+    {
+        FM_ThrottleSet(FM_CHILD_THROTTLE_BYTES_PER_SEC, FM_CHILD_THROTTLE_STATS_PER_SEC, FM_CHILD_THROTTLE_LATENCY_US);
+    }
+
+    return (Result);
+
+} /* End of FM_ThrottleInit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- set rate limits                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ThrottleSet(uint32 BytesPerSec, uint32 StatsPerSec, uint32 LatencyLimit)
+{
+    FM_ChildThrottle_t *Throttle = &FM_GlobalData.ChildThrottle;
+    OS_time_t           Now;
+
+    OS_GetLocalTime(&Now);
+
+    OS_MutSemTake(Throttle->Mutex);
+
+    Throttle->Bytes.Rate     = BytesPerSec;
+    Throttle->Bytes.Current  = BytesPerSec;
+    Throttle->Bytes.Tokens   = 0;
+    Throttle->Bytes.LastFill = Now;
+
+    Throttle->Stats.Rate     = StatsPerSec;
+    Throttle->Stats.Current  = StatsPerSec;
+    Throttle->Stats.Tokens   = 0;
+    Throttle->Stats.LastFill = Now;
+
+    Throttle->LatencyLimit = LatencyLimit;
+    Throttle->Latency      = 0;
+    Throttle->LastAdjust   = Now;
+
+    OS_MutSemGive(Throttle->Mutex);
+
+} /* End of FM_ThrottleSet() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- start of a file data loop               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ThrottleStart(FM_ChildWorker_t *Worker)
+{
+    OS_GetLocalTime(&Worker->ThrottleTime);
+
+} /* End of FM_ThrottleStart() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- pace a block of file data               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ThrottleBytes(FM_ChildWorker_t *Worker, uint32 Bytes)
+{
+    FM_ChildThrottle_t *Throttle = &FM_GlobalData.ChildThrottle;
+    uint32              Delay    = 0;
+    OS_time_t           Now;
+
+    OS_GetLocalTime(&Now);
+
+    OS_MutSemTake(Throttle->Mutex);
+
+    /* The floors follow the block size that this worker reads and writes */
+    FM_ThrottleBackoff(Throttle, OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, Worker->ThrottleTime)), Now,
+                       Worker->BlockSize);
+
+    Delay = FM_ThrottleTake(&Throttle->Bytes, Now, Bytes, Worker->BlockSize);
+
+    OS_MutSemGive(Throttle->Mutex);
+
+    if (Delay > 0)
+    {
+        FM_ThrottleDelay(Delay);
+
+        /* The sleep is not part of the next block latency */
+        OS_GetLocalTime(&Now);
+    }
+
+    Worker->ThrottleTime = Now;
+
+} /* End of FM_ThrottleBytes() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- pace an OS_stat call                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ThrottleStats(void)
+{
+    FM_ChildThrottle_t *Throttle = &FM_GlobalData.ChildThrottle;
+    uint32              Delay    = 0;
+    OS_time_t           Now;
+
+    OS_GetLocalTime(&Now);
+
+    OS_MutSemTake(Throttle->Mutex);
+
+    Delay = FM_ThrottleTake(&Throttle->Stats, Now, 1, 1);
+
+    OS_MutSemGive(Throttle->Mutex);
+
+    FM_ThrottleDelay(Delay);
+
+} /* End of FM_ThrottleStats() */
@@ -0,0 +1,130 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS File Manager child task I/O
+ *   throttle functions.
+ */
+#ifndef FM_THROTTLE_H
+#define FM_THROTTLE_H
+
+#include "cfe.h"
+#include "fm_msg.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM I/O throttle function prototypes (FM main task)              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief I/O Throttle Initialization Function
+ *
+ *  \par Description
+ *       Creates the mutex semaphore shared by the child task workers and
+ *       sets the throttle to the platform configuration rates.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called before the child task workers are created.
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ *
+ *  \sa #FM_ChildInit
+ */
+int32 FM_ThrottleInit(void);
+
+/**
+ *  \brief I/O Throttle Set Function
+ *
+ *  \par Description
+ *       Sets the file data and OS_stat call rate limits and the file block
+ *       latency limit.  Both token buckets are emptied, and the file data
+ *       rate backoff is cancelled.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller must verify that a non-zero file data rate is at least
+ *       one block per second of the current file I/O block size.
+ *
+ *  \param [in]  BytesPerSec  File data rate limit (bytes/sec), 0 = unlimited
+ *  \param [in]  StatsPerSec  OS_stat call rate limit (calls/sec), 0 = unlimited
+ *  \param [in]  LatencyLimit File block latency limit (usec), 0 = backoff disabled
+ *
+ *  \sa #FM_SetThrottleCmd
+ */
+void FM_ThrottleSet(uint32 BytesPerSec, uint32 StatsPerSec, uint32 LatencyLimit);
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM I/O throttle function prototypes (child task)                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief I/O Throttle Loop Start Function
+ *
+ *  \par Description
+ *       Records the start time of a file data loop, so that the latency of
+ *       the first block does not include the time the worker was idle.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]  Worker Pointer to the child task worker
+ *
+ *  \sa #FM_ThrottleBytes
+ */
+void FM_ThrottleStart(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief I/O Throttle File Data Function
+ *
+ *  \par Description
+ *       Takes tokens for a block of file data from the file data bucket,
+ *       and gives up the CPU until the bucket is out of debt.  The time
+ *       since the worker last left the throttle is the block latency used
+ *       by the rate backoff.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once for each block of file data read or written.  The
+ *       worker block size is the smallest burst and backoff floor.
+ *
+ *  \param [in]  Worker Pointer to the child task worker
+ *  \param [in]  Bytes  Number of bytes in the block
+ *
+ *  \sa #FM_ThrottleStart
+ */
+void FM_ThrottleBytes(FM_ChildWorker_t *Worker, uint32 Bytes);
+
+/**
+ *  \brief I/O Throttle OS_stat Function
+ *
+ *  \par Description
+ *       Takes a token for one OS_stat call from the stat bucket, and gives
+ *       up the CPU until the bucket is out of debt.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called before each OS_stat call made for a directory listing.
+ *
+ *  \sa #FM_ChildSleepStat
+ */
+void FM_ThrottleStats(void);
+
+#endif
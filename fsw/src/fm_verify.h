@@ -77,6 +77,11 @@
 #error FM_DIR_LIST_FILE_SUBTYPE must be defined!
 #endif
 
+/* cFE file header sub-type for split file manifest files */
+#ifndef FM_SPLIT_MANIFEST_SUBTYPE
+#error FM_SPLIT_MANIFEST_SUBTYPE must be defined!
+#endif
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM platform configuration parameters - TLM packet definitions   */
@@ -103,24 +108,91 @@
 #error FM_CHILD_FILE_BLOCK_SIZE must be defined!
 #elif FM_CHILD_FILE_BLOCK_SIZE < 256
 #error FM_CHILD_FILE_BLOCK_SIZE cannot be less than 256
-#elif FM_CHILD_FILE_BLOCK_SIZE > 32768
-#error FM_CHILD_FILE_BLOCK_SIZE cannot be greater than 32K
+#elif FM_CHILD_FILE_BLOCK_SIZE > FM_CHILD_MAX_BLOCK_SIZE
+#error FM_CHILD_FILE_BLOCK_SIZE cannot be greater than FM_CHILD_MAX_BLOCK_SIZE
+#elif (FM_CHILD_FILE_BLOCK_SIZE % FM_CHILD_BUFFER_ALIGNMENT) != 0
+#error FM_CHILD_FILE_BLOCK_SIZE must be a multiple of FM_CHILD_BUFFER_ALIGNMENT
 #endif
 
-/* Number of file blocks between task delays */
-#ifndef FM_CHILD_FILE_LOOP_COUNT
-#error FM_CHILD_FILE_LOOP_COUNT must be defined!
-#elif FM_CHILD_FILE_LOOP_COUNT < 1
-#error FM_CHILD_FILE_LOOP_COUNT cannot be less than 1
+/* Size of each child task file I/O buffer */
+#ifndef FM_CHILD_MAX_BLOCK_SIZE
+#error FM_CHILD_MAX_BLOCK_SIZE must be defined!
+#elif FM_CHILD_MAX_BLOCK_SIZE > 16777216
+#error FM_CHILD_MAX_BLOCK_SIZE cannot be greater than 16MB
+#elif (FM_CHILD_MAX_BLOCK_SIZE % FM_CHILD_BUFFER_ALIGNMENT) != 0
+#error FM_CHILD_MAX_BLOCK_SIZE must be a multiple of FM_CHILD_BUFFER_ALIGNMENT
+#elif FM_CHILD_MAX_BLOCK_SIZE < ((OS_MAX_NUM_OPEN_FILES * (OS_MAX_PATH_LEN + OS_MAX_API_NAME)) + OS_MAX_PATH_LEN)
+#error FM_CHILD_MAX_BLOCK_SIZE cannot be less than the Delete All open file list plus one path
 #endif
 
-/* Length of time for each task delay */
-#ifndef FM_CHILD_FILE_SLEEP_MS
-#error FM_CHILD_FILE_SLEEP_MS must be defined!
-#elif FM_CHILD_FILE_SLEEP_MS < 0
-#error FM_CHILD_FILE_SLEEP_MS cannot be less than zero
-#elif FM_CHILD_FILE_SLEEP_MS > 100
-#error FM_CHILD_FILE_SLEEP_MS cannot be greater than 100
+/* Address alignment of each child task file I/O buffer */
+#ifndef FM_CHILD_BUFFER_ALIGNMENT
+#error FM_CHILD_BUFFER_ALIGNMENT must be defined!
+#elif FM_CHILD_BUFFER_ALIGNMENT < 8
+#error FM_CHILD_BUFFER_ALIGNMENT cannot be less than 8
+#elif FM_CHILD_BUFFER_ALIGNMENT > 4096
+#error FM_CHILD_BUFFER_ALIGNMENT cannot be greater than 4096
+#elif (FM_CHILD_BUFFER_ALIGNMENT & (FM_CHILD_BUFFER_ALIGNMENT - 1)) != 0
+#error FM_CHILD_BUFFER_ALIGNMENT must be a power of two
+#endif
+
+/* Child task file data rate limit */
+#ifndef FM_CHILD_THROTTLE_BYTES_PER_SEC
+#error FM_CHILD_THROTTLE_BYTES_PER_SEC must be defined!
+#elif FM_CHILD_THROTTLE_BYTES_PER_SEC < 0
+#error FM_CHILD_THROTTLE_BYTES_PER_SEC cannot be less than zero
+#elif (FM_CHILD_THROTTLE_BYTES_PER_SEC > 0) && (FM_CHILD_THROTTLE_BYTES_PER_SEC < FM_CHILD_FILE_BLOCK_SIZE)
+#error FM_CHILD_THROTTLE_BYTES_PER_SEC cannot be less than FM_CHILD_FILE_BLOCK_SIZE
+#endif
+
+/* Child task OS_stat call rate limit */
+#ifndef FM_CHILD_THROTTLE_STATS_PER_SEC
+#error FM_CHILD_THROTTLE_STATS_PER_SEC must be defined!
+#elif FM_CHILD_THROTTLE_STATS_PER_SEC < 0
+#error FM_CHILD_THROTTLE_STATS_PER_SEC cannot be less than zero
+#endif
+
+/* Tokens accumulated while the child task is idle */
+#ifndef FM_CHILD_THROTTLE_BURST_MS
+#error FM_CHILD_THROTTLE_BURST_MS must be defined!
+#elif FM_CHILD_THROTTLE_BURST_MS < 0
+#error FM_CHILD_THROTTLE_BURST_MS cannot be less than zero
+#elif FM_CHILD_THROTTLE_BURST_MS > 1000
+#error FM_CHILD_THROTTLE_BURST_MS cannot be greater than 1000
+#endif
+
+/* File block latency above which the file data rate backs off */
+#ifndef FM_CHILD_THROTTLE_LATENCY_US
+#error FM_CHILD_THROTTLE_LATENCY_US must be defined!
+#elif FM_CHILD_THROTTLE_LATENCY_US < 0
+#error FM_CHILD_THROTTLE_LATENCY_US cannot be less than zero
+#endif
+
+/* Minimum time between job progress telemetry packets */
+#ifndef FM_CHILD_PROGRESS_INTERVAL_MS
+#error FM_CHILD_PROGRESS_INTERVAL_MS must be defined!
+#elif FM_CHILD_PROGRESS_INTERVAL_MS < 0
+#error FM_CHILD_PROGRESS_INTERVAL_MS cannot be less than zero
+#elif FM_CHILD_PROGRESS_INTERVAL_MS > 60000
+#error FM_CHILD_PROGRESS_INTERVAL_MS cannot be greater than 60000
+#endif
+
+/* Directory levels walked by the copy directory and delete tree commands */
+#ifndef FM_CHILD_DIR_TREE_DEPTH
+#error FM_CHILD_DIR_TREE_DEPTH must be defined!
+#elif FM_CHILD_DIR_TREE_DEPTH < 1
+#error FM_CHILD_DIR_TREE_DEPTH cannot be less than 1
+#elif FM_CHILD_DIR_TREE_DEPTH > 32
+#error FM_CHILD_DIR_TREE_DEPTH cannot be greater than 32
+#endif
+
+/* Segment files written by one split file command */
+#ifndef FM_CHILD_SPLIT_MAX_SEGMENTS
+#error FM_CHILD_SPLIT_MAX_SEGMENTS must be defined!
+#elif FM_CHILD_SPLIT_MAX_SEGMENTS < 1
+#error FM_CHILD_SPLIT_MAX_SEGMENTS cannot be less than 1
+#elif FM_CHILD_SPLIT_MAX_SEGMENTS > 10000
+#error FM_CHILD_SPLIT_MAX_SEGMENTS cannot be greater than 10000
 #endif
 
 /* Number of entries in the child task command queue */
@@ -128,8 +200,82 @@
 #error FM_CHILD_QUEUE_DEPTH must be defined!
 #elif FM_CHILD_QUEUE_DEPTH < 1
 #error FM_CHILD_QUEUE_DEPTH cannot be less than 1
-#elif FM_CHILD_QUEUE_DEPTH > 10
-#error FM_CHILD_QUEUE_DEPTH cannot be greater than 10
+#elif FM_CHILD_QUEUE_DEPTH > 100
+#error FM_CHILD_QUEUE_DEPTH cannot be greater than 100
+#endif
+
+/* Size of each child task command queue path arena block */
+#ifndef FM_CHILD_PATH_BLOCK_SIZE
+#error FM_CHILD_PATH_BLOCK_SIZE must be defined!
+#elif FM_CHILD_PATH_BLOCK_SIZE < 8
+#error FM_CHILD_PATH_BLOCK_SIZE cannot be less than 8
+#elif FM_CHILD_PATH_BLOCK_SIZE > OS_MAX_PATH_LEN
+#error FM_CHILD_PATH_BLOCK_SIZE cannot be greater than OS_MAX_PATH_LEN
+#endif
+
+/* Size of the child task command queue path arena */
+#ifndef FM_CHILD_PATH_ARENA_SIZE
+#error FM_CHILD_PATH_ARENA_SIZE must be defined!
+#elif FM_CHILD_PATH_ARENA_SIZE < (((OS_MAX_PATH_LEN + FM_CHILD_PATH_BLOCK_SIZE - 1) / FM_CHILD_PATH_BLOCK_SIZE) * \
+                                  FM_CHILD_PATH_BLOCK_SIZE * 3)
+#error FM_CHILD_PATH_ARENA_SIZE cannot be less than the paths for one command
+#elif FM_CHILD_PATH_ARENA_SIZE > 65535
+#error FM_CHILD_PATH_ARENA_SIZE cannot be greater than 65535
+#endif
+
+/* Number of entries in the child task pending commands file */
+#ifndef FM_CHILD_PENDING_DEPTH
+#error FM_CHILD_PENDING_DEPTH must be defined!
+#elif FM_CHILD_PENDING_DEPTH < 0
+#error FM_CHILD_PENDING_DEPTH cannot be less than zero
+#elif FM_CHILD_PENDING_DEPTH > 16000
+#error FM_CHILD_PENDING_DEPTH cannot be greater than 16000
+#endif
+
+/* Child task pending commands filename */
+#ifndef FM_CHILD_PENDING_FILE
+#error FM_CHILD_PENDING_FILE must be defined!
+#endif
+
+/* Number of child task workers */
+#ifndef FM_CHILD_WORKER_COUNT
+#error FM_CHILD_WORKER_COUNT must be defined!
+#elif FM_CHILD_WORKER_COUNT < 1
+#error FM_CHILD_WORKER_COUNT cannot be less than 1
+#elif FM_CHILD_WORKER_COUNT > 4
+#error FM_CHILD_WORKER_COUNT cannot be greater than 4
+#endif
+
+/* Child task transfer pipeline depth */
+#ifndef FM_CHILD_PIPELINE_DEPTH
+#error FM_CHILD_PIPELINE_DEPTH must be defined!
+#elif FM_CHILD_PIPELINE_DEPTH < 1
+#error FM_CHILD_PIPELINE_DEPTH cannot be less than 1
+#elif FM_CHILD_PIPELINE_DEPTH > 4
+#error FM_CHILD_PIPELINE_DEPTH cannot be greater than 4
+#endif
+
+/* Child task copy checkpoint interval */
+#ifndef FM_CHILD_CHECKPOINT_INTERVAL
+#error FM_CHILD_CHECKPOINT_INTERVAL must be defined!
+#elif FM_CHILD_CHECKPOINT_INTERVAL < 0
+#error FM_CHILD_CHECKPOINT_INTERVAL cannot be less than zero
+#elif FM_CHILD_CHECKPOINT_INTERVAL > 65535
+#error FM_CHILD_CHECKPOINT_INTERVAL cannot be greater than 65535
+#endif
+
+/* Child task kernel copy chunk size */
+#ifndef FM_CHILD_KERNEL_COPY_SIZE
+#error FM_CHILD_KERNEL_COPY_SIZE must be defined!
+#elif FM_CHILD_KERNEL_COPY_SIZE < FM_CHILD_FILE_BLOCK_SIZE
+#error FM_CHILD_KERNEL_COPY_SIZE cannot be less than FM_CHILD_FILE_BLOCK_SIZE
+#elif FM_CHILD_KERNEL_COPY_SIZE > 16777216
+#error FM_CHILD_KERNEL_COPY_SIZE cannot be greater than 16MB
+#endif
+
+/* Child task copy checkpoint CDS name */
+#ifndef FM_CHILD_CHECKPOINT_CDS_NAME
+#error FM_CHILD_CHECKPOINT_CDS_NAME must be defined!
 #endif
 
 /* Child task name */
@@ -40,8 +40,10 @@
 #include "fm_app.h"
 #include "fm_tbl.h"
 #include "fm_child.h"
+#include "fm_checkpoint.h"
 #include "fm_cmds.h"
 #include "fm_cmd_utils.h"
+#include "fm_queue.h"
 #include "fm_events.h"
 #include "fm_perfids.h"
 #include "fm_platform_cfg.h"
@@ -340,6 +342,7 @@ void Test_FM_AppInit_TableInitSuccess(void)
     UtAssert_STUB_COUNT(CFE_SB_CreatePipe, 1);
     UtAssert_STUB_COUNT(CFE_SB_Subscribe, 2);
     UtAssert_STUB_COUNT(FM_ChildInit, 1);
+    UtAssert_STUB_COUNT(FM_CheckpointInit, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_STARTUP_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 }
@@ -360,8 +363,22 @@ void Test_FM_ReportHK_ReturnPktLengthTrue(void)
     FM_GlobalData.ChildCmdErrCounter  = 4;
     FM_GlobalData.ChildCmdWarnCounter = 5;
     FM_GlobalData.ChildQueueCount     = 6;
-    FM_GlobalData.ChildCurrentCC      = 7;
-    FM_GlobalData.ChildPreviousCC     = 8;
+    FM_GlobalData.ChildLastJobID      = 13;
+
+    FM_GlobalData.ChildThrottle.Bytes.Current = 14;
+    FM_GlobalData.ChildThrottle.Latency       = 15;
+    FM_GlobalData.ChildBlockSize              = 16;
+
+    UT_SetDeferredRetcode(UT_KEY(FM_QueueLaneCount), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(FM_QueueLaneCount), 1, 2);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingCount), 12);
+
+    FM_GlobalData.ChildWorker[FM_CHILD_WORKER_COUNT - 1].Status.CmdCounter = 9;
+    FM_GlobalData.ChildWorker[FM_CHILD_WORKER_COUNT - 1].Status.CurrentCC  = 10;
+    FM_GlobalData.ChildWorker[FM_CHILD_WORKER_COUNT - 1].Status.PreviousCC = 11;
+
+    FM_GlobalData.ChildWorker[FM_CHILD_WORKER_COUNT - 1].Status.CurrentJobID = 12;
+    FM_GlobalData.ChildWorker[FM_CHILD_WORKER_COUNT - 1].CompleteSequence    = 1;
 
     // Act
     UtAssert_VOIDCALL(FM_ReportHK(NULL));
@@ -374,6 +391,8 @@ void Test_FM_ReportHK_ReturnPktLengthTrue(void)
     UtAssert_STUB_COUNT(FM_GetOpenFilesData, 1);
     UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
     UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(FM_QueueLaneCount, 2);
+    UtAssert_STUB_COUNT(FM_QueuePendingCount, 1);
     UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.CommandCounter, FM_GlobalData.CommandCounter);
     UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.CommandErrCounter, FM_GlobalData.CommandErrCounter);
     UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.NumOpenFiles, 0);
@@ -381,9 +400,53 @@ void Test_FM_ReportHK_ReturnPktLengthTrue(void)
     UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildCmdErrCounter, FM_GlobalData.ChildCmdErrCounter);
     UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildCmdWarnCounter, FM_GlobalData.ChildCmdWarnCounter);
     UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildQueueCount, FM_GlobalData.ChildQueueCount);
-    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildCurrentCC, FM_GlobalData.ChildCurrentCC);
-    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildPreviousCC, FM_GlobalData.ChildPreviousCC);
+    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildCurrentCC, 10);
+    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildPreviousCC, 11);
+    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildInteractiveQueueCount, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildBulkQueueCount, 2);
+    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildPendingCount, 12);
+    UtAssert_UINT32_EQ(FM_GlobalData.HousekeepingPkt.ChildLastJobID, 13);
+    UtAssert_UINT32_EQ(FM_GlobalData.HousekeepingPkt.ChildThrottleRate, 14);
+    UtAssert_UINT32_EQ(FM_GlobalData.HousekeepingPkt.ChildThrottleLatency, 15);
+    UtAssert_UINT32_EQ(FM_GlobalData.HousekeepingPkt.ChildBlockSize, 16);
+    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildWorker[FM_CHILD_WORKER_COUNT - 1].CmdCounter, 9);
+    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildWorker[FM_CHILD_WORKER_COUNT - 1].CurrentCC, 10);
+    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildWorker[FM_CHILD_WORKER_COUNT - 1].PreviousCC, 11);
+    UtAssert_UINT32_EQ(FM_GlobalData.HousekeepingPkt.ChildWorker[FM_CHILD_WORKER_COUNT - 1].CurrentJobID, 12);
+}
+
+#if FM_CHILD_WORKER_COUNT > 1
+void Test_FM_ReportHK_ChildActivity(void)
+{
+    // Arrange - the first worker is busy, the second worker finished last and is now busy too
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC  = 7;
+    FM_GlobalData.ChildWorker[0].Status.PreviousCC = 8;
+    FM_GlobalData.ChildWorker[0].CompleteSequence  = 3;
+    FM_GlobalData.ChildWorker[1].Status.CurrentCC  = 10;
+    FM_GlobalData.ChildWorker[1].Status.PreviousCC = 11;
+    FM_GlobalData.ChildWorker[1].CompleteSequence  = 4;
+
+    // Act
+    UtAssert_VOIDCALL(FM_ReportHK(NULL));
+
+    // Assert - a worker that finishes does not hide a worker that is still busy
+    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildCurrentCC, 7);
+    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildPreviousCC, 11);
+
+    // Act - the first worker finishes
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC  = 0;
+    FM_GlobalData.ChildWorker[0].Status.PreviousCC = 7;
+    FM_GlobalData.ChildWorker[0].CompleteSequence  = 5;
+
+    UtAssert_VOIDCALL(FM_ReportHK(NULL));
+
+    // Assert
+    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildCurrentCC, 10);
+    UtAssert_INT32_EQ(FM_GlobalData.HousekeepingPkt.ChildPreviousCC, 7);
 }
+#endif
 
 void Test_FM_ReportHK_ReturnPktLengthFalse(void)
 {
@@ -727,6 +790,186 @@ void Test_FM_ProcessCmd_SetPermissionsCCReturn(void)
     UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
 }
 
+void Test_FM_ProcessCmd_AbortCCReturn(void)
+{
+    // Arrange
+    CFE_MSG_FcnCode_t fcn_code = FM_ABORT_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_AbortCmd), true);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    // Assert
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_AbortCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_SetThrottleCCReturn(void)
+{
+    // Arrange
+    CFE_MSG_FcnCode_t fcn_code = FM_SET_THROTTLE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_SetThrottleCmd), true);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    // Assert
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_SetThrottleCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_SetBlockSizeCCReturn(void)
+{
+    // Arrange
+    CFE_MSG_FcnCode_t fcn_code = FM_SET_BLOCK_SIZE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_SetBlockSizeCmd), true);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    // Assert
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_SetBlockSizeCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_CopyDirCCReturn(void)
+{
+    // Arrange
+    CFE_MSG_FcnCode_t fcn_code = FM_COPY_DIR_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CopyDirCmd), true);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    // Assert
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_CopyDirCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_DeleteTreeCCReturn(void)
+{
+    // Arrange
+    CFE_MSG_FcnCode_t fcn_code = FM_DELETE_TREE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DeleteTreeCmd), true);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    // Assert
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_DeleteTreeCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_DeleteFilterCCReturn(void)
+{
+    // Arrange
+    CFE_MSG_FcnCode_t fcn_code = FM_DELETE_FILTER_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DeleteFilterCmd), true);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    // Assert
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_DeleteFilterCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_ConcatListCCReturn(void)
+{
+    // Arrange
+    CFE_MSG_FcnCode_t fcn_code = FM_CONCAT_LIST_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_ConcatListCmd), true);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    // Assert
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_ConcatListCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_SplitCCReturn(void)
+{
+    // Arrange
+    CFE_MSG_FcnCode_t fcn_code = FM_SPLIT_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_SplitCmd), true);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    // Assert
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_SplitCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_PreallocateCCReturn(void)
+{
+    // Arrange
+    CFE_MSG_FcnCode_t fcn_code = FM_PREALLOCATE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_PreallocateCmd), true);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    // Assert
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_PreallocateCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_TruncateCCReturn(void)
+{
+    // Arrange
+    CFE_MSG_FcnCode_t fcn_code = FM_TRUNCATE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_TruncateCmd), true);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    // Assert
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_TruncateCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
 void Test_FM_ProcessCmd_DefaultReturn(void)
 {
     // Arrange
@@ -854,12 +1097,43 @@ void add_FM_ProcessCmd_tests(void)
     UtTest_Add(Test_FM_ProcessCmd_SetPermissionsCCReturn, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_PRocessCmd_SetPermissionsCCReturn");
 
+    UtTest_Add(Test_FM_ProcessCmd_AbortCCReturn, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ProcessCmd_AbortCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_SetThrottleCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_SetThrottleCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_SetBlockSizeCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_SetBlockSizeCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_CopyDirCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_CopyDirCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_DeleteTreeCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_DeleteTreeCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_DeleteFilterCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_DeleteFilterCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_ConcatListCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_ConcatListCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_SplitCCReturn, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ProcessCmd_SplitCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_PreallocateCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_PreallocateCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_TruncateCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_TruncateCCReturn");
+
     UtTest_Add(Test_FM_ProcessCmd_DefaultReturn, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PRocessCmd_DefaultReturn");
 }
 
 void add_FM_ReportHK_tests(void)
 {
     UtTest_Add(Test_FM_ReportHK_ReturnPktLengthTrue, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ReportHK_Return");
+#if FM_CHILD_WORKER_COUNT > 1
+    UtTest_Add(Test_FM_ReportHK_ChildActivity, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ReportHK_ChildActivity");
+#endif
     UtTest_Add(Test_FM_ReportHK_ReturnPktLengthFalse, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ReportHK_ReturnPktLengthFalse");
 }
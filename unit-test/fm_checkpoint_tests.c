@@ -0,0 +1,555 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task Copy Checkpoint Functions
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_defs.h"
+#include "fm_msgdefs.h"
+#include "fm_events.h"
+#include "fm_checkpoint.h"
+#include "fm_cmd_utils.h"
+#include "fm_crc.h"
+
+/*
+ * UT Assert
+ */
+#include "fm_test_utils.h"
+
+/*
+ * UT includes
+ */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <string.h>
+
+/* Command arguments passed to the FM_InvokeChildTask stub */
+static FM_ChildQueueEntry_t UT_FM_Checkpoint_Invoked;
+
+void UT_Handler_FM_InvokeChildTask(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_FM_Checkpoint_Invoked = FM_GlobalData.ChildQueueEntry;
+}
+
+/* Fill in a checkpoint of a copy command in progress */
+void UT_FM_Checkpoint_Copy(FM_ChildCheckpoint_t *Checkpoint)
+{
+    memset(Checkpoint, 0, sizeof(FM_ChildCheckpoint_t));
+
+    Checkpoint->JobID        = 3;
+    Checkpoint->CommandCode  = FM_COPY_CC;
+    Checkpoint->SourceOffset = 4096;
+    Checkpoint->TargetOffset = 4096;
+    Checkpoint->TargetCRC    = 0x1234;
+    Checkpoint->CRCType      = CFE_MISSION_ES_CRC_16;
+    Checkpoint->Verify       = 1;
+    Checkpoint->Sparse       = 1;
+    strncpy(Checkpoint->Source1, "/cf/src", sizeof(Checkpoint->Source1) - 1);
+    strncpy(Checkpoint->Target, "/cf/tgt", sizeof(Checkpoint->Target) - 1);
+}
+
+/* Have CFE_ES_RegisterCDS return a defined handle for each worker */
+void UT_FM_Checkpoint_RegisterCDS(int32 Status)
+{
+    static CFE_ES_CDSHandle_t Handles[FM_CHILD_WORKER_COUNT];
+    uint32                    i;
+
+    for (i = 0; i < FM_CHILD_WORKER_COUNT; i++)
+    {
+        Handles[i] = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(i + 1));
+    }
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_RegisterCDS), Handles, sizeof(Handles), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), Status);
+}
+
+/*********************************************************************************
+ *          TEST CASE FUNCTIONS
+ *********************************************************************************/
+
+/*****************
+ * CheckpointInit Tests
+ ****************/
+void Test_FM_CheckpointInit_NewCDS(void)
+{
+    uint32 i;
+
+    UT_FM_Checkpoint_RegisterCDS(CFE_SUCCESS);
+
+    UtAssert_VOIDCALL(FM_CheckpointInit());
+
+    /* Each worker has a cleared block and nothing is resumed */
+    for (i = 0; i < FM_CHILD_WORKER_COUNT; i++)
+    {
+        UtAssert_BOOL_TRUE(FM_CheckpointIsEnabled(&FM_GlobalData.ChildWorker[i]));
+    }
+
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, FM_CHILD_WORKER_COUNT);
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, FM_CHILD_WORKER_COUNT);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_CheckpointInit_RestoreValid(void)
+{
+    FM_ChildCheckpoint_t Restored;
+
+    UT_FM_Checkpoint_Copy(&Restored);
+    UT_FM_Checkpoint_RegisterCDS(CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_RestoreFromCDS), &Restored, sizeof(Restored), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+    UT_SetHandlerFunction(UT_KEY(FM_InvokeChildTask), UT_Handler_FM_InvokeChildTask, NULL);
+
+    UtAssert_VOIDCALL(FM_CheckpointInit());
+
+    /* Worker 0 checkpoint is queued to resume and kept in its block, the empty blocks are cleared */
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, FM_CHILD_WORKER_COUNT);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, FM_CHILD_WORKER_COUNT - 1);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_BOOL_TRUE(FM_CheckpointIsEnabled(&FM_GlobalData.ChildWorker[0]));
+
+    UtAssert_INT32_EQ(UT_FM_Checkpoint_Invoked.CommandCode, FM_COPY_CC);
+    UtAssert_INT32_EQ(UT_FM_Checkpoint_Invoked.Resume, 1);
+    UtAssert_UINT32_EQ(UT_FM_Checkpoint_Invoked.FileInfoCRC, CFE_MISSION_ES_CRC_16);
+    UtAssert_UINT32_EQ(UT_FM_Checkpoint_Invoked.Verify, 1);
+    UtAssert_UINT32_EQ(UT_FM_Checkpoint_Invoked.Sparse, 1);
+    UtAssert_STRINGBUF_EQ(UT_FM_Checkpoint_Invoked.Source1, sizeof(UT_FM_Checkpoint_Invoked.Source1),
+                          Restored.Source1, sizeof(Restored.Source1));
+    UtAssert_STRINGBUF_EQ(UT_FM_Checkpoint_Invoked.Target, sizeof(UT_FM_Checkpoint_Invoked.Target),
+                          Restored.Target, sizeof(Restored.Target));
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.Resume, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCheckpoint[0].JobID, Restored.JobID);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCheckpoint[0].TargetOffset, Restored.TargetOffset);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].Checkpoint.JobID, FM_CHILD_JOB_ID_NONE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHECKPOINT_RESUME_EID);
+}
+
+void Test_FM_CheckpointInit_RestoreChildTaskNotAvailable(void)
+{
+    FM_ChildCheckpoint_t Restored;
+
+    UT_FM_Checkpoint_Copy(&Restored);
+    UT_FM_Checkpoint_RegisterCDS(CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_RestoreFromCDS), &Restored, sizeof(Restored), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    UtAssert_VOIDCALL(FM_CheckpointInit());
+
+    /* FM_VerifyChildTask reports the failure */
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 1);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_CheckpointInit_RestoreNotSuccess(void)
+{
+    uint32 i;
+
+    UT_FM_Checkpoint_RegisterCDS(CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RestoreFromCDS), !CFE_SUCCESS);
+
+    UtAssert_VOIDCALL(FM_CheckpointInit());
+
+    /* Corrupt blocks are discarded but still used for new checkpoints */
+    for (i = 0; i < FM_CHILD_WORKER_COUNT; i++)
+    {
+        UtAssert_BOOL_TRUE(FM_CheckpointIsEnabled(&FM_GlobalData.ChildWorker[i]));
+    }
+
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, FM_CHILD_WORKER_COUNT);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, FM_CHILD_WORKER_COUNT);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHECKPOINT_CDS_ERR_EID);
+}
+
+void Test_FM_CheckpointInit_RegisterNotSuccess(void)
+{
+    uint32 i;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), !CFE_SUCCESS);
+
+    UtAssert_VOIDCALL(FM_CheckpointInit());
+
+    for (i = 0; i < FM_CHILD_WORKER_COUNT; i++)
+    {
+        UtAssert_BOOL_FALSE(FM_CheckpointIsEnabled(&FM_GlobalData.ChildWorker[i]));
+    }
+
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, FM_CHILD_WORKER_COUNT);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHECKPOINT_CDS_ERR_EID);
+}
+
+void Test_FM_CheckpointInit_ClearNotSuccess(void)
+{
+    UT_FM_Checkpoint_RegisterCDS(CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CopyToCDS), !CFE_SUCCESS);
+
+    UtAssert_VOIDCALL(FM_CheckpointInit());
+
+    UtAssert_BOOL_FALSE(FM_CheckpointIsEnabled(&FM_GlobalData.ChildWorker[0]));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, FM_CHILD_WORKER_COUNT);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHECKPOINT_CDS_ERR_EID);
+}
+
+/*****************
+ * CheckpointIsValid Tests
+ ****************/
+void Test_FM_CheckpointIsValid(void)
+{
+    FM_ChildCheckpoint_t Checkpoint;
+
+    /* Copy in progress */
+    UT_FM_Checkpoint_Copy(&Checkpoint);
+    UtAssert_BOOL_TRUE(FM_CheckpointIsValid(&Checkpoint));
+
+    /* Unused */
+    Checkpoint.JobID = FM_CHILD_JOB_ID_NONE;
+    UtAssert_BOOL_FALSE(FM_CheckpointIsValid(&Checkpoint));
+
+    /* Copy has no second source file */
+    UT_FM_Checkpoint_Copy(&Checkpoint);
+    Checkpoint.Segment = 1;
+    UtAssert_BOOL_FALSE(FM_CheckpointIsValid(&Checkpoint));
+
+    /* Move across volumes */
+    UT_FM_Checkpoint_Copy(&Checkpoint);
+    Checkpoint.CommandCode = FM_MOVE_CC;
+    UtAssert_BOOL_TRUE(FM_CheckpointIsValid(&Checkpoint));
+
+    /* Not a copy command */
+    UT_FM_Checkpoint_Copy(&Checkpoint);
+    Checkpoint.CommandCode = FM_RENAME_CC;
+    UtAssert_BOOL_FALSE(FM_CheckpointIsValid(&Checkpoint));
+
+    /* Source offset past target offset */
+    UT_FM_Checkpoint_Copy(&Checkpoint);
+    Checkpoint.SourceOffset = Checkpoint.TargetOffset + 1;
+    UtAssert_BOOL_FALSE(FM_CheckpointIsValid(&Checkpoint));
+
+    /* Unterminated filename */
+    UT_FM_Checkpoint_Copy(&Checkpoint);
+    memset(Checkpoint.Target, 't', sizeof(Checkpoint.Target));
+    UtAssert_BOOL_FALSE(FM_CheckpointIsValid(&Checkpoint));
+
+    /* Concat appending source file #2 */
+    UT_FM_Checkpoint_Copy(&Checkpoint);
+    Checkpoint.CommandCode = FM_CONCAT_CC;
+    Checkpoint.Segment     = 1;
+    UtAssert_BOOL_FALSE(FM_CheckpointIsValid(&Checkpoint));
+    strncpy(Checkpoint.Source2, "/cf/src2", sizeof(Checkpoint.Source2) - 1);
+    UtAssert_BOOL_TRUE(FM_CheckpointIsValid(&Checkpoint));
+    Checkpoint.Segment = 2;
+    UtAssert_BOOL_FALSE(FM_CheckpointIsValid(&Checkpoint));
+
+    /* Concat file list appending a listed source */
+    Checkpoint.CommandCode = FM_CONCAT_LIST_CC;
+    UtAssert_BOOL_TRUE(FM_CheckpointIsValid(&Checkpoint));
+    Checkpoint.Segment = 0;
+    UtAssert_BOOL_FALSE(FM_CheckpointIsValid(&Checkpoint));
+}
+
+/*****************
+ * CheckpointStart Tests
+ ****************/
+void Test_FM_CheckpointStart_NewCommand(void)
+{
+    FM_ChildWorker_t *   Worker  = &FM_GlobalData.ChildWorker[0];
+    FM_ChildQueueEntry_t CmdArgs = {.CommandCode = FM_COPY_CC,
+                                    .JobID       = 9,
+                                    .FileInfoCRC = CFE_MISSION_ES_CRC_32,
+                                    .Verify      = 1,
+                                    .Sparse      = 1,
+                                    .Source1     = "/cf/a",
+                                    .Target      = "/cf/b"};
+
+    memset(&Worker->Checkpoint, 0xFF, sizeof(Worker->Checkpoint));
+    Worker->CheckpointBlocks = 7;
+
+    UtAssert_VOIDCALL(FM_CheckpointStart(Worker, &CmdArgs));
+
+    UtAssert_UINT32_EQ(Worker->Checkpoint.JobID, 9);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.CommandCode, FM_COPY_CC);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.Segment, 0);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.SourceOffset, 0);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, 0);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetCRC, 0);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.CRCType, CFE_MISSION_ES_CRC_32);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.Verify, 1);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.Sparse, 1);
+    UtAssert_STRINGBUF_EQ(Worker->Checkpoint.Source1, sizeof(Worker->Checkpoint.Source1), "/cf/a", 6);
+    UtAssert_STRINGBUF_EQ(Worker->Checkpoint.Source2, sizeof(Worker->Checkpoint.Source2), "", 1);
+    UtAssert_STRINGBUF_EQ(Worker->Checkpoint.Target, sizeof(Worker->Checkpoint.Target), "/cf/b", 6);
+    UtAssert_UINT32_EQ(Worker->CheckpointBlocks, 0);
+}
+
+void Test_FM_CheckpointStart_Resume(void)
+{
+    FM_ChildWorker_t *   Worker  = &FM_GlobalData.ChildWorker[0];
+    FM_ChildQueueEntry_t CmdArgs = {.CommandCode = FM_COPY_CC, .JobID = 9, .Resume = FM_CHILD_WORKER_COUNT};
+
+    UT_FM_Checkpoint_Copy(&FM_GlobalData.ChildCheckpoint[FM_CHILD_WORKER_COUNT - 1]);
+    strncpy(CmdArgs.Source1, "/cf/src", sizeof(CmdArgs.Source1) - 1);
+    strncpy(CmdArgs.Target, "/cf/tgt", sizeof(CmdArgs.Target) - 1);
+
+    UtAssert_VOIDCALL(FM_CheckpointStart(Worker, &CmdArgs));
+
+    /* Progress is restored, the job ID is the new one */
+    UtAssert_UINT32_EQ(Worker->CheckpointResume, FM_CHILD_WORKER_COUNT);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.JobID, 9);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.SourceOffset, 4096);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, 4096);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetCRC, 0x1234);
+
+    /* Restored checkpoint for a different command is ignored */
+    CmdArgs.CommandCode = FM_CONCAT_CC;
+
+    UtAssert_VOIDCALL(FM_CheckpointStart(Worker, &CmdArgs));
+
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, 0);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.CommandCode, FM_CONCAT_CC);
+    UtAssert_UINT32_EQ(Worker->CheckpointResume, 0);
+
+    /* Invalid restored checkpoint number is ignored */
+    CmdArgs.CommandCode = FM_COPY_CC;
+    CmdArgs.Resume      = FM_CHILD_WORKER_COUNT + 1;
+
+    UtAssert_VOIDCALL(FM_CheckpointStart(Worker, &CmdArgs));
+
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, 0);
+}
+
+/*****************
+ * CheckpointUpdate Tests
+ ****************/
+void Test_FM_CheckpointUpdate_Disabled(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    UtAssert_VOIDCALL(FM_CheckpointUpdate(Worker, Worker->ChildBuffer, 100));
+    UtAssert_VOIDCALL(FM_CheckpointUpdate(Worker, Worker->ChildBuffer, 20));
+
+    /* Offsets advance, no CRC or checkpoint without a CDS block */
+    UtAssert_UINT32_EQ(Worker->Checkpoint.SourceOffset, 120);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, 120);
+    UtAssert_STUB_COUNT(FM_CrcCalculate, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+}
+
+void Test_FM_CheckpointUpdate_Interval(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+    uint32            i;
+
+    Worker->CheckpointHandle = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(1));
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcCalculate), 0x55);
+
+    for (i = 0; i < FM_CHILD_CHECKPOINT_INTERVAL - 1; i++)
+    {
+        FM_CheckpointUpdate(Worker, Worker->ChildBuffer, FM_CHILD_FILE_BLOCK_SIZE);
+    }
+
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+    UtAssert_UINT32_EQ(Worker->CheckpointBlocks, FM_CHILD_CHECKPOINT_INTERVAL - 1);
+
+    /* Saved on the interval block */
+    UtAssert_VOIDCALL(FM_CheckpointUpdate(Worker, Worker->ChildBuffer, FM_CHILD_FILE_BLOCK_SIZE));
+
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(FM_CrcCalculate, FM_CHILD_CHECKPOINT_INTERVAL);
+    UtAssert_UINT32_EQ(Worker->CheckpointBlocks, 0);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetCRC, 0x55);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, FM_CHILD_CHECKPOINT_INTERVAL * FM_CHILD_FILE_BLOCK_SIZE);
+}
+
+void Test_FM_CheckpointUpdate_KernelCopy(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    Worker->CheckpointHandle = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(1));
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcCalculate), 0x55);
+
+    /* Chunk copied by the kernel counts as several blocks, and has no CRC */
+    UtAssert_VOIDCALL(FM_CheckpointUpdate(Worker, NULL, (2 * FM_CHILD_FILE_BLOCK_SIZE) + 1));
+
+    UtAssert_UINT32_EQ(Worker->CheckpointBlocks, 3);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetCRC, FM_CHECKPOINT_CRC_UNKNOWN);
+
+    /* Later blocks cannot make the CRC known again */
+    UtAssert_VOIDCALL(FM_CheckpointUpdate(Worker, Worker->ChildBuffer, FM_CHILD_FILE_BLOCK_SIZE));
+
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetCRC, FM_CHECKPOINT_CRC_UNKNOWN);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, (3 * FM_CHILD_FILE_BLOCK_SIZE) + 1);
+    UtAssert_STUB_COUNT(FM_CrcCalculate, 0);
+}
+
+/*****************
+ * CheckpointSave Tests
+ ****************/
+void Test_FM_CheckpointSave_NotSuccess(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    Worker->CheckpointHandle = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(1));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CopyToCDS), !CFE_SUCCESS);
+
+    UtAssert_VOIDCALL(FM_CheckpointSave(Worker));
+
+    /* Checkpoints are disabled after the first failure */
+    UtAssert_BOOL_FALSE(FM_CheckpointIsEnabled(Worker));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHECKPOINT_SAVE_ERR_EID);
+
+    UtAssert_VOIDCALL(FM_CheckpointSave(Worker));
+
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void Test_FM_CheckpointSave_Resumed(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+    FM_ChildWorker_t *Owner  = &FM_GlobalData.ChildWorker[FM_CHILD_WORKER_COUNT - 1];
+
+    Worker->CheckpointHandle = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(1));
+    Owner->CheckpointHandle  = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(FM_CHILD_WORKER_COUNT));
+    Worker->CheckpointResume = FM_CHILD_WORKER_COUNT;
+    UT_FM_Checkpoint_Copy(&FM_GlobalData.ChildCheckpoint[FM_CHILD_WORKER_COUNT - 1]);
+    UT_FM_Checkpoint_Copy(&Worker->Checkpoint);
+
+    UtAssert_VOIDCALL(FM_CheckpointSave(Worker));
+
+    /* Progress is saved before the restored block is cleared */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 2);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCheckpoint[FM_CHILD_WORKER_COUNT - 1].JobID, FM_CHILD_JOB_ID_NONE);
+    UtAssert_UINT32_EQ(Worker->CheckpointResume, 0);
+
+    /* Later saves only write the worker block */
+    UtAssert_VOIDCALL(FM_CheckpointSave(Worker));
+
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_CheckpointSave_BlockHeld(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    Worker->CheckpointHandle = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(1));
+    UT_FM_Checkpoint_Copy(&FM_GlobalData.ChildCheckpoint[0]);
+
+    /* Block holds a checkpoint restored for a command not yet resumed */
+    UtAssert_VOIDCALL(FM_CheckpointSave(Worker));
+
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+    UtAssert_BOOL_TRUE(FM_CheckpointIsEnabled(Worker));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCheckpoint[0].JobID, 3);
+
+    /* The worker resuming the command writes over the restored checkpoint */
+    Worker->CheckpointResume = 1;
+
+    UtAssert_VOIDCALL(FM_CheckpointSave(Worker));
+
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCheckpoint[0].JobID, FM_CHILD_JOB_ID_NONE);
+    UtAssert_UINT32_EQ(Worker->CheckpointResume, 0);
+}
+
+/*****************
+ * CheckpointClear Tests
+ ****************/
+void Test_FM_CheckpointClear(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    Worker->CheckpointHandle = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(1));
+    UT_FM_Checkpoint_Copy(&Worker->Checkpoint);
+
+    UtAssert_VOIDCALL(FM_CheckpointClear(Worker));
+
+    UtAssert_UINT32_EQ(Worker->Checkpoint.JobID, FM_CHILD_JOB_ID_NONE);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_CheckpointClear_Resumed(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    /* Checkpoints disabled for the worker, the restored block is still released */
+    Worker->CheckpointResume = 1;
+    UT_FM_Checkpoint_Copy(&FM_GlobalData.ChildCheckpoint[0]);
+
+    UtAssert_VOIDCALL(FM_CheckpointClear(Worker));
+
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCheckpoint[0].JobID, FM_CHILD_JOB_ID_NONE);
+    UtAssert_UINT32_EQ(Worker->CheckpointResume, 0);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_FM_CheckpointInit_NewCDS, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CheckpointInit_NewCDS");
+    UtTest_Add(Test_FM_CheckpointInit_RestoreValid, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CheckpointInit_RestoreValid");
+    UtTest_Add(Test_FM_CheckpointInit_RestoreChildTaskNotAvailable, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CheckpointInit_RestoreChildTaskNotAvailable");
+    UtTest_Add(Test_FM_CheckpointInit_RestoreNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CheckpointInit_RestoreNotSuccess");
+    UtTest_Add(Test_FM_CheckpointInit_RegisterNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CheckpointInit_RegisterNotSuccess");
+    UtTest_Add(Test_FM_CheckpointInit_ClearNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CheckpointInit_ClearNotSuccess");
+    UtTest_Add(Test_FM_CheckpointIsValid, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CheckpointIsValid");
+    UtTest_Add(Test_FM_CheckpointStart_NewCommand, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CheckpointStart_NewCommand");
+    UtTest_Add(Test_FM_CheckpointStart_Resume, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CheckpointStart_Resume");
+    UtTest_Add(Test_FM_CheckpointUpdate_Disabled, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CheckpointUpdate_Disabled");
+    UtTest_Add(Test_FM_CheckpointUpdate_Interval, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CheckpointUpdate_Interval");
+
+    UtTest_Add(Test_FM_CheckpointUpdate_KernelCopy, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CheckpointUpdate_KernelCopy");
+    UtTest_Add(Test_FM_CheckpointSave_NotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CheckpointSave_NotSuccess");
+    UtTest_Add(Test_FM_CheckpointSave_Resumed, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CheckpointSave_Resumed");
+    UtTest_Add(Test_FM_CheckpointSave_BlockHeld, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CheckpointSave_BlockHeld");
+    UtTest_Add(Test_FM_CheckpointClear, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CheckpointClear");
+    UtTest_Add(Test_FM_CheckpointClear_Resumed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CheckpointClear_Resumed");
+}
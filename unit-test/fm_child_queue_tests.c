@@ -0,0 +1,105 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task Command Queue Path Tests
+ *
+ *  Commands are passed from FM_InvokeChildTask through the real command
+ *  queue to FM_ChildProcess, so every command argument a handler uses
+ *  must survive being packed into and unpacked from a queue entry.
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_defs.h"
+#include "fm_msgdefs.h"
+#include "fm_events.h"
+#include "fm_child.h"
+#include "fm_cmd_utils.h"
+#include "fm_queue.h"
+
+/*
+ * UT Assert
+ */
+#include "fm_test_utils.h"
+
+/*
+ * UT includes
+ */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <string.h>
+
+/*********************************************************************************
+ *          TEST CASE FUNCTIONS
+ *********************************************************************************/
+
+/*****************
+ * Delete Filtered Files Tests
+ ****************/
+void Test_FM_ChildQueue_DeleteFilterRange(void)
+{
+    // Arrange - the queue entry as FM_DeleteFilterCmd leaves it
+    FM_ChildQueueEntry_t *CmdArgs    = &FM_GlobalData.ChildQueueEntry;
+    FM_ChildWorker_t *    Worker     = &FM_GlobalData.ChildWorker[0];
+    os_dirent_t           direntry   = {.FileName = "file.tmp"};
+    os_fstat_t            filestatus = {.FileSize = 5};
+
+    CmdArgs->CommandCode = FM_DELETE_FILTER_CC;
+    strncpy(CmdArgs->Source1, "/ram/dir", OS_MAX_PATH_LEN - 1);
+    strncpy(CmdArgs->Target, "*.tmp", OS_MAX_PATH_LEN - 1);
+    CmdArgs->MinAge  = 60;
+    CmdArgs->MaxAge  = 3600;
+    CmdArgs->MinSize = 10;
+    CmdArgs->MaxSize = 1000;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
+
+    // Act
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+    UtAssert_VOIDCALL(FM_ChildProcess());
+
+    // Assert - the handler received the ranges and kept the file that is too small
+    UtAssert_INT32_EQ(Worker->CmdArgs.CommandCode, FM_DELETE_FILTER_CC);
+    UtAssert_STRINGBUF_EQ(Worker->CmdArgs.Target, sizeof(Worker->CmdArgs.Target), "*.tmp", sizeof("*.tmp"));
+    UtAssert_UINT32_EQ(Worker->CmdArgs.MinAge, 60);
+    UtAssert_UINT32_EQ(Worker->CmdArgs.MaxAge, 3600);
+    UtAssert_UINT32_EQ(Worker->CmdArgs.MinSize, 10);
+    UtAssert_UINT32_EQ(Worker->CmdArgs.MaxSize, 1000);
+
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 0);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_FM_ChildQueue_DeleteFilterRange, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildQueue_DeleteFilterRange");
+}
@@ -29,8 +29,13 @@
 #include "fm_events.h"
 #include "fm_app.h"
 #include "fm_child.h"
+#include "fm_checkpoint.h"
+#include "fm_throttle.h"
+#include "fm_pipeline.h"
+#include "fm_crc.h"
 #include "fm_cmds.h"
 #include "fm_cmd_utils.h"
+#include "fm_queue.h"
 #include "fm_perfids.h"
 #include "fm_platform_cfg.h"
 #include "fm_verify.h"
@@ -57,14 +62,105 @@
 
 /* Unit test helpers */
 
-void UT_FM_Child_Cmd_Assert(int32 cmd_ctr, int32 cmderr_ctr, int32 cmdwarn_ctr, int32 previous_cc)
+void UT_FM_Child_Cmd_Assert(int32 cmd_ctr, int32 cmderr_ctr, int32 cmdwarn_ctr)
 {
     UtAssert_INT32_EQ(FM_GlobalData.ChildCmdCounter, cmd_ctr);
     UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, cmderr_ctr);
     UtAssert_INT32_EQ(FM_GlobalData.ChildCmdWarnCounter, cmdwarn_ctr);
 
-    UtAssert_INT32_EQ(FM_GlobalData.ChildPreviousCC, previous_cc);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCurrentCC, 0);
+    /* Only FM_ChildProcess reports worker activity, command handlers do not */
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].Status.CurrentCC, 0);
+}
+
+/* Worker activity reported by FM_ChildProcess after a command */
+void UT_FM_Child_Worker_Assert(uint8 previous_cc)
+{
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].Status.PreviousCC, previous_cc);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].Status.CurrentCC, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].CompleteSequence, FM_GlobalData.ChildCompleteCount);
+}
+
+/* Queue entry index returned by the FM_QueueLanePop stub */
+static uint8 UT_FM_Child_QueueIndex[FM_CHILD_QUEUE_DEPTH];
+
+/* Command arguments returned by the FM_QueueEntryUnpack stub */
+static FM_ChildQueueEntry_t UT_FM_Child_Queue[FM_CHILD_QUEUE_DEPTH];
+
+/* Local time returned by the OS_GetLocalTime stub, advanced by the step on each call */
+static OS_time_t UT_FM_Child_Now;
+static uint32    UT_FM_Child_TimeStep;
+
+void UT_Handler_OS_GetLocalTime(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *TimePtr = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+
+    *TimePtr        = UT_FM_Child_Now;
+    UT_FM_Child_Now = OS_TimeAdd(UT_FM_Child_Now, OS_TimeAssembleFromMilliseconds(0, UT_FM_Child_TimeStep));
+}
+
+void UT_FM_Child_Test_Setup(void)
+{
+    FM_Test_Setup();
+
+    memset(UT_FM_Child_Queue, 0, sizeof(UT_FM_Child_Queue));
+
+    /* Local time stands still unless a test sets a step */
+    UT_FM_Child_Now      = OS_TimeAssembleFromMilliseconds(0, 0);
+    UT_FM_Child_TimeStep = 0;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), UT_Handler_OS_GetLocalTime, NULL);
+
+    /* Blocks submitted to the transfer pipeline are written or CRC'd without error */
+    UT_SetDefaultReturnValue(UT_KEY(FM_PipelineSubmit), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_PipelineFinish), true);
+}
+
+void UT_Handler_FM_QueueEntryUnpack(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint8                 QueueIndex = UT_Hook_GetArgValueByName(Context, "QueueIndex", uint8);
+    FM_ChildQueueEntry_t *CmdArgs    = UT_Hook_GetArgValueByName(Context, "CmdArgs", FM_ChildQueueEntry_t *);
+
+    *CmdArgs = UT_FM_Child_Queue[QueueIndex];
+}
+
+/* Have the lane pops return child queue entries as FM_InvokeChildTask would have queued them */
+void UT_FM_Child_Queue_Entries(const uint8 *queue_index, uint8 count)
+{
+    uint8 i;
+
+    for (i = 0; i < count; i++)
+    {
+        UT_FM_Child_QueueIndex[i] = queue_index[i];
+
+        FM_GlobalData.ChildQueueBusy[queue_index[i]] = true;
+        FM_GlobalData.ChildQueueCount++;
+    }
+
+    UT_SetDataBuffer(UT_KEY(FM_QueueLanePop), UT_FM_Child_QueueIndex, count, false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueLanePop), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueLaneCount), count);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueLaneIsValid), true);
+    UT_SetHandlerFunction(UT_KEY(FM_QueueEntryUnpack), UT_Handler_FM_QueueEntryUnpack, NULL);
+}
+
+void UT_FM_Child_Queue_Entry(uint8 queue_index)
+{
+    UT_FM_Child_Queue_Entries(&queue_index, 1);
+}
+
+/* Have worker 0 execute a command that has been aborted */
+void UT_FM_Child_Abort_Worker(void)
+{
+    FM_GlobalData.ChildWorker[0].CmdArgs.JobID              = 5;
+    FM_GlobalData.ChildAbortJobID[FM_CHILD_ABORT_COUNT - 1] = 5;
+}
+
+void UT_FM_Child_Abort_Assert(void)
+{
+    UtAssert_BOOL_TRUE(FM_GlobalData.ChildWorker[0].Aborted);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].JobCompletePkt.Status, FM_JOB_STATUS_ABORTED);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_ABORT_EID);
 }
 
 /*********************************************************************************
@@ -98,6 +194,34 @@ void Test_FM_ChildInit_MutSemCreateNotSuccess(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_QSEM_ERR_EID);
 }
 
+void Test_FM_ChildInit_ThrottleInitNotSuccess(void)
+{
+    // Arrange
+    UT_SetDefaultReturnValue(UT_KEY(FM_ThrottleInit), !CFE_SUCCESS);
+
+    // Act
+    UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_TSEM_ERR_EID);
+}
+
+void Test_FM_ChildInit_BufferInitNotSuccess(void)
+{
+    // Arrange
+    UT_SetDefaultReturnValue(UT_KEY(FM_PipelineBufferInit), !CFE_SUCCESS);
+
+    // Act
+    UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
+
+    // Assert - no worker runs without its buffers
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(FM_PipelineInit, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_POOL_ERR_EID);
+}
+
 void Test_FM_ChildInit_MuteSemCreateSuccess_CreateChildTaskNotSuccess(void)
 {
     // Arrange
@@ -106,6 +230,7 @@ void Test_FM_ChildInit_MuteSemCreateSuccess_CreateChildTaskNotSuccess(void)
     // Act
     UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
 
+    UtAssert_STUB_COUNT(FM_PipelineInit, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_CREATE_ERR_EID);
 }
@@ -114,9 +239,30 @@ void Test_FM_ChildInit_ReturnSuccess(void)
 {
     UtAssert_INT32_EQ(FM_ChildInit(), CFE_SUCCESS);
 
+    UtAssert_STUB_COUNT(FM_ThrottleInit, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, FM_CHILD_WORKER_COUNT);
+    UtAssert_STUB_COUNT(FM_CrcInit, 1);
+    UtAssert_STUB_COUNT(FM_QueuePendingInit, 1);
+    UtAssert_STUB_COUNT(FM_PipelineInit, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+#if FM_CHILD_WORKER_COUNT > 1
+void Test_FM_ChildInit_CreateSecondWorkerNotSuccess(void)
+{
+    // Arrange
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 2, !CFE_SUCCESS);
+
+    // Act
+    UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
+
+    // Assert
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_CREATE_ERR_EID);
+}
+#endif
+
 /* ****************
  * ChildTask Tests
  * ***************/
@@ -142,1659 +288,4298 @@ void Test_FM_ChildTask_ChildLoopCalled(void)
 }
 
 /* ****************
- * ChildProcess Tests
+ * ChildGetWorker Tests
  * ***************/
-void Test_FM_ChildProcess_ChildReadIndexGreaterChildQDepth(void)
+void Test_FM_ChildGetWorker_TaskIDMatch(void)
 {
     // Arrange
-    FM_GlobalData.ChildReadIndex                                       = FM_CHILD_QUEUE_DEPTH - 1;
-    FM_GlobalData.ChildQueue[FM_GlobalData.ChildReadIndex].CommandCode = -1;
+    CFE_ES_TaskId_t taskid = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(2));
 
-    // Act
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    FM_GlobalData.ChildWorker[0].TaskID                         = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(1));
+    FM_GlobalData.ChildWorker[FM_CHILD_WORKER_COUNT - 1].TaskID = taskid;
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildReadIndex, 0);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &taskid, sizeof(taskid), false);
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
+    // Act / Assert
+    UtAssert_ADDRESS_EQ(FM_ChildGetWorker(), &FM_GlobalData.ChildWorker[FM_CHILD_WORKER_COUNT - 1]);
 }
 
-void Test_FM_ChildProcess_FMCopyCC(void)
+void Test_FM_ChildGetWorker_NoTaskIDMatch(void)
 {
     // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_COPY_CC;
+    CFE_ES_TaskId_t taskid = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(3));
+    uint32          i      = 0;
 
-    // Act
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    for (i = 0; i < FM_CHILD_WORKER_COUNT; i++)
+    {
+        FM_GlobalData.ChildWorker[i].TaskID = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(i + 4));
+    }
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &taskid, sizeof(taskid), false);
 
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_CMD_EID);
+    // Act / Assert
+    UtAssert_ADDRESS_EQ(FM_ChildGetWorker(), &FM_GlobalData.ChildWorker[0]);
 }
 
-void Test_FM_ChildProcess_FMMoveCC(void)
+/* ****************
+ * ChildIsAborted / ChildCheckAbort Tests
+ * ***************/
+void Test_FM_ChildIsAborted(void)
 {
     // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_MOVE_CC;
+    FM_GlobalData.ChildAbortJobID[FM_CHILD_ABORT_COUNT - 1] = 7;
 
-    // Act
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    // Act / Assert - empty abort list entries never match job ID none
+    UtAssert_BOOL_FALSE(FM_ChildIsAborted(FM_CHILD_JOB_ID_NONE));
+    UtAssert_BOOL_FALSE(FM_ChildIsAborted(6));
+    UtAssert_BOOL_TRUE(FM_ChildIsAborted(7));
+}
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+void Test_FM_ChildCheckAbort(void)
+{
+    // Arrange
+    FM_GlobalData.ChildWorker[0].CmdArgs.JobID = 5;
 
-    UtAssert_STUB_COUNT(OS_mv, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_CMD_EID);
+    // Act / Assert - not aborted
+    UtAssert_BOOL_FALSE(FM_ChildCheckAbort(&FM_GlobalData.ChildWorker[0], "Test"));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    // Arrange
+    UT_FM_Child_Abort_Worker();
+
+    // Act / Assert - abort is reported once
+    UtAssert_BOOL_TRUE(FM_ChildCheckAbort(&FM_GlobalData.ChildWorker[0], "Test"));
+    UtAssert_BOOL_TRUE(FM_ChildCheckAbort(&FM_GlobalData.ChildWorker[0], "Test"));
+
+    UT_FM_Child_Cmd_Assert(0, 0, 1);
+    UT_FM_Child_Abort_Assert();
 }
 
-void Test_FM_ChildProcess_FMRenameCC(void)
+void Test_FM_ChildCheckAbort_Queued(void)
 {
-    // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_RENAME_CC;
+    // Arrange - marked while waiting in the queue, not in the abort list
+    FM_GlobalData.ChildWorker[0].CmdArgs.JobID   = 5;
+    FM_GlobalData.ChildWorker[0].CmdArgs.Aborted = true;
 
-    // Act
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    // Act / Assert
+    UtAssert_BOOL_TRUE(FM_ChildCheckAbort(&FM_GlobalData.ChildWorker[0], "Test"));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 0, 1);
+    UT_FM_Child_Abort_Assert();
+}
 
-    UtAssert_STUB_COUNT(OS_rename, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_CMD_EID);
+void Test_FM_ChildReportStatus(void)
+{
+    // Act / Assert - most severe status is kept
+    UtAssert_VOIDCALL(FM_ChildReportStatus(FM_JOB_STATUS_ERROR));
+    UtAssert_VOIDCALL(FM_ChildReportStatus(FM_JOB_STATUS_WARNING));
+
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].JobCompletePkt.Status, FM_JOB_STATUS_ERROR);
+    UT_FM_Child_Cmd_Assert(0, 1, 1);
+
+    // Act / Assert - aborts are counted as warnings
+    UtAssert_VOIDCALL(FM_ChildReportStatus(FM_JOB_STATUS_ABORTED));
+
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].JobCompletePkt.Status, FM_JOB_STATUS_ABORTED);
+    UT_FM_Child_Cmd_Assert(0, 1, 2);
 }
 
-void Test_FM_ChildProcess_FMDeleteCC(void)
+void Test_FM_ChildJobStart_ClockSetBackwards(void)
 {
     // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_DELETE_CC;
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    UT_FM_Child_Now               = OS_TimeAssembleFromMilliseconds(10, 0);
+    Worker->CmdArgs.QueueTime     = OS_TimeAssembleFromMilliseconds(1000, 0);
+    Worker->JobCompletePkt.Status = FM_JOB_STATUS_ERROR;
+    FM_GlobalData.ChildBlockSize  = FM_CHILD_MAX_BLOCK_SIZE;
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    UtAssert_VOIDCALL(FM_ChildJobStart(Worker));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, FM_GlobalData.ChildQueue[0].CommandCode);
-
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_CMD_EID);
+    UtAssert_UINT32_EQ(Worker->BlockSize, FM_CHILD_MAX_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(Worker->JobCompletePkt.QueueTime, 0);
+    UtAssert_INT32_EQ(Worker->JobCompletePkt.Status, FM_JOB_STATUS_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
 }
 
-void Test_FM_ChildProcess_FMDeleteAllCC(void)
+void Test_FM_ChildJobTotal(void)
 {
     // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_DELETE_ALL_CC;
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    // Act / Assert - size added from stat, unchanged on stat failure
+    UtAssert_VOIDCALL(FM_ChildJobTotal(Worker, "/cf/src1"));
+    UtAssert_VOIDCALL(FM_ChildJobTotal(Worker, "/cf/src2"));
 
-    // Act
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    UtAssert_STUB_COUNT(OS_stat, 2);
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), OS_ERROR);
+    Worker->JobProgressPkt.BytesTotal = 7;
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_OS_ERR_EID);
+    UtAssert_VOIDCALL(FM_ChildJobTotal(Worker, "/cf/src3"));
+
+    UtAssert_UINT32_EQ(Worker->JobProgressPkt.BytesTotal, 7);
 }
 
-#ifdef FM_INCLUDE_DECOMPRESS
-void Test_FM_ChildProcess_FMDecompressCC(void)
+void Test_FM_ChildJobBytes_Interval(void)
 {
     // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_DECOMPRESS_CC;
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
 
-    UT_SetDefaultReturnValue(UT_KEY(FS_LIB_Decompress), !CFE_SUCCESS);
+    UT_FM_Child_TimeStep = FM_CHILD_PROGRESS_INTERVAL_MS / 2;
 
-    // Act
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    // Act / Assert - nothing sent until the interval has passed
+    UtAssert_VOIDCALL(FM_ChildJobBytes(Worker, 100));
+    UtAssert_VOIDCALL(FM_ChildJobBytes(Worker, 100));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UtAssert_UINT32_EQ(Worker->JobCompletePkt.BytesProcessed, 200);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
 
-    UtAssert_STUB_COUNT(FS_LIB_Decompress, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CFE_ERR_EID);
+    UtAssert_VOIDCALL(FM_ChildJobBytes(Worker, 100));
+
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(Worker->JobProgressPkt.BytesDone, 300);
+    UtAssert_UINT32_EQ(Worker->ProgressBytes, 300);
+    UtAssert_UINT32_EQ(OS_TimeGetTotalMilliseconds(Worker->ProgressTime), FM_CHILD_PROGRESS_INTERVAL_MS);
+
+    // Act / Assert - local time set backwards restarts the interval
+    UT_FM_Child_Now = OS_TimeAssembleFromMilliseconds(0, 0);
+
+    UtAssert_VOIDCALL(FM_ChildJobBytes(Worker, 100));
+
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(Worker->ProgressBytes, 400);
+    UtAssert_UINT32_EQ(OS_TimeGetTotalMilliseconds(Worker->ProgressTime), 0);
 }
-#endif
 
-void Test_FM_ChildProcess_FMConcatCC(void)
+void Test_FM_ChildJobProgress(void)
 {
     // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_CONCAT_CC;
-    FM_GlobalData.ChildCurrentCC            = 1;
+    FM_ChildWorker_t *   Worker      = &FM_GlobalData.ChildWorker[0];
+    FM_JobProgressPkt_t *ProgressPkt = &Worker->JobProgressPkt;
+
+    Worker->CmdArgs.JobID                 = 6;
+    Worker->CmdArgs.CommandCode           = FM_COPY_CC;
+    Worker->JobCompletePkt.BytesProcessed = 3000;
+    Worker->ProgressBytes                 = 1000;
+    ProgressPkt->BytesTotal               = 10000;
+
+    // Act / Assert - 2000 bytes in 2 secs, 7000 bytes to go
+    UtAssert_VOIDCALL(FM_ChildJobProgress(Worker, 2000));
+
+    UtAssert_UINT32_EQ(ProgressPkt->JobID, 6);
+    UtAssert_INT32_EQ(ProgressPkt->CommandCode, FM_COPY_CC);
+    UtAssert_UINT32_EQ(ProgressPkt->BytesDone, 3000);
+    UtAssert_UINT32_EQ(ProgressPkt->Throughput, 1000);
+    UtAssert_UINT32_EQ(ProgressPkt->TimeRemaining, 7);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_cp), !OS_SUCCESS);
+    // Act / Assert - stalled
+    Worker->ProgressBytes = 3000;
 
-    // Act
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    UtAssert_VOIDCALL(FM_ChildJobProgress(Worker, 2000));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UtAssert_UINT32_EQ(ProgressPkt->Throughput, 0);
+    UtAssert_UINT32_EQ(ProgressPkt->TimeRemaining, FM_JOB_TIME_UNKNOWN);
 
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSCPY_ERR_EID);
+    // Act / Assert - done, but still writing
+    ProgressPkt->BytesTotal = 2000;
+
+    UtAssert_VOIDCALL(FM_ChildJobProgress(Worker, 2000));
+
+    UtAssert_UINT32_EQ(ProgressPkt->TimeRemaining, 0);
+
+    // Act / Assert - total not known
+    ProgressPkt->BytesTotal = 0;
+    Worker->ProgressBytes   = 1000;
+
+    UtAssert_VOIDCALL(FM_ChildJobProgress(Worker, 2000));
+
+    UtAssert_UINT32_EQ(ProgressPkt->Throughput, 1000);
+    UtAssert_UINT32_EQ(ProgressPkt->TimeRemaining, FM_JOB_TIME_UNKNOWN);
 }
 
-void Test_FM_ChildProcess_FMCreateDirCC(void)
+/* ****************
+ * ChildProcess Tests
+ * ***************/
+void Test_FM_ChildProcess_JobComplete(void)
 {
     // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_CREATE_DIR_CC;
-    FM_GlobalData.ChildCurrentCC            = 1;
+    FM_JobCompletePkt_t *JobPkt = &FM_GlobalData.ChildWorker[0].JobCompletePkt;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), !OS_SUCCESS);
+    UT_FM_Child_Queue[0].CommandCode = FM_RENAME_CC;
+    UT_FM_Child_Queue[0].JobID       = 9;
+    UT_FM_Child_Queue[0].QueueTime   = OS_TimeAssembleFromMilliseconds(1000, 0);
+    UT_FM_Child_Now                  = OS_TimeAssembleFromMilliseconds(1002, 0);
+    UT_FM_Child_TimeStep             = 250;
+
+    JobPkt->BytesProcessed = 3;
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
     UtAssert_VOIDCALL(FM_ChildProcess());
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
-
-    UtAssert_STUB_COUNT(OS_mkdir, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_OS_ERR_EID);
+    // Assert - sent once with the times measured when dequeued and completed
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(JobPkt->JobID, 9);
+    UtAssert_INT32_EQ(JobPkt->CommandCode, FM_RENAME_CC);
+    UtAssert_INT32_EQ(JobPkt->Status, FM_JOB_STATUS_SUCCESS);
+    UtAssert_UINT32_EQ(JobPkt->BytesProcessed, 0);
+    UtAssert_UINT32_EQ(JobPkt->QueueTime, 2000);
+    UtAssert_UINT32_EQ(JobPkt->WallTime, 250);
 }
 
-void Test_FM_ChildProcess_FMDeleteDirCC(void)
+void Test_FM_ChildProcess_WorkerStatus(void)
 {
     // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_DELETE_DIR_CC;
-    FM_GlobalData.ChildCurrentCC            = 1;
+    UT_FM_Child_Queue[0].CommandCode              = FM_COPY_CC;
+    UT_FM_Child_Queue[0].JobID                    = 4;
+    UT_FM_Child_Queue[0].Source1[0]               = 's';
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
+    FM_GlobalData.ChildWorker[0].Aborted          = true;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
     UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OPENDIR_OS_ERR_EID);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].Status.CmdCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].Status.CurrentCC, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].Status.PreviousCC, FM_COPY_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].Status.CurrentJobID, FM_CHILD_JOB_ID_NONE);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].CmdArgs.CommandCode, FM_COPY_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].CmdArgs.JobID, 4);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildWorker[0].Aborted);
+    UtAssert_STUB_COUNT(FM_CheckpointStart, 1);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildWorker[0].CmdArgs.Source1,
+                          sizeof(FM_GlobalData.ChildWorker[0].CmdArgs.Source1), "s", 2);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 0);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildQueueBusy[0]);
+    UtAssert_STUB_COUNT(FM_QueueLanePop, 1);
+    UtAssert_STUB_COUNT(FM_QueueEntryUnpack, 1);
+    UtAssert_STUB_COUNT(FM_QueuePendingPop, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
 }
 
-void Test_FM_ChildProcess_FMGetFileInfoCC(void)
+void Test_FM_ChildProcess_InteractiveLaneFirst(void)
 {
     // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode   = FM_GET_FILE_INFO_CC;
-    FM_GlobalData.ChildQueue[0].FileInfoCRC   = !FM_IGNORE_CRC;
-    FM_GlobalData.ChildQueue[0].FileInfoState = FM_NAME_IS_FILE_OPEN;
-    FM_GlobalData.ChildCurrentCC              = 1;
+    uint8 queue_index[] = {1, 0};
 
-    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_Init), CFE_SUCCESS);
+    UT_FM_Child_Queue[0].CommandCode = FM_COPY_CC;
+    UT_FM_Child_Queue[1].CommandCode = FM_RENAME_CC;
+
+    UT_FM_Child_Queue_Entries(queue_index, 2);
 
     // Act
     UtAssert_VOIDCALL(FM_ChildProcess());
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, FM_GlobalData.ChildQueue[0].CommandCode);
+    // Assert - interactive lane pop succeeds, bulk lane not touched
+    UtAssert_STUB_COUNT(FM_QueueLanePop, 1);
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(FM_CheckpointStart, 0);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildQueueBusy[1]);
+    UtAssert_BOOL_TRUE(FM_GlobalData.ChildQueueBusy[0]);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 1);
 
-    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
-    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_STATE_WARNING_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+    // Arrange - interactive lane now empty
+    UT_SetDeferredRetcode(UT_KEY(FM_QueueLanePop), 1, false);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildProcess());
+
+    // Assert - bulk lane pop follows the empty interactive lane
+    UtAssert_STUB_COUNT(FM_QueueLanePop, 3);
+    UtAssert_STUB_COUNT(FM_CheckpointStart, 1);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildQueueBusy[0]);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 0);
 }
 
-void Test_FM_ChildProcess_FMGetDirListsFileCC(void)
+void Test_FM_ChildProcess_LanesEmpty(void)
 {
     // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_GET_DIR_FILE_CC;
-    FM_GlobalData.ChildCurrentCC            = 1;
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    FM_GlobalData.ChildQueueCount = 1;
 
     // Act
     UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UtAssert_STUB_COUNT(FM_QueueLanePop, 2);
+    UtAssert_STUB_COUNT(FM_QueuePendingPop, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].Status.CmdCounter, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSOPENDIR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
 }
 
-void Test_FM_ChildProcess_FMGetDirListsPktCC(void)
+void Test_FM_ChildProcess_PendingCommand(void)
 {
     // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_GET_DIR_PKT_CC;
-    FM_GlobalData.ChildCurrentCC            = 1;
+    FM_ChildQueueEntry_t pending_entry = {.CommandCode = FM_RENAME_CC};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    FM_GlobalData.ChildQueueCount = FM_CHILD_QUEUE_DEPTH;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingPop), true);
+    UT_SetDataBuffer(UT_KEY(FM_QueuePendingPop), &pending_entry, sizeof(pending_entry), false);
 
     // Act
     UtAssert_VOIDCALL(FM_ChildProcess());
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, FM_GlobalData.ChildQueue[0].CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
-    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_EID);
+    // Assert - pending commands file read after both lanes, queue count untouched
+    UtAssert_STUB_COUNT(FM_QueueLanePop, 2);
+    UtAssert_STUB_COUNT(FM_QueuePendingPop, 1);
+    UtAssert_STUB_COUNT(FM_QueueEntryUnpack, 0);
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].Status.PreviousCC, FM_RENAME_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, FM_CHILD_QUEUE_DEPTH);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
 }
 
-void Test_FM_ChildProcess_FMSetFilePermCC(void)
+void Test_FM_ChildProcess_AbortedInQueue(void)
 {
     // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_SET_FILE_PERM_CC;
-    FM_GlobalData.ChildCurrentCC            = 1;
+    UT_FM_Child_Queue[0].CommandCode = FM_COPY_CC;
+    UT_FM_Child_Queue[0].JobID       = 5;
+    UT_FM_Child_Queue[0].Aborted     = true;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_chmod), !OS_SUCCESS);
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
     UtAssert_VOIDCALL(FM_ChildProcess());
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    // Assert - command is removed from the queue but not started
+    UtAssert_STUB_COUNT(FM_CheckpointStart, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].Status.CmdCounter, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].Status.PreviousCC, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 0);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildQueueBusy[0]);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdWarnCounter, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].JobCompletePkt.JobID, 5);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].Status.CurrentJobID, FM_CHILD_JOB_ID_NONE);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UT_FM_Child_Abort_Assert();
+}
 
-    UtAssert_STUB_COUNT(OS_chmod, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_OS_ERR_EID);
+void Test_FM_ChildProcess_AbortedInQueueResume(void)
+{
+    // Arrange
+    UT_FM_Child_Queue[0].CommandCode = FM_COPY_CC;
+    UT_FM_Child_Queue[0].JobID       = 5;
+    UT_FM_Child_Queue[0].Aborted     = true;
+    UT_FM_Child_Queue[0].Resume      = 1;
+
+    UT_FM_Child_Queue_Entry(0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildProcess());
+
+    // Assert - restored checkpoint is released so the command is not resumed again
+    UtAssert_STUB_COUNT(FM_CheckpointStart, 1);
+    UtAssert_STUB_COUNT(FM_CheckpointClear, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].Status.CmdCounter, 0);
+    UT_FM_Child_Abort_Assert();
 }
 
-void Test_FM_ChildProcess_DefaultSwitch(void)
+void Test_FM_ChildProcess_LastQueueEntryInvalidCC(void)
 {
     // Arrange
-    FM_GlobalData.ChildQueue[0].CommandCode = -1;
+    UT_FM_Child_Queue[FM_CHILD_QUEUE_DEPTH - 1].CommandCode = -1;
+
+    UT_FM_Child_Queue_Entry(FM_CHILD_QUEUE_DEPTH - 1);
 
     // Act
     UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].JobCompletePkt.Status, FM_JOB_STATUS_ERROR);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildQueueBusy[FM_CHILD_QUEUE_DEPTH - 1]);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
 }
 
-/* ****************
- * ChildCopyCmd Tests
- * ***************/
-void Test_FM_ChildCopyCmd_OScpIsSuccess(void)
+void Test_FM_ChildProcess_FMCopyCC(void)
 {
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC};
+    // Arrange
+    UT_FM_Child_Queue[0].CommandCode = FM_COPY_CC;
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
+    UtAssert_STUB_COUNT(FM_CheckpointStart, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_CMD_EID);
 }
 
-void Test_FM_ChildCopyCmd_OScpNotSuccess(void)
+void Test_FM_ChildProcess_FMMoveCC(void)
 {
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC};
-
     // Arrange
-    UT_SetDefaultReturnValue(UT_KEY(OS_cp), !OS_SUCCESS);
+    UT_FM_Child_Queue[0].CommandCode = FM_MOVE_CC;
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
+    UtAssert_STUB_COUNT(OS_rename, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_CMD_EID);
 }
 
-/* ****************
- * ChildMoveCmd Tests
- * ***************/
-void Test_FM_ChildMoveCmd_OSmvNotSuccess(void)
+void Test_FM_ChildProcess_FMRenameCC(void)
 {
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_CC};
-
     // Arrange
-    UT_SetDefaultReturnValue(UT_KEY(OS_mv), !OS_SUCCESS);
+    UT_FM_Child_Queue[0].CommandCode = FM_RENAME_CC;
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildMoveCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_mv, 1);
+    UtAssert_STUB_COUNT(OS_rename, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_CMD_EID);
 }
 
-void Test_FM_ChildMoveCmd_OSmvSuccess(void)
+void Test_FM_ChildProcess_FMDeleteCC(void)
 {
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_CC};
+    // Arrange
+    UT_FM_Child_Queue[0].CommandCode = FM_DELETE_CC;
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildMoveCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_mv, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_CMD_EID);
 }
 
-/* ****************
- * ChildRenameCmd Tests
- * ***************/
-void Test_FM_ChildRenameCmd_OSRenameSuccess(void)
+void Test_FM_ChildProcess_FMDeleteAllCC(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_RENAME_CC};
+    UT_FM_Child_Queue[0].CommandCode = FM_DELETE_ALL_CC;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildRenameCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_OS_ERR_EID);
 }
 
-void Test_FM_ChildRenameCmd_OSRenameNotSuccess(void)
+#ifdef FM_INCLUDE_DECOMPRESS
+void Test_FM_ChildProcess_FMDecompressCC(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_RENAME_CC};
+    UT_FM_Child_Queue[0].CommandCode = FM_DECOMPRESS_CC;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_rename), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FS_LIB_Decompress), !CFE_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildRenameCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(FS_LIB_Decompress, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CFE_ERR_EID);
 }
+#endif
 
-/* ****************
- * ChildDeleteCmd Tests
- * ***************/
-void Test_FM_ChildDeleteCmd_OSRemoveSuccess(void)
+void Test_FM_ChildProcess_FMConcatCC(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_CC};
+    UT_FM_Child_Queue[0].CommandCode              = FM_CONCAT_CC;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSCPY_ERR_EID);
 }
 
-void Test_FM_ChildDeleteCmd_OSRemoveNotSuccess(void)
+void Test_FM_ChildProcess_FMCreateDirCC(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_CC};
+    UT_FM_Child_Queue[0].CommandCode              = FM_CREATE_DIR_CC;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), !OS_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_OS_ERR_EID);
 }
 
-/* ****************
- * ChildDeleteAllCmd Tests
- * ***************/
-void Test_FM_ChildDeleteAllCmd_DirOpenNotSuccess(void)
+void Test_FM_ChildProcess_FMDeleteDirCC(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    UT_FM_Child_Queue[0].CommandCode              = FM_DELETE_DIR_CC;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
 
     UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
 
+    UT_FM_Child_Queue_Entry(0);
+
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
     UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OPENDIR_OS_ERR_EID);
 }
 
-void Test_FM_ChildDeleteAllCmd_DirReadNotSuccess(void)
+void Test_FM_ChildProcess_FMGetFileInfoCC(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    UT_FM_Child_Queue[0].CommandCode              = FM_GET_FILE_INFO_CC;
+    UT_FM_Child_Queue[0].FileInfoCRC              = !FM_IGNORE_CRC;
+    UT_FM_Child_Queue[0].FileInfoState            = FM_NAME_IS_FILE_OPEN;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_Init), CFE_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_STATE_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
 }
 
-void Test_FM_ChildDeleteAllCmd_DirEntryThisDirectory(void)
+void Test_FM_ChildProcess_FMGetDirListsFileCC(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
-    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
+    UT_FM_Child_Queue[0].CommandCode              = FM_GET_DIR_FILE_CC;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
     UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSOPENDIR_ERR_EID);
 }
 
-void Test_FM_ChildDeleteAllCmd_DirEntryParentDirectory(void)
+void Test_FM_ChildProcess_FMGetDirListsPktCC(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
-    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
+    UT_FM_Child_Queue[0].CommandCode              = FM_GET_DIR_PKT_CC;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
     UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 2);
     UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_EID);
 }
 
-void Test_FM_ChildDeleteAllCmd_PathFilenameLengthGreaterMaxPthLen(void)
+void Test_FM_ChildProcess_FMSetFilePermCC(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_ALL_CC,
-                                        .Source1     = "dummy_source1",
-                                        .Source2     = "dummy_source2HasAReallyLongNameSomeSayTheNameIs42Characters"};
-    os_dirent_t          direntry    = {.FileName = "ThisDirectory"};
+    UT_FM_Child_Queue[0].CommandCode              = FM_SET_FILE_PERM_CC;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_chmod), !OS_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_STUB_COUNT(OS_chmod, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_OS_ERR_EID);
 }
 
-void Test_FM_ChildDeleteAllCmd_InvalidFilenameState(void)
+void Test_FM_ChildProcess_FMCopyDirCC(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    UT_FM_Child_Queue[0].CommandCode              = FM_COPY_DIR_CC;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_INVALID);
+    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), !OS_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_DIR_OS_ERR_EID);
 }
 
-void Test_FM_ChildDeleteAllCmd_NotInUseFilenameState(void)
+void Test_FM_ChildProcess_FMDeleteTreeCC(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    UT_FM_Child_Queue[0].CommandCode              = FM_DELETE_TREE_CC;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_NOT_IN_USE);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
     UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_TREE_OS_ERR_EID);
 }
 
-void Test_FM_ChildDeleteAllCmd_DirectoryFilenameState(void)
+void Test_FM_ChildProcess_FMDeleteFilterCC(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    UT_FM_Child_Queue[0].CommandCode              = FM_DELETE_FILTER_CC;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_DIRECTORY);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
     UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_SKIP_WARNING_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_FILTER_OS_ERR_EID);
 }
 
-void Test_FM_ChildDeleteAllCmd_OpenFilenameState(void)
+void Test_FM_ChildProcess_FMConcatListCC(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    UT_FM_Child_Queue[0].CommandCode              = FM_CONCAT_LIST_CC;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_OPEN);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_ERR_EID);
+}
+
+void Test_FM_ChildProcess_FMSplitCC(void)
+{
+    // Arrange
+    UT_FM_Child_Queue[0].CommandCode              = FM_SPLIT_CC;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildProcess());
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
+
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SPLIT_OS_ERR_EID);
+}
+
+void Test_FM_ChildProcess_FMPreallocateCC(void)
+{
+    // Arrange
+    UT_FM_Child_Queue[0].CommandCode              = FM_PREALLOCATE_CC;
+    UT_FM_Child_Queue[0].FileSize                 = 8;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildProcess());
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PREALLOCATE_OS_ERR_EID);
+}
+
+void Test_FM_ChildProcess_FMTruncateCC(void)
+{
+    // Arrange
+    UT_FM_Child_Queue[0].CommandCode              = FM_TRUNCATE_CC;
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
+
+    UT_FM_Child_Queue_Entry(0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildProcess());
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+    UT_FM_Child_Worker_Assert(UT_FM_Child_Queue[0].CommandCode);
+
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_TRUNCATE_OS_ERR_EID);
+}
+
+void Test_FM_ChildProcess_DefaultSwitch(void)
+{
+    // Arrange
+    UT_FM_Child_Queue[0].CommandCode = -1;
+
+    UT_FM_Child_Queue_Entry(0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildProcess());
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
+}
+
+/* ****************
+ * ChildCopyCmd Tests
+ * ***************/
+void Test_FM_ChildCopyCmd_Success(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC};
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(FM_CheckpointStart, 1);
+    UtAssert_STUB_COUNT(FM_CheckpointClear, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_CMD_EID);
+}
+
+void Test_FM_ChildCopyCmd_OpenSourceNotSuccess(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC};
+
+    // Arrange
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    // Assert - an existing target file is left alone
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(FM_CheckpointClear, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+}
+
+void Test_FM_ChildCopyCmd_OpenTargetNotSuccess(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC};
+
+    // Arrange
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 2, !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+}
+
+void Test_FM_ChildCopyCmd_WriteNotSuccess(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC};
+
+    // Arrange - the pipeline fails to write the first block
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDefaultReturnValue(UT_KEY(FM_PipelineSubmit), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_PipelineFinish), false);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    // Assert - partial target file is removed, after the pipeline has finished with it
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 1);
+    UtAssert_STUB_COUNT(FM_PipelineFinish, 1);
+    UtAssert_STUB_COUNT(FM_ThrottleBytes, 0);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+}
+
+void Test_FM_ChildCopyCmd_Checkpoint(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC};
+
+    // Arrange
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 4, 0);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CheckpointIsEnabled), true);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    // Assert - source recorded and checkpoint saved before the first block
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_stat, 2);
+    UtAssert_STUB_COUNT(FM_CheckpointSave, 1);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 3);
+    UtAssert_STUB_COUNT(FM_CheckpointClear, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+}
+
+void Test_FM_ChildCopyCmd_CRC(void)
+{
+    FM_ChildWorker_t *   Worker      = &FM_GlobalData.ChildWorker[0];
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC, .FileInfoCRC = CFE_MISSION_ES_CRC_16};
+
+    // Arrange - checkpoint start is stubbed, so set the CRC type it would have copied
+    Worker->Checkpoint.CRCType = CFE_MISSION_ES_CRC_16;
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+
+    // Pipeline start is stubbed, so set the CRC the pipeline would have computed
+    Worker->Pipeline.CRC = 0x55;
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    // Assert - CRC computed by the pipeline for each block written and reported with the job
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(FM_PipelineStart, 1);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 2);
+    UtAssert_UINT32_EQ(Worker->JobCompletePkt.CRC, 0x55);
+    UtAssert_INT32_EQ(Worker->JobCompletePkt.CRCType, CFE_MISSION_ES_CRC_16);
+    UtAssert_INT32_EQ(Worker->JobCompletePkt.Verified, FM_JOB_VERIFY_NONE);
+}
+
+/* Pipeline start stub records the mode of the last transfer */
+uint8 UT_FM_PipelineMode;
+
+void UT_Handler_FM_PipelineStart_Mode(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_FM_PipelineMode = UT_Hook_GetArgValueByName(Context, "Mode", uint8);
+}
+
+void Test_FM_ChildCopyCmd_Sparse(void)
+{
+    FM_ChildWorker_t *   Worker        = &FM_GlobalData.ChildWorker[0];
+    FM_ChildQueueEntry_t queue_entry   = {.CommandCode = FM_COPY_CC, .Sparse = true};
+    FM_ChildCopyEvents_t Events        = {1, 2, 3, 4, 5};
+    bool                 OpenedTgtFile = false;
+
+    // Arrange - checkpoint start is stubbed, so set the sparse flag it would have copied
+    Worker->Checkpoint.Sparse = true;
+    UT_FM_PipelineMode        = FM_PIPELINE_MODE_CRC;
+    UT_SetHandlerFunction(UT_KEY(FM_PipelineStart), UT_Handler_FM_PipelineStart_Mode, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    // Assert - new target file, so zero blocks are left as holes
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+    UtAssert_UINT32_EQ(UT_FM_PipelineMode, FM_PIPELINE_MODE_SPARSE);
+
+    // Act - appending to existing target data writes every block
+    Worker->Checkpoint.SourceOffset = 4;
+    Worker->Checkpoint.TargetOffset = 4;
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), 4);
+    UtAssert_BOOL_TRUE(FM_ChildCopySegment(Worker, "Copy File", &Events, &OpenedTgtFile));
+
+    UtAssert_UINT32_EQ(UT_FM_PipelineMode, FM_PIPELINE_MODE_WRITE);
+}
+
+/* Pipeline start stub computes a different CRC for each transfer */
+void UT_Handler_FM_PipelineStart_NewCRC(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    FM_GlobalData.ChildWorker[0].Pipeline.CRC = 0x55 + UT_GetStubCount(UT_KEY(FM_PipelineStart));
+}
+
+void Test_FM_ChildCopyCmd_Verify(void)
+{
+    FM_ChildWorker_t *   Worker      = &FM_GlobalData.ChildWorker[0];
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC, .FileInfoCRC = CFE_MISSION_ES_CRC_16, .Verify = 1};
+
+    // Arrange - two blocks copied, then one block read back
+    Worker->Checkpoint.CRCType = CFE_MISSION_ES_CRC_16;
+    Worker->Pipeline.CRC       = 0x55;
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    // Assert - the target file read back has the CRC of the data copied
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(FM_PipelineStart, 2);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 3);
+    UtAssert_STUB_COUNT(FM_PipelineFinish, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 3);
+    UtAssert_STUB_COUNT(OS_close, 3);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(FM_CheckpointClear, 1);
+    UtAssert_UINT32_EQ(Worker->JobCompletePkt.CRC, 0x55);
+    UtAssert_UINT32_EQ(Worker->JobCompletePkt.TargetCRC, 0x55);
+    UtAssert_INT32_EQ(Worker->JobCompletePkt.Verified, FM_JOB_VERIFY_MATCH);
+    UtAssert_INT32_EQ(Worker->JobCompletePkt.CRCType, CFE_MISSION_ES_CRC_16);
+}
+
+void Test_FM_ChildCopyCmd_VerifyMismatch(void)
+{
+    FM_ChildWorker_t *   Worker      = &FM_GlobalData.ChildWorker[0];
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC, .FileInfoCRC = CFE_MISSION_ES_CRC_32, .Verify = 1};
+
+    // Arrange
+    Worker->Checkpoint.CRCType = CFE_MISSION_ES_CRC_32;
+    UT_SetHandlerFunction(UT_KEY(FM_PipelineStart), UT_Handler_FM_PipelineStart_NewCRC, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    // Assert - both CRC's are reported and the target file is removed
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_UINT32_EQ(Worker->JobCompletePkt.TargetCRC, Worker->JobCompletePkt.CRC + 1);
+    UtAssert_INT32_EQ(Worker->JobCompletePkt.Verified, FM_JOB_VERIFY_MISMATCH);
+    UtAssert_INT32_EQ(Worker->JobCompletePkt.CRCType, CFE_MISSION_ES_CRC_32);
+    UtAssert_INT32_EQ(Worker->JobCompletePkt.Status, FM_JOB_STATUS_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_VERIFY_READ_ERR_EID);
+}
+
+void Test_FM_ChildCopyCmd_VerifyReadNotSuccess(void)
+{
+    FM_ChildWorker_t *   Worker      = &FM_GlobalData.ChildWorker[0];
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC, .FileInfoCRC = CFE_MISSION_ES_CRC_16, .Verify = 1};
+
+    // Arrange - the read back fails after the copy completes
+    Worker->Checkpoint.CRCType = CFE_MISSION_ES_CRC_16;
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, -1);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_close, 3);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_INT32_EQ(Worker->JobCompletePkt.Verified, FM_JOB_VERIFY_NONE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_VERIFY_READ_ERR_EID);
+
+    // Target file that cannot be opened again is also removed
+    UT_ResetState(UT_KEY(OS_read));
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 3, OS_ERROR);
+
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    UtAssert_STUB_COUNT(OS_close, 5);
+    UtAssert_STUB_COUNT(OS_remove, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_COPY_VERIFY_READ_ERR_EID);
+}
+
+void Test_FM_ChildCopyCmd_SeekNotSuccess(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC};
+
+    // Arrange
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), -1);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+}
+
+void Test_FM_ChildCopyCmd_LinkNotSuccess(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC, .Link = FM_COPY_LINK_HARD};
+
+    // Arrange - no link in either build
+    UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), OS_ERROR);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    // Assert - the file data is copied instead, without an error
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(FM_CheckpointStart, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_CMD_EID);
+}
+
+void Test_FM_ChildCopyCmd_LinkCrossVolume(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_CC, .Link = FM_COPY_LINK_CLONE, .CrossVolume = true};
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    // Assert - the link is not tried
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_TranslatePath, 0);
+    UtAssert_STUB_COUNT(FM_CheckpointStart, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_CMD_EID);
+}
+
+/* ****************
+ * ChildMoveCmd Tests
+ * ***************/
+void Test_FM_ChildMoveCmd_RenameSuccess(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_CC};
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildMoveCmd(&queue_entry));
+
+    // Assert - same volume, no file data is read
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(FM_CheckpointStart, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_CMD_EID);
+}
+
+void Test_FM_ChildMoveCmd_CrossVolume(void)
+{
+    FM_ChildWorker_t *   Worker      = &FM_GlobalData.ChildWorker[0];
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_CC, .CrossVolume = 1};
+
+    // Arrange - one block copied, then read back
+    Worker->Checkpoint.CRCType = CFE_MISSION_ES_CRC_16;
+    Worker->Pipeline.CRC       = 0x55;
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildMoveCmd(&queue_entry));
+
+    // Assert - source file removed after the target file is verified
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_rename, 0);
+    UtAssert_STUB_COUNT(FM_CheckpointStart, 1);
+    UtAssert_STUB_COUNT(FM_CheckpointClear, 1);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_INT32_EQ(Worker->JobCompletePkt.Verified, FM_JOB_VERIFY_MATCH);
+    UtAssert_UINT32_EQ(Worker->JobCompletePkt.TargetCRC, 0x55);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_CMD_EID);
+}
+
+void Test_FM_ChildMoveCmd_RenameNotSuccess(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_CC};
+
+    // Arrange - rename fails and the streaming fallback cannot open the source
+    UT_SetDefaultReturnValue(UT_KEY(OS_rename), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildMoveCmd(&queue_entry));
+
+    // Assert - no target file was created and the source file is kept
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(FM_CheckpointStart, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_OS_ERR_EID);
+}
+
+void Test_FM_ChildMoveCmd_VerifyMismatch(void)
+{
+    FM_ChildWorker_t *   Worker      = &FM_GlobalData.ChildWorker[0];
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_CC, .CrossVolume = 1};
+
+    // Arrange
+    Worker->Checkpoint.CRCType = CFE_MISSION_ES_CRC_16;
+    UT_SetHandlerFunction(UT_KEY(FM_PipelineStart), UT_Handler_FM_PipelineStart_NewCRC, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildMoveCmd(&queue_entry));
+
+    // Assert - only the target file is removed
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_INT32_EQ(Worker->JobCompletePkt.Verified, FM_JOB_VERIFY_MISMATCH);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_OS_ERR_EID);
+}
+
+void Test_FM_ChildMoveCmd_RemoveSourceNotSuccess(void)
+{
+    FM_ChildWorker_t *   Worker      = &FM_GlobalData.ChildWorker[0];
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_CC, .CrossVolume = 1};
+
+    // Arrange
+    Worker->Checkpoint.CRCType = CFE_MISSION_ES_CRC_16;
+    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildMoveCmd(&queue_entry));
+
+    // Assert - the verified target file is kept
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_INT32_EQ(Worker->JobCompletePkt.Verified, FM_JOB_VERIFY_MATCH);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildRenameCmd Tests
+ * ***************/
+void Test_FM_ChildRenameCmd_OSRenameSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_RENAME_CC};
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildRenameCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_CMD_EID);
+}
+
+void Test_FM_ChildRenameCmd_OSRenameNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_RENAME_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_rename), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildRenameCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildDeleteCmd Tests
+ * ***************/
+void Test_FM_ChildDeleteCmd_OSRemoveSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_CC};
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_CMD_EID);
+}
+
+void Test_FM_ChildDeleteCmd_OSRemoveNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildDeleteAllCmd Tests
+ * ***************/
+void Test_FM_ChildDeleteAllCmd_DirOpenNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_OS_ERR_EID);
+}
+
+void Test_FM_ChildDeleteAllCmd_DirReadNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+}
+
+void Test_FM_ChildDeleteAllCmd_DirEntryThisDirectory(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameStateFromList, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+}
+
+void Test_FM_ChildDeleteAllCmd_DirEntryParentDirectory(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameStateFromList, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+}
+
+void Test_FM_ChildDeleteAllCmd_PathFilenameLengthGreaterMaxPthLen(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_ALL_CC,
+                                        .Source1     = "dummy_source1",
+                                        .Source2     = "dummy_source2HasAReallyLongNameSomeSayTheNameIs42Characters"};
+    os_dirent_t          direntry    = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameStateFromList, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllCmd_InvalidFilenameState(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameStateFromList), FM_NAME_IS_INVALID);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameStateFromList, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllCmd_NotInUseFilenameState(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameStateFromList), FM_NAME_IS_NOT_IN_USE);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameStateFromList, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllCmd_DirectoryFilenameState(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameStateFromList), FM_NAME_IS_DIRECTORY);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameStateFromList, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_SKIP_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllCmd_OpenFilenameState(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameStateFromList), FM_NAME_IS_FILE_OPEN);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameStateFromList, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllCmd_ClosedFilename_OSRmNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameStateFromList), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameStateFromList, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllCmd_ClosedFilename_OSrmSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameStateFromList), FM_NAME_IS_FILE_CLOSED);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameStateFromList, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 0);
+    UtAssert_STUB_COUNT(FM_GetOpenFilesData, 1);
+    UtAssert_STUB_COUNT(FM_ThrottleStats, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+}
+
+void Test_FM_ChildDeleteAllCmd_FilenameStateDefaultReturn(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameStateFromList), -1); // default case
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameStateFromList, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllCmd_ManyEntries(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    /* More names than fit in one batch */
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 5001, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameStateFromList), FM_NAME_IS_FILE_CLOSED);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+
+    // Assert - every entry is read once and the open files are listed once
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 5001);
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 0);
+    UtAssert_STUB_COUNT(FM_GetOpenFilesData, 1);
+    UtAssert_STUB_COUNT(FM_GetFilenameStateFromList, 5000);
+    UtAssert_STUB_COUNT(OS_remove, 5000);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+}
+
+/* ****************
+ * ChildDecompressCmd Tests
+ * ***************/
+#ifdef FM_INCLUDE_DECOMPRESS
+void Test_FM_ChildDecompressCmd_FSDecompressSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DECOMPRESS_CC};
+
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDecompressCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(FS_LIB_Decompress, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CMD_EID);
+}
+
+void Test_FM_ChildDecompressCmd_FSDecompressNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DECOMPRESS_CC};
+
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
+    UT_SetDefaultReturnValue(UT_KEY(FS_LIB_Decompress), !CFE_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDecompressCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(FS_LIB_Decompress, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CFE_ERR_EID);
+}
+#endif
+
+/* ****************
+ * ChildConcatCmd Tests
+ * ***************/
+void Test_FM_ChildConcatCmd_CopySource1NotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+
+    FM_GlobalData.ChildWorker[0].Status.CurrentCC = 1;
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(FM_CheckpointClear, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSCPY_ERR_EID);
+}
+
+void Test_FM_ChildConcatCmd_OSOpenCreateSourceNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 3, !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 3);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OPEN_SRC2_ERR_EID);
+}
+
+void Test_FM_ChildConcatCmd_OSOpenCreateTargetNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 4, !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 4);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OPEN_TGT_ERR_EID);
+}
+
+void Test_FM_ChildConcatCmd_OSReadBytesZero(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].Checkpoint.Segment, 1);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 4);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(OS_close, 4);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_CMD_EID);
+}
+
+void Test_FM_ChildConcatCmd_OSReadBytesLessThanZero(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 4);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 4);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSRD_ERR_EID);
+}
+
+void Test_FM_ChildConcatCmd_BytesWrittenNotEqualBytesRead(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+    UT_SetDefaultReturnValue(UT_KEY(FM_PipelineSubmit), false);
+    UT_SetDeferredRetcode(UT_KEY(FM_PipelineFinish), 2, false);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 4);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 4);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSWR_ERR_EID);
+}
+
+void Test_FM_ChildConcatCmd_CopyInProgressThrottled(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 5, -1);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+
+    // Assert - fails while copying source file #1, every block written is paced
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_read, 5);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 4);
+    UtAssert_STUB_COUNT(FM_PipelineFinish, 1);
+    UtAssert_STUB_COUNT(FM_ThrottleStart, 1);
+    UtAssert_STUB_COUNT(FM_ThrottleBytes, 4);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].JobCompletePkt.Status, FM_JOB_STATUS_ERROR);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSCPY_ERR_EID);
+}
+
+void Test_FM_ChildConcatCmd_Aborted(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+
+    UT_FM_Child_Abort_Worker();
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+
+    // Assert - stops after the first block and removes the partial target
+    UT_FM_Child_Cmd_Assert(0, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(FM_CheckpointClear, 1);
+    UT_FM_Child_Abort_Assert();
+}
+
+void Test_FM_ChildConcatCmd_ResumeSource2(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+
+    FM_GlobalData.ChildWorker[0].Checkpoint.Segment = 1;
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+
+    // Assert - only source file #2 is copied
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_CMD_EID);
+}
+
+/* ****************
+ * ChildCopyResume Tests
+ * ***************/
+void Test_FM_ChildCopyResume_NewCommand(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyResume(Worker, "Copy File"));
+
+    // Assert - nothing written before a reset, nothing to verify
+    UtAssert_STUB_COUNT(OS_stat, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_ChildCopyResume_Match(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange - target CRC matches the stub CRC, source size and time match the stub stat
+    Worker->Checkpoint.TargetOffset = FM_CHILD_FILE_BLOCK_SIZE + 4;
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 4);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, FM_CHILD_FILE_BLOCK_SIZE);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyResume(Worker, "Copy File"));
+
+    // Assert
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, FM_CHILD_FILE_BLOCK_SIZE + 4);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(FM_CrcCalculate, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_RESUME_EID);
+}
+
+void Test_FM_ChildCopyResume_CRCMismatch(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    Worker->Checkpoint.Segment      = 1;
+    Worker->Checkpoint.TargetOffset = 4;
+    Worker->Checkpoint.TargetCRC    = 1;
+    Worker->Checkpoint.CRCType      = CFE_MISSION_ES_CRC_16;
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 4);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcCalculate), 2);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyResume(Worker, "Concat Files"));
+
+    // Assert - restarted from the beginning of source file #1
+    UtAssert_STUB_COUNT(FM_CrcCalculate, 2);
+    UtAssert_UINT32_EQ(Worker->JobCompletePkt.BytesProcessed, 0);
+    UtAssert_UINT32_EQ(Worker->JobCompletePkt.CRC, 0);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.Segment, 0);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, 0);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetCRC, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_RESUME_RESTART_EID);
+}
+
+void Test_FM_ChildCopyResume_TargetShort(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange - target file ends before the checkpoint offset
+    Worker->Checkpoint.TargetOffset = 4;
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyResume(Worker, "Copy File"));
+
+    // Assert
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_RESUME_RESTART_EID);
+}
+
+void Test_FM_ChildCopyResume_SourceModified(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    Worker->Checkpoint.SourceOffset = 4;
+    Worker->Checkpoint.TargetOffset = 4;
+    Worker->Checkpoint.SourceSize   = 8;
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyResume(Worker, "Copy File"));
+
+    // Assert - target file is not read
+    UtAssert_UINT32_EQ(Worker->Checkpoint.SourceOffset, 0);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, 0);
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_RESUME_RESTART_EID);
+}
+
+void Test_FM_ChildCopyResume_KernelCopied(void)
+{
+    FM_ChildWorker_t *Worker      = &FM_GlobalData.ChildWorker[0];
+    os_fstat_t        FileStat[2] = {{.FileSize = 8}, {.FileSize = 4}};
+
+    // Arrange - source unchanged, target holds the data copied by the kernel
+    Worker->Checkpoint.SourceOffset = 4;
+    Worker->Checkpoint.TargetOffset = 4;
+    Worker->Checkpoint.SourceSize   = 8;
+    Worker->Checkpoint.TargetCRC    = FM_CHECKPOINT_CRC_UNKNOWN;
+    UT_SetDataBuffer(UT_KEY(OS_stat), FileStat, sizeof(FileStat), false);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyResume(Worker, "Copy File"));
+
+    // Assert - target file size checked instead of reading it back
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, 4);
+    UtAssert_UINT32_EQ(Worker->JobCompletePkt.BytesProcessed, 4);
+    UtAssert_UINT32_EQ(Worker->ProgressBytes, 4);
+    UtAssert_STUB_COUNT(OS_stat, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_RESUME_EID);
+}
+
+void Test_FM_ChildCopyResume_KernelCopiedTargetShort(void)
+{
+    FM_ChildWorker_t *Worker      = &FM_GlobalData.ChildWorker[0];
+    os_fstat_t        FileStat[2] = {{.FileSize = 8}, {.FileSize = 3}};
+
+    // Arrange
+    Worker->Checkpoint.SourceOffset = 4;
+    Worker->Checkpoint.TargetOffset = 4;
+    Worker->Checkpoint.SourceSize   = 8;
+    Worker->Checkpoint.TargetCRC    = FM_CHECKPOINT_CRC_UNKNOWN;
+    UT_SetDataBuffer(UT_KEY(OS_stat), FileStat, sizeof(FileStat), false);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyResume(Worker, "Copy File"));
+
+    // Assert - restarted, target CRC is known again
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetOffset, 0);
+    UtAssert_UINT32_EQ(Worker->Checkpoint.TargetCRC, 0);
+    UtAssert_UINT32_EQ(Worker->JobCompletePkt.BytesProcessed, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_RESUME_RESTART_EID);
+}
+
+#ifdef FM_INCLUDE_KERNEL_COPY
+
+/* ****************
+ * ChildKernelCopy Tests
+ * ***************/
+void Test_FM_ChildKernelCopy_NotAvailable(void)
+{
+    FM_ChildWorker_t *   Worker     = &FM_GlobalData.ChildWorker[0];
+    FM_ChildCopyEvents_t Events     = {1, 2, 3, 4};
+    bool                 CopyResult = false;
+
+    // Arrange
+    UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), OS_ERROR);
+
+    // Act / Assert - nothing copied, left to the portable loop
+    UtAssert_BOOL_FALSE(FM_ChildKernelCopy(Worker, "Copy File", &Events, "/cf/src", &CopyResult));
+
+    UtAssert_BOOL_FALSE(CopyResult);
+    UtAssert_STUB_COUNT(FM_CheckpointUpdate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+#endif
+
+/* ****************
+ * ChildFileInfoCmd Tests
+ * ***************/
+void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualIgnoreCRC(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "dummy_source1",
+                                        .Source2       = "dummy_source2",
+                                        .FileInfoCRC   = FM_IGNORE_CRC,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+#ifndef FM_INCLUDE_ALLOCATED_SIZE
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].FileInfoPkt.AllocatedSize, FM_FILE_SIZE_UNKNOWN);
+#endif
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoStateIsNotFileClosed(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "dummy_source1",
+                                        .Source2       = "dummy_source2",
+                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_8,
+                                        .FileInfoState = FM_NAME_IS_FILE_OPEN};
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].FileInfoPkt.AllocatedSize, FM_FILE_SIZE_UNKNOWN);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_STATE_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission8(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "dummy_source1",
+                                        .Source2       = "dummy_source2",
+                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_8,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission16(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "dummy_source1",
+                                        .Source2       = "dummy_source2",
+                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission32(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "dummy_source1",
+                                        .Source2       = "dummy_source2",
+                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_32,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoCRCNotEqualToAnyMissionES(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "dummy_source1",
+                                        .Source2       = "dummy_source2",
+                                        .FileInfoCRC   = -1,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_TYPE_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_OSOpenCreateTrueBytesReadZero(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "dummy_source1",
+                                        .Source2       = "dummy_source2",
+                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_BytesReadLessThanZero(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "dummy_source1",
+                                        .Source2       = "dummy_source2",
+                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_READ_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_BytesReadGreaterThanZero(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "dummy_source1",
+                                        .Source2       = "dummy_source2",
+                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_8,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED,
+                                        .FileInfoSize  = 4};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 5, 0);
+
+    // Pipeline start is stubbed, so set the CRC the pipeline would have computed
+    FM_GlobalData.ChildWorker[0].Pipeline.CRC = 0x55;
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_read, 5);
+    UtAssert_STUB_COUNT(FM_PipelineStart, 1);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 4);
+    UtAssert_STUB_COUNT(FM_ThrottleStart, 1);
+    UtAssert_STUB_COUNT(FM_ThrottleBytes, 4);
+    UtAssert_BOOL_TRUE(FM_GlobalData.ChildWorker[0].FileInfoPkt.CRC_Computed);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].FileInfoPkt.CRC, 0x55);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].JobProgressPkt.BytesTotal, 4);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_PipelineNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "dummy_source1",
+                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_8,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+    UT_SetDefaultReturnValue(UT_KEY(FM_PipelineFinish), false);
+
+    FM_GlobalData.ChildWorker[0].Pipeline.CRC = 0x55;
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    // Assert - file info is still reported, without a partial CRC
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(FM_PipelineFinish, 1);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildWorker[0].FileInfoPkt.CRC_Computed);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].FileInfoPkt.CRC, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_READ_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_Aborted(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "dummy_source1",
+                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_8,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+
+    UT_FM_Child_Abort_Worker();
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    // Assert - stops after the first block, no file info packet is sent
+    UT_FM_Child_Cmd_Assert(0, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildWorker[0].FileInfoPkt.CRC_Computed);
+    UT_FM_Child_Abort_Assert();
+}
+
+/* ****************
+ * ChildCreateDirCmd Tests
+ * ***************/
+void Test_FM_ChildCreateDirCmd_OSMkDirSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CREATE_DIR_CC};
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCreateDirCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_CMD_EID);
+}
+
+void Test_FM_ChildCreateDirCmd_OSMkDirNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CREATE_DIR_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), !CFE_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCreateDirCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildDeleteDirCmd Tests
+ * ***************/
+void Test_FM_ChildDeleteDirCmd_OSDirectoryOpenNoSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIR_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteDirCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OPENDIR_OS_ERR_EID);
+}
+
+void Test_FM_ChildDeleteDirCmd_OSDirectoryReadNoSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIR_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteDirCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_EID);
+}
+
+void Test_FM_ChildDeleteDirCmd_StrCmpThisDirectoryZero(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIR_CC};
+    os_dirent_t          direntry    = {.FileName = FM_THIS_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteDirCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_EID);
+}
+
+void Test_FM_ChildDeleteDirCmd_StrCmpParentDirectoryZero(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIR_CC};
+    os_dirent_t          direntry    = {.FileName = FM_PARENT_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteDirCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_EMPTY_ERR_EID);
+}
+
+void Test_FM_ChildDeleteDirCmd_RemoveTheDirIsTrueRmDirSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIR_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteDirCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_EID);
+}
+
+void Test_FM_ChildDeleteDirCmd_RemoveDirTrueOSRmDirNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIR_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_rmdir), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteDirCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_RMDIR_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildDirListFileCmd Tests
+ * ***************/
+void Test_FM_ChildDirListFileCmd_OSDirOpenNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_DIR_FILE_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSOPENDIR_ERR_EID);
+}
+
+void Test_FM_ChildDirListFileCmd_ChildDirListFileInitFalse(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_FILE_CC, .Source1 = "dummy_source1", .Target = "dummy_target"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSCREAT_ERR_EID);
+}
+
+void Test_FM_ChildDirListFileCmd_ChildDirListFileInitTrue(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_FILE_CC, .Source1 = "dummy_source1", .Target = "dummy_target"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_EID);
+}
+
+void Test_FM_ChildDirListFileCmd_Aborted(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_FILE_CC, .Source1 = "dummy_source1", .Target = "dummy_target"};
+    os_dirent_t direntry = {.FileName = "filename"};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    UT_FM_Child_Abort_Worker();
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+
+    // Assert - stops at the first entry and removes the partial output file
+    UT_FM_Child_Cmd_Assert(0, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UT_FM_Child_Abort_Assert();
+}
+
+/* ****************
+ * ChildDirListPktCmd Tests
+ * ***************/
+void Test_FM_ChildDirListPktCmd_OSDirOpenNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_PKT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_OS_ERR_EID);
+}
+
+void Test_FM_ChildDirListPktCmd_OSDirReadNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_PKT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_EID);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListPkt.PacketFiles, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_DirEntryNameThisDirectory(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_PKT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_EID);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListPkt.PacketFiles, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_DirEntryNameParentDirectory(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_PKT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_EID);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListPkt.PacketFiles, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_DirListOffsetNotExceeded(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_PKT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2", .DirListOffset = 1};
+    os_dirent_t direntry = {.FileName = "filename"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_EID);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListPkt.FirstFile, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListPkt.TotalFiles, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListPkt.PacketFiles, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_Aborted(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_PKT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry = {.FileName = "filename"};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    UT_FM_Child_Abort_Worker();
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    // Assert - stops at the first entry, no directory list packet is sent
+    UT_FM_Child_Cmd_Assert(0, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListPkt.TotalFiles, 0);
+    UT_FM_Child_Abort_Assert();
+}
+
+void Test_FM_ChildDirListPktCmd_DirListOffsetExceeded(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_PKT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    os_dirent_t direntry[FM_DIR_LIST_PKT_ENTRIES + 1];
+
+    /* Unit under test doesn't really care if the entry name is empty */
+    memset(direntry, 0, sizeof(direntry));
+
+    /* Will fill the entire packet and have one more */
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), sizeof(direntry) / sizeof(direntry[0]) + 1, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, sizeof(direntry) / sizeof(direntry[0]) + 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_EID);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListPkt.FirstFile, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListPkt.TotalFiles, sizeof(direntry) / sizeof(direntry[0]));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListPkt.PacketFiles, FM_DIR_LIST_PKT_ENTRIES);
+}
+
+void Test_FM_ChildDirListPktCmd_PathAndEntryLengthGreaterMaxPathLength(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_ALL_CC,
+                                        .Source1     = "dummy_source1",
+                                        .Source2 = "dummy_source2_has_a_long_name_to_make_path_length_longer_than_64"};
+    os_dirent_t          direntry    = {.FileName = "direntry_long"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_WARNING_EID);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListPkt.FirstFile, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListPkt.TotalFiles, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListPkt.PacketFiles, 0);
+}
+
+/* ****************
+ * ChildSetPermissionsCmd Tests
+ * ***************/
+void Test_FM_ChildSetPermissionsCmd_OSChmodSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_SET_FILE_PERM_CC};
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildSetPermissionsCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_chmod, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_CMD_EID);
+}
+
+void Test_FM_ChildSetPermissionsCmd_OSChmodNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_SET_FILE_PERM_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_chmod), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildSetPermissionsCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_chmod, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildCopyDirCmd Tests
+ * ***************/
+void Test_FM_ChildCopyDirCmd_EmptyDirectory(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_DIR_CC, .Source1 = "src", .Target = "tgt"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyDirCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
     UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_DIR_CMD_EID);
 }
 
-void Test_FM_ChildDeleteAllCmd_ClosedFilename_OSRmNotSuccess(void)
+void Test_FM_ChildCopyDirCmd_MkDirNotSuccess(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_DIR_CC, .Source1 = "src", .Target = "tgt"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyDirCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 0);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_DIR_OS_ERR_EID);
+}
+
+void Test_FM_ChildCopyDirCmd_DirOpenNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_DIR_CC, .Source1 = "src", .Target = "tgt"};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_DIRECTORY);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyDirCmd(&queue_entry));
+
+    // Assert - an existing target directory is reused
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_mkdir, 0);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_DIR_OS_ERR_EID);
+}
+
+void Test_FM_ChildCopyDirCmd_ClosedFile(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_DIR_CC, .Source1 = "src", .Target = "tgt"};
+    os_dirent_t          direntry    = {.FileName = "filename"};
 
     UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
     UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
-    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_NOT_IN_USE);
+    UT_SetDeferredRetcode(UT_KEY(FM_GetFilenameState), 2, FM_NAME_IS_FILE_CLOSED);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCopyDirCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 3);
+    UtAssert_STUB_COUNT(FM_CheckpointStart, 1);
+    UtAssert_STUB_COUNT(FM_CheckpointClear, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_remove, 0);
     UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_DIR_CMD_EID);
+}
+
+void Test_FM_ChildCopyDirCmd_CopyFileNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_DIR_CC, .Source1 = "src", .Target = "tgt"};
+    os_dirent_t          direntry    = {.FileName = "filename"};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_NOT_IN_USE);
+    UT_SetDeferredRetcode(UT_KEY(FM_GetFilenameState), 2, FM_NAME_IS_FILE_CLOSED);
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 2, !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyDirCmd(&queue_entry));
+
+    // Assert - stops at the first failure, without reading the next entry
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_DIR_OS_ERR_EID);
+}
+
+void Test_FM_ChildCopyDirCmd_OpenFileSkipped(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_DIR_CC, .Source1 = "src", .Target = "tgt"};
+    os_dirent_t          direntry    = {.FileName = "filename"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_NOT_IN_USE);
+    UT_SetDeferredRetcode(UT_KEY(FM_GetFilenameState), 2, FM_NAME_IS_FILE_OPEN);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyDirCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_DIR_CMD_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_COPY_DIR_SKIP_WARNING_EID);
 }
 
-void Test_FM_ChildDeleteAllCmd_ClosedFilename_OSrmSuccess(void)
+void Test_FM_ChildCopyDirCmd_Subdirectory(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_DIR_CC, .Source1 = "src", .Target = "tgt"};
+    os_dirent_t          direntry    = {.FileName = "subdir"};
 
+    /* The subdirectory is empty, then the source directory has no more entries */
     UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 1, !OS_SUCCESS);
     UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_NOT_IN_USE);
+    UT_SetDeferredRetcode(UT_KEY(FM_GetFilenameState), 2, FM_NAME_IS_DIRECTORY);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCopyDirCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRewind, 1);
+    UtAssert_STUB_COUNT(OS_mkdir, 2);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 2);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 3);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 2);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_DIR_CMD_EID);
 }
 
-void Test_FM_ChildDeleteAllCmd_FilenameStateDefaultReturn(void)
+void Test_FM_ChildCopyDirCmd_PathLengthGreaterMaxPathLen(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_DIR_CC, .Target = "tgt"};
+    os_dirent_t          direntry    = {.FileName = "filename"};
+
+    /* Source directory name plus separator fills the path buffer */
+    memset(queue_entry.Source1, 'a', OS_MAX_PATH_LEN - 2);
 
     UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
     UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), -1); // default case
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteAllCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCopyDirCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    // Assert - only the target directory state is queried
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
     UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_COPY_DIR_SKIP_WARNING_EID);
+}
+
+void Test_FM_ChildCopyDirCmd_Aborted(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_DIR_CC, .Source1 = "src", .Target = "tgt"};
+
+    UT_FM_Child_Abort_Worker();
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildCopyDirCmd(&queue_entry));
+
+    // Assert - the open source directory is closed before any entry is read
+    UT_FM_Child_Cmd_Assert(0, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UT_FM_Child_Abort_Assert();
 }
 
 /* ****************
- * ChildDecompressCmd Tests
+ * ChildDeleteTreeCmd Tests
  * ***************/
-#ifdef FM_INCLUDE_DECOMPRESS
-void Test_FM_ChildDecompressCmd_FSDecompressSuccess(void)
+void Test_FM_ChildDeleteTreeCmd_DirOpenNotSuccess(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DECOMPRESS_CC};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_TREE_CC, .Source1 = "dir"};
 
-    FM_GlobalData.ChildCurrentCC = 1;
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDecompressCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteTreeCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(FS_LIB_Decompress, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STUB_COUNT(OS_rmdir, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_TREE_OS_ERR_EID);
 }
 
-void Test_FM_ChildDecompressCmd_FSDecompressNotSuccess(void)
+void Test_FM_ChildDeleteTreeCmd_EmptyDirectory(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DECOMPRESS_CC};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_TREE_CC, .Source1 = "dir"};
 
-    FM_GlobalData.ChildCurrentCC = 1;
-    UT_SetDefaultReturnValue(UT_KEY(FS_LIB_Decompress), !CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDecompressCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteTreeCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(FS_LIB_Decompress, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_rmdir, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CFE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_TREE_CMD_EID);
 }
-#endif
 
-/* ****************
- * ChildConcatCmd Tests
- * ***************/
-void Test_FM_ChildConcatCmd_OSCpNotSuccess(void)
+void Test_FM_ChildDeleteTreeCmd_ClosedFile(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_TREE_CC, .Source1 = "dir"};
+    os_dirent_t          direntry    = {.FileName = "filename"};
 
-    FM_GlobalData.ChildCurrentCC = 1;
-    UT_SetDefaultReturnValue(UT_KEY(OS_cp), !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteTreeCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    // Assert - the file, then the emptied directory, are removed
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_cp, 1);
+    UtAssert_STUB_COUNT(FM_ThrottleStats, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_rmdir, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSCPY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_TREE_CMD_EID);
 }
 
-void Test_FM_ChildConcatCmd_OSOpenCreateSourceNotSuccess(void)
+void Test_FM_ChildDeleteTreeCmd_RemoveNotSuccess(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_TREE_CC, .Source1 = "dir"};
+    os_dirent_t          direntry    = {.FileName = "filename"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_rmdir), !OS_SUCCESS);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteTreeCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    // Assert - both the file and the directory holding it are skipped
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
 
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
     UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_rmdir, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_TREE_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_TREE_SKIP_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteTreeCmd_OpenFileSkipped(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_TREE_CC, .Source1 = "dir"};
+    os_dirent_t          direntry    = {.FileName = "filename"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_OPEN);
+    UT_SetDefaultReturnValue(UT_KEY(OS_rmdir), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteTreeCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_TREE_SKIP_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteTreeCmd_Subdirectory(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_TREE_CC, .Source1 = "dir"};
+    os_dirent_t          direntry    = {.FileName = "subdir"};
+
+    /* The subdirectory is empty, then the directory has no more entries */
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 1, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_DIRECTORY);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteTreeCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 2);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 3);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 2);
+    UtAssert_STUB_COUNT(OS_rmdir, 2);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OPEN_SRC2_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_TREE_CMD_EID);
 }
 
-void Test_FM_ChildConcatCmd_OSOpenCreateTargetNotSuccess(void)
+void Test_FM_ChildDeleteTreeCmd_Aborted(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_TREE_CC, .Source1 = "dir"};
 
-    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 2, !OS_SUCCESS);
+    UT_FM_Child_Abort_Worker();
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteTreeCmd(&queue_entry));
+
+    // Assert - the open directory is closed but not removed
+    UT_FM_Child_Cmd_Assert(0, 0, 1);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_rmdir, 0);
+    UT_FM_Child_Abort_Assert();
+}
+
+/* ****************
+ * ChildDeleteFilterCmd Tests
+ * ***************/
+void Test_FM_ChildDeleteFilterCmd_DirOpenNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILTER_CC, .Source1 = "dir", .Target = "*"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildDeleteFilterCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OPEN_TGT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_FILTER_OS_ERR_EID);
 }
 
-void Test_FM_ChildConcatCmd_OSReadBytesZero(void)
+void Test_FM_ChildDeleteFilterCmd_NameNotMatched(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILTER_CC, .Source1 = "dir", .Target = "*.tmp"};
+    os_dirent_t          direntry    = {.FileName = "file.dat"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteFilterCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    // Assert - names are matched before any file status is read
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(FM_ThrottleStats, 0);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
     UtAssert_STUB_COUNT(OS_remove, 0);
-    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_FILTER_CMD_EID);
 }
 
-void Test_FM_ChildConcatCmd_OSReadBytesLessThanZero(void)
+void Test_FM_ChildDeleteFilterCmd_NameMatched(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILTER_CC, .Source1 = "dir", .Target = "*.tmp"};
+    os_dirent_t          direntry    = {.FileName = "file.tmp"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteFilterCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    // Assert - without a range only the open file search reads file status
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_stat, 0);
+    UtAssert_STUB_COUNT(FM_ThrottleStats, 1);
     UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSRD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_FILTER_CMD_EID);
 }
 
-void Test_FM_ChildConcatCmd_BytesWrittenNotEqualBytesRead(void)
+void Test_FM_ChildDeleteFilterCmd_SizeOutsideRange(void)
 {
     // Arrange
     FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+        .CommandCode = FM_DELETE_FILTER_CC, .Source1 = "dir", .Target = "*", .MinSize = 10};
+    os_dirent_t direntry   = {.FileName = "filename"};
+    os_fstat_t  filestatus = {.FileSize = 5};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteFilterCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    // Assert - files outside the range are not searched for in the open file list
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(FM_ThrottleStats, 1);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSWR_ERR_EID);
 }
 
-void Test_FM_ChildConcatCmd_CopyInProgressTrueLoopCountEqualChildFileLoopCount(void)
+void Test_FM_ChildDeleteFilterCmd_AgeWithinRange(void)
 {
     // Arrange
     FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_CONCAT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+        .CommandCode = FM_DELETE_FILTER_CC, .Source1 = "dir", .Target = "*", .MinAge = 600, .MaxAge = 1000};
+    os_dirent_t direntry   = {.FileName = "filename"};
+    os_fstat_t  filestatus = {.FileTime = OS_TimeAssembleFromMilliseconds(100, 0)};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), 1);
-    UT_SetDeferredRetcode(UT_KEY(OS_read), FM_CHILD_FILE_LOOP_COUNT + 1, -1);
+    UT_FM_Child_Now = OS_TimeAssembleFromMilliseconds(1000, 0);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildConcatCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteFilterCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    // Assert - each file status query is paced by the stat throttle
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_read, FM_CHILD_FILE_LOOP_COUNT + 1);
-    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(FM_ThrottleStats, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
     UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_close, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSRD_ERR_EID);
 }
 
-/* ****************
- * ChildFileInfoCmd Tests
- * ***************/
-void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualIgnoreCRC(void)
+void Test_FM_ChildDeleteFilterCmd_AgeOutsideRange(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "dummy_source1",
-                                        .Source2       = "dummy_source2",
-                                        .FileInfoCRC   = FM_IGNORE_CRC,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_FILTER_CC, .Source1 = "dir", .Target = "*", .MaxAge = 600};
+    os_dirent_t direntry   = {.FileName = "filename"};
+    os_fstat_t  filestatus = {.FileTime = OS_TimeAssembleFromMilliseconds(100, 0)};
+
+    UT_FM_Child_Now = OS_TimeAssembleFromMilliseconds(1000, 0);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteFilterCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_EID);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoStateIsNotFileClosed(void)
+void Test_FM_ChildDeleteFilterCmd_StatNotSuccess(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "dummy_source1",
-                                        .Source2       = "dummy_source2",
-                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_8,
-                                        .FileInfoState = FM_NAME_IS_FILE_OPEN};
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_FILTER_CC, .Source1 = "dir", .Target = "*", .MaxSize = 100};
+    os_dirent_t direntry = {.FileName = "filename"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteFilterCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    // Assert - an entry removed since the directory was read is not a skip
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_STATE_WARNING_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission8(void)
+void Test_FM_ChildDeleteFilterCmd_OpenFileSkipped(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "dummy_source1",
-                                        .Source2       = "dummy_source2",
-                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_8,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILTER_CC, .Source1 = "dir", .Target = "*"};
+    os_dirent_t          direntry    = {.FileName = "filename"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_OPEN);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteFilterCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_FILTER_SKIP_WARNING_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission16(void)
+void Test_FM_ChildDeleteFilterCmd_DirectorySkipped(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "dummy_source1",
-                                        .Source2       = "dummy_source2",
-                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_16,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILTER_CC, .Source1 = "dir", .Target = "*"};
+    os_dirent_t          direntry    = {.FileName = "subdir"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_DIRECTORY);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteFilterCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(OS_rmdir, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_FILTER_SKIP_WARNING_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission32(void)
+void Test_FM_ChildDeleteFilterCmd_RemoveNotSuccess(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "dummy_source1",
-                                        .Source2       = "dummy_source2",
-                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_32,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILTER_CC, .Source1 = "dir", .Target = "*"};
+    os_dirent_t          direntry    = {.FileName = "filename"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteFilterCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_FILTER_SKIP_WARNING_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoCRCNotEqualToAnyMissionES(void)
+void Test_FM_ChildDeleteFilterCmd_Aborted(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "dummy_source1",
-                                        .Source2       = "dummy_source2",
-                                        .FileInfoCRC   = -1,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILTER_CC, .Source1 = "dir", .Target = "*"};
+
+    UT_FM_Child_Abort_Worker();
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteFilterCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 0, 1);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_TYPE_WARNING_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UT_FM_Child_Abort_Assert();
 }
 
-void Test_FM_ChildFileInfoCmd_OSOpenCreateTrueBytesReadZero(void)
+/* ****************
+ * ChildConcatListCmd Tests
+ * ***************/
+
+/* Each OS_read returns the next string of the script, then end of file */
+typedef struct
+{
+    const char *const *Text;
+    uint32             Count;
+    uint32             Index;
+} UT_FM_Child_ReadScript_t;
+
+void UT_Handler_OS_read_Script(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_FM_Child_ReadScript_t *Script = UserObj;
+    void *                    Buffer = UT_Hook_GetArgValueByName(Context, "buffer", void *);
+    size_t                    Size   = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+    int32                     Status = 0;
+
+    if (Script->Index < Script->Count)
+    {
+        Status = strlen(Script->Text[Script->Index]);
+        if ((size_t)Status > Size)
+        {
+            Status = Size;
+        }
+
+        memcpy(Buffer, Script->Text[Script->Index], Status);
+        Script->Index++;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, Status);
+}
+
+/* Check pass list read, check pass end of list, copy pass list read, empty sources and end of list */
+static const char *const UT_FM_Child_ListReads[] = {"src1\nsrc2\n", "", "src1\nsrc2\n", "", "", ""};
+
+void Test_FM_ChildConcatListCmd_ListOpenNotSuccess(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "dummy_source1",
-                                        .Source2       = "dummy_source2",
-                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_16,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "tgt"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(FM_CheckpointClear, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_ERR_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_BytesReadLessThanZero(void)
+void Test_FM_ChildConcatListCmd_ListEmpty(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "dummy_source1",
-                                        .Source2       = "dummy_source2",
-                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_16,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "tgt"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    // Assert - the target file is not created
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
     UtAssert_STUB_COUNT(OS_OpenCreate, 1);
     UtAssert_STUB_COUNT(OS_close, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_READ_WARNING_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_EID);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_ERR_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_BytesReadGreaterThanZero(void)
+void Test_FM_ChildConcatListCmd_SourceNotClosed(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "dummy_source1",
-                                        .Source2       = "dummy_source2",
-                                        .FileInfoCRC   = CFE_MISSION_ES_CRC_8,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    FM_ChildQueueEntry_t     queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "tgt"};
+    UT_FM_Child_ReadScript_t script      = {UT_FM_Child_ListReads, 6, 0};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
-    UT_SetDeferredRetcode(UT_KEY(OS_read), FM_CHILD_FILE_LOOP_COUNT + 1, 0);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0);
+    UT_SetHandlerFunction(UT_KEY(OS_read), UT_Handler_OS_read_Script, &script);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_OPEN);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    // Assert - every source is checked before the target file is created
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_read, FM_CHILD_FILE_LOOP_COUNT + 1);
-    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(FM_ThrottleStats, 1);
     UtAssert_STUB_COUNT(OS_OpenCreate, 1);
     UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_ERR_EID);
 }
 
-/* ****************
- * ChildCreateDirCmd Tests
- * ***************/
-void Test_FM_ChildCreateDirCmd_OSMkDirSuccess(void)
+void Test_FM_ChildConcatListCmd_SourceIsTarget(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CREATE_DIR_CC};
+    FM_ChildQueueEntry_t     queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "src2"};
+    UT_FM_Child_ReadScript_t script      = {UT_FM_Child_ListReads, 6, 0};
+
+    strncpy(FM_GlobalData.ChildWorker[0].Checkpoint.Target, "src2",
+            sizeof(FM_GlobalData.ChildWorker[0].Checkpoint.Target) - 1);
+
+    UT_SetHandlerFunction(UT_KEY(OS_read), UT_Handler_OS_read_Script, &script);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildCreateDirCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(FM_ThrottleStats, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_ERR_EID);
 }
 
-void Test_FM_ChildCreateDirCmd_OSMkDirNotSuccess(void)
+void Test_FM_ChildConcatListCmd_Success(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CREATE_DIR_CC};
+    FM_ChildQueueEntry_t     queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "tgt"};
+    UT_FM_Child_ReadScript_t script      = {UT_FM_Child_ListReads, 6, 0};
+    FM_ChildWorker_t *       Worker      = &FM_GlobalData.ChildWorker[0];
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), !CFE_SUCCESS);
+    UT_SetHandlerFunction(UT_KEY(OS_read), UT_Handler_OS_read_Script, &script);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildCreateDirCmd(&queue_entry));
-
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(&queue_entry));
+
+    // Assert - the list is read twice, each source is opened once with the target
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_UINT32_EQ(Worker->Checkpoint.Segment, 2);
+    UtAssert_STRINGBUF_EQ(Worker->Checkpoint.Source2, sizeof(Worker->Checkpoint.Source2), "src2", sizeof("src2"));
+    UtAssert_STUB_COUNT(OS_read, 6);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 6);
+    UtAssert_STUB_COUNT(OS_close, 6);
+    UtAssert_STUB_COUNT(FM_ThrottleStats, 2);
+    UtAssert_STUB_COUNT(FM_ThrottleStart, 2);
+    UtAssert_STUB_COUNT(OS_remove, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_CMD_EID);
 }
-
-/* ****************
- * ChildDeleteDirCmd Tests
- * ***************/
-void Test_FM_ChildDeleteDirCmd_OSDirectoryOpenNoSuccess(void)
+
+void Test_FM_ChildConcatListCmd_SourceOpenNotSuccess(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIR_CC};
+    FM_ChildQueueEntry_t     queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "tgt"};
+    UT_FM_Child_ReadScript_t script      = {UT_FM_Child_ListReads, 6, 0};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    UT_SetHandlerFunction(UT_KEY(OS_read), UT_Handler_OS_read_Script, &script);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 3, !OS_SUCCESS);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteDirCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    // Assert - the target file was not opened, so there is nothing to remove
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 3);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_remove, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OPENDIR_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_OS_ERR_EID);
 }
 
-void Test_FM_ChildDeleteDirCmd_OSDirectoryReadNoSuccess(void)
+void Test_FM_ChildConcatListCmd_ResumeEntry(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIR_CC};
+    FM_ChildQueueEntry_t     queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "tgt"};
+    UT_FM_Child_ReadScript_t script      = {UT_FM_Child_ListReads, 6, 0};
+    FM_ChildWorker_t *       Worker      = &FM_GlobalData.ChildWorker[0];
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    Worker->Checkpoint.Segment = 2;
+    strncpy(Worker->Checkpoint.Source2, "src2", sizeof(Worker->Checkpoint.Source2) - 1);
+
+    UT_SetHandlerFunction(UT_KEY(OS_read), UT_Handler_OS_read_Script, &script);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteDirCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    // Assert - the entry before the checkpoint entry is not appended again
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_EID);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 4);
+    UtAssert_STUB_COUNT(FM_ThrottleStart, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_CMD_EID);
 }
 
-void Test_FM_ChildDeleteDirCmd_StrCmpThisDirectoryZero(void)
+void Test_FM_ChildConcatListCmd_ResumeListModified(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIR_CC};
-    os_dirent_t          direntry    = {.FileName = FM_THIS_DIRECTORY};
+    FM_ChildQueueEntry_t     queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "tgt"};
+    UT_FM_Child_ReadScript_t script      = {UT_FM_Child_ListReads, 6, 0};
+    FM_ChildWorker_t *       Worker      = &FM_GlobalData.ChildWorker[0];
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    Worker->Checkpoint.Segment = 2;
+    strncpy(Worker->Checkpoint.Source2, "src3", sizeof(Worker->Checkpoint.Source2) - 1);
+
+    UT_SetHandlerFunction(UT_KEY(OS_read), UT_Handler_OS_read_Script, &script);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteDirCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_ERR_EID);
 }
 
-void Test_FM_ChildDeleteDirCmd_StrCmpParentDirectoryZero(void)
+void Test_FM_ChildConcatListCmd_Aborted(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIR_CC};
-    os_dirent_t          direntry    = {.FileName = FM_PARENT_DIRECTORY};
+    FM_ChildQueueEntry_t     queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "tgt"};
+    UT_FM_Child_ReadScript_t script      = {UT_FM_Child_ListReads, 6, 0};
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetHandlerFunction(UT_KEY(OS_read), UT_Handler_OS_read_Script, &script);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+
+    UT_FM_Child_Abort_Worker();
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteDirCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    // Assert - stops before the first source is appended
+    UT_FM_Child_Cmd_Assert(0, 0, 1);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 3);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_EMPTY_ERR_EID);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UT_FM_Child_Abort_Assert();
 }
 
-void Test_FM_ChildDeleteDirCmd_RemoveTheDirIsTrueRmDirSuccess(void)
+/* ****************
+ * ChildSplitCmd Tests
+ * ***************/
+
+/* Each OS_read fills the requested size, then end of file once the optional read count runs out */
+void UT_Handler_OS_read_Full(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *ReadsLeft = UserObj;
+    size_t  Size      = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+
+    if (ReadsLeft != NULL)
+    {
+        if (*ReadsLeft == 0)
+        {
+            Size = 0;
+        }
+        else
+        {
+            (*ReadsLeft)--;
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, (int32)Size);
+}
+
+/* Source file of 6 bytes split into a 4 byte segment and a 2 byte segment */
+static os_fstat_t UT_FM_Child_SplitStat = {.FileSize = 6};
+
+void UT_FM_Child_Split_Setup(void)
+{
+    UT_SetDataBuffer(UT_KEY(OS_stat), &UT_FM_Child_SplitStat, sizeof(UT_FM_Child_SplitStat), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_NOT_IN_USE);
+    UT_SetHandlerFunction(UT_KEY(OS_read), UT_Handler_OS_read_Full, NULL);
+}
+
+void Test_FM_ChildSplitCmd_StatNotSuccess(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIR_CC};
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_SPLIT_CC, .Source1 = "src", .Target = "tgt", .SegmentSize = 4};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteDirCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildSplitCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(FM_CheckpointClear, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SPLIT_OS_ERR_EID);
 }
 
-void Test_FM_ChildDeleteDirCmd_RemoveDirTrueOSRmDirNotSuccess(void)
+void Test_FM_ChildSplitCmd_SegmentExists(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIR_CC};
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_SPLIT_CC, .Source1 = "src", .Target = "tgt", .SegmentSize = 4};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
-    UT_SetDefaultReturnValue(UT_KEY(OS_rmdir), !OS_SUCCESS);
+    UT_FM_Child_Split_Setup();
+    UT_SetDeferredRetcode(UT_KEY(FM_GetFilenameState), 2, FM_NAME_IS_FILE_CLOSED);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDeleteDirCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildSplitCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    // Assert - every segment is checked before the source file is opened
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_RMDIR_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SPLIT_SEGMENT_ERR_EID);
 }
 
-/* ****************
- * ChildDirListFileCmd Tests
- * ***************/
-void Test_FM_ChildDirListFileCmd_OSDirOpenNotSuccess(void)
+void Test_FM_ChildSplitCmd_SourceOpenNotSuccess(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_DIR_FILE_CC};
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_SPLIT_CC, .Source1 = "src", .Target = "tgt", .SegmentSize = 4};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    UT_FM_Child_Split_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildSplitCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSOPENDIR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SPLIT_OS_ERR_EID);
 }
 
-void Test_FM_ChildDirListFileCmd_ChildDirListFileInitFalse(void)
+void Test_FM_ChildSplitCmd_ManifestWriteNotSuccess(void)
 {
     // Arrange
     FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_FILE_CC, .Source1 = "dummy_source1", .Target = "dummy_target"};
+        .CommandCode = FM_SPLIT_CC, .Source1 = "src", .Target = "tgt", .SegmentSize = 4};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    UT_FM_Child_Split_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t) - 1);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildSplitCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    // Assert - the manifest is removed, no segment was written
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_STUB_COUNT(OS_close, 0);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSCREAT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SPLIT_OS_ERR_EID);
 }
 
-void Test_FM_ChildDirListFileCmd_ChildDirListFileInitTrue(void)
+void Test_FM_ChildSplitCmd_Success(void)
 {
     // Arrange
     FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_FILE_CC, .Source1 = "dummy_source1", .Target = "dummy_target"};
+        .CommandCode = FM_SPLIT_CC, .Source1 = "src", .Target = "tgt", .SegmentSize = 4};
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    UT_FM_Child_Split_Setup();
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildSplitCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    // Assert - the source is read once, the manifest holds the stats and one entry per segment
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_UINT32_EQ(Worker->JobProgressPkt.BytesTotal, 6);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 4);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(FM_PipelineStart, 2);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 2);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+    UtAssert_STUB_COUNT(OS_write, 3);
+    UtAssert_STUB_COUNT(OS_close, 4);
+    UtAssert_STUB_COUNT(OS_remove, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SPLIT_CMD_EID);
 }
 
-/* ****************
- * ChildDirListPktCmd Tests
- * ***************/
-void Test_FM_ChildDirListPktCmd_OSDirOpenNotSuccess(void)
+void Test_FM_ChildSplitCmd_SegmentNotSuccess(void)
 {
     // Arrange
     FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_PKT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+        .CommandCode = FM_SPLIT_CC, .Source1 = "src", .Target = "tgt", .SegmentSize = 4};
+    uint32 ReadsLeft = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    UT_FM_Child_Split_Setup();
+    UT_SetHandlerFunction(UT_KEY(OS_read), UT_Handler_OS_read_Full, &ReadsLeft);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildSplitCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    // Assert - the partial segment, the complete segment and the manifest are removed
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 4);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_close, 4);
+    UtAssert_STUB_COUNT(OS_remove, 3);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SPLIT_OS_ERR_EID);
 }
 
-void Test_FM_ChildDirListPktCmd_OSDirReadNotSuccess(void)
+void Test_FM_ChildSplitCmd_Aborted(void)
 {
     // Arrange
     FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_PKT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
+        .CommandCode = FM_SPLIT_CC, .Source1 = "src", .Target = "tgt", .SegmentSize = 4};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    UT_FM_Child_Split_Setup();
+    UT_FM_Child_Abort_Worker();
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildSplitCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    // Assert - stops before the first segment is written
+    UT_FM_Child_Cmd_Assert(0, 0, 1);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_EID);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.PacketFiles, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UT_FM_Child_Abort_Assert();
 }
 
-void Test_FM_ChildDirListPktCmd_DirEntryNameThisDirectory(void)
+/* ****************
+ * ChildPreallocateCmd Tests
+ * ***************/
+void Test_FM_ChildPreallocateCmd_AlreadyAllocated(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_PKT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
-    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_PREALLOCATE_CC, .Source1 = "file", .FileSize = 4};
+    os_fstat_t           filestatus  = {.FileSize = 8};
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildPreallocateCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    // Assert - the file is never shortened
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(FM_CheckpointClear, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_EID);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.PacketFiles, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PREALLOCATE_CMD_EID);
 }
 
-void Test_FM_ChildDirListPktCmd_DirEntryNameParentDirectory(void)
+void Test_FM_ChildPreallocateCmd_OpenNotSuccess(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_PKT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
-    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_PREALLOCATE_CC, .Source1 = "file", .FileSize = 8};
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildPreallocateCmd(&queue_entry));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_PipelineStart, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(FM_CheckpointClear, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_EID);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.PacketFiles, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PREALLOCATE_OS_ERR_EID);
 }
 
-void Test_FM_ChildDirListPktCmd_DirListOffsetNotExceeded(void)
+void Test_FM_ChildPreallocateCmd_NewFile(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_PKT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2", .DirListOffset = 1};
-    os_dirent_t direntry = {.FileName = "filename"};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_PREALLOCATE_CC, .Source1 = "file", .FileSize = 6};
+    FM_ChildWorker_t *   Worker      = &FM_GlobalData.ChildWorker[0];
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildPreallocateCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    // Assert - the new file is created and written with zero blocks
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_UINT32_EQ(Worker->JobProgressPkt.BytesTotal, 6);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 1);
+    UtAssert_STUB_COUNT(FM_PipelineFinish, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_EID);
-
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.FirstFile, 1);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.TotalFiles, 1);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.PacketFiles, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PREALLOCATE_CMD_EID);
 }
 
-void Test_FM_ChildDirListPktCmd_DirListOffsetExceeded(void)
+void Test_FM_ChildPreallocateCmd_ExistingFile(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_PKT_CC, .Source1 = "dummy_source1", .Source2 = "dummy_source2"};
-    os_dirent_t direntry[FM_DIR_LIST_PKT_ENTRIES + 1];
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_PREALLOCATE_CC, .Source1 = "file", .FileSize = 10};
+    FM_ChildWorker_t *   Worker      = &FM_GlobalData.ChildWorker[0];
+    os_fstat_t           filestatus  = {.FileSize = 4};
 
-    /* Unit under test doesn't really care if the entry name is empty */
-    memset(direntry, 0, sizeof(direntry));
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), 4);
 
-    /* Will fill the entire packet and have one more */
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), sizeof(direntry) / sizeof(direntry[0]) + 1, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    // Act
+    UtAssert_VOIDCALL(FM_ChildPreallocateCmd(&queue_entry));
+
+    // Assert - only the bytes after the existing file data are written
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
+
+    UtAssert_UINT32_EQ(Worker->JobProgressPkt.BytesTotal, 6);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PREALLOCATE_CMD_EID);
+}
+
+void Test_FM_ChildPreallocateCmd_WriteNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_PREALLOCATE_CC, .Source1 = "file", .FileSize = 6};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_PipelineFinish), false);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildPreallocateCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    // Assert - the file is closed, the blocks already written are left in place
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, sizeof(direntry) / sizeof(direntry[0]) + 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_EID);
-
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.FirstFile, 0);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.TotalFiles, sizeof(direntry) / sizeof(direntry[0]));
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.PacketFiles, FM_DIR_LIST_PKT_ENTRIES);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PREALLOCATE_OS_ERR_EID);
 }
 
-void Test_FM_ChildDirListPktCmd_PathAndEntryLengthGreaterMaxPathLength(void)
+void Test_FM_ChildPreallocateCmd_Aborted(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_ALL_CC,
-                                        .Source1     = "dummy_source1",
-                                        .Source2 = "dummy_source2_has_a_long_name_to_make_path_length_longer_than_64"};
-    os_dirent_t          direntry    = {.FileName = "direntry_long"};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_PREALLOCATE_CC, .Source1 = "file", .FileSize = 6};
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    FM_GlobalData.ChildWorker[0].BlockSize = 2;
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
+
+    UT_FM_Child_Abort_Worker();
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildPreallocateCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    // Assert - stops after the first block
+    UT_FM_Child_Cmd_Assert(0, 0, 1);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_WARNING_EID);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UT_FM_Child_Abort_Assert();
+}
+
+/* ****************
+ * ChildTruncateCmd Tests
+ * ***************/
+void Test_FM_ChildTruncateCmd_StatNotSuccess(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_TRUNCATE_CC, .Source1 = "file", .FileSize = 4};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildTruncateCmd(&queue_entry));
+
+    // Assert
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.FirstFile, 0);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.TotalFiles, 1);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.PacketFiles, 0);
+    UtAssert_STUB_COUNT(OS_TranslatePath, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_TRUNCATE_OS_ERR_EID);
 }
 
-/* ****************
- * ChildSetPermissionsCmd Tests
- * ***************/
-void Test_FM_ChildSetPermissionsCmd_OSChmodSuccess(void)
+void Test_FM_ChildTruncateCmd_SizeTooLarge(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_SET_FILE_PERM_CC};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_TRUNCATE_CC, .Source1 = "file", .FileSize = 8};
+    os_fstat_t           filestatus  = {.FileSize = 4};
+
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildSetPermissionsCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildTruncateCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    // Assert - the file is not extended
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_chmod, 1);
+    UtAssert_STUB_COUNT(OS_TranslatePath, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_TRUNCATE_SIZE_ERR_EID);
 }
 
-void Test_FM_ChildSetPermissionsCmd_OSChmodNotSuccess(void)
+void Test_FM_ChildTruncateCmd_TruncateNotSuccess(void)
 {
     // Arrange
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_SET_FILE_PERM_CC};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_TRUNCATE_CC, .Source1 = "file", .FileSize = 4};
+    os_fstat_t           filestatus  = {.FileSize = 8};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_chmod), !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), OS_ERROR);
 
     // Act
-    UtAssert_VOIDCALL(FM_ChildSetPermissionsCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildTruncateCmd(&queue_entry));
 
-    // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    // Assert - without the file allocate backend the command always fails
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_chmod, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_TRUNCATE_OS_ERR_EID);
 }
 
 /* ****************
@@ -1813,7 +4598,7 @@ void Test_FM_ChildDirListFileInit_OSOpenCreateFail(void)
     UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(&fileid, directory, filename));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
     UtAssert_STUB_COUNT(OS_OpenCreate, 1);
     UtAssert_STUB_COUNT(OS_close, 0);
@@ -1838,7 +4623,7 @@ void Test_FM_ChildDirListFileInit_FSWriteHeaderNotSameSizeFSHeadert(void)
     UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(&fileid, directory, filename));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
     UtAssert_STUB_COUNT(OS_OpenCreate, 1);
     UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
@@ -1863,7 +4648,7 @@ void Test_FM_ChildDirListFileInit_OSWriteNotSameSizeDirListFileStatst(void)
     UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(&fileid, directory, filename));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
     UtAssert_STUB_COUNT(OS_OpenCreate, 1);
     UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
@@ -1885,7 +4670,7 @@ void Test_FM_ChildDirListFileInit_OSWriteSameSizeDirListFileStatst(void)
     UtAssert_BOOL_TRUE(FM_ChildDirListFileInit(&fileid, directory, filename));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 0, 0, 0);
+    UT_FM_Child_Cmd_Assert(0, 0, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
     UtAssert_STUB_COUNT(OS_OpenCreate, 1);
@@ -1906,7 +4691,7 @@ void Test_FM_ChildDirListFileLoop_OSDirReadNotSuccess(void)
     UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
     UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
     UtAssert_STUB_COUNT(OS_write, 0);
@@ -1915,8 +4700,8 @@ void Test_FM_ChildDirListFileLoop_OSDirReadNotSuccess(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_EID);
 
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 0);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListFileStats.DirEntries, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListFileStats.FileEntries, 0);
 }
 
 void Test_FM_ChildDirListFileLoop_OSDirEntryNameIsThisDirectory(void)
@@ -1931,7 +4716,7 @@ void Test_FM_ChildDirListFileLoop_OSDirEntryNameIsThisDirectory(void)
     UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
     UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
     UtAssert_STUB_COUNT(OS_write, 0);
@@ -1940,8 +4725,8 @@ void Test_FM_ChildDirListFileLoop_OSDirEntryNameIsThisDirectory(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_EID);
 
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 0);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListFileStats.DirEntries, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].DirListFileStats.FileEntries, 0);
 }
 
 void Test_FM_ChildDirListFileLoop_OSDirEntryNameIsParentDirectory(void)
@@ -1956,7 +4741,7 @@ void Test_FM_ChildDirListFileLoop_OSDirEntryNameIsParentDirectory(void)
     UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
     UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
     UtAssert_STUB_COUNT(OS_write, 0);
@@ -1982,7 +4767,7 @@ void Test_FM_ChildDirListFileLoop_PathLengthAndEntryLengthGreaterMaxPathLen(void
     UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", dirwithsep, "fname", false));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, 0);
+    UT_FM_Child_Cmd_Assert(1, 0, 1);
 
     UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
     UtAssert_STUB_COUNT(OS_write, 1);
@@ -1993,8 +4778,8 @@ void Test_FM_ChildDirListFileLoop_PathLengthAndEntryLengthGreaterMaxPathLen(void
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_DIR_FILE_CMD_EID);
 
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 1);
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].DirListFileStats.DirEntries, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].DirListFileStats.FileEntries, 0);
 }
 
 void Test_FM_ChildDirListFileLoop_FileEntriesGreaterFMDirListFileEntries(void)
@@ -2009,7 +4794,7 @@ void Test_FM_ChildDirListFileLoop_FileEntriesGreaterFMDirListFileEntries(void)
     UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+    UT_FM_Child_Cmd_Assert(1, 0, 0);
 
     UtAssert_STUB_COUNT(OS_DirectoryRead, entrycnt + 1);
     UtAssert_STUB_COUNT(OS_write, FM_DIR_LIST_FILE_ENTRIES + 1);
@@ -2018,8 +4803,8 @@ void Test_FM_ChildDirListFileLoop_FileEntriesGreaterFMDirListFileEntries(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_EID);
 
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, entrycnt);
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, FM_DIR_LIST_FILE_ENTRIES);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].DirListFileStats.DirEntries, entrycnt);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].DirListFileStats.FileEntries, FM_DIR_LIST_FILE_ENTRIES);
 }
 
 void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLength(void)
@@ -2035,7 +4820,7 @@ void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLength(void)
     UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
     UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
     UtAssert_STUB_COUNT(OS_write, 2);
@@ -2044,8 +4829,8 @@ void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLength(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_UPSTATS_ERR_EID);
 
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 1);
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].DirListFileStats.DirEntries, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].DirListFileStats.FileEntries, 1);
 }
 
 void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop(void)
@@ -2061,7 +4846,7 @@ void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop(void)
     UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
 
     // Assert
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+    UT_FM_Child_Cmd_Assert(0, 1, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
@@ -2070,8 +4855,8 @@ void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WRENTRY_ERR_EID);
 
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].DirListFileStats.DirEntries, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[0].DirListFileStats.FileEntries, 0);
 }
 
 /* ****************
@@ -2096,498 +4881,1307 @@ void Test_FM_ChildSizeTimeMode_OsStatNoSuccess(void)
     UtAssert_UINT32_EQ(filemode, 0);
 }
 
-void Test_FM_ChildSizeTimeMode_OSFilestateTimeDefined(void)
+void Test_FM_ChildSizeTimeMode_OSFilestateTimeDefined(void)
+{
+    // Arrange
+    uint32 filesize = 0;
+    uint32 filetime = 0;
+    uint32 filemode = 0;
+
+    OS_time_t  ostime     = {.ticks = 1};
+    os_fstat_t filestatus = {.FileModeBits = 2, .FileTime = ostime, .FileSize = 3};
+
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
+
+    // Act
+    UtAssert_INT32_EQ(FM_ChildSizeTimeMode("fname", &filesize, &filetime, &filemode), OS_SUCCESS);
+
+    // Assert
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_UINT32_EQ(filetime, OS_FILESTAT_TIME(filestatus));
+    UtAssert_UINT32_EQ(filesize, OS_FILESTAT_SIZE(filestatus));
+    UtAssert_UINT32_EQ(filemode, OS_FILESTAT_MODE(filestatus));
+}
+
+void Test_FM_ChildAllocatedSize_NotAvailable(void)
+{
+    // Arrange
+    UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), OS_ERROR);
+
+    // Act / Assert
+    UtAssert_UINT32_EQ(FM_ChildAllocatedSize("fname"), FM_FILE_SIZE_UNKNOWN);
+}
+
+/* ****************
+ * ChildLoop Tests
+ * ***************/
+void Test_FM_ChildLoop_CountSemTakeNotSuccess(void)
+{
+    // Arrange
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), !CFE_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildLoop());
+
+    // Assert
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_SEM_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 0);
+}
+
+void Test_FM_ChildLoop_ChildQCountEqualZero(void)
+{
+    // Act
+    UtAssert_VOIDCALL(FM_ChildLoop());
+
+    // Assert
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_EMPTYQ_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+}
+
+void Test_FM_ChildLoop_LanesEmpty(void)
+{
+    // Arrange
+    FM_GlobalData.ChildQueueCount = 1;
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildLoop());
+
+    // Assert
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_EMPTYQ_ERR_EID);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+}
+
+void Test_FM_ChildLoop_PendingCommand(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t pending_entry = {.CommandCode = FM_RENAME_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingCount), 1);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueLaneIsValid), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingPop), true);
+    UT_SetDataBuffer(UT_KEY(FM_QueuePendingPop), &pending_entry, sizeof(pending_entry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, !CFE_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildLoop());
+
+    // Assert - queue is empty but the pending commands file is not
+    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_CHILD_TERM_SEM_ERR_EID);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 0);
+}
+
+void Test_FM_ChildLoop_LaneNotValid(void)
+{
+    // Arrange
+    FM_GlobalData.ChildQueueCount = 1;
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueLaneCount), 1);
+    UT_SetDeferredRetcode(UT_KEY(FM_QueueLaneIsValid), 1, true);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildLoop());
+
+    // Assert
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_QIDX_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+}
+
+void Test_FM_ChildLoop_CountSemTakeSuccessDefault(void)
+{
+    // Arrange
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = -1};
+
+    UT_FM_Child_Queue[0] = queue_entry;
+    UT_FM_Child_Queue_Entry(0);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, !CFE_SUCCESS);
+
+    // Act
+    UtAssert_VOIDCALL(FM_ChildLoop());
+
+    // Assert
+    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_CHILD_TERM_SEM_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+}
+
+/* ****************
+ * ChildSleepStat Tests
+ * ***************/
+
+void Test_FM_ChildSleepStat_getSizeTimeModeFalse(void)
+{
+    // Arrange
+    FM_DirListEntry_t DirListData = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
+
+    // Assert
+    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, false));
+    UtAssert_INT32_EQ(DirListData.EntrySize, 0);
+    UtAssert_INT32_EQ(DirListData.ModifyTime, 0);
+    UtAssert_INT32_EQ(DirListData.Mode, 0);
+    UtAssert_STUB_COUNT(FM_ThrottleStats, 0);
+    UtAssert_STUB_COUNT(OS_stat, 0);
+}
+
+void Test_FM_ChildSleepStat_getSizeTimeModeTrue(void)
+{
+    // Arrange
+    FM_DirListEntry_t DirListData = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
+
+    // Assert - each OS_stat call is paced by the stat throttle
+    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, true));
+    UtAssert_STUB_COUNT(FM_ThrottleStats, 1);
+    UtAssert_STUB_COUNT(OS_stat, 1);
+}
+
+void Test_FM_ChildPatternMatch_Literal(void)
+{
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("file.dat", "file.dat"));
+    UtAssert_BOOL_FALSE(FM_ChildPatternMatch("file.dat", "file.da"));
+    UtAssert_BOOL_FALSE(FM_ChildPatternMatch("file.da", "file.dat"));
+    UtAssert_BOOL_FALSE(FM_ChildPatternMatch("File.dat", "file.dat"));
+}
+
+void Test_FM_ChildPatternMatch_Wildcards(void)
+{
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("*", "file.dat"));
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("*.tmp", "file.tmp"));
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("*.tmp", ".tmp"));
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("*.tmp", "a.tmp.tmp"));
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("log_??.*", "log_01.txt"));
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("a*b*c", "aXbYbZc"));
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("file**", "file"));
+}
+
+void Test_FM_ChildPatternMatch_NoMatch(void)
+{
+    UtAssert_BOOL_FALSE(FM_ChildPatternMatch("*.tmp", "file.tmp1"));
+    UtAssert_BOOL_FALSE(FM_ChildPatternMatch("log_??.*", "log_1.txt"));
+    UtAssert_BOOL_FALSE(FM_ChildPatternMatch("a*b*c", "aXbYbZ"));
+    UtAssert_BOOL_FALSE(FM_ChildPatternMatch("?", ""));
+}
+
+void Test_FM_ChildListNext_Lines(void)
+{
+    FM_ChildListFile_t ListFile;
+    char               Name[OS_MAX_PATH_LEN];
+    const char *       Text = "a\r\n\nbb\nccc";
+
+    UT_SetDataBuffer(UT_KEY(OS_read), (void *)Text, strlen(Text), false);
+
+    UtAssert_INT32_EQ(FM_ChildListOpen(&ListFile, "list"), OS_SUCCESS);
+
+    /* Empty lines are skipped, the last line need not end with a newline */
+    UtAssert_INT32_EQ(FM_ChildListNext(&ListFile, Name), 1);
+    UtAssert_STRINGBUF_EQ(Name, sizeof(Name), "a", sizeof("a"));
+    UtAssert_INT32_EQ(FM_ChildListNext(&ListFile, Name), 2);
+    UtAssert_STRINGBUF_EQ(Name, sizeof(Name), "bb", sizeof("bb"));
+    UtAssert_INT32_EQ(FM_ChildListNext(&ListFile, Name), 3);
+    UtAssert_STRINGBUF_EQ(Name, sizeof(Name), "ccc", sizeof("ccc"));
+    UtAssert_INT32_EQ(FM_ChildListNext(&ListFile, Name), 0);
+    UtAssert_INT32_EQ(FM_ChildListNext(&ListFile, Name), 0);
+
+    UtAssert_UINT32_EQ(ListFile.Line, 4);
+    UtAssert_STUB_COUNT(OS_read, 2);
+}
+
+void Test_FM_ChildListNext_LineTooLong(void)
+{
+    FM_ChildListFile_t ListFile;
+    char               Name[OS_MAX_PATH_LEN];
+    char               Text[OS_MAX_PATH_LEN];
+
+    memset(Text, 'x', sizeof(Text));
+
+    UT_SetDataBuffer(UT_KEY(OS_read), Text, sizeof(Text), false);
+
+    UtAssert_INT32_EQ(FM_ChildListOpen(&ListFile, "list"), OS_SUCCESS);
+    UtAssert_INT32_EQ(FM_ChildListNext(&ListFile, Name), OS_FS_ERR_PATH_TOO_LONG);
+}
+
+void Test_FM_ChildListNext_ReadNotSuccess(void)
+{
+    FM_ChildListFile_t ListFile;
+    char               Name[OS_MAX_PATH_LEN];
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), OS_ERROR);
+
+    UtAssert_INT32_EQ(FM_ChildListOpen(&ListFile, "list"), OS_SUCCESS);
+    UtAssert_INT32_EQ(FM_ChildListNext(&ListFile, Name), OS_ERROR);
+}
+
+/* ****************
+ * ChildSplit Utility Tests
+ * ***************/
+void Test_FM_ChildSplitCheck_Count(void)
+{
+    uint32 SegmentCount = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_NOT_IN_USE);
+
+    // Last segment holds the remainder
+    UtAssert_BOOL_TRUE(FM_ChildSplitCheck("Split File", "tgt", 9, 4, &SegmentCount));
+    UtAssert_UINT32_EQ(SegmentCount, 3);
+
+    UtAssert_BOOL_TRUE(FM_ChildSplitCheck("Split File", "tgt", 8, 4, &SegmentCount));
+    UtAssert_UINT32_EQ(SegmentCount, 2);
+
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 5);
+    UtAssert_STUB_COUNT(FM_ThrottleStats, 5);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_ChildSplitCheck_InvalidCount(void)
+{
+    uint32 SegmentCount = 0;
+
+    // Zero segment size, empty source file and too many segments
+    UtAssert_BOOL_FALSE(FM_ChildSplitCheck("Split File", "tgt", 8, 0, &SegmentCount));
+    UtAssert_BOOL_FALSE(FM_ChildSplitCheck("Split File", "tgt", 0, 4, &SegmentCount));
+    UtAssert_BOOL_FALSE(FM_ChildSplitCheck("Split File", "tgt", FM_CHILD_SPLIT_MAX_SEGMENTS + 1, 1, &SegmentCount));
+
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SPLIT_SEGMENT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_SPLIT_SEGMENT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, FM_SPLIT_SEGMENT_ERR_EID);
+}
+
+void Test_FM_ChildSplitCheck_NameTooLong(void)
+{
+    char   Target[OS_MAX_PATH_LEN];
+    uint32 SegmentCount = 0;
+
+    memset(Target, 'a', sizeof(Target) - 1);
+    Target[sizeof(Target) - 4] = '\0';
+
+    UtAssert_BOOL_FALSE(FM_ChildSplitCheck("Split File", Target, 8, 4, &SegmentCount));
+
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SPLIT_SEGMENT_ERR_EID);
+}
+
+void Test_FM_ChildSplitSegment_Success(void)
+{
+    FM_ChildWorker_t *      Worker = &FM_GlobalData.ChildWorker[0];
+    FM_SplitManifestEntry_t Entry  = {.Offset = 4, .Size = 2};
+
+    // Pipeline start is stubbed, so set the CRC the pipeline would have computed
+    Worker->Pipeline.CRC = 0x55;
+    UT_SetHandlerFunction(UT_KEY(OS_read), UT_Handler_OS_read_Full, NULL);
+
+    UtAssert_BOOL_TRUE(FM_ChildSplitSegment(Worker, "Split File", FM_UT_OBJID_1, "tgt.001", &Entry));
+
+    UtAssert_UINT32_EQ(Entry.CRC, 0x55);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 1);
+    UtAssert_STUB_COUNT(FM_PipelineFinish, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_ChildSplitSegment_Blocks(void)
+{
+    FM_ChildWorker_t *      Worker = &FM_GlobalData.ChildWorker[0];
+    FM_SplitManifestEntry_t Entry  = {.Offset = 0, .Size = 5};
+
+    // A block never crosses the end of the segment
+    Worker->BlockSize = 2;
+    UT_SetHandlerFunction(UT_KEY(OS_read), UT_Handler_OS_read_Full, NULL);
+
+    UtAssert_BOOL_TRUE(FM_ChildSplitSegment(Worker, "Split File", FM_UT_OBJID_1, "tgt.000", &Entry));
+
+    UtAssert_STUB_COUNT(OS_read, 3);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 3);
+    UtAssert_STUB_COUNT(FM_ThrottleBytes, 2);
+}
+
+void Test_FM_ChildSplitSegment_OpenNotSuccess(void)
+{
+    FM_ChildWorker_t *      Worker = &FM_GlobalData.ChildWorker[0];
+    FM_SplitManifestEntry_t Entry  = {.Offset = 0, .Size = 4};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    UtAssert_BOOL_FALSE(FM_ChildSplitSegment(Worker, "Split File", FM_UT_OBJID_1, "tgt.000", &Entry));
+
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SPLIT_OS_ERR_EID);
+}
+
+void Test_FM_ChildSplitSegment_ReadNotSuccess(void)
+{
+    FM_ChildWorker_t *      Worker = &FM_GlobalData.ChildWorker[0];
+    FM_SplitManifestEntry_t Entry  = {.Offset = 0, .Size = 4};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    UtAssert_BOOL_FALSE(FM_ChildSplitSegment(Worker, "Split File", FM_UT_OBJID_1, "tgt.000", &Entry));
+
+    // Partial segment file is removed
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SPLIT_OS_ERR_EID);
+}
+
+void Test_FM_ChildSplitSegment_FinishNotSuccess(void)
+{
+    FM_ChildWorker_t *      Worker = &FM_GlobalData.ChildWorker[0];
+    FM_SplitManifestEntry_t Entry  = {.Offset = 0, .Size = 4};
+
+    UT_SetHandlerFunction(UT_KEY(OS_read), UT_Handler_OS_read_Full, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(FM_PipelineFinish), false);
+
+    UtAssert_BOOL_FALSE(FM_ChildSplitSegment(Worker, "Split File", FM_UT_OBJID_1, "tgt.000", &Entry));
+
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SPLIT_OS_ERR_EID);
+}
+
+void Test_FM_ChildSplitName(void)
 {
-    // Arrange
-    uint32 filesize = 0;
-    uint32 filetime = 0;
-    uint32 filemode = 0;
+    char Name[OS_MAX_PATH_LEN];
+    char Target[OS_MAX_PATH_LEN];
 
-    OS_time_t  ostime     = {.ticks = 1};
-    os_fstat_t filestatus = {.FileModeBits = 2, .FileTime = ostime, .FileSize = 3};
+    UtAssert_BOOL_TRUE(FM_ChildSplitName(Name, "tgt", 7));
+    UtAssert_STRINGBUF_EQ(Name, sizeof(Name), "tgt.007", sizeof("tgt.007"));
 
-    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
+    UtAssert_BOOL_TRUE(FM_ChildSplitName(Name, "tgt", 1234));
+    UtAssert_STRINGBUF_EQ(Name, sizeof(Name), "tgt.1234", sizeof("tgt.1234"));
 
-    // Act
-    UtAssert_INT32_EQ(FM_ChildSizeTimeMode("fname", &filesize, &filetime, &filemode), OS_SUCCESS);
+    // Name must fit with its terminator
+    memset(Target, 'a', sizeof(Target) - 1);
+    Target[sizeof(Target) - 5] = '\0';
+    UtAssert_BOOL_TRUE(FM_ChildSplitName(Name, Target, 0));
 
-    // Assert
-    UtAssert_STUB_COUNT(OS_stat, 1);
-    UtAssert_UINT32_EQ(filetime, OS_FILESTAT_TIME(filestatus));
-    UtAssert_UINT32_EQ(filesize, OS_FILESTAT_SIZE(filestatus));
-    UtAssert_UINT32_EQ(filemode, OS_FILESTAT_MODE(filestatus));
+    Target[sizeof(Target) - 5] = 'a';
+    Target[sizeof(Target) - 4] = '\0';
+    UtAssert_BOOL_FALSE(FM_ChildSplitName(Name, Target, 0));
 }
 
 /* ****************
- * ChildLoop Tests
+ * ChildPreallocateWrite Tests
  * ***************/
-void Test_FM_ChildLoop_CountSemTakeNotSuccess(void)
+void Test_FM_ChildPreallocateWrite_Blocks(void)
 {
-    // Arrange
-    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), !CFE_SUCCESS);
-
-    // Act
-    UtAssert_VOIDCALL(FM_ChildLoop());
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
 
-    // Assert
-    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_SEM_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 0);
-}
+    // A block never crosses the commanded size
+    Worker->BlockSize = 4;
 
-void Test_FM_ChildLoop_ChildQCountEqualZero(void)
-{
-    // Act
-    UtAssert_VOIDCALL(FM_ChildLoop());
+    UtAssert_BOOL_TRUE(FM_ChildPreallocateWrite(Worker, "Preallocate File", FM_UT_OBJID_1, "file", 0, 10));
 
-    // Assert
-    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_EMPTYQ_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+    UtAssert_STUB_COUNT(FM_PipelineStart, 1);
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 3);
+    UtAssert_STUB_COUNT(FM_ThrottleBytes, 2);
+    UtAssert_STUB_COUNT(FM_PipelineFinish, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_FM_ChildLoop_ChildReadIndexEqualChildQDepth(void)
+void Test_FM_ChildPreallocateWrite_SeekNotSuccess(void)
 {
-    // Arrange
-    FM_GlobalData.ChildQueueCount = 1;
-    FM_GlobalData.ChildReadIndex  = FM_CHILD_QUEUE_DEPTH;
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
 
-    // Act
-    UtAssert_VOIDCALL(FM_ChildLoop());
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERROR);
 
-    // Assert
-    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_BOOL_FALSE(FM_ChildPreallocateWrite(Worker, "Preallocate File", FM_UT_OBJID_1, "file", 4, 10));
+
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 0);
+    UtAssert_STUB_COUNT(FM_PipelineFinish, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_QIDX_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PREALLOCATE_OS_ERR_EID);
 }
 
-void Test_FM_ChildLoop_CountSemTakeSuccessDefault(void)
+void Test_FM_ChildPreallocateWrite_SubmitNotSuccess(void)
 {
-    // Arrange
-    FM_GlobalData.ChildQueueCount    = 1;
-    FM_GlobalData.ChildReadIndex     = 0;
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = -1};
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
 
-    FM_GlobalData.ChildQueue[0] = queue_entry;
-    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, !CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_PipelineSubmit), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_PipelineFinish), false);
 
-    // Act
-    UtAssert_VOIDCALL(FM_ChildLoop());
+    UtAssert_BOOL_FALSE(FM_ChildPreallocateWrite(Worker, "Preallocate File", FM_UT_OBJID_1, "file", 0, 10));
 
-    // Assert
-    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_CHILD_TERM_SEM_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+    // Reported once, when the pipeline finishes
+    UtAssert_STUB_COUNT(FM_PipelineSubmit, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PREALLOCATE_OS_ERR_EID);
 }
 
 /* ****************
- * ChildSleepStat Tests
+ * ChildTruncateFile Tests
  * ***************/
-
-void Test_FM_ChildSleepStat_getSizeTimeModeFalse(void)
+void Test_FM_ChildTruncateFile(void)
 {
-    // Arrange
-    FM_DirListEntry_t DirListData    = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
-    int32             FilesTillSleep = 1;
+#ifdef FM_INCLUDE_FILE_TRUNCATE
+    UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), OS_ERROR);
 
-    // Assert
-    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, &FilesTillSleep, false));
-    UtAssert_INT32_EQ(DirListData.EntrySize, 0);
-    UtAssert_INT32_EQ(DirListData.ModifyTime, 0);
-    UtAssert_INT32_EQ(DirListData.Mode, 0);
+    UtAssert_INT32_EQ(FM_ChildTruncateFile("/cf/file", 0), OS_ERROR);
+#else
+    UtAssert_INT32_EQ(FM_ChildTruncateFile("/cf/file", 0), OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_STUB_COUNT(OS_TranslatePath, 0);
+#endif
 }
 
-void Test_FM_ChildSleepStat_FilesTillSleepPositive(void)
+/* ****************
+ * ChildLinkFile Tests
+ * ***************/
+void Test_FM_ChildLinkFile(void)
 {
-    // Arrange
-    FM_DirListEntry_t DirListData           = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
-    int32             FilesTillSleep        = FM_CHILD_STAT_SLEEP_FILECOUNT + 1;
-    int32             FilesTillSleep_before = FilesTillSleep;
+#ifdef FM_INCLUDE_FILE_LINK
+    UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), OS_ERROR);
 
-    // Assert
-    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, &FilesTillSleep, true));
-    UtAssert_INT32_EQ(FilesTillSleep, FilesTillSleep_before - 1);
+    UtAssert_INT32_EQ(FM_ChildLinkFile("/cf/src", "/cf/tgt", FM_COPY_LINK_HARD), OS_ERROR);
+    UtAssert_INT32_EQ(FM_ChildLinkFile("/cf/src", "/cf/tgt", FM_COPY_LINK_CLONE), OS_ERROR);
+
+    /* A target that is the source file is left as is, the local path stub returns the path unchanged */
+    UT_ResetState(UT_KEY(OS_TranslatePath));
+
+    UtAssert_INT32_EQ(FM_ChildLinkFile("/dev/null", "/dev/null", FM_COPY_LINK_HARD), OS_SUCCESS);
+    UtAssert_INT32_EQ(FM_ChildLinkFile("/dev/null", "/dev/null", FM_COPY_LINK_CLONE), OS_SUCCESS);
+#else
+    UtAssert_INT32_EQ(FM_ChildLinkFile("/cf/src", "/cf/tgt", FM_COPY_LINK_HARD), OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_STUB_COUNT(OS_TranslatePath, 0);
+#endif
 }
 
-void Test_FM_ChildSleepStat_FilesTillSleepLTEQZero(void)
+#ifdef FM_INCLUDE_FILE_ALLOCATE
+
+/* ****************
+ * ChildFileAllocate Tests
+ * ***************/
+void Test_FM_ChildFileAllocate_NotAvailable(void)
 {
+    FM_ChildWorker_t *Worker         = &FM_GlobalData.ChildWorker[0];
+    bool              AllocateResult = false;
+
     // Arrange
-    FM_DirListEntry_t DirListData    = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
-    int32             FilesTillSleep = 0;
+    UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), OS_ERROR);
 
-    // Assert
-    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, &FilesTillSleep, true));
-    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
-    UtAssert_INT32_EQ(FilesTillSleep, FM_CHILD_STAT_SLEEP_FILECOUNT - 1);
+    // Act / Assert - nothing changed, left to the zero block writes
+    UtAssert_BOOL_FALSE(FM_ChildFileAllocate(Worker, "Preallocate File", "/cf/file", 0, 8, &AllocateResult));
+
+    UtAssert_BOOL_FALSE(AllocateResult);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+#endif
+
 /* * * * * * * * * * * * * *
  * Add Method Tests
  * * * * * * * * * * * * * */
 void add_FM_ChildInit_tests(void)
 {
-    UtTest_Add(Test_FM_ChildInit_CountSemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildInit_CountSemCreateNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildInit_CountSemCreateNotSuccess");
 
-    UtTest_Add(Test_FM_ChildInit_MutSemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildInit_MutSemCreateNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildInit_MutSemCreateNotSuccess");
 
-    UtTest_Add(Test_FM_ChildInit_MuteSemCreateSuccess_CreateChildTaskNotSuccess, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildInit_MuteSemCreateSuccess_CreateChildTaskNotSuccess");
+    UtTest_Add(Test_FM_ChildInit_ThrottleInitNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_ThrottleInitNotSuccess");
+
+    UtTest_Add(Test_FM_ChildInit_BufferInitNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_BufferInitNotSuccess");
 
-    UtTest_Add(Test_FM_ChildInit_ReturnSuccess, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildInit_ReturnSuccess");
+    UtTest_Add(Test_FM_ChildInit_MuteSemCreateSuccess_CreateChildTaskNotSuccess, UT_FM_Child_Test_Setup,
+               FM_Test_Teardown, "Test_FM_ChildInit_MuteSemCreateSuccess_CreateChildTaskNotSuccess");
+
+    UtTest_Add(Test_FM_ChildInit_ReturnSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_ReturnSuccess");
+#if FM_CHILD_WORKER_COUNT > 1
+    UtTest_Add(Test_FM_ChildInit_CreateSecondWorkerNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_CreateSecondWorkerNotSuccess");
+#endif
 }
 
 void add_FM_ChildTask_tests(void)
 {
-    UtTest_Add(Test_FM_ChildTask_ChildLoopCalled, FM_Test_Setup, FM_Test_Teardown, "FM_ChildTask_ChildLoopCalled");
+    UtTest_Add(Test_FM_ChildTask_ChildLoopCalled, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "FM_ChildTask_ChildLoopCalled");
+}
+
+void add_FM_ChildGetWorker_tests(void)
+{
+    UtTest_Add(Test_FM_ChildGetWorker_TaskIDMatch, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildGetWorker_TaskIDMatch");
+
+    UtTest_Add(Test_FM_ChildGetWorker_NoTaskIDMatch, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildGetWorker_NoTaskIDMatch");
+}
+
+void add_FM_ChildAbort_tests(void)
+{
+    UtTest_Add(Test_FM_ChildIsAborted, UT_FM_Child_Test_Setup, FM_Test_Teardown, "Test_FM_ChildIsAborted");
+
+    UtTest_Add(Test_FM_ChildCheckAbort, UT_FM_Child_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCheckAbort");
+
+    UtTest_Add(Test_FM_ChildCheckAbort_Queued, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckAbort_Queued");
+}
+
+void add_FM_ChildJob_tests(void)
+{
+    UtTest_Add(Test_FM_ChildReportStatus, UT_FM_Child_Test_Setup, FM_Test_Teardown, "Test_FM_ChildReportStatus");
+
+    UtTest_Add(Test_FM_ChildJobStart_ClockSetBackwards, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildJobStart_ClockSetBackwards");
+
+    UtTest_Add(Test_FM_ChildJobTotal, UT_FM_Child_Test_Setup, FM_Test_Teardown, "Test_FM_ChildJobTotal");
+
+    UtTest_Add(Test_FM_ChildJobBytes_Interval, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildJobBytes_Interval");
+
+    UtTest_Add(Test_FM_ChildJobProgress, UT_FM_Child_Test_Setup, FM_Test_Teardown, "Test_FM_ChildJobProgress");
 }
 
 void add_FM_ChildProcess_tests(void)
 {
-    UtTest_Add(Test_FM_ChildProcess_FMCopyCC, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildProcess_FMCopyCC");
+    UtTest_Add(Test_FM_ChildProcess_WorkerStatus, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_WorkerStatus");
+
+    UtTest_Add(Test_FM_ChildProcess_JobComplete, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_JobComplete");
+
+    UtTest_Add(Test_FM_ChildProcess_AbortedInQueue, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_AbortedInQueue");
+
+    UtTest_Add(Test_FM_ChildProcess_AbortedInQueueResume, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_AbortedInQueueResume");
+
+    UtTest_Add(Test_FM_ChildProcess_FMCopyCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMCopyCC");
 
-    UtTest_Add(Test_FM_ChildProcess_FMMoveCC, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildProcess_FMMoveCC");
+    UtTest_Add(Test_FM_ChildProcess_FMMoveCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMMoveCC");
 
-    UtTest_Add(Test_FM_ChildProcess_FMRenameCC, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildProcess_FMRenameCC");
+    UtTest_Add(Test_FM_ChildProcess_FMRenameCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMRenameCC");
 
-    UtTest_Add(Test_FM_ChildProcess_FMDeleteCC, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildProcess_FMDeleteCC");
+    UtTest_Add(Test_FM_ChildProcess_FMDeleteCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMDeleteCC");
 
-    UtTest_Add(Test_FM_ChildProcess_FMDeleteAllCC, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildProcess_FMDeleteAllCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_FMDeleteAllCC");
 #ifdef FM_INCLUDE_DECOMPRESS
-    UtTest_Add(Test_FM_ChildProcess_FMDecompressCC, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildProcess_FMDecompressCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_FMDecompressCC");
 #endif
-    UtTest_Add(Test_FM_ChildProcess_FMConcatCC, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildProcess_FMConcatCC");
+    UtTest_Add(Test_FM_ChildProcess_FMConcatCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMConcatCC");
 
-    UtTest_Add(Test_FM_ChildProcess_FMCreateDirCC, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildProcess_FMCreateDirCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_FMCreateDirCC");
 
-    UtTest_Add(Test_FM_ChildProcess_FMDeleteDirCC, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildProcess_FMDeleteDirCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_FMDeleteDirCC");
 
-    UtTest_Add(Test_FM_ChildProcess_FMGetFileInfoCC, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildProcess_FMGetFileInfoCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_FMGetFileInfoCC");
 
-    UtTest_Add(Test_FM_ChildProcess_FMGetDirListsFileCC, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildProcess_FMGetDirListsFileCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_FMGetDirListsFileCC");
 
-    UtTest_Add(Test_FM_ChildProcess_FMGetDirListsPktCC, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildProcess_FMGetDirListsPktCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_FMGetDirListsPktCC");
 
-    UtTest_Add(Test_FM_ChildProcess_FMSetFilePermCC, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildProcess_FMSetFilePermCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_FMSetFilePermCC");
 
-    UtTest_Add(Test_FM_ChildProcess_DefaultSwitch, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildProcess_FMCopyDirCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMCopyDirCC");
+
+    UtTest_Add(Test_FM_ChildProcess_FMDeleteTreeCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMDeleteTreeCC");
+
+    UtTest_Add(Test_FM_ChildProcess_FMDeleteFilterCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMDeleteFilterCC");
+
+    UtTest_Add(Test_FM_ChildProcess_FMConcatListCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMConcatListCC");
+
+    UtTest_Add(Test_FM_ChildProcess_FMSplitCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMSplitCC");
+
+    UtTest_Add(Test_FM_ChildProcess_FMPreallocateCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMPreallocateCC");
+
+    UtTest_Add(Test_FM_ChildProcess_FMTruncateCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMTruncateCC");
+
+    UtTest_Add(Test_FM_ChildProcess_DefaultSwitch, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_DefaultSwitch");
 
-    UtTest_Add(Test_FM_ChildProcess_ChildReadIndexGreaterChildQDepth, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildProcess_ChildReadIndexGreaterChildQDepth");
+    UtTest_Add(Test_FM_ChildProcess_InteractiveLaneFirst, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_InteractiveLaneFirst");
+
+    UtTest_Add(Test_FM_ChildProcess_LanesEmpty, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_LanesEmpty");
+    UtTest_Add(Test_FM_ChildProcess_PendingCommand, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_PendingCommand");
+    UtTest_Add(Test_FM_ChildProcess_LastQueueEntryInvalidCC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_LastQueueEntryInvalidCC");
 }
 
 void add_FM_ChildCopyCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildCopyCmd_OScpIsSuccess, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildCopyCmd_OScpIsSuccess");
+    UtTest_Add(Test_FM_ChildCopyCmd_Success, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyCmd_Success");
 
-    UtTest_Add(Test_FM_ChildCopyCmd_OScpNotSuccess, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildCopyCmd_OScpNotSuccess");
+    UtTest_Add(Test_FM_ChildCopyCmd_OpenSourceNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyCmd_OpenSourceNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyCmd_OpenTargetNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyCmd_OpenTargetNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyCmd_WriteNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyCmd_WriteNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyCmd_Checkpoint, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyCmd_Checkpoint");
+
+    UtTest_Add(Test_FM_ChildCopyCmd_CRC, UT_FM_Child_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCopyCmd_CRC");
+
+    UtTest_Add(Test_FM_ChildCopyCmd_Sparse, UT_FM_Child_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCopyCmd_Sparse");
+    UtTest_Add(Test_FM_ChildCopyCmd_Verify, UT_FM_Child_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCopyCmd_Verify");
+
+    UtTest_Add(Test_FM_ChildCopyCmd_VerifyMismatch, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyCmd_VerifyMismatch");
+
+    UtTest_Add(Test_FM_ChildCopyCmd_VerifyReadNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyCmd_VerifyReadNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyCmd_SeekNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyCmd_SeekNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyCmd_LinkNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyCmd_LinkNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyCmd_LinkCrossVolume, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyCmd_LinkCrossVolume");
 }
 
 void add_FM_ChildMoveCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildMoveCmd_OSmvNotSuccess, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildMoveCmd_OSmvNotSuccess");
+    UtTest_Add(Test_FM_ChildMoveCmd_RenameSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildMoveCmd_RenameSuccess");
+
+    UtTest_Add(Test_FM_ChildMoveCmd_CrossVolume, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildMoveCmd_CrossVolume");
+
+    UtTest_Add(Test_FM_ChildMoveCmd_RenameNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildMoveCmd_RenameNotSuccess");
 
-    UtTest_Add(Test_FM_ChildMoveCmd_OSmvSuccess, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildMoveCmd_OSmvSuccess");
+    UtTest_Add(Test_FM_ChildMoveCmd_VerifyMismatch, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildMoveCmd_VerifyMismatch");
+
+    UtTest_Add(Test_FM_ChildMoveCmd_RemoveSourceNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildMoveCmd_RemoveSourceNotSuccess");
 }
 
 void add_FM_ChildRenameCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildRenameCmd_OSRenameNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildRenameCmd_OSRenameNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildRenameCmd_OSRenameNotSuccess");
 
-    UtTest_Add(Test_FM_ChildRenameCmd_OSRenameSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildRenameCmd_OSRenameSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildRenameCmd_OSRenameSuccess");
 }
 
 void add_FM_ChildDeleteCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildDeleteCmd_OSRemoveSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteCmd_OSRemoveSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteCmd_OSRemoveSuccess");
 
-    UtTest_Add(Test_FM_ChildDeleteCmd_OSRemoveNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteCmd_OSRemoveNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteCmd_OSRemoveNotSuccess");
 }
 
 void add_FM_ChildDeleteAllCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildDeleteAllCmd_DirOpenNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteAllCmd_DirOpenNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllCmd_DirOpenNotSuccess");
 
-    UtTest_Add(Test_FM_ChildDeleteAllCmd_DirReadNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteAllCmd_DirReadNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllCmd_DirReadNotSuccess");
 
-    UtTest_Add(Test_FM_ChildDeleteAllCmd_DirEntryThisDirectory, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteAllCmd_DirEntryThisDirectory, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllCmd_DirEntryThisDirectory");
 
-    UtTest_Add(Test_FM_ChildDeleteAllCmd_DirEntryParentDirectory, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteAllCmd_DirEntryParentDirectory, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllCmd_DirEntryParentDirectory");
 
-    UtTest_Add(Test_FM_ChildDeleteAllCmd_PathFilenameLengthGreaterMaxPthLen, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteAllCmd_PathFilenameLengthGreaterMaxPthLen, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllCmd_PathFilenameLengthGreaterMaxPthLen");
 
-    UtTest_Add(Test_FM_ChildDeleteAllCmd_InvalidFilenameState, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteAllCmd_InvalidFilenameState, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllCmd_InvalidFilenameState");
 
-    UtTest_Add(Test_FM_ChildDeleteAllCmd_NotInUseFilenameState, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteAllCmd_NotInUseFilenameState, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllCmd_NotInUseFilenameState");
 
-    UtTest_Add(Test_FM_ChildDeleteAllCmd_DirectoryFilenameState, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteAllCmd_DirectoryFilenameState, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllCmd_DirectoryFilenameState");
 
-    UtTest_Add(Test_FM_ChildDeleteAllCmd_OpenFilenameState, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteAllCmd_OpenFilenameState, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllCmd_OpenFilenameState");
 
-    UtTest_Add(Test_FM_ChildDeleteAllCmd_ClosedFilename_OSRmNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteAllCmd_ClosedFilename_OSRmNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllCmd_ClosedFilename_OSRmNotSuccess");
 
-    UtTest_Add(Test_FM_ChildDeleteAllCmd_ClosedFilename_OSrmSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteAllCmd_ClosedFilename_OSrmSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllCmd_ClosedFilename_OSrmSuccess");
 
-    UtTest_Add(Test_FM_ChildDeleteAllCmd_FilenameStateDefaultReturn, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteAllCmd_FilenameStateDefaultReturn, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllCmd_FilenameStateDefaultReturn");
+
+    UtTest_Add(Test_FM_ChildDeleteAllCmd_ManyEntries, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteAllCmd_ManyEntries");
 }
 #ifdef FM_INCLUDE_DECOMPRESS
 void add_FM_ChildDecompressCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildDecompressCmd_FSDecompressNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDecompressCmd_FSDecompressNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDecompressCmd_FSDecompressNotSuccess");
 
-    UtTest_Add(Test_FM_ChildDecompressCmd_FSDecompressSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDecompressCmd_FSDecompressSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDecompressCmd_FSDecompressSuccess");
 }
 #endif
 
 void add_FM_ChildConcatCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildConcatCmd_OSCpNotSuccess, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildConcatCmd_OSCpNotSuccess");
+    UtTest_Add(Test_FM_ChildConcatCmd_CopySource1NotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatCmd_CopySource1NotSuccess");
 
-    UtTest_Add(Test_FM_ChildConcatCmd_OSOpenCreateSourceNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildConcatCmd_OSOpenCreateSourceNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildConcatCmd_OSOpenCreateSourceNotSuccess");
 
-    UtTest_Add(Test_FM_ChildConcatCmd_OSOpenCreateTargetNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildConcatCmd_OSOpenCreateTargetNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildConcatCmd_OSOpenCreateTargetNotSuccess");
 
-    UtTest_Add(Test_FM_ChildConcatCmd_OSReadBytesZero, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildConcatCmd_OSReadBytesZero, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildConcatCmd_OSReadBytesZero");
 
-    UtTest_Add(Test_FM_ChildConcatCmd_OSReadBytesLessThanZero, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildConcatCmd_OSReadBytesLessThanZero, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildConcatCmd_OSReadBytesLessThanZero");
 
-    UtTest_Add(Test_FM_ChildConcatCmd_BytesWrittenNotEqualBytesRead, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildConcatCmd_BytesWrittenNotEqualBytesRead, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildConcatCmd_BytesWrittenNotEqualBytesRead");
 
-    UtTest_Add(Test_FM_ChildConcatCmd_CopyInProgressTrueLoopCountEqualChildFileLoopCount, FM_Test_Setup,
-               FM_Test_Teardown, "Test_FM_ChildConcatCmd_CopyInProgressTrueLoopCountEqualChildFileLoopCount");
+    UtTest_Add(Test_FM_ChildConcatCmd_CopyInProgressThrottled, UT_FM_Child_Test_Setup,
+               FM_Test_Teardown, "Test_FM_ChildConcatCmd_CopyInProgressThrottled");
+
+    UtTest_Add(Test_FM_ChildConcatCmd_Aborted, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatCmd_Aborted");
+
+    UtTest_Add(Test_FM_ChildConcatCmd_ResumeSource2, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatCmd_ResumeSource2");
+}
+
+void add_FM_ChildCopyResume_tests(void)
+{
+    UtTest_Add(Test_FM_ChildCopyResume_NewCommand, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyResume_NewCommand");
+
+    UtTest_Add(Test_FM_ChildCopyResume_KernelCopied, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyResume_KernelCopied");
+
+    UtTest_Add(Test_FM_ChildCopyResume_KernelCopiedTargetShort, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyResume_KernelCopiedTargetShort");
+
+#ifdef FM_INCLUDE_KERNEL_COPY
+    UtTest_Add(Test_FM_ChildKernelCopy_NotAvailable, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildKernelCopy_NotAvailable");
+#endif
+
+    UtTest_Add(Test_FM_ChildCopyResume_Match, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyResume_Match");
+
+    UtTest_Add(Test_FM_ChildCopyResume_CRCMismatch, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyResume_CRCMismatch");
+
+    UtTest_Add(Test_FM_ChildCopyResume_TargetShort, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyResume_TargetShort");
+
+    UtTest_Add(Test_FM_ChildCopyResume_SourceModified, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyResume_SourceModified");
 }
 
 void add_FM_ChildFileInfoCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildFileInfoCmd_FileInfoCRCEqualIgnoreCRC, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildFileInfoCmd_FileInfoCRCEqualIgnoreCRC, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildFileInfoCmd_FileInfoCRCEqualIgnoreCRC");
 
-    UtTest_Add(Test_FM_ChildFileInfoCmd_FileInfoStateIsNotFileClosed, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildFileInfoCmd_FileInfoStateIsNotFileClosed, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildFileInfoCmd_FileInfoStateIsNotFileClosed");
 
-    UtTest_Add(Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission8, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission8, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission8");
 
-    UtTest_Add(Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission16, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission16, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission16");
 
-    UtTest_Add(Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission32, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission32, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission32");
 
-    UtTest_Add(Test_FM_ChildFileInfoCmd_FileInfoCRCNotEqualToAnyMissionES, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildFileInfoCmd_FileInfoCRCNotEqualToAnyMissionES, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildFileInfoCmd_FileInfoCRCNotEqualToAnyMissionES");
 
-    UtTest_Add(Test_FM_ChildFileInfoCmd_OSOpenCreateTrueBytesReadZero, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildFileInfoCmd_OSOpenCreateTrueBytesReadZero, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildFileInfoCmd_OSOpenCreateTrueBytesReadZero");
 
-    UtTest_Add(Test_FM_ChildFileInfoCmd_BytesReadLessThanZero, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildFileInfoCmd_BytesReadLessThanZero, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildFileInfoCmd_BytesReadLessThanZero");
 
-    UtTest_Add(Test_FM_ChildFileInfoCmd_BytesReadGreaterThanZero, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildFileInfoCmd_BytesReadGreaterThanZero, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildFileInfoCmd_BytesReadGreaterThanZero");
+
+    UtTest_Add(Test_FM_ChildFileInfoCmd_PipelineNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_PipelineNotSuccess");
+    UtTest_Add(Test_FM_ChildFileInfoCmd_Aborted, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_Aborted");
 }
 
 void add_FM_ChildCreateDirCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildCreateDirCmd_OSMkDirNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildCreateDirCmd_OSMkDirNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildCreateDirCmd_OSMkDirNotSuccess");
 
-    UtTest_Add(Test_FM_ChildCreateDirCmd_OSMkDirSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildCreateDirCmd_OSMkDirSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildCreateDirCmd_OSMkDirSuccess");
 }
 
 void add_FM_ChildDeleteDirCmd_tests(void)
 {
 
-    UtTest_Add(Test_FM_ChildDeleteDirCmd_OSDirectoryOpenNoSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteDirCmd_OSDirectoryOpenNoSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteDirCmd_OSDirectoryOpenNoSuccess");
 
-    UtTest_Add(Test_FM_ChildDeleteDirCmd_OSDirectoryReadNoSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteDirCmd_OSDirectoryReadNoSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteDirCmd_OSDirectoryReadNoSuccess");
 
-    UtTest_Add(Test_FM_ChildDeleteDirCmd_StrCmpThisDirectoryZero, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteDirCmd_StrCmpThisDirectoryZero, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteDirCmd_StrCmpThisDirectoryZero");
 
-    UtTest_Add(Test_FM_ChildDeleteDirCmd_StrCmpParentDirectoryZero, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteDirCmd_StrCmpParentDirectoryZero, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteDirCmd_StrCmpParentDirectoryZero");
 
-    UtTest_Add(Test_FM_ChildDeleteDirCmd_RemoveTheDirIsTrueRmDirSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteDirCmd_RemoveTheDirIsTrueRmDirSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteDirCmd_RemoveTheDirIsTrueRmDirSuccess");
 
-    UtTest_Add(Test_FM_ChildDeleteDirCmd_RemoveDirTrueOSRmDirNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDeleteDirCmd_RemoveDirTrueOSRmDirNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteDirCmd_RemoveDirTrueOSRmDirNotSuccess");
 }
 
 void add_FM_ChildDirListFileCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildDirListFileCmd_OSDirOpenNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListFileCmd_OSDirOpenNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileCmd_OSDirOpenNotSuccess");
 
-    UtTest_Add(Test_FM_ChildDirListFileCmd_ChildDirListFileInitFalse, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListFileCmd_ChildDirListFileInitFalse, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileCmd_ChildDirListFileInitFalse");
 
-    UtTest_Add(Test_FM_ChildDirListFileCmd_ChildDirListFileInitTrue, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListFileCmd_ChildDirListFileInitTrue, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileCmd_ChildDirListFileInitTrue");
+
+    UtTest_Add(Test_FM_ChildDirListFileCmd_Aborted, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileCmd_Aborted");
 }
 
 void add_FM_ChildDirListPktCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildDirListPktCmd_OSDirOpenNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListPktCmd_OSDirOpenNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListPktCmd_OSDirOpenNotSuccess");
 
-    UtTest_Add(Test_FM_ChildDirListPktCmd_OSDirReadNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListPktCmd_OSDirReadNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListPktCmd_OSDirReadNotSuccess");
 
-    UtTest_Add(Test_FM_ChildDirListPktCmd_DirEntryNameThisDirectory, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListPktCmd_DirEntryNameThisDirectory, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListPktCmd_DirEntryNameThisDirectory");
 
-    UtTest_Add(Test_FM_ChildDirListPktCmd_DirEntryNameParentDirectory, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListPktCmd_DirEntryNameParentDirectory, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListPktCmd_DirEntryNameParentDirectory");
 
-    UtTest_Add(Test_FM_ChildDirListPktCmd_DirListOffsetNotExceeded, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListPktCmd_DirListOffsetNotExceeded, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListPktCmd_DirListOffsetNotExceeded");
 
-    UtTest_Add(Test_FM_ChildDirListPktCmd_DirListOffsetExceeded, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListPktCmd_Aborted, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListPktCmd_Aborted");
+
+    UtTest_Add(Test_FM_ChildDirListPktCmd_DirListOffsetExceeded, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListPktCmd_DirListOffsetExceeded");
 
-    UtTest_Add(Test_FM_ChildDirListPktCmd_PathAndEntryLengthGreaterMaxPathLength, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildDirListPktCmd_PathAndEntryLengthGreaterMaxPathLength");
+    UtTest_Add(Test_FM_ChildDirListPktCmd_PathAndEntryLengthGreaterMaxPathLength, UT_FM_Child_Test_Setup,
+               FM_Test_Teardown, "Test_FM_ChildDirListPktCmd_PathAndEntryLengthGreaterMaxPathLength");
 }
 
 void add_FM_ChildSetPermissionsCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildSetPermissionsCmd_OSChmodNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildSetPermissionsCmd_OSChmodNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildSetPermissionsCmd_OSChmodNotSuccess");
 
-    UtTest_Add(Test_FM_ChildSetPermissionsCmd_OSChmodSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildSetPermissionsCmd_OSChmodSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildSetPermissionsCmd_OSChmodSuccess");
 }
 
+void add_FM_ChildCopyDirCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildCopyDirCmd_EmptyDirectory, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyDirCmd_EmptyDirectory");
+
+    UtTest_Add(Test_FM_ChildCopyDirCmd_MkDirNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyDirCmd_MkDirNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyDirCmd_DirOpenNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyDirCmd_DirOpenNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyDirCmd_ClosedFile, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyDirCmd_ClosedFile");
+
+    UtTest_Add(Test_FM_ChildCopyDirCmd_CopyFileNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyDirCmd_CopyFileNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyDirCmd_OpenFileSkipped, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyDirCmd_OpenFileSkipped");
+
+    UtTest_Add(Test_FM_ChildCopyDirCmd_Subdirectory, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyDirCmd_Subdirectory");
+
+    UtTest_Add(Test_FM_ChildCopyDirCmd_PathLengthGreaterMaxPathLen, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyDirCmd_PathLengthGreaterMaxPathLen");
+
+    UtTest_Add(Test_FM_ChildCopyDirCmd_Aborted, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyDirCmd_Aborted");
+}
+
+void add_FM_ChildDeleteTreeCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildDeleteTreeCmd_DirOpenNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteTreeCmd_DirOpenNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDeleteTreeCmd_EmptyDirectory, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteTreeCmd_EmptyDirectory");
+
+    UtTest_Add(Test_FM_ChildDeleteTreeCmd_ClosedFile, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteTreeCmd_ClosedFile");
+
+    UtTest_Add(Test_FM_ChildDeleteTreeCmd_RemoveNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteTreeCmd_RemoveNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDeleteTreeCmd_OpenFileSkipped, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteTreeCmd_OpenFileSkipped");
+
+    UtTest_Add(Test_FM_ChildDeleteTreeCmd_Subdirectory, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteTreeCmd_Subdirectory");
+
+    UtTest_Add(Test_FM_ChildDeleteTreeCmd_Aborted, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteTreeCmd_Aborted");
+}
+
+void add_FM_ChildDeleteFilterCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildDeleteFilterCmd_DirOpenNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteFilterCmd_DirOpenNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDeleteFilterCmd_NameNotMatched, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteFilterCmd_NameNotMatched");
+
+    UtTest_Add(Test_FM_ChildDeleteFilterCmd_NameMatched, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteFilterCmd_NameMatched");
+
+    UtTest_Add(Test_FM_ChildDeleteFilterCmd_SizeOutsideRange, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteFilterCmd_SizeOutsideRange");
+
+    UtTest_Add(Test_FM_ChildDeleteFilterCmd_AgeWithinRange, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteFilterCmd_AgeWithinRange");
+
+    UtTest_Add(Test_FM_ChildDeleteFilterCmd_AgeOutsideRange, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteFilterCmd_AgeOutsideRange");
+
+    UtTest_Add(Test_FM_ChildDeleteFilterCmd_StatNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteFilterCmd_StatNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDeleteFilterCmd_OpenFileSkipped, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteFilterCmd_OpenFileSkipped");
+
+    UtTest_Add(Test_FM_ChildDeleteFilterCmd_DirectorySkipped, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteFilterCmd_DirectorySkipped");
+
+    UtTest_Add(Test_FM_ChildDeleteFilterCmd_RemoveNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteFilterCmd_RemoveNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDeleteFilterCmd_Aborted, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteFilterCmd_Aborted");
+}
+
 void add_FM_ChildDirListFileInit_tests(void)
 {
-    UtTest_Add(Test_FM_ChildDirListFileInit_OSOpenCreateFail, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListFileInit_OSOpenCreateFail, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileInit_OSOpenCreateFail");
 
-    UtTest_Add(Test_FM_ChildDirListFileInit_FSWriteHeaderNotSameSizeFSHeadert, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListFileInit_FSWriteHeaderNotSameSizeFSHeadert, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileInit_FSWriteHeaderNotSameSizeFSHeadert");
 
-    UtTest_Add(Test_FM_ChildDirListFileInit_OSWriteNotSameSizeDirListFileStatst, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildDirListFileInit_OSWriteNotSameSizeDirListFileStatst");
+    UtTest_Add(Test_FM_ChildDirListFileInit_OSWriteNotSameSizeDirListFileStatst, UT_FM_Child_Test_Setup,
+               FM_Test_Teardown, "Test_FM_ChildDirListFileInit_OSWriteNotSameSizeDirListFileStatst");
 
-    UtTest_Add(Test_FM_ChildDirListFileInit_OSWriteSameSizeDirListFileStatst, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListFileInit_OSWriteSameSizeDirListFileStatst, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileInit_OSWriteSameSizeDirListFileStatst");
 }
 
 void add_FM_ChildDirListFileLoop_tests(void)
 {
-    UtTest_Add(Test_FM_ChildDirListFileLoop_OSDirReadNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListFileLoop_OSDirReadNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileLoop_OSDirReadNotSuccess");
 
-    UtTest_Add(Test_FM_ChildDirListFileLoop_OSDirEntryNameIsThisDirectory, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListFileLoop_OSDirEntryNameIsThisDirectory, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileLoop_OSDirEntryNameIsThisDirectory");
 
-    UtTest_Add(Test_FM_ChildDirListFileLoop_OSDirEntryNameIsParentDirectory, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListFileLoop_OSDirEntryNameIsParentDirectory, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileLoop_OSDirEntryNameIsParentDirectory");
 
-    UtTest_Add(Test_FM_ChildDirListFileLoop_PathLengthAndEntryLengthGreaterMaxPathLen, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildDirListFileLoop_PathLengthAndEntryLengthGreaterMaxPathLen");
+    UtTest_Add(Test_FM_ChildDirListFileLoop_PathLengthAndEntryLengthGreaterMaxPathLen, UT_FM_Child_Test_Setup,
+               FM_Test_Teardown, "Test_FM_ChildDirListFileLoop_PathLengthAndEntryLengthGreaterMaxPathLen");
 
-    UtTest_Add(Test_FM_ChildDirListFileLoop_FileEntriesGreaterFMDirListFileEntries, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildDirListFileLoop_FileEntriesGreaterFMDirListFileEntries");
+    UtTest_Add(Test_FM_ChildDirListFileLoop_FileEntriesGreaterFMDirListFileEntries, UT_FM_Child_Test_Setup,
+               FM_Test_Teardown, "Test_FM_ChildDirListFileLoop_FileEntriesGreaterFMDirListFileEntries");
 
-    UtTest_Add(Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLength, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLength, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLength");
 
-    UtTest_Add(Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop");
+    UtTest_Add(Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop, UT_FM_Child_Test_Setup,
+               FM_Test_Teardown, "Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop");
 }
 
 void add_FM_ChildSizeTimeMode_tests(void)
 {
-    UtTest_Add(Test_FM_ChildSizeTimeMode_OsStatNoSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildSizeTimeMode_OsStatNoSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildSizeTimeMode_OsStatNoSuccess");
 
-    UtTest_Add(Test_FM_ChildSizeTimeMode_OSFilestateTimeDefined, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildSizeTimeMode_OSFilestateTimeDefined, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildSizeTimeMode_OSFilestateTimeDefined");
+
+    UtTest_Add(Test_FM_ChildAllocatedSize_NotAvailable, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildAllocatedSize_NotAvailable");
 }
 
 void add_FM_ChildSleepStat_tests(void)
 {
-    UtTest_Add(Test_FM_ChildSleepStat_getSizeTimeModeFalse, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildSleepStat_getSizeTimeModeFalse, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildSleepStat_getSizeTimeModeFalse");
 
-    UtTest_Add(Test_FM_ChildSleepStat_FilesTillSleepPositive, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildSleepStat_FilesTillSleepPositive");
+    UtTest_Add(Test_FM_ChildSleepStat_getSizeTimeModeTrue, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSleepStat_getSizeTimeModeTrue");
+}
+
+void add_FM_ChildPatternMatch_tests(void)
+{
+    UtTest_Add(Test_FM_ChildPatternMatch_Literal, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPatternMatch_Literal");
+
+    UtTest_Add(Test_FM_ChildPatternMatch_Wildcards, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPatternMatch_Wildcards");
+
+    UtTest_Add(Test_FM_ChildPatternMatch_NoMatch, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPatternMatch_NoMatch");
+}
+
+void add_FM_ChildConcatListCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildConcatListCmd_ListOpenNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_ListOpenNotSuccess");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_ListEmpty, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_ListEmpty");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_SourceNotClosed, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_SourceNotClosed");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_SourceIsTarget, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_SourceIsTarget");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_Success, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_Success");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_SourceOpenNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_SourceOpenNotSuccess");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_ResumeEntry, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_ResumeEntry");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_ResumeListModified, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_ResumeListModified");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_Aborted, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_Aborted");
+}
+
+void add_FM_ChildSplitCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildSplitCmd_StatNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitCmd_StatNotSuccess");
+
+    UtTest_Add(Test_FM_ChildSplitCmd_SegmentExists, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitCmd_SegmentExists");
+
+    UtTest_Add(Test_FM_ChildSplitCmd_SourceOpenNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitCmd_SourceOpenNotSuccess");
+
+    UtTest_Add(Test_FM_ChildSplitCmd_ManifestWriteNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitCmd_ManifestWriteNotSuccess");
+
+    UtTest_Add(Test_FM_ChildSplitCmd_Success, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitCmd_Success");
+
+    UtTest_Add(Test_FM_ChildSplitCmd_SegmentNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitCmd_SegmentNotSuccess");
+
+    UtTest_Add(Test_FM_ChildSplitCmd_Aborted, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitCmd_Aborted");
+}
+
+void add_FM_ChildPreallocateCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildPreallocateCmd_AlreadyAllocated, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPreallocateCmd_AlreadyAllocated");
+
+    UtTest_Add(Test_FM_ChildPreallocateCmd_OpenNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPreallocateCmd_OpenNotSuccess");
+
+    UtTest_Add(Test_FM_ChildPreallocateCmd_NewFile, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPreallocateCmd_NewFile");
+
+    UtTest_Add(Test_FM_ChildPreallocateCmd_ExistingFile, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPreallocateCmd_ExistingFile");
+
+    UtTest_Add(Test_FM_ChildPreallocateCmd_WriteNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPreallocateCmd_WriteNotSuccess");
 
-    UtTest_Add(Test_FM_ChildSleepStat_FilesTillSleepLTEQZero, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildSleepStat_FilesTillSleepLTEQZero");
+    UtTest_Add(Test_FM_ChildPreallocateCmd_Aborted, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPreallocateCmd_Aborted");
+}
+
+void add_FM_ChildTruncateCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildTruncateCmd_StatNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildTruncateCmd_StatNotSuccess");
+
+    UtTest_Add(Test_FM_ChildTruncateCmd_SizeTooLarge, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildTruncateCmd_SizeTooLarge");
+
+    UtTest_Add(Test_FM_ChildTruncateCmd_TruncateNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildTruncateCmd_TruncateNotSuccess");
+}
+
+void add_FM_ChildListNext_tests(void)
+{
+    UtTest_Add(Test_FM_ChildListNext_Lines, UT_FM_Child_Test_Setup, FM_Test_Teardown, "Test_FM_ChildListNext_Lines");
+
+    UtTest_Add(Test_FM_ChildListNext_LineTooLong, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildListNext_LineTooLong");
+
+    UtTest_Add(Test_FM_ChildListNext_ReadNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildListNext_ReadNotSuccess");
+}
+
+void add_FM_ChildSplit_tests(void)
+{
+    UtTest_Add(Test_FM_ChildSplitCheck_Count, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitCheck_Count");
+
+    UtTest_Add(Test_FM_ChildSplitCheck_InvalidCount, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitCheck_InvalidCount");
+
+    UtTest_Add(Test_FM_ChildSplitCheck_NameTooLong, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitCheck_NameTooLong");
+
+    UtTest_Add(Test_FM_ChildSplitSegment_Success, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitSegment_Success");
+
+    UtTest_Add(Test_FM_ChildSplitSegment_Blocks, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitSegment_Blocks");
+
+    UtTest_Add(Test_FM_ChildSplitSegment_OpenNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitSegment_OpenNotSuccess");
+
+    UtTest_Add(Test_FM_ChildSplitSegment_ReadNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitSegment_ReadNotSuccess");
+
+    UtTest_Add(Test_FM_ChildSplitSegment_FinishNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSplitSegment_FinishNotSuccess");
+
+    UtTest_Add(Test_FM_ChildSplitName, UT_FM_Child_Test_Setup, FM_Test_Teardown, "Test_FM_ChildSplitName");
+}
+
+void add_FM_ChildFileSize_tests(void)
+{
+    UtTest_Add(Test_FM_ChildPreallocateWrite_Blocks, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPreallocateWrite_Blocks");
+
+    UtTest_Add(Test_FM_ChildPreallocateWrite_SeekNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPreallocateWrite_SeekNotSuccess");
+
+    UtTest_Add(Test_FM_ChildPreallocateWrite_SubmitNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPreallocateWrite_SubmitNotSuccess");
+
+    UtTest_Add(Test_FM_ChildTruncateFile, UT_FM_Child_Test_Setup, FM_Test_Teardown, "Test_FM_ChildTruncateFile");
+
+    UtTest_Add(Test_FM_ChildLinkFile, UT_FM_Child_Test_Setup, FM_Test_Teardown, "Test_FM_ChildLinkFile");
+
+#ifdef FM_INCLUDE_FILE_ALLOCATE
+    UtTest_Add(Test_FM_ChildFileAllocate_NotAvailable, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileAllocate_NotAvailable");
+#endif
 }
 
 void add_FM_ChildLoop_tests(void)
 {
-    UtTest_Add(Test_FM_ChildLoop_CountSemTakeNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildLoop_CountSemTakeNotSuccess, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildLoop_CountSemTakeNotSuccess");
 
-    UtTest_Add(Test_FM_ChildLoop_ChildQCountEqualZero, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildLoop_ChildQCountEqualZero, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildLoop_ChildQCountEqualZero");
 
-    UtTest_Add(Test_FM_ChildLoop_ChildReadIndexEqualChildQDepth, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildLoop_ChildReadIndexEqualChildQDepth");
+    UtTest_Add(Test_FM_ChildLoop_LanesEmpty, UT_FM_Child_Test_Setup, FM_Test_Teardown, "Test_FM_ChildLoop_LanesEmpty");
+
+    UtTest_Add(Test_FM_ChildLoop_PendingCommand, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildLoop_PendingCommand");
+
+    UtTest_Add(Test_FM_ChildLoop_LaneNotValid, UT_FM_Child_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildLoop_LaneNotValid");
 
-    UtTest_Add(Test_FM_ChildLoop_CountSemTakeSuccessDefault, FM_Test_Setup, FM_Test_Teardown,
+    UtTest_Add(Test_FM_ChildLoop_CountSemTakeSuccessDefault, UT_FM_Child_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildLoop_CountSemTakeSuccessDefault");
 }
 
 /*
     UtTest_Add(,
-        FM_Test_Setup, FM_Test_Teardown,
+        UT_FM_Child_Test_Setup, FM_Test_Teardown,
         "");
 */
 
@@ -2598,6 +6192,9 @@ void UtTest_Setup(void)
 {
     add_FM_ChildInit_tests();
     add_FM_ChildTask_tests();
+    add_FM_ChildGetWorker_tests();
+    add_FM_ChildAbort_tests();
+    add_FM_ChildJob_tests();
     add_FM_ChildProcess_tests();
     add_FM_ChildCopyCmd_tests();
     add_FM_ChildMoveCmd_tests();
@@ -2608,15 +6205,27 @@ void UtTest_Setup(void)
     add_FM_ChildDecompressCmd_tests();
 #endif
     add_FM_ChildConcatCmd_tests();
+    add_FM_ChildCopyResume_tests();
     add_FM_ChildFileInfoCmd_tests();
     add_FM_ChildCreateDirCmd_tests();
     add_FM_ChildDeleteDirCmd_tests();
     add_FM_ChildDirListFileCmd_tests();
     add_FM_ChildDirListPktCmd_tests();
     add_FM_ChildSetPermissionsCmd_tests();
+    add_FM_ChildCopyDirCmd_tests();
+    add_FM_ChildDeleteTreeCmd_tests();
+    add_FM_ChildDeleteFilterCmd_tests();
+    add_FM_ChildConcatListCmd_tests();
+    add_FM_ChildSplitCmd_tests();
+    add_FM_ChildPreallocateCmd_tests();
+    add_FM_ChildTruncateCmd_tests();
     add_FM_ChildDirListFileInit_tests();
     add_FM_ChildDirListFileLoop_tests();
     add_FM_ChildSizeTimeMode_tests();
     add_FM_ChildSleepStat_tests();
+    add_FM_ChildPatternMatch_tests();
+    add_FM_ChildListNext_tests();
+    add_FM_ChildSplit_tests();
+    add_FM_ChildFileSize_tests();
     add_FM_ChildLoop_tests();
 }
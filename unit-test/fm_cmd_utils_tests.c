@@ -25,7 +25,9 @@
 #include "cfe.h"
 #include "fm_cmd_utils.h"
 #include "fm_msg.h"
+#include "fm_msgdefs.h"
 #include "fm_child.h"
+#include "fm_queue.h"
 #include "fm_perfids.h"
 #include "fm_events.h"
 
@@ -88,6 +90,27 @@ void Test_FM_VerifyOverwrite(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+/* **************************
+ * VerifyCRCType Tests
+ * *************************/
+void Test_FM_VerifyCRCType(void)
+{
+    uint32 eventid = 1;
+
+    /* CRC ignored or a known algorithm */
+    UtAssert_BOOL_TRUE(FM_VerifyCRCType(FM_IGNORE_CRC, eventid, "Cmd Text"));
+    UtAssert_BOOL_TRUE(FM_VerifyCRCType(CFE_MISSION_ES_CRC_8, eventid, "Cmd Text"));
+    UtAssert_BOOL_TRUE(FM_VerifyCRCType(CFE_MISSION_ES_CRC_16, eventid, "Cmd Text"));
+    UtAssert_BOOL_TRUE(FM_VerifyCRCType(CFE_MISSION_ES_CRC_32, eventid, "Cmd Text"));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* Unknown algorithm */
+    UtAssert_BOOL_FALSE(FM_VerifyCRCType(99, eventid, "Cmd Text"));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, eventid);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 /* **************************
  * GetOpenFilesData Tests
  * *************************/
@@ -144,6 +167,37 @@ void Test_FM_GetOpenFilesData(void)
     UtAssert_STRINGBUF_EQ(files_entry.AppName, sizeof(files_entry.AppName), task_prop.name, sizeof(task_prop.name));
 }
 
+void Test_FM_GetOpenFilesData_ListFull(void)
+{
+    osal_id_t           id = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t           ids[OS_MAX_NUM_OPEN_FILES + 1];
+    FM_OpenFilesEntry_t files_list[OS_MAX_NUM_OPEN_FILES + 1];
+    OS_file_prop_t      file_prop;
+    uint32              i;
+
+    memset(files_list, 0, sizeof(files_list));
+    memset(&file_prop, 0, sizeof(file_prop));
+
+    strncpy(file_prop.Path, "FilePath", sizeof(file_prop.Path));
+
+    OS_OpenCreate(&id, NULL, 0, 0);
+
+    for (i = 0; i < (OS_MAX_NUM_OPEN_FILES + 1); i++)
+    {
+        ids[i] = id;
+    }
+
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), ids, sizeof(ids), false);
+    UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
+
+    /* More open files than the list holds, the entry past the list is not written */
+    UtAssert_UINT32_EQ(FM_GetOpenFilesData(files_list), OS_MAX_NUM_OPEN_FILES);
+    UtAssert_STUB_COUNT(OS_FDGetInfo, OS_MAX_NUM_OPEN_FILES);
+    UtAssert_STRINGBUF_EQ(files_list[0].LogicalName, sizeof(files_list[0].LogicalName), file_prop.Path,
+                          sizeof(file_prop.Path));
+    UtAssert_UINT32_EQ(files_list[OS_MAX_NUM_OPEN_FILES].LogicalName[0], 0);
+}
+
 /* **************************
  * GetFilenameState Tests
  * *************************/
@@ -210,6 +264,42 @@ void Test_FM_GetFilenameState(void)
     UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false), FM_NAME_IS_FILE_OPEN);
 }
 
+void Test_FM_GetFilenameStateFromList(void)
+{
+    char                filename[OS_MAX_FILE_NAME] = "File";
+    os_fstat_t          fstat;
+    FM_OpenFilesEntry_t open_files[2];
+
+    memset(&fstat, 0, sizeof(fstat));
+    memset(open_files, 0, sizeof(open_files));
+    strncpy(open_files[0].LogicalName, "Other", sizeof(open_files[0].LogicalName));
+
+    /* NULL filename */
+    UtAssert_UINT32_EQ(FM_GetFilenameStateFromList(NULL, 0, open_files, 0), FM_NAME_IS_INVALID);
+
+    /* Unterminated string */
+    UtAssert_UINT32_EQ(FM_GetFilenameStateFromList(filename, 2, open_files, 0), FM_NAME_IS_INVALID);
+    UtAssert_STUB_COUNT(OS_stat, 0);
+
+    /* OS_stat failure */
+    UT_SetDeferredRetcode(UT_KEY(OS_stat), 1, !OS_SUCCESS);
+    UtAssert_UINT32_EQ(FM_GetFilenameStateFromList(filename, sizeof(filename), open_files, 0), FM_NAME_IS_NOT_IN_USE);
+
+    /* File is directory */
+    fstat.FileModeBits = OS_FILESTAT_MODE_DIR;
+    UT_SetDataBuffer(UT_KEY(OS_stat), &fstat, sizeof(fstat), false);
+    UtAssert_UINT32_EQ(FM_GetFilenameStateFromList(filename, sizeof(filename), open_files, 0), FM_NAME_IS_DIRECTORY);
+
+    /* File is not in the list */
+    UtAssert_UINT32_EQ(FM_GetFilenameStateFromList(filename, sizeof(filename), open_files, 1),
+                       FM_NAME_IS_FILE_CLOSED);
+
+    /* File is in the list, no OSAL objects are searched */
+    strncpy(open_files[1].LogicalName, filename, sizeof(open_files[1].LogicalName));
+    UtAssert_UINT32_EQ(FM_GetFilenameStateFromList(filename, sizeof(filename), open_files, 2), FM_NAME_IS_FILE_OPEN);
+    UtAssert_STUB_COUNT(OS_ForEachObject, 0);
+}
+
 /* **************************
  * VerifyNameValid Tests
  * *************************/
@@ -491,6 +581,8 @@ void Test_FM_VerifyDirNoExist(void)
  * *********************/
 void Test_FM_VerifyChildTask(void)
 {
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueArenaHasRoom), true);
+
     /* ChildSemaphore not defined */
     UtAssert_BOOL_FALSE(FM_VerifyChildTask(0, "Cmd Text"));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -516,23 +608,139 @@ void Test_FM_VerifyChildTask(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[3].EventID, FM_CHILD_BROKEN_EID_OFFSET);
 
-    /* Success */
-    FM_GlobalData.ChildWriteIndex = FM_CHILD_QUEUE_DEPTH - 1;
+    /* Success, staging entry cleared */
+    FM_GlobalData.ChildWriteIndex             = FM_CHILD_QUEUE_DEPTH - 1;
+    FM_GlobalData.ChildQueueEntry.CommandCode = FM_COPY_CC;
     UtAssert_BOOL_TRUE(FM_VerifyChildTask(0, "Cmd Text"));
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
+
+    /* Success, skips queue entry that is waiting in a lane */
+    FM_GlobalData.ChildQueueBusy[FM_CHILD_QUEUE_DEPTH - 1] = true;
+    UtAssert_BOOL_TRUE(FM_VerifyChildTask(0, "Cmd Text"));
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWriteIndex, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
+}
+
+void Test_FM_VerifyChildTask_PendingFile(void)
+{
+    FM_GlobalData.ChildSemaphore = FM_UT_OBJID_1;
+
+    /* Path arena full, pending commands file full */
+    UtAssert_BOOL_FALSE(FM_VerifyChildTask(0, "Cmd Text"));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_Q_FULL_EID_OFFSET);
+
+    /* Path arena full, pending commands file has room */
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingHasRoom), true);
+    UtAssert_BOOL_TRUE(FM_VerifyChildTask(0, "Cmd Text"));
+
+    /* Queue full, pending commands file has room */
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueArenaHasRoom), true);
+    FM_GlobalData.ChildQueueCount = FM_CHILD_QUEUE_DEPTH;
+    UtAssert_BOOL_TRUE(FM_VerifyChildTask(0, "Cmd Text"));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Queue has room but commands are waiting in the pending commands file, which is full */
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingHasRoom), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingCount), FM_CHILD_PENDING_DEPTH);
+    FM_GlobalData.ChildQueueCount = 0;
+    UtAssert_BOOL_FALSE(FM_VerifyChildTask(0, "Cmd Text"));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_CHILD_Q_FULL_EID_OFFSET);
+}
+
+void Test_FM_VerifyChildTask_AllEntriesBusy(void)
+{
+    uint8 i = 0;
+
+    FM_GlobalData.ChildSemaphore  = FM_UT_OBJID_1;
+    FM_GlobalData.ChildQueueCount = 0;
+
+    for (i = 0; i < FM_CHILD_QUEUE_DEPTH; i++)
+    {
+        FM_GlobalData.ChildQueueBusy[i] = true;
+    }
+
+    UtAssert_BOOL_FALSE(FM_VerifyChildTask(0, "Cmd Text"));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_BROKEN_EID_OFFSET);
+}
+
+/* **********************
+ * GetChildQueueLane tests
+ * *********************/
+void Test_FM_GetChildQueueLane(void)
+{
+    FM_ChildQueueEntry_t queue_entry;
+
+    memset(&queue_entry, 0, sizeof(queue_entry));
+
+    /* Metadata commands */
+    queue_entry.CommandCode = FM_RENAME_CC;
+    UtAssert_INT32_EQ(FM_GetChildQueueLane(&queue_entry), FM_CHILD_LANE_INTERACTIVE);
+    queue_entry.CommandCode = FM_DELETE_CC;
+    UtAssert_INT32_EQ(FM_GetChildQueueLane(&queue_entry), FM_CHILD_LANE_INTERACTIVE);
+    queue_entry.CommandCode = FM_CREATE_DIR_CC;
+    UtAssert_INT32_EQ(FM_GetChildQueueLane(&queue_entry), FM_CHILD_LANE_INTERACTIVE);
+    queue_entry.CommandCode = FM_DELETE_DIR_CC;
+    UtAssert_INT32_EQ(FM_GetChildQueueLane(&queue_entry), FM_CHILD_LANE_INTERACTIVE);
+    queue_entry.CommandCode = FM_SET_FILE_PERM_CC;
+    UtAssert_INT32_EQ(FM_GetChildQueueLane(&queue_entry), FM_CHILD_LANE_INTERACTIVE);
+
+    /* File info without and with CRC */
+    queue_entry.CommandCode = FM_GET_FILE_INFO_CC;
+    queue_entry.FileInfoCRC = FM_IGNORE_CRC;
+    UtAssert_INT32_EQ(FM_GetChildQueueLane(&queue_entry), FM_CHILD_LANE_INTERACTIVE);
+    queue_entry.FileInfoCRC = CFE_MISSION_ES_CRC_16;
+    UtAssert_INT32_EQ(FM_GetChildQueueLane(&queue_entry), FM_CHILD_LANE_BULK);
+
+    /* File data commands */
+    queue_entry.CommandCode = FM_COPY_CC;
+    UtAssert_INT32_EQ(FM_GetChildQueueLane(&queue_entry), FM_CHILD_LANE_BULK);
+    queue_entry.CommandCode = FM_CONCAT_CC;
+    UtAssert_INT32_EQ(FM_GetChildQueueLane(&queue_entry), FM_CHILD_LANE_BULK);
+    queue_entry.CommandCode = FM_GET_DIR_FILE_CC;
+    UtAssert_INT32_EQ(FM_GetChildQueueLane(&queue_entry), FM_CHILD_LANE_BULK);
 }
 
 /* **********************
  * InvokeChildTask tests
  * *********************/
+
+/* Lane and queue entry passed to the last FM_QueueLanePush call */
+static FM_ChildLane_t *UT_FM_PushLane;
+static uint8           UT_FM_PushQueueIndex;
+
+void UT_Handler_FM_QueueLanePush(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_FM_PushLane       = UT_Hook_GetArgValueByName(Context, "Lane", FM_ChildLane_t *);
+    UT_FM_PushQueueIndex = UT_Hook_GetArgValueByName(Context, "QueueIndex", uint8);
+}
+
+/* Lane passed to the last FM_QueuePendingPush call */
+static uint8 UT_FM_PendingLane;
+
+void UT_Handler_FM_QueuePendingPush(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_FM_PendingLane = UT_Hook_GetArgValueByName(Context, "Lane", uint8);
+}
+
 void Test_FM_InvokeChildTask(void)
 {
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueEntryPack), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueLanePush), true);
+    UT_SetHandlerFunction(UT_KEY(FM_QueueLanePush), UT_Handler_FM_QueueLanePush, NULL);
+
     /* Conditions true */
     FM_GlobalData.ChildWriteIndex = FM_CHILD_QUEUE_DEPTH - 1;
     FM_GlobalData.ChildSemaphore  = FM_UT_OBJID_1;
     UtAssert_VOIDCALL(FM_InvokeChildTask());
     UtAssert_INT32_EQ(FM_GlobalData.ChildWriteIndex, 0);
     UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 1);
+    UtAssert_ADDRESS_EQ(UT_FM_PushLane, &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK]);
+    UtAssert_INT32_EQ(UT_FM_PushQueueIndex, FM_CHILD_QUEUE_DEPTH - 1);
+    UtAssert_BOOL_TRUE(FM_GlobalData.ChildQueueBusy[FM_CHILD_QUEUE_DEPTH - 1]);
     UtAssert_STUB_COUNT(OS_CountSemGive, 1);
 
     /* Conditions false */
@@ -541,6 +749,140 @@ void Test_FM_InvokeChildTask(void)
     UtAssert_INT32_EQ(FM_GlobalData.ChildWriteIndex, 1);
     UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 2);
     UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+
+    /* Interactive lane */
+    FM_GlobalData.ChildQueueEntry.CommandCode = FM_CREATE_DIR_CC;
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+    UtAssert_ADDRESS_EQ(UT_FM_PushLane, &FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE]);
+    UtAssert_INT32_EQ(UT_FM_PushQueueIndex, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 3);
+
+    /* No mutex is taken by the FM main task */
+    UtAssert_STUB_COUNT(FM_QueueEntryPack, 3);
+    UtAssert_STUB_COUNT(FM_QueueLanePush, 3);
+    UtAssert_STUB_COUNT(FM_QueuePendingPush, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 0);
+}
+
+void Test_FM_InvokeChildTask_LanePushFail(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueEntryPack), true);
+
+    FM_GlobalData.ChildWriteIndex = 0;
+    FM_GlobalData.ChildQueueCount = 1;
+    FM_GlobalData.ChildSemaphore  = FM_UT_OBJID_1;
+
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+    UtAssert_STUB_COUNT(FM_QueueLanePush, 1);
+    UtAssert_STUB_COUNT(FM_QueueEntryRelease, 1);
+    UtAssert_STUB_COUNT(FM_QueuePendingPush, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWriteIndex, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 1);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildQueueBusy[0]);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_PENDING_WRITE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void Test_FM_InvokeChildTask_PendingFile(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingPush), true);
+
+    FM_GlobalData.ChildSemaphore = FM_UT_OBJID_1;
+
+    /* Path arena full */
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+    UtAssert_STUB_COUNT(FM_QueueEntryPack, 1);
+    UtAssert_STUB_COUNT(FM_QueueLanePush, 0);
+    UtAssert_STUB_COUNT(FM_QueuePendingPush, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+
+    /* Queue full */
+    FM_GlobalData.ChildQueueCount = FM_CHILD_QUEUE_DEPTH;
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+    UtAssert_STUB_COUNT(FM_QueueEntryPack, 1);
+    UtAssert_STUB_COUNT(FM_QueuePendingPush, 2);
+
+    /* Commands already waiting in the pending commands file keep their place */
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueEntryPack), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingCount), 1);
+    FM_GlobalData.ChildQueueCount = 0;
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+    UtAssert_STUB_COUNT(FM_QueueEntryPack, 1);
+    UtAssert_STUB_COUNT(FM_QueuePendingPush, 3);
+
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWriteIndex, 0);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildQueueBusy[0]);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_InvokeChildTask_PendingInteractive(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueEntryPack), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueLanePush), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingPush), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingCount), 300);
+    UT_SetHandlerFunction(UT_KEY(FM_QueueLanePush), UT_Handler_FM_QueueLanePush, NULL);
+    UT_SetHandlerFunction(UT_KEY(FM_QueuePendingPush), UT_Handler_FM_QueuePendingPush, NULL);
+
+    FM_GlobalData.ChildSemaphore = FM_UT_OBJID_1;
+
+    /* An interactive command passes bulk commands waiting in the pending commands file */
+    FM_GlobalData.ChildQueueEntry.CommandCode = FM_CREATE_DIR_CC;
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+    UtAssert_STUB_COUNT(FM_QueueLanePush, 1);
+    UtAssert_ADDRESS_EQ(UT_FM_PushLane, &FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE]);
+    UtAssert_STUB_COUNT(FM_QueuePendingPush, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 1);
+
+    /* A bulk command waits behind them */
+    FM_GlobalData.ChildQueueEntry.CommandCode = FM_COPY_CC;
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+    UtAssert_STUB_COUNT(FM_QueueLanePush, 1);
+    UtAssert_STUB_COUNT(FM_QueuePendingPush, 1);
+    UtAssert_UINT32_EQ(UT_FM_PendingLane, FM_CHILD_LANE_BULK);
+
+    /* An interactive command does not pass a waiting interactive command */
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingHasInteractive), true);
+    FM_GlobalData.ChildQueueEntry.CommandCode = FM_DELETE_CC;
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+    UtAssert_STUB_COUNT(FM_QueueLanePush, 1);
+    UtAssert_STUB_COUNT(FM_QueuePendingPush, 2);
+    UtAssert_UINT32_EQ(UT_FM_PendingLane, FM_CHILD_LANE_INTERACTIVE);
+
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_InvokeChildTask_JobID(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueEntryPack), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueLanePush), true);
+
+    /* Each command is assigned the next job ID */
+    FM_GlobalData.ChildLastJobID = 4;
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildLastJobID, 5);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.JobID, 5);
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 1);
+
+    /* Job ID none is skipped when the job ID wraps */
+    FM_GlobalData.ChildLastJobID = 0xFFFFFFFF;
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildLastJobID, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.JobID, 1);
+
+    /* Commands written to the pending commands file are assigned a job ID */
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueEntryPack), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingPush), true);
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.JobID, 2);
+    UtAssert_STUB_COUNT(FM_QueuePendingPush, 1);
 }
 
 /* **********************
@@ -568,6 +910,34 @@ void Test_FM_AppendPathSep(void)
     UtAssert_UINT32_EQ(strncmp(directory, "a/", sizeof(directory)), 0);
 }
 
+void Test_FM_GetVolumeIndex(void)
+{
+    FM_FreeSpaceTable_t Table;
+
+    memset(&Table, 0, sizeof(Table));
+    Table.FileSys[0].State = FM_TABLE_ENTRY_ENABLED;
+    strncpy(Table.FileSys[0].Name, "/cf", sizeof(Table.FileSys[0].Name) - 1);
+    Table.FileSys[1].State = FM_TABLE_ENTRY_DISABLED;
+    strncpy(Table.FileSys[1].Name, "/cf/logs/", sizeof(Table.FileSys[1].Name) - 1);
+    Table.FileSys[2].State = FM_TABLE_ENTRY_UNUSED;
+    strncpy(Table.FileSys[2].Name, "/ram", sizeof(Table.FileSys[2].Name) - 1);
+
+    /* Table not loaded */
+    UtAssert_UINT32_EQ(FM_GetVolumeIndex("/cf/a"), FM_TABLE_ENTRY_COUNT);
+
+    FM_GlobalData.FreeSpaceTablePtr = &Table;
+
+    UtAssert_UINT32_EQ(FM_GetVolumeIndex("/cf/a"), 0);
+    UtAssert_UINT32_EQ(FM_GetVolumeIndex("/cf"), 0);
+
+    /* Most specific mount point */
+    UtAssert_UINT32_EQ(FM_GetVolumeIndex("/cf/logs/b"), 1);
+
+    /* Partial path components and unused entries do not match */
+    UtAssert_UINT32_EQ(FM_GetVolumeIndex("/cfx/a"), FM_TABLE_ENTRY_COUNT);
+    UtAssert_UINT32_EQ(FM_GetVolumeIndex("/ram/a"), FM_TABLE_ENTRY_COUNT);
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -575,8 +945,15 @@ void UtTest_Setup(void)
 {
     UtTest_Add(Test_FM_IsValidCmdPktLength, FM_Test_Setup, FM_Test_Teardown, "Test_FM_IsValidCmdPktLength");
     UtTest_Add(Test_FM_VerifyOverwrite, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyOverwrite");
+
+    UtTest_Add(Test_FM_VerifyCRCType, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyCRCType");
     UtTest_Add(Test_FM_GetOpenFilesData, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetOpenFilesData");
+
+    UtTest_Add(Test_FM_GetOpenFilesData_ListFull, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetOpenFilesData_ListFull");
     UtTest_Add(Test_FM_GetFilenameState, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetFilenameState");
+    UtTest_Add(Test_FM_GetFilenameStateFromList, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetFilenameStateFromList");
     UtTest_Add(Test_FM_VerifyNameValid, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyNameValid");
     UtTest_Add(Test_FM_VerifyFileClosed, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyFileClosed");
     UtTest_Add(Test_FM_VerifyFileExists, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyFileExists");
@@ -585,6 +962,19 @@ void UtTest_Setup(void)
     UtTest_Add(Test_FM_VerifyDirExists, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyDirExists");
     UtTest_Add(Test_FM_VerifyDirNoExist, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyDirNoExist");
     UtTest_Add(Test_FM_VerifyChildTask, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyChildTask");
+    UtTest_Add(Test_FM_VerifyChildTask_PendingFile, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_VerifyChildTask_PendingFile");
+    UtTest_Add(Test_FM_VerifyChildTask_AllEntriesBusy, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_VerifyChildTask_AllEntriesBusy");
+    UtTest_Add(Test_FM_GetChildQueueLane, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetChildQueueLane");
     UtTest_Add(Test_FM_InvokeChildTask, FM_Test_Setup, FM_Test_Teardown, "Test_FM_InvokeChildTask");
+    UtTest_Add(Test_FM_InvokeChildTask_LanePushFail, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_InvokeChildTask_LanePushFail");
+    UtTest_Add(Test_FM_InvokeChildTask_PendingFile, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_InvokeChildTask_PendingFile");
+    UtTest_Add(Test_FM_InvokeChildTask_PendingInteractive, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_InvokeChildTask_PendingInteractive");
+    UtTest_Add(Test_FM_InvokeChildTask_JobID, FM_Test_Setup, FM_Test_Teardown, "Test_FM_InvokeChildTask_JobID");
     UtTest_Add(Test_FM_AppendPathSep, FM_Test_Setup, FM_Test_Teardown, "Test_FM_AppendPathSep");
+    UtTest_Add(Test_FM_GetVolumeIndex, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetVolumeIndex");
 }
@@ -31,6 +31,8 @@
 #include "fm_child.h"
 #include "fm_cmds.h"
 #include "fm_cmd_utils.h"
+#include "fm_queue.h"
+#include "fm_throttle.h"
 #include "fm_perfids.h"
 #include "fm_platform_cfg.h"
 #include "fm_verify.h"
@@ -191,11 +193,13 @@ void Test_FM_CopyFileCmd_Success(void)
 {
     strncpy(UT_CmdBuf.CopyFileCmd.Source, "src1", sizeof(UT_CmdBuf.CopyFileCmd.Source) - 1);
     strncpy(UT_CmdBuf.CopyFileCmd.Target, "tgt", sizeof(UT_CmdBuf.CopyFileCmd.Target) - 1);
+    UT_CmdBuf.CopyFileCmd.CRCType = CFE_MISSION_ES_CRC_16;
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
@@ -209,17 +213,195 @@ void Test_FM_CopyFileCmd_Success(void)
     UtAssert_True(Result == true, "FM_CopyFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_COPY_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_COPY_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.FileInfoCRC, CFE_MISSION_ES_CRC_16);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.Verify, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.Sparse, 0);
+}
+
+void Test_FM_CopyFileCmd_Sparse(void)
+{
+    UT_CmdBuf.CopyFileCmd.Sparse              = 1;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    UtAssert_BOOL_TRUE(FM_CopyFileCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_COPY_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.Sparse, 1);
+}
+
+void Test_FM_CopyFileCmd_BadSparse(void)
+{
+    UT_CmdBuf.CopyFileCmd.Sparse              = 2;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
+
+    UtAssert_BOOL_FALSE(FM_CopyFileCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_SPARSE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
+    UtAssert_STUB_COUNT(FM_VerifyFileExists, 0);
+}
+
+void Test_FM_CopyFileCmd_Link(void)
+{
+    strncpy(UT_CmdBuf.CopyFileCmd.Source, "src1", sizeof(UT_CmdBuf.CopyFileCmd.Source) - 1);
+    strncpy(UT_CmdBuf.CopyFileCmd.Target, "tgt", sizeof(UT_CmdBuf.CopyFileCmd.Target) - 1);
+    UT_CmdBuf.CopyFileCmd.Link                = FM_COPY_LINK_HARD;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    // Same volume
+    UtAssert_BOOL_TRUE(FM_CopyFileCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_COPY_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.Link, FM_COPY_LINK_HARD);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.CrossVolume, 0);
+
+    // Known different volumes, the child task copies the file data
+    UT_SetDeferredRetcode(UT_KEY(FM_GetVolumeIndex), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(FM_GetVolumeIndex), 1, 1);
+
+    UtAssert_BOOL_TRUE(FM_CopyFileCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.CrossVolume, 1);
+    UtAssert_STUB_COUNT(FM_GetVolumeIndex, 4);
+}
+
+void Test_FM_CopyFileCmd_BadLink(void)
+{
+    UT_CmdBuf.CopyFileCmd.Link                = FM_COPY_LINK_CLONE + 1;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
+
+    UtAssert_BOOL_FALSE(FM_CopyFileCmd(&UT_CmdBuf.Buf));
+
+    // No CRC can be computed for a linked copy
+    UT_CmdBuf.CopyFileCmd.Link    = FM_COPY_LINK_CLONE;
+    UT_CmdBuf.CopyFileCmd.CRCType = CFE_MISSION_ES_CRC_16;
+
+    UtAssert_BOOL_FALSE(FM_CopyFileCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_LINK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_COPY_LINK_ERR_EID);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
+    UtAssert_STUB_COUNT(FM_VerifyFileExists, 0);
+}
+
+void Test_FM_CopyFileCmd_LinkSameFile(void)
+{
+    strncpy(UT_CmdBuf.CopyFileCmd.Source, "src1", sizeof(UT_CmdBuf.CopyFileCmd.Source) - 1);
+    strncpy(UT_CmdBuf.CopyFileCmd.Target, "src1", sizeof(UT_CmdBuf.CopyFileCmd.Target) - 1);
+    UT_CmdBuf.CopyFileCmd.Overwrite           = 1;
+    UT_CmdBuf.CopyFileCmd.Link                = FM_COPY_LINK_HARD;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
+
+    // Overwriting the target would delete the source file
+    UtAssert_BOOL_FALSE(FM_CopyFileCmd(&UT_CmdBuf.Buf));
+
+    UT_CmdBuf.CopyFileCmd.Link = FM_COPY_LINK_CLONE;
+
+    UtAssert_BOOL_FALSE(FM_CopyFileCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_LINK_SAME_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_COPY_LINK_SAME_ERR_EID);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
+    UtAssert_STUB_COUNT(FM_VerifyFileExists, 0);
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+}
+
+void Test_FM_CopyFileCmd_Verify(void)
+{
+    UT_CmdBuf.CopyFileCmd.CRCType             = CFE_MISSION_ES_CRC_32;
+    UT_CmdBuf.CopyFileCmd.Verify              = 1;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    UtAssert_BOOL_TRUE(FM_CopyFileCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_COPY_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.FileInfoCRC, CFE_MISSION_ES_CRC_32);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.Verify, 1);
+}
+
+void Test_FM_CopyFileCmd_BadVerify(void)
+{
+    UT_CmdBuf.CopyFileCmd.CRCType             = CFE_MISSION_ES_CRC_16;
+    UT_CmdBuf.CopyFileCmd.Verify              = 2;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
+
+    UtAssert_BOOL_FALSE(FM_CopyFileCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_VERIFY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
+    UtAssert_STUB_COUNT(FM_VerifyFileExists, 0);
+
+    /* Read back needs a CRC to compare */
+    UT_CmdBuf.CopyFileCmd.CRCType = FM_IGNORE_CRC;
+    UT_CmdBuf.CopyFileCmd.Verify  = 1;
+
+    UtAssert_BOOL_FALSE(FM_CopyFileCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_COPY_VERIFY_ERR_EID);
+    UtAssert_STUB_COUNT(FM_VerifyFileExists, 0);
 }
 
 void Test_FM_CopyFileCmd_BadLength(void)
 {
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
@@ -233,17 +415,43 @@ void Test_FM_CopyFileCmd_BadLength(void)
     UtAssert_True(Result == false, "FM_CopyFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_CopyFileCmd_BadOverwrite(void)
 {
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    bool Result = FM_CopyFileCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_CopyFileCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
+}
+
+void Test_FM_CopyFileCmd_BadCRCType(void)
+{
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
@@ -257,17 +465,19 @@ void Test_FM_CopyFileCmd_BadOverwrite(void)
     UtAssert_True(Result == false, "FM_CopyFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
+    UtAssert_STUB_COUNT(FM_VerifyFileExists, 0);
 }
 
 void Test_FM_CopyFileCmd_SourceNotExist(void)
 {
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
@@ -281,17 +491,18 @@ void Test_FM_CopyFileCmd_SourceNotExist(void)
     UtAssert_True(Result == false, "FM_CopyFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_CopyFileCmd_NoOverwriteTargetExists(void)
 {
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
@@ -305,7 +516,7 @@ void Test_FM_CopyFileCmd_NoOverwriteTargetExists(void)
     UtAssert_True(Result == false, "FM_CopyFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_CopyFileCmd_OverwriteFileOpen(void)
@@ -313,10 +524,11 @@ void Test_FM_CopyFileCmd_OverwriteFileOpen(void)
 
     UT_CmdBuf.CopyFileCmd.Overwrite         = 1;
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), false);
@@ -330,17 +542,18 @@ void Test_FM_CopyFileCmd_OverwriteFileOpen(void)
     UtAssert_True(Result == false, "FM_CopyFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_CopyFileCmd_NoChildTask(void)
 {
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
@@ -354,7 +567,7 @@ void Test_FM_CopyFileCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_CopyFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void add_FM_CopyFileCmd_tests(void)
@@ -365,6 +578,18 @@ void add_FM_CopyFileCmd_tests(void)
 
     UtTest_Add(Test_FM_CopyFileCmd_BadOverwrite, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyFileCmd_BadOverwrite");
 
+    UtTest_Add(Test_FM_CopyFileCmd_BadCRCType, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyFileCmd_BadCRCType");
+
+    UtTest_Add(Test_FM_CopyFileCmd_Verify, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyFileCmd_Verify");
+
+    UtTest_Add(Test_FM_CopyFileCmd_BadVerify, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyFileCmd_BadVerify");
+    UtTest_Add(Test_FM_CopyFileCmd_Sparse, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyFileCmd_Sparse");
+    UtTest_Add(Test_FM_CopyFileCmd_BadSparse, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyFileCmd_BadSparse");
+    UtTest_Add(Test_FM_CopyFileCmd_Link, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyFileCmd_Link");
+    UtTest_Add(Test_FM_CopyFileCmd_BadLink, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyFileCmd_BadLink");
+    UtTest_Add(Test_FM_CopyFileCmd_LinkSameFile, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CopyFileCmd_LinkSameFile");
+
     UtTest_Add(Test_FM_CopyFileCmd_SourceNotExist, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_CopyFileCmd_SourceNotExist");
 
@@ -385,7 +610,7 @@ void Test_FM_MoveFileCmd_Success(void)
 {
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
@@ -402,14 +627,44 @@ void Test_FM_MoveFileCmd_Success(void)
     UtAssert_True(Result == true, "FM_MoveFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_MOVE_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_MOVE_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.CrossVolume, 0);
+}
+
+void Test_FM_MoveFileCmd_CrossVolume(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Source and target on different known volumes */
+    UT_SetDeferredRetcode(UT_KEY(FM_GetVolumeIndex), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(FM_GetVolumeIndex), 1, 1);
+
+    UtAssert_BOOL_TRUE(FM_MoveFileCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.CrossVolume, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.FileInfoCRC, CFE_MISSION_ES_DEFAULT_CRC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.Verify, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.Sparse, 0);
+
+    /* Target volume unknown, the child task tries a rename first */
+    UT_SetDeferredRetcode(UT_KEY(FM_GetVolumeIndex), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(FM_GetVolumeIndex), 1, FM_TABLE_ENTRY_COUNT);
+
+    UtAssert_BOOL_TRUE(FM_MoveFileCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.CrossVolume, 0);
+    UtAssert_STUB_COUNT(FM_GetVolumeIndex, 4);
 }
 
 void Test_FM_MoveFileCmd_BadLength(void)
 {
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
@@ -426,13 +681,13 @@ void Test_FM_MoveFileCmd_BadLength(void)
     UtAssert_True(Result == false, "FM_MoveFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_MoveFileCmd_BadOverwrite(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), false);
@@ -449,13 +704,13 @@ void Test_FM_MoveFileCmd_BadOverwrite(void)
     UtAssert_True(Result == false, "FM_MoveFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_MoveFileCmd_SourceNotExist(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
@@ -472,13 +727,13 @@ void Test_FM_MoveFileCmd_SourceNotExist(void)
     UtAssert_True(Result == false, "FM_MoveFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_MoveFileCmd_NoOverwriteTargetExists(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
@@ -495,14 +750,14 @@ void Test_FM_MoveFileCmd_NoOverwriteTargetExists(void)
     UtAssert_True(Result == false, "FM_MoveFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_MoveFileCmd_OverwriteFileOpen(void)
 {
     UT_CmdBuf.MoveFileCmd.Overwrite         = 1;
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
@@ -519,13 +774,13 @@ void Test_FM_MoveFileCmd_OverwriteFileOpen(void)
     UtAssert_True(Result == false, "FM_MoveFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_MoveFileCmd_NoChildTask(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
@@ -542,13 +797,15 @@ void Test_FM_MoveFileCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_MoveFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void add_FM_MoveFileCmd_tests(void)
 {
     UtTest_Add(Test_FM_MoveFileCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_MoveFileCmd_Success");
 
+    UtTest_Add(Test_FM_MoveFileCmd_CrossVolume, FM_Test_Setup, FM_Test_Teardown, "Test_FM_MoveFileCmd_CrossVolume");
+
     UtTest_Add(Test_FM_MoveFileCmd_BadLength, FM_Test_Setup, FM_Test_Teardown, "Test_FM_MoveFileCmd_BadLength");
 
     UtTest_Add(Test_FM_MoveFileCmd_BadOverwrite, FM_Test_Setup, FM_Test_Teardown, "Test_FM_MoveFileCmd_BadOverwrite");
@@ -575,7 +832,7 @@ void Test_FM_RenameFileCmd_Success(void)
     strncpy(UT_CmdBuf.RenameFileCmd.Target, "tgt", sizeof(UT_CmdBuf.RenameFileCmd.Target) - 1);
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -590,13 +847,13 @@ void Test_FM_RenameFileCmd_Success(void)
     UtAssert_True(Result == true, "FM_RenameFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_RENAME_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_RENAME_CC);
 }
 
 void Test_FM_RenameFileCmd_BadLength(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -611,13 +868,13 @@ void Test_FM_RenameFileCmd_BadLength(void)
     UtAssert_True(Result == false, "FM_RenameFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_RenameFileCmd_SourceNotExist(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), false);
@@ -632,13 +889,13 @@ void Test_FM_RenameFileCmd_SourceNotExist(void)
     UtAssert_True(Result == false, "FM_RenameFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_RenameFileCmd_TargetExists(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -653,13 +910,13 @@ void Test_FM_RenameFileCmd_TargetExists(void)
     UtAssert_True(Result == false, "FM_RenameFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_RenameFileCmd_NoChildTask(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -674,7 +931,7 @@ void Test_FM_RenameFileCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_RenameFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void add_FM_RenameFileCmd_tests(void)
@@ -699,7 +956,7 @@ void add_FM_RenameFileCmd_tests(void)
 void Test_FM_DeleteFileCmd_Success(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     CFE_MSG_FcnCode_t forced_CmdCode = FM_DELETE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
@@ -716,13 +973,13 @@ void Test_FM_DeleteFileCmd_Success(void)
     UtAssert_True(Result == true, "FM_DeleteFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_DELETE_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_DELETE_CC);
 }
 
 void Test_FM_DeleteFileCmd_BadLength(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     CFE_MSG_FcnCode_t forced_CmdCode = FM_DELETE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
@@ -739,13 +996,13 @@ void Test_FM_DeleteFileCmd_BadLength(void)
     UtAssert_True(Result == false, "FM_DeleteFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_DeleteFileCmd_FileNotClosed(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     CFE_MSG_FcnCode_t forced_CmdCode = FM_DELETE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
@@ -762,13 +1019,13 @@ void Test_FM_DeleteFileCmd_FileNotClosed(void)
     UtAssert_True(Result == false, "FM_DeleteFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_DeleteFileCmd_NoChildTask(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     CFE_MSG_FcnCode_t forced_CmdCode = FM_DELETE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
@@ -785,7 +1042,7 @@ void Test_FM_DeleteFileCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_DeleteFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void add_FM_DeleteFileCmd_tests(void)
@@ -809,7 +1066,7 @@ void Test_FM_DeleteAllFilesCmd_Success(void)
     strncpy(UT_CmdBuf.DeleteAllCmd.Directory, "dir", sizeof(UT_CmdBuf.DeleteAllCmd.Directory) - 1);
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -823,13 +1080,13 @@ void Test_FM_DeleteAllFilesCmd_Success(void)
     UtAssert_True(Result == true, "FM_DeleteAllFilesCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_DELETE_ALL_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_DELETE_ALL_CC);
 }
 
 void Test_FM_DeleteAllFilesCmd_BadLength(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -843,13 +1100,13 @@ void Test_FM_DeleteAllFilesCmd_BadLength(void)
     UtAssert_True(Result == false, "FM_DeleteAllFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_DeleteAllFilesCmd_DirNoExist(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
@@ -863,14 +1120,14 @@ void Test_FM_DeleteAllFilesCmd_DirNoExist(void)
     UtAssert_True(Result == false, "FM_DeleteAllFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_DeleteAllFilesCmd_NoChildTask(void)
 {
     strncpy(UT_CmdBuf.DeleteAllCmd.Directory, "dir", sizeof(UT_CmdBuf.DeleteAllCmd.Directory) - 1);
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -884,7 +1141,7 @@ void Test_FM_DeleteAllFilesCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_DeleteAllFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void add_FM_DeleteAllFilesCmd_tests(void)
@@ -910,7 +1167,7 @@ void Test_FM_DecompressFileCmd_Success(void)
 {
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
@@ -925,13 +1182,13 @@ void Test_FM_DecompressFileCmd_Success(void)
     UtAssert_True(Result == true, "FM_DecompressFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_DECOMPRESS_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_DECOMPRESS_CC);
 }
 
 void Test_FM_DecompressFileCmd_BadLength(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
@@ -946,13 +1203,13 @@ void Test_FM_DecompressFileCmd_BadLength(void)
     UtAssert_True(Result == false, "FM_DecompressFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_DecompressFileCmd_SourceFileOpen(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), false);
@@ -967,13 +1224,13 @@ void Test_FM_DecompressFileCmd_SourceFileOpen(void)
     UtAssert_True(Result == false, "FM_DecompressFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_DecompressFileCmd_TargetFileExists(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
@@ -988,13 +1245,13 @@ void Test_FM_DecompressFileCmd_TargetFileExists(void)
     UtAssert_True(Result == false, "FM_DecompressFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_DecompressFileCmd_NoChildTask(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
@@ -1009,7 +1266,7 @@ void Test_FM_DecompressFileCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_DecompressFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void add_FM_DecompressFileCmd_tests(void)
@@ -1040,11 +1297,13 @@ void Test_FM_ConcatFilesCmd_Success(void)
     strncpy(UT_CmdBuf.ConcatCmd.Source1, "src1", sizeof(UT_CmdBuf.ConcatCmd.Source1) - 1);
     strncpy(UT_CmdBuf.ConcatCmd.Source2, "src2", sizeof(UT_CmdBuf.ConcatCmd.Source2) - 1);
     strncpy(UT_CmdBuf.ConcatCmd.Target, "tgt", sizeof(UT_CmdBuf.ConcatCmd.Target) - 1);
+    UT_CmdBuf.ConcatCmd.CRCType = CFE_MISSION_ES_CRC_32;
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -1057,15 +1316,38 @@ void Test_FM_ConcatFilesCmd_Success(void)
     UtAssert_True(Result == true, "FM_ConcatFilesCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_CONCAT_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_CONCAT_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.FileInfoCRC, CFE_MISSION_ES_CRC_32);
 }
 
 void Test_FM_ConcatFilesCmd_BadLength(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    bool Result                  = FM_ConcatFilesCmd(&UT_CmdBuf.Buf);
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_ConcatFilesCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
+}
+
+void Test_FM_ConcatFilesCmd_BadCRCType(void)
+{
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -1077,15 +1359,17 @@ void Test_FM_ConcatFilesCmd_BadLength(void)
     UtAssert_True(Result == false, "FM_ConcatFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
+    UtAssert_STUB_COUNT(FM_VerifyFileClosed, 0);
 }
 
 void Test_FM_ConcatFilesCmd_SourceFile1NotClosed(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -1097,15 +1381,16 @@ void Test_FM_ConcatFilesCmd_SourceFile1NotClosed(void)
     UtAssert_True(Result == false, "FM_ConcatFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_ConcatFilesCmd_SourceFile2NotClosed(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
     UT_SetDeferredRetcode(UT_KEY(FM_VerifyFileClosed), 2, false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
@@ -1118,15 +1403,16 @@ void Test_FM_ConcatFilesCmd_SourceFile2NotClosed(void)
     UtAssert_True(Result == false, "FM_ConcatFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_ConcatFilesCmd_TargetFileExists(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -1138,15 +1424,16 @@ void Test_FM_ConcatFilesCmd_TargetFileExists(void)
     UtAssert_True(Result == false, "FM_ConcatFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_ConcatFilesCmd_NoChildTask(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
@@ -1158,7 +1445,7 @@ void Test_FM_ConcatFilesCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_ConcatFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void add_FM_ConcatFilesCmd_tests(void)
@@ -1167,6 +1454,8 @@ void add_FM_ConcatFilesCmd_tests(void)
 
     UtTest_Add(Test_FM_ConcatFilesCmd_BadLength, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ConcatFilesCmd_BadLength");
 
+    UtTest_Add(Test_FM_ConcatFilesCmd_BadCRCType, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ConcatFilesCmd_BadCRCType");
+
     UtTest_Add(Test_FM_ConcatFilesCmd_SourceFile1NotClosed, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ConcatFilesCmd_SourceFile1NotClosed");
 
@@ -1189,7 +1478,7 @@ void Test_FM_GetFileInfoCmd_Success(void)
     strncpy(UT_CmdBuf.GetFileInfoCmd.Filename, "file", sizeof(UT_CmdBuf.GetFileInfoCmd.Filename) - 1);
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyNameValid), true);
@@ -1203,13 +1492,13 @@ void Test_FM_GetFileInfoCmd_Success(void)
     UtAssert_True(Result == true, "FM_GetFileInfoCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_GET_FILE_INFO_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_GET_FILE_INFO_CC);
 }
 
 void Test_FM_GetFileInfoCmd_BadLength(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyNameValid), true);
@@ -1223,13 +1512,13 @@ void Test_FM_GetFileInfoCmd_BadLength(void)
     UtAssert_True(Result == false, "FM_GetFileInfoCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_GetFileInfoCmd_InvalidName(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyNameValid), false);
@@ -1243,13 +1532,13 @@ void Test_FM_GetFileInfoCmd_InvalidName(void)
     UtAssert_True(Result == false, "FM_GetFileInfoCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_GetFileInfoCmd_NoChildTask(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyNameValid), true);
@@ -1263,7 +1552,7 @@ void Test_FM_GetFileInfoCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_GetFileInfoCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void add_FM_GetFileInfoCmd_tests(void)
@@ -1339,7 +1628,7 @@ void Test_FM_CreateDirectoryCmd_Success(void)
 {
     strncpy(UT_CmdBuf.CreateDirCmd.Directory, "dir", sizeof(UT_CmdBuf.CreateDirCmd.Directory) - 1);
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirNoExist), true);
@@ -1353,13 +1642,13 @@ void Test_FM_CreateDirectoryCmd_Success(void)
     UtAssert_True(Result == true, "FM_CreateDirectoryCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_CREATE_DIR_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_CREATE_DIR_CC);
 }
 
 void Test_FM_CreateDirectoryCmd_BadLength(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirNoExist), true);
@@ -1373,13 +1662,13 @@ void Test_FM_CreateDirectoryCmd_BadLength(void)
     UtAssert_True(Result == false, "FM_CreateDirectoryCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_CreateDirectoryCmd_DirExists(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirNoExist), false);
@@ -1393,13 +1682,13 @@ void Test_FM_CreateDirectoryCmd_DirExists(void)
     UtAssert_True(Result == false, "FM_CreateDirectoryCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_CreateDirectoryCmd_NoChildTask(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirNoExist), true);
@@ -1413,7 +1702,7 @@ void Test_FM_CreateDirectoryCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_CreateDirectoryCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void add_FM_CreateDirectoryCmd_tests(void)
@@ -1439,7 +1728,7 @@ void Test_FM_DeleteDirectoryCmd_Success(void)
 {
     strncpy(UT_CmdBuf.DeleteDirCmd.Directory, "dir", sizeof(UT_CmdBuf.DeleteDirCmd.Directory) - 1);
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -1453,13 +1742,13 @@ void Test_FM_DeleteDirectoryCmd_Success(void)
     UtAssert_True(Result == true, "FM_DeleteDirectoryCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_DELETE_DIR_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_DELETE_DIR_CC);
 }
 
 void Test_FM_DeleteDirectoryCmd_BadLength(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -1473,13 +1762,13 @@ void Test_FM_DeleteDirectoryCmd_BadLength(void)
     UtAssert_True(Result == false, "FM_DeleteDirectoryCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_DeleteDirectoryCmd_DirNoExist(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
@@ -1493,13 +1782,13 @@ void Test_FM_DeleteDirectoryCmd_DirNoExist(void)
     UtAssert_True(Result == false, "FM_DeleteDirectoryCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_DeleteDirectoryCmd_NoChildTask(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -1513,7 +1802,7 @@ void Test_FM_DeleteDirectoryCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_DeleteDirectoryCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void add_FM_DeleteDirectoryCmd_tests(void)
@@ -1540,7 +1829,7 @@ void Test_FM_GetDirListFileCmd_Success(void)
     strncpy(UT_CmdBuf.GetDirFileCmd.Filename, "file", sizeof(UT_CmdBuf.GetDirFileCmd.Filename) - 1);
     strncpy(UT_CmdBuf.GetDirFileCmd.Directory, "dir", sizeof(UT_CmdBuf.GetDirFileCmd.Directory) - 1);
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -1555,7 +1844,7 @@ void Test_FM_GetDirListFileCmd_Success(void)
     UtAssert_True(Result == true, "FM_GetDirListFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_GET_DIR_FILE_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_GET_DIR_FILE_CC);
 }
 
 void Test_FM_GetDirListFileCmd_SuccessDefaultPath(void)
@@ -1563,7 +1852,7 @@ void Test_FM_GetDirListFileCmd_SuccessDefaultPath(void)
     strncpy(UT_CmdBuf.GetDirFileCmd.Directory, "dir", sizeof(UT_CmdBuf.GetDirFileCmd.Directory) - 1);
     UT_CmdBuf.GetDirFileCmd.Filename[0]     = '\0';
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -1578,13 +1867,13 @@ void Test_FM_GetDirListFileCmd_SuccessDefaultPath(void)
     UtAssert_True(Result == true, "FM_GetDirListFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_GET_DIR_FILE_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_GET_DIR_FILE_CC);
 }
 
 void Test_FM_GetDirListFileCmd_BadLength(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -1599,13 +1888,13 @@ void Test_FM_GetDirListFileCmd_BadLength(void)
     UtAssert_True(Result == false, "FM_GetDirListFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_GetDirListFileCmd_SourceNotExist(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
@@ -1620,7 +1909,7 @@ void Test_FM_GetDirListFileCmd_SourceNotExist(void)
     UtAssert_True(Result == false, "FM_GetDirListFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_GetDirListFileCmd_TargetFileOpen(void)
@@ -1629,7 +1918,7 @@ void Test_FM_GetDirListFileCmd_TargetFileOpen(void)
     strncpy(UT_CmdBuf.GetDirFileCmd.Directory, "dir", sizeof(UT_CmdBuf.GetDirFileCmd.Directory) - 1);
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -1644,7 +1933,7 @@ void Test_FM_GetDirListFileCmd_TargetFileOpen(void)
     UtAssert_True(Result == false, "FM_GetDirListFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_GetDirListFileCmd_NoChildTask(void)
@@ -1653,7 +1942,7 @@ void Test_FM_GetDirListFileCmd_NoChildTask(void)
     strncpy(UT_CmdBuf.GetDirFileCmd.Directory, "dir", sizeof(UT_CmdBuf.GetDirFileCmd.Directory) - 1);
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -1668,7 +1957,7 @@ void Test_FM_GetDirListFileCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_GetDirListFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void add_FM_GetDirListFileCmd_tests(void)
@@ -1700,7 +1989,7 @@ void Test_FM_GetDirListPktCmd_Success(void)
     strncpy(UT_CmdBuf.GetDirPktCmd.Directory, "dir", sizeof(UT_CmdBuf.GetDirPktCmd.Directory) - 1);
 
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -1714,13 +2003,13 @@ void Test_FM_GetDirListPktCmd_Success(void)
     UtAssert_True(Result == true, "FM_GetDirListPktCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_GET_DIR_PKT_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_GET_DIR_PKT_CC);
 }
 
 void Test_FM_GetDirListPktCmd_BadLength(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -1734,13 +2023,13 @@ void Test_FM_GetDirListPktCmd_BadLength(void)
     UtAssert_True(Result == false, "FM_GetDirListPktCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_GetDirListPktCmd_SourceNotExist(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
@@ -1754,13 +2043,13 @@ void Test_FM_GetDirListPktCmd_SourceNotExist(void)
     UtAssert_True(Result == false, "FM_GetDirListPktCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_GetDirListPktCmd_NoChildTask(void)
 {
     FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
@@ -1774,7 +2063,7 @@ void Test_FM_GetDirListPktCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_GetDirListPktCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void add_FM_GetDirListPktCmd_tests(void)
@@ -2198,7 +2487,7 @@ void Test_FM_SetPermissionsCmd_Success(void)
     UtAssert_True(Result == true, "FM_SetPermissionsCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_SET_FILE_PERM_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_SET_FILE_PERM_CC);
 }
 
 void Test_FM_SetPermissionsCmd_BadLength(void)
@@ -2215,7 +2504,7 @@ void Test_FM_SetPermissionsCmd_BadLength(void)
     UtAssert_True(Result == false, "FM_SetPermissionsCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_SetPermissionsCmd_BadName(void)
@@ -2232,7 +2521,7 @@ void Test_FM_SetPermissionsCmd_BadName(void)
     UtAssert_True(Result == false, "FM_SetPermissionsCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void Test_FM_SetPermissionsCmd_NoChildTask(void)
@@ -2249,7 +2538,7 @@ void Test_FM_SetPermissionsCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_SetPermissionsCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
 }
 
 void add_FM_SetPermissionsCmd_tests(void)
@@ -2265,6 +2554,1245 @@ void add_FM_SetPermissionsCmd_tests(void)
                "Test_FM_SetPermissionsCmd_NoChildTask");
 }
 
+/****************************/
+/* Abort Tests              */
+/****************************/
+
+void Test_FM_AbortCmd_Success(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "%%s command: job = %%lu");
+
+    UT_CmdBuf.AbortCmd.JobID                                = 3;
+    FM_GlobalData.ChildLastJobID                            = 5;
+    FM_GlobalData.ChildAbortIndex                           = FM_CHILD_ABORT_COUNT - 1;
+    FM_GlobalData.ChildAbortJobID[0]                        = 1;
+    FM_GlobalData.ChildAbortJobID[FM_CHILD_ABORT_COUNT - 1] = 2;
+
+    /* Job is executing in the last worker */
+    FM_GlobalData.ChildWorker[FM_CHILD_WORKER_COUNT - 1].Status.CurrentJobID = 3;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+
+    bool Result = FM_AbortCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == true, "FM_AbortCmd returned true");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ABORT_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    /* Oldest abort request is replaced and the index wraps */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildAbortJobID[FM_CHILD_ABORT_COUNT - 1], 3);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildAbortJobID[0], 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildAbortIndex, 0);
+
+    /* Both lanes and the pending commands file are searched under the dequeue mutex */
+    UtAssert_STUB_COUNT(FM_QueueLaneAbort, 2);
+    UtAssert_STUB_COUNT(FM_QueuePendingAbort, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void Test_FM_AbortCmd_Queued(void)
+{
+    UT_CmdBuf.AbortCmd.JobID     = 3;
+    FM_GlobalData.ChildLastJobID = 5;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueueLaneAbort), true);
+
+    bool Result = FM_AbortCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == true, "FM_AbortCmd returned true");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ABORT_CMD_EID);
+
+    /* Command is marked in the lane, the abort list is left for executing jobs */
+    UtAssert_STUB_COUNT(FM_QueueLaneAbort, 1);
+    UtAssert_STUB_COUNT(FM_QueuePendingAbort, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildAbortJobID[0], 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildAbortIndex, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void Test_FM_AbortCmd_Pending(void)
+{
+    UT_CmdBuf.AbortCmd.JobID     = 3;
+    FM_GlobalData.ChildLastJobID = 5;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_QueuePendingAbort), true);
+
+    bool Result = FM_AbortCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == true, "FM_AbortCmd returned true");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ABORT_CMD_EID);
+
+    UtAssert_STUB_COUNT(FM_QueueLaneAbort, 2);
+    UtAssert_STUB_COUNT(FM_QueuePendingAbort, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildAbortJobID[0], 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildAbortIndex, 0);
+}
+
+void Test_FM_AbortCmd_NotQueuedOrActive(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "%%s error: job is not queued or active: job = %%lu");
+
+    /* Job has completed, a later job is executing */
+    UT_CmdBuf.AbortCmd.JobID                         = 3;
+    FM_GlobalData.ChildLastJobID                     = 5;
+    FM_GlobalData.ChildWorker[0].Status.CurrentJobID = 4;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+
+    bool Result = FM_AbortCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_AbortCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ABORT_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildAbortJobID[0], 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildAbortIndex, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void Test_FM_AbortCmd_BadLength(void)
+{
+    UT_CmdBuf.AbortCmd.JobID     = 1;
+    FM_GlobalData.ChildLastJobID = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
+
+    bool Result = FM_AbortCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_AbortCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildAbortJobID[0], 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildAbortIndex, 0);
+}
+
+void Test_FM_AbortCmd_JobIDNone(void)
+{
+    UT_CmdBuf.AbortCmd.JobID     = FM_CHILD_JOB_ID_NONE;
+    FM_GlobalData.ChildLastJobID = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+
+    bool Result = FM_AbortCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_AbortCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ABORT_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildAbortIndex, 0);
+}
+
+void Test_FM_AbortCmd_JobIDNotAssigned(void)
+{
+    UT_CmdBuf.AbortCmd.JobID     = 6;
+    FM_GlobalData.ChildLastJobID = 5;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+
+    bool Result = FM_AbortCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_AbortCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ABORT_ARG_ERR_EID);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildAbortJobID[0], 0);
+}
+
+void add_FM_AbortCmd_tests(void)
+{
+    UtTest_Add(Test_FM_AbortCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_AbortCmd_Success");
+
+    UtTest_Add(Test_FM_AbortCmd_Queued, FM_Test_Setup, FM_Test_Teardown, "Test_FM_AbortCmd_Queued");
+
+    UtTest_Add(Test_FM_AbortCmd_Pending, FM_Test_Setup, FM_Test_Teardown, "Test_FM_AbortCmd_Pending");
+
+    UtTest_Add(Test_FM_AbortCmd_NotQueuedOrActive, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_AbortCmd_NotQueuedOrActive");
+
+    UtTest_Add(Test_FM_AbortCmd_BadLength, FM_Test_Setup, FM_Test_Teardown, "Test_FM_AbortCmd_BadLength");
+
+    UtTest_Add(Test_FM_AbortCmd_JobIDNone, FM_Test_Setup, FM_Test_Teardown, "Test_FM_AbortCmd_JobIDNone");
+
+    UtTest_Add(Test_FM_AbortCmd_JobIDNotAssigned, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_AbortCmd_JobIDNotAssigned");
+}
+
+/****************************/
+/* Set Throttle Tests       */
+/****************************/
+
+void Test_FM_SetThrottleCmd_Success(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "%%s command: bytes/sec = %%lu, stats/sec = %%lu, latency = %%lu usec");
+
+    FM_GlobalData.ChildBlockSize          = FM_CHILD_FILE_BLOCK_SIZE;
+    UT_CmdBuf.SetThrottleCmd.BytesPerSec  = FM_CHILD_FILE_BLOCK_SIZE;
+    UT_CmdBuf.SetThrottleCmd.StatsPerSec  = 10;
+    UT_CmdBuf.SetThrottleCmd.LatencyLimit = 5000;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+
+    bool Result = FM_SetThrottleCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == true, "FM_SetThrottleCmd returned true");
+
+    UtAssert_STUB_COUNT(FM_ThrottleSet, 1);
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_THROTTLE_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void Test_FM_SetThrottleCmd_Unlimited(void)
+{
+    UT_CmdBuf.SetThrottleCmd.BytesPerSec  = 0;
+    UT_CmdBuf.SetThrottleCmd.StatsPerSec  = 0;
+    UT_CmdBuf.SetThrottleCmd.LatencyLimit = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+
+    bool Result = FM_SetThrottleCmd(&UT_CmdBuf.Buf);
+
+    /* Assert */
+    UtAssert_True(Result == true, "FM_SetThrottleCmd returned true");
+
+    UtAssert_STUB_COUNT(FM_ThrottleSet, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_THROTTLE_CMD_EID);
+}
+
+void Test_FM_SetThrottleCmd_BadLength(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
+
+    bool Result = FM_SetThrottleCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_SetThrottleCmd returned false");
+
+    UtAssert_STUB_COUNT(FM_ThrottleSet, 0);
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_SetThrottleCmd_RateTooLow(void)
+{
+    FM_GlobalData.ChildBlockSize         = FM_CHILD_FILE_BLOCK_SIZE;
+    UT_CmdBuf.SetThrottleCmd.BytesPerSec = FM_CHILD_FILE_BLOCK_SIZE - 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+
+    bool Result = FM_SetThrottleCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_SetThrottleCmd returned false");
+
+    UtAssert_STUB_COUNT(FM_ThrottleSet, 0);
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_THROTTLE_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void Test_FM_SetThrottleCmd_RateBelowBlockSize(void)
+{
+    /* The minimum follows the commanded block size, not the startup size */
+    FM_GlobalData.ChildBlockSize         = FM_CHILD_MAX_BLOCK_SIZE;
+    UT_CmdBuf.SetThrottleCmd.BytesPerSec = FM_CHILD_MAX_BLOCK_SIZE - 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+
+    UtAssert_BOOL_FALSE(FM_SetThrottleCmd(&UT_CmdBuf.Buf));
+
+    UT_CmdBuf.SetThrottleCmd.BytesPerSec = FM_CHILD_MAX_BLOCK_SIZE;
+
+    UtAssert_BOOL_TRUE(FM_SetThrottleCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_ThrottleSet, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_THROTTLE_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_SET_THROTTLE_CMD_EID);
+}
+
+void add_FM_SetThrottleCmd_tests(void)
+{
+    UtTest_Add(Test_FM_SetThrottleCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SetThrottleCmd_Success");
+
+    UtTest_Add(Test_FM_SetThrottleCmd_Unlimited, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SetThrottleCmd_Unlimited");
+
+    UtTest_Add(Test_FM_SetThrottleCmd_BadLength, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SetThrottleCmd_BadLength");
+
+    UtTest_Add(Test_FM_SetThrottleCmd_RateTooLow, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetThrottleCmd_RateTooLow");
+
+    UtTest_Add(Test_FM_SetThrottleCmd_RateBelowBlockSize, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetThrottleCmd_RateBelowBlockSize");
+}
+
+/****************************/
+/* Set Block Size Tests     */
+/****************************/
+
+void Test_FM_SetBlockSizeCmd_Success(void)
+{
+    FM_GlobalData.ChildBlockSize        = FM_CHILD_FILE_BLOCK_SIZE;
+    UT_CmdBuf.SetBlockSizeCmd.BlockSize = FM_CHILD_MAX_BLOCK_SIZE;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+
+    UtAssert_BOOL_TRUE(FM_SetBlockSizeCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildBlockSize, FM_CHILD_MAX_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_BLOCK_SIZE_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void Test_FM_SetBlockSizeCmd_BadLength(void)
+{
+    FM_GlobalData.ChildBlockSize = FM_CHILD_FILE_BLOCK_SIZE;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
+
+    UtAssert_BOOL_FALSE(FM_SetBlockSizeCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildBlockSize, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_SetBlockSizeCmd_BadSize(void)
+{
+    FM_GlobalData.ChildBlockSize = FM_CHILD_FILE_BLOCK_SIZE;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+
+    /* Too small, too large for the buffers, then not aligned */
+    UT_CmdBuf.SetBlockSizeCmd.BlockSize = FM_CHILD_MIN_BLOCK_SIZE - FM_CHILD_BUFFER_ALIGNMENT;
+    UtAssert_BOOL_FALSE(FM_SetBlockSizeCmd(&UT_CmdBuf.Buf));
+
+    UT_CmdBuf.SetBlockSizeCmd.BlockSize = FM_CHILD_MAX_BLOCK_SIZE + FM_CHILD_BUFFER_ALIGNMENT;
+    UtAssert_BOOL_FALSE(FM_SetBlockSizeCmd(&UT_CmdBuf.Buf));
+
+    UT_CmdBuf.SetBlockSizeCmd.BlockSize = FM_CHILD_FILE_BLOCK_SIZE + 1;
+    UtAssert_BOOL_FALSE(FM_SetBlockSizeCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildBlockSize, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, FM_SET_BLOCK_SIZE_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void Test_FM_SetBlockSizeCmd_AboveThrottle(void)
+{
+    FM_GlobalData.ChildBlockSize           = FM_CHILD_FILE_BLOCK_SIZE;
+    FM_GlobalData.ChildThrottle.Bytes.Rate = FM_CHILD_FILE_BLOCK_SIZE * 2;
+    UT_CmdBuf.SetBlockSizeCmd.BlockSize    = FM_CHILD_FILE_BLOCK_SIZE * 4;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+
+    /* A block must pass the throttle at least once per second */
+    UtAssert_BOOL_FALSE(FM_SetBlockSizeCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildBlockSize, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_BLOCK_SIZE_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    UT_CmdBuf.SetBlockSizeCmd.BlockSize = FM_CHILD_FILE_BLOCK_SIZE * 2;
+
+    UtAssert_BOOL_TRUE(FM_SetBlockSizeCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildBlockSize, FM_CHILD_FILE_BLOCK_SIZE * 2);
+}
+
+void add_FM_SetBlockSizeCmd_tests(void)
+{
+    UtTest_Add(Test_FM_SetBlockSizeCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SetBlockSizeCmd_Success");
+
+    UtTest_Add(Test_FM_SetBlockSizeCmd_BadLength, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetBlockSizeCmd_BadLength");
+
+    UtTest_Add(Test_FM_SetBlockSizeCmd_BadSize, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SetBlockSizeCmd_BadSize");
+
+    UtTest_Add(Test_FM_SetBlockSizeCmd_AboveThrottle, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetBlockSizeCmd_AboveThrottle");
+}
+
+/****************************/
+/* Copy Directory Tests     */
+/****************************/
+
+void Test_FM_CopyDirCmd_Success(void)
+{
+    strncpy(UT_CmdBuf.CopyDirCmd.Source, "src", sizeof(UT_CmdBuf.CopyDirCmd.Source) - 1);
+    strncpy(UT_CmdBuf.CopyDirCmd.Target, "tgt", sizeof(UT_CmdBuf.CopyDirCmd.Target) - 1);
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
+    FM_GlobalData.ChildQueueEntry.Verify      = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    UtAssert_BOOL_TRUE(FM_CopyDirCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_VerifyDirNoExist, 1);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_COPY_DIR_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueueEntry.Source1, sizeof(FM_GlobalData.ChildQueueEntry.Source1),
+                          "src", sizeof("src"));
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueueEntry.Target, sizeof(FM_GlobalData.ChildQueueEntry.Target),
+                          "tgt", sizeof("tgt"));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.FileInfoCRC, FM_IGNORE_CRC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.Verify, 0);
+}
+
+void Test_FM_CopyDirCmd_OverwriteExistingDir(void)
+{
+    strncpy(UT_CmdBuf.CopyDirCmd.Source, "src", sizeof(UT_CmdBuf.CopyDirCmd.Source) - 1);
+    strncpy(UT_CmdBuf.CopyDirCmd.Target, "tgt", sizeof(UT_CmdBuf.CopyDirCmd.Target) - 1);
+    UT_CmdBuf.CopyDirCmd.Overwrite = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_DIRECTORY);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    UtAssert_BOOL_TRUE(FM_CopyDirCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyDirNoExist, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+}
+
+void Test_FM_CopyDirCmd_BadLength(void)
+{
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
+
+    UtAssert_BOOL_FALSE(FM_CopyDirCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyOverwrite, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, 0);
+}
+
+void Test_FM_CopyDirCmd_BadOverwrite(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), false);
+
+    UtAssert_BOOL_FALSE(FM_CopyDirCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyDirExists, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_CopyDirCmd_SourceNotDir(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
+
+    UtAssert_BOOL_FALSE(FM_CopyDirCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyDirNoExist, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_CopyDirCmd_TargetExists(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirNoExist), false);
+
+    UtAssert_BOOL_FALSE(FM_CopyDirCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_CopyDirCmd_TargetNested(void)
+{
+    strncpy(UT_CmdBuf.CopyDirCmd.Source, "src", sizeof(UT_CmdBuf.CopyDirCmd.Source) - 1);
+    strncpy(UT_CmdBuf.CopyDirCmd.Target, "src/tgt", sizeof(UT_CmdBuf.CopyDirCmd.Target) - 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    UtAssert_BOOL_FALSE(FM_CopyDirCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_DIR_TGT_NESTED_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void Test_FM_CopyDirCmd_NoChildTask(void)
+{
+    strncpy(UT_CmdBuf.CopyDirCmd.Source, "src", sizeof(UT_CmdBuf.CopyDirCmd.Source) - 1);
+    strncpy(UT_CmdBuf.CopyDirCmd.Target, "tgt", sizeof(UT_CmdBuf.CopyDirCmd.Target) - 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    UtAssert_BOOL_FALSE(FM_CopyDirCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void add_FM_CopyDirCmd_tests(void)
+{
+    UtTest_Add(Test_FM_CopyDirCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyDirCmd_Success");
+
+    UtTest_Add(Test_FM_CopyDirCmd_OverwriteExistingDir, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CopyDirCmd_OverwriteExistingDir");
+
+    UtTest_Add(Test_FM_CopyDirCmd_BadLength, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyDirCmd_BadLength");
+
+    UtTest_Add(Test_FM_CopyDirCmd_BadOverwrite, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyDirCmd_BadOverwrite");
+
+    UtTest_Add(Test_FM_CopyDirCmd_SourceNotDir, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyDirCmd_SourceNotDir");
+
+    UtTest_Add(Test_FM_CopyDirCmd_TargetExists, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyDirCmd_TargetExists");
+
+    UtTest_Add(Test_FM_CopyDirCmd_TargetNested, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyDirCmd_TargetNested");
+
+    UtTest_Add(Test_FM_CopyDirCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CopyDirCmd_NoChildTask");
+}
+
+/****************************/
+/* Delete Tree Tests        */
+/****************************/
+
+void Test_FM_DeleteTreeCmd_Success(void)
+{
+    strncpy(UT_CmdBuf.DeleteTreeCmd.Directory, "dir", sizeof(UT_CmdBuf.DeleteTreeCmd.Directory) - 1);
+    FM_GlobalData.ChildQueueEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    UtAssert_BOOL_TRUE(FM_DeleteTreeCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_DELETE_TREE_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueueEntry.Source1, sizeof(FM_GlobalData.ChildQueueEntry.Source1),
+                          "dir", sizeof("dir"));
+}
+
+void Test_FM_DeleteTreeCmd_BadLength(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
+
+    UtAssert_BOOL_FALSE(FM_DeleteTreeCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyDirExists, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_DeleteTreeCmd_DirNoExist(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
+
+    UtAssert_BOOL_FALSE(FM_DeleteTreeCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_DeleteTreeCmd_NoChildTask(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    UtAssert_BOOL_FALSE(FM_DeleteTreeCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void add_FM_DeleteTreeCmd_tests(void)
+{
+    UtTest_Add(Test_FM_DeleteTreeCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DeleteTreeCmd_Success");
+
+    UtTest_Add(Test_FM_DeleteTreeCmd_BadLength, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DeleteTreeCmd_BadLength");
+
+    UtTest_Add(Test_FM_DeleteTreeCmd_DirNoExist, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DeleteTreeCmd_DirNoExist");
+
+    UtTest_Add(Test_FM_DeleteTreeCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DeleteTreeCmd_NoChildTask");
+}
+
+/****************************/
+/* Delete Filter Tests      */
+/****************************/
+
+void UT_FM_DeleteFilterCmd_Setup(void)
+{
+    strncpy(UT_CmdBuf.DeleteFilterCmd.Directory, "dir", sizeof(UT_CmdBuf.DeleteFilterCmd.Directory) - 1);
+    strncpy(UT_CmdBuf.DeleteFilterCmd.Pattern, "*.tmp", sizeof(UT_CmdBuf.DeleteFilterCmd.Pattern) - 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+}
+
+void Test_FM_DeleteFilterCmd_Success(void)
+{
+    UT_FM_DeleteFilterCmd_Setup();
+    UT_CmdBuf.DeleteFilterCmd.MinAge  = 1;
+    UT_CmdBuf.DeleteFilterCmd.MaxAge  = 2;
+    UT_CmdBuf.DeleteFilterCmd.MinSize = 3;
+    UT_CmdBuf.DeleteFilterCmd.MaxSize = 4;
+
+    UtAssert_BOOL_TRUE(FM_DeleteFilterCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_DELETE_FILTER_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueueEntry.Source1, sizeof(FM_GlobalData.ChildQueueEntry.Source1),
+                          "dir", sizeof("dir"));
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueueEntry.Target, sizeof(FM_GlobalData.ChildQueueEntry.Target),
+                          "*.tmp", sizeof("*.tmp"));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.MinAge, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.MaxAge, 2);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.MinSize, 3);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.MaxSize, 4);
+}
+
+void Test_FM_DeleteFilterCmd_NoMaximum(void)
+{
+    UT_FM_DeleteFilterCmd_Setup();
+    UT_CmdBuf.DeleteFilterCmd.MinAge  = 100;
+    UT_CmdBuf.DeleteFilterCmd.MinSize = 100;
+
+    UtAssert_BOOL_TRUE(FM_DeleteFilterCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+}
+
+void Test_FM_DeleteFilterCmd_BadLength(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
+
+    UtAssert_BOOL_FALSE(FM_DeleteFilterCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyDirExists, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_DeleteFilterCmd_DirNoExist(void)
+{
+    UT_FM_DeleteFilterCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
+
+    UtAssert_BOOL_FALSE(FM_DeleteFilterCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_DeleteFilterCmd_PatternEmpty(void)
+{
+    UT_FM_DeleteFilterCmd_Setup();
+    UT_CmdBuf.DeleteFilterCmd.Pattern[0] = '\0';
+
+    UtAssert_BOOL_FALSE(FM_DeleteFilterCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_FILTER_ARG_ERR_EID);
+}
+
+void Test_FM_DeleteFilterCmd_PatternUnterminated(void)
+{
+    UT_FM_DeleteFilterCmd_Setup();
+    memset(UT_CmdBuf.DeleteFilterCmd.Pattern, '*', sizeof(UT_CmdBuf.DeleteFilterCmd.Pattern));
+
+    UtAssert_BOOL_FALSE(FM_DeleteFilterCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_FILTER_ARG_ERR_EID);
+}
+
+void Test_FM_DeleteFilterCmd_PatternPath(void)
+{
+    UT_FM_DeleteFilterCmd_Setup();
+    strncpy(UT_CmdBuf.DeleteFilterCmd.Pattern, "sub/*", sizeof(UT_CmdBuf.DeleteFilterCmd.Pattern) - 1);
+
+    UtAssert_BOOL_FALSE(FM_DeleteFilterCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_FILTER_ARG_ERR_EID);
+}
+
+void Test_FM_DeleteFilterCmd_AgeRangeInvalid(void)
+{
+    UT_FM_DeleteFilterCmd_Setup();
+    UT_CmdBuf.DeleteFilterCmd.MinAge = 2;
+    UT_CmdBuf.DeleteFilterCmd.MaxAge = 1;
+
+    UtAssert_BOOL_FALSE(FM_DeleteFilterCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_FILTER_ARG_ERR_EID);
+}
+
+void Test_FM_DeleteFilterCmd_SizeRangeInvalid(void)
+{
+    UT_FM_DeleteFilterCmd_Setup();
+    UT_CmdBuf.DeleteFilterCmd.MinSize = 2;
+    UT_CmdBuf.DeleteFilterCmd.MaxSize = 1;
+
+    UtAssert_BOOL_FALSE(FM_DeleteFilterCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_FILTER_ARG_ERR_EID);
+}
+
+void Test_FM_DeleteFilterCmd_NoChildTask(void)
+{
+    UT_FM_DeleteFilterCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    UtAssert_BOOL_FALSE(FM_DeleteFilterCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void add_FM_DeleteFilterCmd_tests(void)
+{
+    UtTest_Add(Test_FM_DeleteFilterCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DeleteFilterCmd_Success");
+
+    UtTest_Add(Test_FM_DeleteFilterCmd_NoMaximum, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DeleteFilterCmd_NoMaximum");
+
+    UtTest_Add(Test_FM_DeleteFilterCmd_BadLength, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DeleteFilterCmd_BadLength");
+
+    UtTest_Add(Test_FM_DeleteFilterCmd_DirNoExist, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DeleteFilterCmd_DirNoExist");
+
+    UtTest_Add(Test_FM_DeleteFilterCmd_PatternEmpty, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DeleteFilterCmd_PatternEmpty");
+
+    UtTest_Add(Test_FM_DeleteFilterCmd_PatternUnterminated, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DeleteFilterCmd_PatternUnterminated");
+
+    UtTest_Add(Test_FM_DeleteFilterCmd_PatternPath, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DeleteFilterCmd_PatternPath");
+
+    UtTest_Add(Test_FM_DeleteFilterCmd_AgeRangeInvalid, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DeleteFilterCmd_AgeRangeInvalid");
+
+    UtTest_Add(Test_FM_DeleteFilterCmd_SizeRangeInvalid, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DeleteFilterCmd_SizeRangeInvalid");
+
+    UtTest_Add(Test_FM_DeleteFilterCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DeleteFilterCmd_NoChildTask");
+}
+
+/****************************/
+/* Concat File List Tests   */
+/****************************/
+
+void UT_FM_ConcatListCmd_Setup(void)
+{
+    strncpy(UT_CmdBuf.ConcatListCmd.ListFile, "list", sizeof(UT_CmdBuf.ConcatListCmd.ListFile) - 1);
+    strncpy(UT_CmdBuf.ConcatListCmd.Target, "tgt", sizeof(UT_CmdBuf.ConcatListCmd.Target) - 1);
+    UT_CmdBuf.ConcatListCmd.CRCType = CFE_MISSION_ES_CRC_32;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+}
+
+void Test_FM_ConcatListCmd_Success(void)
+{
+    UT_FM_ConcatListCmd_Setup();
+
+    /* Arguments left by a previous command are not passed on */
+    strncpy(FM_GlobalData.ChildQueueEntry.Source2, "old", sizeof(FM_GlobalData.ChildQueueEntry.Source2) - 1);
+    FM_GlobalData.ChildQueueEntry.Verify = true;
+
+    UtAssert_BOOL_TRUE(FM_ConcatListCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_CONCAT_LIST_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueueEntry.Source1, sizeof(FM_GlobalData.ChildQueueEntry.Source1),
+                          "list", sizeof("list"));
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueueEntry.Source2, sizeof(FM_GlobalData.ChildQueueEntry.Source2), "",
+                          sizeof(""));
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueueEntry.Target, sizeof(FM_GlobalData.ChildQueueEntry.Target), "tgt",
+                          sizeof("tgt"));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.FileInfoCRC, CFE_MISSION_ES_CRC_32);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildQueueEntry.Verify);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildQueueEntry.Sparse);
+}
+
+void Test_FM_ConcatListCmd_BadLength(void)
+{
+    UT_FM_ConcatListCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
+
+    UtAssert_BOOL_FALSE(FM_ConcatListCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyCRCType, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_ConcatListCmd_BadCRCType(void)
+{
+    UT_FM_ConcatListCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), false);
+
+    UtAssert_BOOL_FALSE(FM_ConcatListCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyFileClosed, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_ConcatListCmd_ListNotClosed(void)
+{
+    UT_FM_ConcatListCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), false);
+
+    UtAssert_BOOL_FALSE(FM_ConcatListCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyFileNoExist, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_ConcatListCmd_TargetFileExists(void)
+{
+    UT_FM_ConcatListCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), false);
+
+    UtAssert_BOOL_FALSE(FM_ConcatListCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_ConcatListCmd_NoChildTask(void)
+{
+    UT_FM_ConcatListCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    UtAssert_BOOL_FALSE(FM_ConcatListCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void add_FM_ConcatListCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ConcatListCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ConcatListCmd_Success");
+
+    UtTest_Add(Test_FM_ConcatListCmd_BadLength, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ConcatListCmd_BadLength");
+
+    UtTest_Add(Test_FM_ConcatListCmd_BadCRCType, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ConcatListCmd_BadCRCType");
+
+    UtTest_Add(Test_FM_ConcatListCmd_ListNotClosed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ConcatListCmd_ListNotClosed");
+
+    UtTest_Add(Test_FM_ConcatListCmd_TargetFileExists, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ConcatListCmd_TargetFileExists");
+
+    UtTest_Add(Test_FM_ConcatListCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ConcatListCmd_NoChildTask");
+}
+
+/****************************/
+/* Split File Tests         */
+/****************************/
+
+void UT_FM_SplitCmd_Setup(void)
+{
+    strncpy(UT_CmdBuf.SplitCmd.Source, "src", sizeof(UT_CmdBuf.SplitCmd.Source) - 1);
+    strncpy(UT_CmdBuf.SplitCmd.Target, "tgt", sizeof(UT_CmdBuf.SplitCmd.Target) - 1);
+    UT_CmdBuf.SplitCmd.SegmentSize = 4096;
+    UT_CmdBuf.SplitCmd.CRCType     = CFE_MISSION_ES_CRC_32;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+}
+
+void Test_FM_SplitCmd_Success(void)
+{
+    UT_FM_SplitCmd_Setup();
+
+    UtAssert_BOOL_TRUE(FM_SplitCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_SPLIT_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueueEntry.Source1, sizeof(FM_GlobalData.ChildQueueEntry.Source1), "src",
+                          sizeof("src"));
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueueEntry.Target, sizeof(FM_GlobalData.ChildQueueEntry.Target), "tgt",
+                          sizeof("tgt"));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.SegmentSize, 4096);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.FileInfoCRC, CFE_MISSION_ES_CRC_32);
+}
+
+void Test_FM_SplitCmd_BadLength(void)
+{
+    UT_FM_SplitCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
+
+    UtAssert_BOOL_FALSE(FM_SplitCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_VerifyCRCType, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_SplitCmd_BadSegmentSize(void)
+{
+    UT_FM_SplitCmd_Setup();
+    UT_CmdBuf.SplitCmd.SegmentSize = 0;
+
+    UtAssert_BOOL_FALSE(FM_SplitCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SPLIT_SIZE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(FM_VerifyCRCType, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_SplitCmd_BadCRCType(void)
+{
+    UT_FM_SplitCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyCRCType), false);
+
+    UtAssert_BOOL_FALSE(FM_SplitCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyFileClosed, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_SplitCmd_SourceNotClosed(void)
+{
+    UT_FM_SplitCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), false);
+
+    UtAssert_BOOL_FALSE(FM_SplitCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyFileNoExist, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_SplitCmd_TargetFileExists(void)
+{
+    UT_FM_SplitCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), false);
+
+    UtAssert_BOOL_FALSE(FM_SplitCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_SplitCmd_NoChildTask(void)
+{
+    UT_FM_SplitCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    UtAssert_BOOL_FALSE(FM_SplitCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void add_FM_SplitCmd_tests(void)
+{
+    UtTest_Add(Test_FM_SplitCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SplitCmd_Success");
+
+    UtTest_Add(Test_FM_SplitCmd_BadLength, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SplitCmd_BadLength");
+
+    UtTest_Add(Test_FM_SplitCmd_BadSegmentSize, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SplitCmd_BadSegmentSize");
+
+    UtTest_Add(Test_FM_SplitCmd_BadCRCType, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SplitCmd_BadCRCType");
+
+    UtTest_Add(Test_FM_SplitCmd_SourceNotClosed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SplitCmd_SourceNotClosed");
+
+    UtTest_Add(Test_FM_SplitCmd_TargetFileExists, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SplitCmd_TargetFileExists");
+
+    UtTest_Add(Test_FM_SplitCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SplitCmd_NoChildTask");
+}
+
+/****************************/
+/* Preallocate File Tests   */
+/****************************/
+
+void UT_FM_PreallocateCmd_Setup(void)
+{
+    strncpy(UT_CmdBuf.PreallocateCmd.Filename, "file", sizeof(UT_CmdBuf.PreallocateCmd.Filename) - 1);
+    UT_CmdBuf.PreallocateCmd.Size = 65536;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+}
+
+void Test_FM_PreallocateCmd_Success(void)
+{
+    UT_FM_PreallocateCmd_Setup();
+
+    UtAssert_BOOL_TRUE(FM_PreallocateCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_PREALLOCATE_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueueEntry.Source1, sizeof(FM_GlobalData.ChildQueueEntry.Source1), "file",
+                          sizeof("file"));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.FileSize, 65536);
+}
+
+void Test_FM_PreallocateCmd_BadLength(void)
+{
+    UT_FM_PreallocateCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
+
+    UtAssert_BOOL_FALSE(FM_PreallocateCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_VerifyFileNotOpen, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_PreallocateCmd_BadSize(void)
+{
+    UT_FM_PreallocateCmd_Setup();
+    UT_CmdBuf.PreallocateCmd.Size = 0;
+
+    UtAssert_BOOL_FALSE(FM_PreallocateCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PREALLOCATE_SIZE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(FM_VerifyFileNotOpen, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_PreallocateCmd_FileOpen(void)
+{
+    UT_FM_PreallocateCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), false);
+
+    UtAssert_BOOL_FALSE(FM_PreallocateCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_PreallocateCmd_NoChildTask(void)
+{
+    UT_FM_PreallocateCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    UtAssert_BOOL_FALSE(FM_PreallocateCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void add_FM_PreallocateCmd_tests(void)
+{
+    UtTest_Add(Test_FM_PreallocateCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PreallocateCmd_Success");
+
+    UtTest_Add(Test_FM_PreallocateCmd_BadLength, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PreallocateCmd_BadLength");
+
+    UtTest_Add(Test_FM_PreallocateCmd_BadSize, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PreallocateCmd_BadSize");
+
+    UtTest_Add(Test_FM_PreallocateCmd_FileOpen, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PreallocateCmd_FileOpen");
+
+    UtTest_Add(Test_FM_PreallocateCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PreallocateCmd_NoChildTask");
+}
+
+/****************************/
+/* Truncate File Tests      */
+/****************************/
+
+void UT_FM_TruncateCmd_Setup(void)
+{
+    strncpy(UT_CmdBuf.TruncateCmd.Filename, "file", sizeof(UT_CmdBuf.TruncateCmd.Filename) - 1);
+    UT_CmdBuf.TruncateCmd.Size = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+}
+
+void Test_FM_TruncateCmd_BadLength(void)
+{
+    UT_FM_TruncateCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsValidCmdPktLength), false);
+
+    UtAssert_BOOL_FALSE(FM_TruncateCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_VerifyFileClosed, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+#ifdef FM_INCLUDE_FILE_TRUNCATE
+
+void Test_FM_TruncateCmd_Success(void)
+{
+    UT_FM_TruncateCmd_Setup();
+
+    UtAssert_BOOL_TRUE(FM_TruncateCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueEntry.CommandCode, FM_TRUNCATE_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueueEntry.Source1, sizeof(FM_GlobalData.ChildQueueEntry.Source1), "file",
+                          sizeof("file"));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueEntry.FileSize, 0);
+}
+
+void Test_FM_TruncateCmd_FileNotClosed(void)
+{
+    UT_FM_TruncateCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), false);
+
+    UtAssert_BOOL_FALSE(FM_TruncateCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_TruncateCmd_NoChildTask(void)
+{
+    UT_FM_TruncateCmd_Setup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    UtAssert_BOOL_FALSE(FM_TruncateCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+#else
+
+void Test_FM_TruncateCmd_Unsupported(void)
+{
+    UT_FM_TruncateCmd_Setup();
+
+    UtAssert_BOOL_FALSE(FM_TruncateCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_TRUNCATE_UNSUPPORTED_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(FM_VerifyFileClosed, 0);
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildLastJobID, 0);
+}
+
+#endif
+
+void add_FM_TruncateCmd_tests(void)
+{
+    UtTest_Add(Test_FM_TruncateCmd_BadLength, FM_Test_Setup, FM_Test_Teardown, "Test_FM_TruncateCmd_BadLength");
+
+#ifdef FM_INCLUDE_FILE_TRUNCATE
+    UtTest_Add(Test_FM_TruncateCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_TruncateCmd_Success");
+
+    UtTest_Add(Test_FM_TruncateCmd_FileNotClosed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_TruncateCmd_FileNotClosed");
+
+    UtTest_Add(Test_FM_TruncateCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown, "Test_FM_TruncateCmd_NoChildTask");
+#else
+    UtTest_Add(Test_FM_TruncateCmd_Unsupported, FM_Test_Setup, FM_Test_Teardown, "Test_FM_TruncateCmd_Unsupported");
+#endif
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -2292,4 +3820,14 @@ void UtTest_Setup(void)
     add_FM_GetFreeSpaceCmd_tests();
     add_FM_SetTableStateCmd_tests();
     add_FM_SetPermissionsCmd_tests();
+    add_FM_AbortCmd_tests();
+    add_FM_SetThrottleCmd_tests();
+    add_FM_SetBlockSizeCmd_tests();
+    add_FM_CopyDirCmd_tests();
+    add_FM_DeleteTreeCmd_tests();
+    add_FM_DeleteFilterCmd_tests();
+    add_FM_ConcatListCmd_tests();
+    add_FM_SplitCmd_tests();
+    add_FM_PreallocateCmd_tests();
+    add_FM_TruncateCmd_tests();
 }
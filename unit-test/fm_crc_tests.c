@@ -0,0 +1,248 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task CRC Functions
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_defs.h"
+#include "fm_crc.h"
+#include "fm_platform_cfg.h"
+
+/*
+ * UT Assert
+ */
+#include "fm_test_utils.h"
+
+/*
+ * UT includes
+ */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <string.h>
+
+/* Data for the kernel tests, long enough for the folding loops and the tails */
+static uint8 UT_FM_Crc_Data[1024];
+
+/* The cFE CRC-16 computed one byte at a time, as cFE does */
+uint16 UT_FM_Crc_Reference(uint16 Crc, const uint8 *Buffer, size_t Length)
+{
+    size_t Index = 0;
+    uint32 Bit   = 0;
+
+    for (Index = 0; Index < Length; Index++)
+    {
+        Crc ^= Buffer[Index];
+
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            Crc = ((Crc & 1) != 0) ? ((Crc >> 1) ^ 0xA001) : (Crc >> 1);
+        }
+    }
+
+    return Crc;
+}
+
+void UT_FM_Crc_Test_Setup(void)
+{
+    uint32 Index = 0;
+
+    FM_Test_Setup();
+
+    for (Index = 0; Index < sizeof(UT_FM_Crc_Data); Index++)
+    {
+        UT_FM_Crc_Data[Index] = (uint8)((Index * 167) + (Index >> 3));
+    }
+
+    FM_CrcInit();
+}
+
+/*********************************************************************************
+ *          TEST CASE FUNCTIONS
+ *********************************************************************************/
+
+/*****************
+ * CrcInit Tests
+ ****************/
+void Test_FM_CrcInit_Tables(void)
+{
+    FM_ChildCrc_t *Engine = &FM_GlobalData.ChildCrc;
+    uint8          Data[FM_CRC_SLICE_COUNT];
+    uint32         Slice = 0;
+
+    // Assert - table 0 matches the cFE table
+    UtAssert_UINT32_EQ(Engine->Table[0][0], 0x0000);
+    UtAssert_UINT32_EQ(Engine->Table[0][1], 0xC0C1);
+    UtAssert_UINT32_EQ(Engine->Table[0][128], 0xA001);
+    UtAssert_UINT32_EQ(Engine->Table[0][255], 0x4040);
+
+    // Assert - table N is a byte followed by N zero bytes
+    memset(Data, 0, sizeof(Data));
+    Data[0] = 0x5A;
+
+    for (Slice = 0; Slice < FM_CRC_SLICE_COUNT; Slice++)
+    {
+        UtAssert_UINT32_EQ(Engine->Table[Slice][0x5A], UT_FM_Crc_Reference(0, Data, Slice + 1));
+    }
+}
+
+void Test_FM_CrcInit_Kernel(void)
+{
+#ifdef FM_CRC_INCLUDE_PCLMUL
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("pclmul"))
+    {
+        UtAssert_UINT32_EQ(FM_GlobalData.ChildCrc.Kernel, FM_CRC_KERNEL_PCLMUL);
+    }
+    else
+    {
+        UtAssert_UINT32_EQ(FM_GlobalData.ChildCrc.Kernel, FM_CRC_KERNEL_SLICE);
+    }
+#else
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCrc.Kernel, FM_CRC_KERNEL_SLICE);
+#endif
+}
+
+/*****************
+ * CrcCalculate Tests
+ ****************/
+void Test_FM_CrcCalculate_CheckValue(void)
+{
+    // Assert - the standard check value, sign extended as cFE returns it
+    UtAssert_UINT32_EQ(FM_CrcCalculate("123456789", 9, 0, CFE_MISSION_ES_CRC_16), 0xFFFFBB3D);
+    UtAssert_UINT32_EQ(FM_CrcCalculate("A", 1, 0, CFE_MISSION_ES_CRC_16), 0x30C0);
+
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 0);
+}
+
+void Test_FM_CrcCalculate_Continue(void)
+{
+    uint32 Whole = FM_CrcCalculate(UT_FM_Crc_Data, sizeof(UT_FM_Crc_Data), 0, CFE_MISSION_ES_CRC_16);
+    uint32 Split = 0;
+
+    // Act - a sign extended CRC continues like the 16-bit CRC
+    Split = FM_CrcCalculate(UT_FM_Crc_Data, 333, 0, CFE_MISSION_ES_CRC_16);
+    Split = FM_CrcCalculate(&UT_FM_Crc_Data[333], sizeof(UT_FM_Crc_Data) - 333, Split, CFE_MISSION_ES_CRC_16);
+
+    UtAssert_UINT32_EQ(Split, Whole);
+}
+
+void Test_FM_CrcCalculate_NoData(void)
+{
+    UtAssert_UINT32_EQ(FM_CrcCalculate(NULL, 10, 0x1234, CFE_MISSION_ES_CRC_16), 0x1234);
+    UtAssert_UINT32_EQ(FM_CrcCalculate(UT_FM_Crc_Data, 0, 0x1234, CFE_MISSION_ES_CRC_16), 0x1234);
+}
+
+void Test_FM_CrcCalculate_SliceKernel(void)
+{
+    uint16 Expected = UT_FM_Crc_Reference(0, UT_FM_Crc_Data, sizeof(UT_FM_Crc_Data));
+
+    // Arrange - the kernel used on CPUs without PCLMULQDQ
+    FM_GlobalData.ChildCrc.Kernel = FM_CRC_KERNEL_SLICE;
+
+    UtAssert_UINT32_EQ(FM_CrcCalculate(UT_FM_Crc_Data, sizeof(UT_FM_Crc_Data), 0, CFE_MISSION_ES_CRC_16) & 0xFFFF,
+                       Expected);
+}
+
+void Test_FM_CrcCalculate_OtherType(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x12345678);
+
+    // Act - CRC-32 is computed by cFE
+    UtAssert_UINT32_EQ(FM_CrcCalculate(UT_FM_Crc_Data, 16, 0, CFE_MISSION_ES_CRC_32), 0x12345678);
+
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+}
+
+/*****************
+ * CrcSlice16 Tests
+ ****************/
+void Test_FM_CrcSlice16_Lengths(void)
+{
+    size_t Length = 0;
+    uint32 Errors = 0;
+
+    // Act - every length through the eight byte loop and the tail, at an odd start
+    for (Length = 0; Length < 100; Length++)
+    {
+        if (FM_CrcSlice16(0x1D0F, &UT_FM_Crc_Data[3], Length) !=
+            UT_FM_Crc_Reference(0x1D0F, &UT_FM_Crc_Data[3], Length))
+        {
+            Errors++;
+        }
+    }
+
+    UtAssert_UINT32_EQ(Errors, 0);
+}
+
+#ifdef FM_CRC_INCLUDE_PCLMUL
+
+/*****************
+ * CrcFold16 Tests
+ ****************/
+void Test_FM_CrcFold16_Lengths(void)
+{
+    size_t Length = 0;
+    uint32 Errors = 0;
+
+    if (FM_GlobalData.ChildCrc.Kernel == FM_CRC_KERNEL_PCLMUL)
+    {
+        // Act - short blocks, whole 64 byte blocks, 16 byte blocks and tails
+        for (Length = 0; Length < (sizeof(UT_FM_Crc_Data) - 1); Length++)
+        {
+            if (FM_CrcFold16(0x1D0F, &UT_FM_Crc_Data[1], Length) !=
+                UT_FM_Crc_Reference(0x1D0F, &UT_FM_Crc_Data[1], Length))
+            {
+                Errors++;
+            }
+        }
+    }
+
+    UtAssert_UINT32_EQ(Errors, 0);
+}
+
+#endif
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_FM_CrcInit_Tables, UT_FM_Crc_Test_Setup, FM_Test_Teardown, "Test_FM_CrcInit_Tables");
+    UtTest_Add(Test_FM_CrcInit_Kernel, UT_FM_Crc_Test_Setup, FM_Test_Teardown, "Test_FM_CrcInit_Kernel");
+    UtTest_Add(Test_FM_CrcCalculate_CheckValue, UT_FM_Crc_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CrcCalculate_CheckValue");
+    UtTest_Add(Test_FM_CrcCalculate_Continue, UT_FM_Crc_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CrcCalculate_Continue");
+    UtTest_Add(Test_FM_CrcCalculate_NoData, UT_FM_Crc_Test_Setup, FM_Test_Teardown, "Test_FM_CrcCalculate_NoData");
+    UtTest_Add(Test_FM_CrcCalculate_SliceKernel, UT_FM_Crc_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CrcCalculate_SliceKernel");
+    UtTest_Add(Test_FM_CrcCalculate_OtherType, UT_FM_Crc_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CrcCalculate_OtherType");
+    UtTest_Add(Test_FM_CrcSlice16_Lengths, UT_FM_Crc_Test_Setup, FM_Test_Teardown, "Test_FM_CrcSlice16_Lengths");
+#ifdef FM_CRC_INCLUDE_PCLMUL
+    UtTest_Add(Test_FM_CrcFold16_Lengths, UT_FM_Crc_Test_Setup, FM_Test_Teardown, "Test_FM_CrcFold16_Lengths");
+#endif
+}
@@ -0,0 +1,699 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task Transfer Pipeline Functions
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_msgdefs.h"
+#include "fm_defs.h"
+#include "fm_events.h"
+#include "fm_child.h"
+#include "fm_checkpoint.h"
+#include "fm_pipeline.h"
+#include "fm_crc.h"
+#include "fm_platform_cfg.h"
+
+/*
+ * UT Assert
+ */
+#include "fm_test_utils.h"
+
+/*
+ * UT includes
+ */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <string.h>
+
+/* Have worker 0 start a transfer of 4 byte blocks */
+void UT_FM_Pipeline_Start(uint8 Mode, bool Running)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    Worker->Pipeline.Running = Running;
+
+    FM_PipelineStart(Worker, Mode, FM_UT_OBJID_1, CFE_MISSION_ES_CRC_16, 0);
+}
+
+/* Memory pool, room for each buffer to start one byte past the buffer alignment */
+char  UT_FM_Pipeline_Pool[FM_CHILD_BUFFER_COUNT][FM_CHILD_POOL_BLOCK_SIZE + FM_CHILD_BUFFER_ALIGNMENT];
+char *UT_FM_Pipeline_PoolBuf[FM_CHILD_BUFFER_COUNT];
+
+void UT_Handler_CFE_ES_GetPoolBuf(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_ES_MemPoolBuf_t *BufPtr = UT_Hook_GetArgValueByName(Context, "BufPtr", CFE_ES_MemPoolBuf_t *);
+    uint32               Index  = UT_GetStubCount(UT_KEY(CFE_ES_GetPoolBuf)) - 1;
+    char *               Start  = UT_FM_Pipeline_Pool[Index];
+
+    Start += FM_CHILD_BUFFER_ALIGNMENT - ((cpuaddr)Start % FM_CHILD_BUFFER_ALIGNMENT) + 1;
+
+    UT_FM_Pipeline_PoolBuf[Index] = Start;
+    *BufPtr                       = Start;
+}
+
+/*********************************************************************************
+ *          TEST CASE FUNCTIONS
+ *********************************************************************************/
+
+/*****************
+ * PipelineBufferInit Tests
+ ****************/
+void Test_FM_PipelineBufferInit_Success(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[FM_CHILD_WORKER_COUNT - 1];
+
+    // Arrange
+    FM_GlobalData.ChildBlockSize = 0;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), FM_CHILD_POOL_BLOCK_SIZE);
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetPoolBuf), UT_Handler_CFE_ES_GetPoolBuf, NULL);
+
+    // Act
+    UtAssert_INT32_EQ(FM_PipelineBufferInit(), CFE_SUCCESS);
+
+    // Assert - buffers are rounded up to the alignment, worker buffer first
+    UtAssert_STUB_COUNT(CFE_ES_PoolCreateEx, 1);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, FM_CHILD_BUFFER_COUNT);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildBlockSize, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(Worker->BlockSize, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_ADDRESS_EQ(FM_GlobalData.ChildWorker[0].ChildBuffer,
+                        UT_FM_Pipeline_PoolBuf[0] + FM_CHILD_BUFFER_ALIGNMENT - 1);
+    UtAssert_ADDRESS_EQ(Worker->Pipeline.Buffer[FM_CHILD_PIPELINE_DEPTH - 1],
+                        UT_FM_Pipeline_PoolBuf[FM_CHILD_BUFFER_COUNT - 1] + FM_CHILD_BUFFER_ALIGNMENT - 1);
+    UtAssert_UINT32_EQ((cpuaddr)Worker->ChildBuffer % FM_CHILD_BUFFER_ALIGNMENT, 0);
+}
+
+void Test_FM_PipelineBufferInit_PoolCreateNotSuccess(void)
+{
+    // Arrange
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_PoolCreateEx), CFE_ES_BAD_ARGUMENT);
+
+    // Act and Assert
+    UtAssert_INT32_EQ(FM_PipelineBufferInit(), CFE_ES_BAD_ARGUMENT);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 0);
+}
+
+void Test_FM_PipelineBufferInit_GetPoolBufNotSuccess(void)
+{
+    // Arrange - the first pipeline buffer does not fit in the pool
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), FM_CHILD_POOL_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetPoolBuf), UT_Handler_CFE_ES_GetPoolBuf, NULL);
+
+    // Act and Assert
+    UtAssert_INT32_EQ(FM_PipelineBufferInit(), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 2);
+}
+
+/*****************
+ * PipelineInit Tests
+ ****************/
+void Test_FM_PipelineInit_Success(void)
+{
+    UtAssert_VOIDCALL(FM_PipelineInit());
+
+#if FM_CHILD_PIPELINE_DEPTH > 1
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 2 * FM_CHILD_WORKER_COUNT);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, FM_CHILD_WORKER_COUNT);
+#else
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+#endif
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+#if FM_CHILD_PIPELINE_DEPTH > 1
+void Test_FM_PipelineInit_CountSemCreateNotSuccess(void)
+{
+    // Arrange - the empty semaphore of the first worker fails
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 2, OS_ERROR);
+
+    // Act
+    UtAssert_VOIDCALL(FM_PipelineInit());
+
+    // Assert - no helper task is created
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 2);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_PIPE_ERR_EID);
+}
+
+void Test_FM_PipelineInit_CreateChildTaskNotSuccess(void)
+{
+    // Arrange
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CreateChildTask), OS_ERROR);
+
+    // Act
+    UtAssert_VOIDCALL(FM_PipelineInit());
+
+    // Assert - workers transfer each block themselves
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 2 * FM_CHILD_WORKER_COUNT);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_PIPE_ERR_EID);
+}
+#endif
+
+/*****************
+ * PipelineTask Tests
+ ****************/
+void Test_FM_PipelineTask_ProcessBlocks(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange - one block is processed, then the semaphore fails
+    Worker->Pipeline.Mode    = FM_PIPELINE_MODE_CRC;
+    Worker->Pipeline.CRCType = FM_IGNORE_CRC;
+    Worker->Pipeline.Size[0] = 4;
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
+
+    // Act
+    UtAssert_VOIDCALL(FM_PipelineTask());
+
+    // Assert
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPipelineCount, 1);
+    UtAssert_BOOL_FALSE(Worker->Pipeline.Running);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+    UtAssert_STUB_COUNT(FM_ChildJobBytes, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_SEM_ERR_EID);
+}
+
+void Test_FM_PipelineTask_NoWorker(void)
+{
+    // Arrange - every worker already has a helper task
+    FM_GlobalData.ChildPipelineCount = FM_CHILD_WORKER_COUNT;
+
+    // Act
+    UtAssert_VOIDCALL(FM_PipelineTask());
+
+    // Assert
+    UtAssert_STUB_COUNT(OS_CountSemTake, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+}
+
+/*****************
+ * PipelineProcess Tests
+ ****************/
+void Test_FM_PipelineProcess_Write(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_WRITE, false);
+    Worker->Pipeline.Size[0] = 4;
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 4);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcCalculate), 0x55);
+
+    // Act
+    UtAssert_VOIDCALL(FM_PipelineProcess(Worker));
+
+    // Assert - written, then added to the CRC, checkpoint and job progress
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(FM_CrcCalculate, 1);
+    UtAssert_STUB_COUNT(FM_CheckpointUpdate, 1);
+    UtAssert_STUB_COUNT(FM_ChildJobBytes, 1);
+    UtAssert_UINT32_EQ(Worker->Pipeline.CRC, 0x55);
+    UtAssert_BOOL_FALSE(Worker->Pipeline.Failed);
+    UtAssert_UINT32_EQ(Worker->Pipeline.ReadIndex, 1 % FM_CHILD_PIPELINE_DEPTH);
+}
+
+void Test_FM_PipelineProcess_WriteNotSuccess(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_WRITE, false);
+    Worker->Pipeline.Size[0] = 4;
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 1);
+
+    // Act
+    UtAssert_VOIDCALL(FM_PipelineProcess(Worker));
+
+    // Assert - the failure is kept for the worker to report
+    UtAssert_BOOL_TRUE(Worker->Pipeline.Failed);
+    UtAssert_INT32_EQ(Worker->Pipeline.Result, 1);
+    UtAssert_INT32_EQ(Worker->Pipeline.Expected, 4);
+    UtAssert_STUB_COUNT(FM_CrcCalculate, 0);
+    UtAssert_STUB_COUNT(FM_CheckpointUpdate, 0);
+    UtAssert_STUB_COUNT(FM_ChildJobBytes, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_PipelineProcess_AfterFailure(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_WRITE, false);
+    Worker->Pipeline.Size[0] = 4;
+    Worker->Pipeline.Failed  = true;
+
+    // Act
+    UtAssert_VOIDCALL(FM_PipelineProcess(Worker));
+
+    // Assert - the block is dropped, the buffer is still released
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(FM_ChildJobBytes, 0);
+    UtAssert_UINT32_EQ(Worker->Pipeline.ReadIndex, 1 % FM_CHILD_PIPELINE_DEPTH);
+}
+
+void Test_FM_PipelineProcess_CRC(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange - the last buffer of the ring
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_CRC, false);
+    Worker->Pipeline.ReadIndex                         = FM_CHILD_PIPELINE_DEPTH - 1;
+    Worker->Pipeline.Size[FM_CHILD_PIPELINE_DEPTH - 1] = 4;
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcCalculate), 0x55);
+
+    // Act
+    UtAssert_VOIDCALL(FM_PipelineProcess(Worker));
+
+    // Assert - nothing is written and no checkpoint is kept
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(FM_CheckpointUpdate, 0);
+    UtAssert_STUB_COUNT(FM_ChildJobBytes, 1);
+    UtAssert_UINT32_EQ(Worker->Pipeline.CRC, 0x55);
+    UtAssert_UINT32_EQ(Worker->Pipeline.ReadIndex, 0);
+}
+
+void Test_FM_PipelineProcess_SparseZero(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_SPARSE, false);
+    memset(Worker->Pipeline.Buffer[0], 0, 4);
+    Worker->Pipeline.Size[0] = 4;
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), 4);
+
+    // Act
+    UtAssert_VOIDCALL(FM_PipelineProcess(Worker));
+
+    // Assert - seeked over, then added to the CRC, checkpoint and job progress
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(FM_CrcCalculate, 1);
+    UtAssert_STUB_COUNT(FM_CheckpointUpdate, 1);
+    UtAssert_STUB_COUNT(FM_ChildJobBytes, 1);
+    UtAssert_BOOL_TRUE(Worker->Pipeline.Hole);
+    UtAssert_BOOL_FALSE(Worker->Pipeline.Failed);
+}
+
+void Test_FM_PipelineProcess_SparseData(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange - a block that follows a hole
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_SPARSE, false);
+    memset(Worker->Pipeline.Buffer[0], 0, 4);
+    Worker->Pipeline.Buffer[0][3] = 1;
+    Worker->Pipeline.Size[0]      = 4;
+    Worker->Pipeline.Hole         = true;
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 4);
+
+    // Act
+    UtAssert_VOIDCALL(FM_PipelineProcess(Worker));
+
+    // Assert
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(FM_CheckpointUpdate, 1);
+    UtAssert_BOOL_FALSE(Worker->Pipeline.Hole);
+    UtAssert_BOOL_FALSE(Worker->Pipeline.Failed);
+}
+
+void Test_FM_PipelineProcess_SparseSeekNotSuccess(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_SPARSE, false);
+    memset(Worker->Pipeline.Buffer[0], 0, 4);
+    Worker->Pipeline.Size[0] = 4;
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERROR);
+
+    // Act
+    UtAssert_VOIDCALL(FM_PipelineProcess(Worker));
+
+    // Assert - the failure is kept for the worker to report
+    UtAssert_BOOL_TRUE(Worker->Pipeline.Failed);
+    UtAssert_INT32_EQ(Worker->Pipeline.Result, OS_ERROR);
+    UtAssert_INT32_EQ(Worker->Pipeline.Expected, 4);
+    UtAssert_STUB_COUNT(FM_CheckpointUpdate, 0);
+    UtAssert_STUB_COUNT(FM_ChildJobBytes, 0);
+}
+
+/*****************
+ * PipelineStart Tests
+ ****************/
+void Test_FM_PipelineStart_Helper(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange - state left over from a failed transfer
+    Worker->Pipeline.Failed     = true;
+    Worker->Pipeline.Result     = OS_ERROR;
+    Worker->Pipeline.ReadIndex  = 1;
+    Worker->Pipeline.WriteIndex = 1;
+    Worker->Pipeline.Running    = true;
+
+    // Act
+    UtAssert_VOIDCALL(FM_PipelineStart(Worker, FM_PIPELINE_MODE_WRITE, FM_UT_OBJID_1, CFE_MISSION_ES_CRC_16, 7));
+
+    // Assert
+    UtAssert_BOOL_TRUE(Worker->Pipeline.Async == (FM_CHILD_PIPELINE_DEPTH > 1));
+    UtAssert_UINT32_EQ(Worker->Pipeline.Mode, FM_PIPELINE_MODE_WRITE);
+    UtAssert_UINT32_EQ(Worker->Pipeline.CRCType, CFE_MISSION_ES_CRC_16);
+    UtAssert_UINT32_EQ(Worker->Pipeline.CRC, 7);
+    UtAssert_BOOL_FALSE(Worker->Pipeline.Failed);
+    UtAssert_INT32_EQ(Worker->Pipeline.Result, OS_SUCCESS);
+    UtAssert_UINT32_EQ(Worker->Pipeline.ReadIndex, 0);
+    UtAssert_UINT32_EQ(Worker->Pipeline.WriteIndex, 0);
+}
+
+void Test_FM_PipelineStart_NoHelper(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Act
+    UtAssert_VOIDCALL(FM_PipelineStart(Worker, FM_PIPELINE_MODE_CRC, FM_UT_OBJID_1, FM_IGNORE_CRC, 0));
+
+    // Assert
+    UtAssert_BOOL_FALSE(Worker->Pipeline.Async);
+}
+
+/*****************
+ * PipelineBuffer Tests
+ ****************/
+void Test_FM_PipelineBuffer_NoHelper(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_WRITE, false);
+
+    // Act and Assert
+    UtAssert_ADDRESS_EQ(FM_PipelineBuffer(Worker), Worker->Pipeline.Buffer[0]);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 0);
+}
+
+void Test_FM_PipelineBuffer_Helper(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_WRITE, true);
+    Worker->Pipeline.Async = true;
+
+    // Act - the buffer is kept until it is submitted
+    UtAssert_ADDRESS_EQ(FM_PipelineBuffer(Worker), Worker->Pipeline.Buffer[0]);
+    UtAssert_ADDRESS_EQ(FM_PipelineBuffer(Worker), Worker->Pipeline.Buffer[0]);
+
+    // Assert
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_UINT32_EQ(Worker->Pipeline.Reserved, 1);
+}
+
+void Test_FM_PipelineBuffer_TakeNotSuccess(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_WRITE, true);
+    Worker->Pipeline.Async = true;
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), OS_ERROR);
+
+    // Act - a buffer the helper never uses is returned
+    UtAssert_ADDRESS_EQ(FM_PipelineBuffer(Worker), Worker->ChildBuffer);
+
+    // Assert
+    UtAssert_BOOL_TRUE(Worker->Pipeline.Failed);
+    UtAssert_INT32_EQ(Worker->Pipeline.Result, OS_ERROR);
+    UtAssert_UINT32_EQ(Worker->Pipeline.Reserved, 0);
+}
+
+/*****************
+ * PipelineSubmit Tests
+ ****************/
+void Test_FM_PipelineSubmit_NoHelper(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_WRITE, false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 4);
+
+    // Act - the block is written before the next one is read
+    UtAssert_BOOL_TRUE(FM_PipelineSubmit(Worker, 4));
+
+    // Assert
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_INT32_EQ(Worker->Pipeline.Size[0], 4);
+    UtAssert_UINT32_EQ(Worker->Pipeline.WriteIndex, Worker->Pipeline.ReadIndex);
+}
+
+void Test_FM_PipelineSubmit_NoHelperWriteNotSuccess(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_WRITE, false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 0);
+
+    // Act and Assert - the worker stops reading
+    UtAssert_BOOL_FALSE(FM_PipelineSubmit(Worker, 4));
+    UtAssert_BOOL_FALSE(FM_PipelineFinish(Worker));
+    UtAssert_INT32_EQ(Worker->Pipeline.Result, 0);
+    UtAssert_INT32_EQ(Worker->Pipeline.Expected, 4);
+}
+
+void Test_FM_PipelineSubmit_Helper(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_WRITE, true);
+    Worker->Pipeline.Async    = true;
+    Worker->Pipeline.Reserved = 1;
+
+    // Act
+    UtAssert_BOOL_TRUE(FM_PipelineSubmit(Worker, 4));
+
+    // Assert - the helper writes the block
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_UINT32_EQ(Worker->Pipeline.Reserved, 0);
+    UtAssert_UINT32_EQ(Worker->Pipeline.WriteIndex, 1 % FM_CHILD_PIPELINE_DEPTH);
+}
+
+void Test_FM_PipelineSubmit_Failed(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange - an earlier block failed to write
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_WRITE, true);
+    Worker->Pipeline.Async  = true;
+    Worker->Pipeline.Failed = true;
+
+    // Act
+    UtAssert_BOOL_FALSE(FM_PipelineSubmit(Worker, 4));
+
+    // Assert - the block is dropped
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_UINT32_EQ(Worker->Pipeline.WriteIndex, 0);
+}
+
+/*****************
+ * PipelineFinish Tests
+ ****************/
+void Test_FM_PipelineFinish_NoHelper(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_WRITE, false);
+
+    // Act and Assert
+    UtAssert_BOOL_TRUE(FM_PipelineFinish(Worker));
+    UtAssert_STUB_COUNT(OS_CountSemTake, 0);
+}
+
+void Test_FM_PipelineFinish_Helper(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange - the worker holds a buffer it did not submit
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_WRITE, true);
+    Worker->Pipeline.Async    = true;
+    Worker->Pipeline.Reserved = 1;
+
+    // Act
+    UtAssert_BOOL_TRUE(FM_PipelineFinish(Worker));
+
+    // Assert - waits for every other buffer, then frees them all
+    UtAssert_STUB_COUNT(OS_CountSemTake, FM_CHILD_PIPELINE_DEPTH - 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, FM_CHILD_PIPELINE_DEPTH);
+    UtAssert_UINT32_EQ(Worker->Pipeline.Reserved, 0);
+}
+
+void Test_FM_PipelineFinish_TakeNotSuccess(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_WRITE, true);
+    Worker->Pipeline.Async = true;
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), OS_ERROR);
+
+    // Act
+    UtAssert_BOOL_FALSE(FM_PipelineFinish(Worker));
+
+    // Assert - only the buffers taken are freed
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_INT32_EQ(Worker->Pipeline.Result, OS_ERROR);
+}
+
+void Test_FM_PipelineFinish_TrailingHole(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_SPARSE, false);
+    Worker->Pipeline.Hole = true;
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), 3);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 1);
+
+    // Act
+    UtAssert_BOOL_TRUE(FM_PipelineFinish(Worker));
+
+    // Assert - the last byte of the hole is written
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_BOOL_FALSE(Worker->Pipeline.Hole);
+}
+
+void Test_FM_PipelineFinish_TrailingHoleNotSuccess(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    // Arrange
+    UT_FM_Pipeline_Start(FM_PIPELINE_MODE_SPARSE, false);
+    Worker->Pipeline.Hole = true;
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERROR);
+
+    // Act
+    UtAssert_BOOL_FALSE(FM_PipelineFinish(Worker));
+
+    // Assert
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_INT32_EQ(Worker->Pipeline.Result, OS_ERROR);
+    UtAssert_INT32_EQ(Worker->Pipeline.Expected, 1);
+}
+
+/*****************
+ * PipelineIsZero Tests
+ ****************/
+void Test_FM_PipelineIsZero(void)
+{
+    char Buffer[8];
+
+    memset(Buffer, 0, sizeof(Buffer));
+
+    // Act and Assert
+    UtAssert_BOOL_TRUE(FM_PipelineIsZero(Buffer, sizeof(Buffer)));
+    UtAssert_BOOL_TRUE(FM_PipelineIsZero(Buffer, 1));
+    UtAssert_BOOL_FALSE(FM_PipelineIsZero(Buffer, 0));
+
+    Buffer[7] = 1;
+    UtAssert_BOOL_FALSE(FM_PipelineIsZero(Buffer, sizeof(Buffer)));
+    UtAssert_BOOL_TRUE(FM_PipelineIsZero(Buffer, sizeof(Buffer) - 1));
+
+    Buffer[0] = 1;
+    Buffer[7] = 0;
+    UtAssert_BOOL_FALSE(FM_PipelineIsZero(Buffer, sizeof(Buffer)));
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_FM_PipelineBufferInit_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineBufferInit_Success");
+    UtTest_Add(Test_FM_PipelineBufferInit_PoolCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineBufferInit_PoolCreateNotSuccess");
+    UtTest_Add(Test_FM_PipelineBufferInit_GetPoolBufNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineBufferInit_GetPoolBufNotSuccess");
+    UtTest_Add(Test_FM_PipelineInit_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineInit_Success");
+#if FM_CHILD_PIPELINE_DEPTH > 1
+    UtTest_Add(Test_FM_PipelineInit_CountSemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineInit_CountSemCreateNotSuccess");
+    UtTest_Add(Test_FM_PipelineInit_CreateChildTaskNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineInit_CreateChildTaskNotSuccess");
+#endif
+    UtTest_Add(Test_FM_PipelineTask_ProcessBlocks, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineTask_ProcessBlocks");
+    UtTest_Add(Test_FM_PipelineTask_NoWorker, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineTask_NoWorker");
+    UtTest_Add(Test_FM_PipelineProcess_Write, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineProcess_Write");
+    UtTest_Add(Test_FM_PipelineProcess_WriteNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineProcess_WriteNotSuccess");
+    UtTest_Add(Test_FM_PipelineProcess_AfterFailure, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineProcess_AfterFailure");
+    UtTest_Add(Test_FM_PipelineProcess_CRC, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineProcess_CRC");
+    UtTest_Add(Test_FM_PipelineProcess_SparseZero, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineProcess_SparseZero");
+    UtTest_Add(Test_FM_PipelineProcess_SparseData, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineProcess_SparseData");
+    UtTest_Add(Test_FM_PipelineProcess_SparseSeekNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineProcess_SparseSeekNotSuccess");
+    UtTest_Add(Test_FM_PipelineStart_Helper, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineStart_Helper");
+    UtTest_Add(Test_FM_PipelineStart_NoHelper, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineStart_NoHelper");
+    UtTest_Add(Test_FM_PipelineBuffer_NoHelper, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineBuffer_NoHelper");
+    UtTest_Add(Test_FM_PipelineBuffer_Helper, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineBuffer_Helper");
+    UtTest_Add(Test_FM_PipelineBuffer_TakeNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineBuffer_TakeNotSuccess");
+    UtTest_Add(Test_FM_PipelineSubmit_NoHelper, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineSubmit_NoHelper");
+    UtTest_Add(Test_FM_PipelineSubmit_NoHelperWriteNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineSubmit_NoHelperWriteNotSuccess");
+    UtTest_Add(Test_FM_PipelineSubmit_Helper, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineSubmit_Helper");
+    UtTest_Add(Test_FM_PipelineSubmit_Failed, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineSubmit_Failed");
+    UtTest_Add(Test_FM_PipelineFinish_NoHelper, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineFinish_NoHelper");
+    UtTest_Add(Test_FM_PipelineFinish_Helper, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineFinish_Helper");
+    UtTest_Add(Test_FM_PipelineFinish_TakeNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineFinish_TakeNotSuccess");
+    UtTest_Add(Test_FM_PipelineFinish_TrailingHole, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineFinish_TrailingHole");
+    UtTest_Add(Test_FM_PipelineFinish_TrailingHoleNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_PipelineFinish_TrailingHoleNotSuccess");
+    UtTest_Add(Test_FM_PipelineIsZero, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PipelineIsZero");
+}
@@ -0,0 +1,809 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task Command Queue Lane Functions
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_defs.h"
+#include "fm_msgdefs.h"
+#include "fm_events.h"
+#include "fm_queue.h"
+
+/*
+ * UT Assert
+ */
+#include "fm_test_utils.h"
+
+/*
+ * UT includes
+ */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+
+/* Number of commands passed between the stress test threads */
+#define UT_FM_QUEUE_STRESS_COUNT 200000
+
+/*********************************************************************************
+ *          TEST CASE FUNCTIONS
+ *********************************************************************************/
+
+/*****************
+ * QueueLanePush / QueueLanePop Tests
+ ****************/
+void Test_FM_QueueLanePushPop_Fifo(void)
+{
+    FM_ChildLane_t *Lane       = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
+    uint8           QueueIndex = 0;
+    uint8           i          = 0;
+
+    /* Fill the lane */
+    for (i = 0; i < FM_CHILD_QUEUE_DEPTH; i++)
+    {
+        UtAssert_BOOL_TRUE(FM_QueueLanePush(Lane, FM_CHILD_QUEUE_DEPTH - 1 - i));
+        UtAssert_INT32_EQ(FM_QueueLaneCount(Lane), i + 1);
+    }
+
+    /* Full lane */
+    UtAssert_BOOL_FALSE(FM_QueueLanePush(Lane, 0));
+    UtAssert_INT32_EQ(FM_QueueLaneCount(Lane), FM_CHILD_QUEUE_DEPTH);
+    UtAssert_BOOL_TRUE(FM_QueueLaneIsValid(Lane));
+
+    /* Entries come out in the order they went in */
+    for (i = 0; i < FM_CHILD_QUEUE_DEPTH; i++)
+    {
+        UtAssert_BOOL_TRUE(FM_QueueLanePop(Lane, &QueueIndex));
+        UtAssert_INT32_EQ(QueueIndex, FM_CHILD_QUEUE_DEPTH - 1 - i);
+    }
+
+    /* Empty lane leaves the output untouched */
+    QueueIndex = FM_CHILD_QUEUE_DEPTH;
+    UtAssert_BOOL_FALSE(FM_QueueLanePop(Lane, &QueueIndex));
+    UtAssert_INT32_EQ(QueueIndex, FM_CHILD_QUEUE_DEPTH);
+    UtAssert_INT32_EQ(FM_QueueLaneCount(Lane), 0);
+
+    /* The other lane is not affected */
+    UtAssert_INT32_EQ(FM_QueueLaneCount(&FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE]), 0);
+}
+
+void Test_FM_QueueLanePush_InvalidQueueIndex(void)
+{
+    FM_ChildLane_t *Lane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE];
+
+    UtAssert_BOOL_FALSE(FM_QueueLanePush(Lane, FM_CHILD_QUEUE_DEPTH));
+    UtAssert_INT32_EQ(FM_QueueLaneCount(Lane), 0);
+    UtAssert_INT32_EQ(Lane->WriteIndex, 0);
+}
+
+void Test_FM_QueueLanePushPop_Wrap(void)
+{
+    FM_ChildLane_t *Lane       = &FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE];
+    uint8           QueueIndex = 0;
+    uint32          i          = 0;
+
+    /* Indexes wrap at twice the lane depth, run through several times */
+    for (i = 0; i < (FM_CHILD_QUEUE_DEPTH * 5); i++)
+    {
+        UtAssert_BOOL_TRUE(FM_QueueLanePush(Lane, i % FM_CHILD_QUEUE_DEPTH));
+        UtAssert_BOOL_TRUE(FM_QueueLanePop(Lane, &QueueIndex));
+        UtAssert_INT32_EQ(QueueIndex, i % FM_CHILD_QUEUE_DEPTH);
+        UtAssert_INT32_EQ(FM_QueueLaneCount(Lane), 0);
+        UtAssert_BOOL_TRUE(Lane->WriteIndex < (FM_CHILD_QUEUE_DEPTH * 2));
+        UtAssert_BOOL_TRUE(Lane->ReadIndex < (FM_CHILD_QUEUE_DEPTH * 2));
+    }
+
+    UtAssert_INT32_EQ(Lane->WriteIndex, (FM_CHILD_QUEUE_DEPTH * 5) % (FM_CHILD_QUEUE_DEPTH * 2));
+    UtAssert_INT32_EQ(Lane->ReadIndex, Lane->WriteIndex);
+}
+
+void Test_FM_QueueLanePushPop_CorruptIndex(void)
+{
+    FM_ChildLane_t *Lane       = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
+    uint8           QueueIndex = 0;
+
+    /* Write index out of range */
+    Lane->WriteIndex = FM_CHILD_QUEUE_DEPTH * 2;
+    UtAssert_BOOL_FALSE(FM_QueueLanePush(Lane, 0));
+
+    /* Read index out of range */
+    Lane->WriteIndex = 1;
+    Lane->ReadIndex  = FM_CHILD_QUEUE_DEPTH * 2;
+    UtAssert_BOOL_FALSE(FM_QueueLanePop(Lane, &QueueIndex));
+}
+
+/*****************
+ * QueueLaneAbort Tests
+ ****************/
+void Test_FM_QueueLaneAbort(void)
+{
+    FM_ChildLane_t *Lane       = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
+    uint8           QueueIndex = 0;
+
+    FM_GlobalData.ChildQueue[0].JobID = 4;
+    FM_GlobalData.ChildQueue[1].JobID = 5;
+    FM_GlobalData.ChildQueue[2].JobID = 6;
+
+    UtAssert_BOOL_TRUE(FM_QueueLanePush(Lane, 0));
+    UtAssert_BOOL_TRUE(FM_QueueLanePush(Lane, 1));
+    UtAssert_BOOL_TRUE(FM_QueueLanePush(Lane, 2));
+    UtAssert_BOOL_TRUE(FM_QueueLanePop(Lane, &QueueIndex));
+
+    /* Waiting entry is marked in place, the lane is unchanged */
+    UtAssert_BOOL_TRUE(FM_QueueLaneAbort(Lane, 6));
+    UtAssert_BOOL_TRUE(FM_GlobalData.ChildQueue[2].Aborted);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildQueue[1].Aborted);
+    UtAssert_INT32_EQ(FM_QueueLaneCount(Lane), 2);
+
+    /* Entry already removed from the lane, unknown job, other lane */
+    UtAssert_BOOL_FALSE(FM_QueueLaneAbort(Lane, 4));
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildQueue[0].Aborted);
+    UtAssert_BOOL_FALSE(FM_QueueLaneAbort(Lane, 7));
+    UtAssert_BOOL_FALSE(FM_QueueLaneAbort(&FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE], 5));
+
+    /* Corrupt read index */
+    Lane->ReadIndex = FM_CHILD_QUEUE_DEPTH * 2;
+    UtAssert_BOOL_FALSE(FM_QueueLaneAbort(Lane, 5));
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildQueue[1].Aborted);
+}
+
+/*****************
+ * QueueLaneIsValid Tests
+ ****************/
+void Test_FM_QueueLaneIsValid(void)
+{
+    FM_ChildLane_t *Lane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
+
+    /* Empty lane */
+    UtAssert_BOOL_TRUE(FM_QueueLaneIsValid(Lane));
+
+    /* Read index out of range */
+    Lane->ReadIndex = FM_CHILD_QUEUE_DEPTH * 2;
+    UtAssert_BOOL_FALSE(FM_QueueLaneIsValid(Lane));
+
+    /* Write index out of range */
+    Lane->ReadIndex  = 0;
+    Lane->WriteIndex = FM_CHILD_QUEUE_DEPTH * 2;
+    UtAssert_BOOL_FALSE(FM_QueueLaneIsValid(Lane));
+
+    /* More entries than the lane can hold */
+    Lane->WriteIndex = FM_CHILD_QUEUE_DEPTH + 1;
+    UtAssert_BOOL_FALSE(FM_QueueLaneIsValid(Lane));
+
+    /* Full lane */
+    Lane->WriteIndex = FM_CHILD_QUEUE_DEPTH;
+    UtAssert_BOOL_TRUE(FM_QueueLaneIsValid(Lane));
+    UtAssert_INT32_EQ(FM_QueueLaneCount(Lane), FM_CHILD_QUEUE_DEPTH);
+}
+
+/*****************
+ * QueueEntryPack / QueueEntryUnpack Tests
+ ****************/
+
+/* Count the path arena blocks in use */
+uint16 UT_FM_QueueArenaBusyCount(void)
+{
+    uint16 Count = 0;
+    uint16 i     = 0;
+
+    for (i = 0; i < FM_CHILD_PATH_BLOCK_COUNT; i++)
+    {
+        if (FM_GlobalData.ChildPathBlockBusy[i] == true)
+        {
+            Count++;
+        }
+    }
+
+    return Count;
+}
+
+void Test_FM_QueueEntryPackUnpack(void)
+{
+    FM_ChildQueueEntry_t CmdArgs;
+    FM_ChildQueueEntry_t Result;
+
+    memset(&CmdArgs, 0, sizeof(CmdArgs));
+    memset(&Result, 0xFF, sizeof(Result));
+
+    CmdArgs.CommandCode     = FM_CONCAT_CC;
+    CmdArgs.DirListOffset   = 1;
+    CmdArgs.GetSizeTimeMode = 2;
+    CmdArgs.FileInfoState   = 3;
+    CmdArgs.FileInfoSize    = 4;
+    CmdArgs.FileInfoTime    = 5;
+    CmdArgs.FileInfoCRC     = 6;
+    CmdArgs.Mode            = 7;
+    CmdArgs.JobID           = 8;
+    CmdArgs.Aborted         = true;
+    CmdArgs.MinAge          = 11;
+    CmdArgs.MaxAge          = 12;
+    CmdArgs.MinSize         = 13;
+    CmdArgs.MaxSize         = 14;
+    CmdArgs.SegmentSize     = 15;
+    CmdArgs.FileSize        = 16;
+    CmdArgs.Resume          = 2;
+    CmdArgs.Verify          = 1;
+    CmdArgs.Sparse          = 1;
+    CmdArgs.Link            = FM_COPY_LINK_CLONE;
+    CmdArgs.QueueTime       = OS_TimeAssembleFromMilliseconds(9, 10);
+    strncpy(CmdArgs.Source1, "/ram/src1", sizeof(CmdArgs.Source1) - 1);
+    memset(CmdArgs.Target, 't', sizeof(CmdArgs.Target) - 1);
+
+    UtAssert_BOOL_TRUE(FM_QueueEntryPack(1, &CmdArgs));
+
+    /* Empty path uses no blocks, longest path uses the most */
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[1].PathBlockCount[FM_CHILD_PATH_SOURCE1], 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[1].PathBlockCount[FM_CHILD_PATH_SOURCE2], 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[1].PathBlockCount[FM_CHILD_PATH_TARGET], FM_CHILD_PATH_BLOCK_MAX);
+    UtAssert_INT32_EQ(UT_FM_QueueArenaBusyCount(), FM_CHILD_PATH_BLOCK_MAX + 1);
+
+    FM_QueueEntryUnpack(1, &Result);
+
+    UtAssert_INT32_EQ(Result.CommandCode, FM_CONCAT_CC);
+    UtAssert_INT32_EQ(Result.DirListOffset, 1);
+    UtAssert_INT32_EQ(Result.GetSizeTimeMode, 2);
+    UtAssert_INT32_EQ(Result.FileInfoState, 3);
+    UtAssert_INT32_EQ(Result.FileInfoSize, 4);
+    UtAssert_INT32_EQ(Result.FileInfoTime, 5);
+    UtAssert_INT32_EQ(Result.FileInfoCRC, 6);
+    UtAssert_INT32_EQ(Result.Mode, 7);
+    UtAssert_UINT32_EQ(Result.JobID, 8);
+    UtAssert_BOOL_TRUE(Result.Aborted);
+    UtAssert_UINT32_EQ(Result.MinAge, 11);
+    UtAssert_UINT32_EQ(Result.MaxAge, 12);
+    UtAssert_UINT32_EQ(Result.MinSize, 13);
+    UtAssert_UINT32_EQ(Result.MaxSize, 14);
+    UtAssert_UINT32_EQ(Result.SegmentSize, 15);
+    UtAssert_UINT32_EQ(Result.FileSize, 16);
+    UtAssert_UINT32_EQ(Result.Resume, 2);
+    UtAssert_UINT32_EQ(Result.Verify, 1);
+    UtAssert_UINT32_EQ(Result.Sparse, 1);
+    UtAssert_UINT32_EQ(Result.Link, FM_COPY_LINK_CLONE);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMilliseconds(Result.QueueTime), 9010);
+    UtAssert_STRINGBUF_EQ(Result.Source1, sizeof(Result.Source1), CmdArgs.Source1, sizeof(CmdArgs.Source1));
+    UtAssert_STRINGBUF_EQ(Result.Source2, sizeof(Result.Source2), "", 1);
+    UtAssert_STRINGBUF_EQ(Result.Target, sizeof(Result.Target), CmdArgs.Target, sizeof(CmdArgs.Target));
+
+    /* Unpack returns the blocks to the arena */
+    UtAssert_INT32_EQ(UT_FM_QueueArenaBusyCount(), 0);
+}
+
+void Test_FM_QueueEntryPack_ArenaFull(void)
+{
+    FM_ChildQueueEntry_t CmdArgs;
+    uint16               i = 0;
+
+    memset(&CmdArgs, 0, sizeof(CmdArgs));
+    strncpy(CmdArgs.Source1, "/ram/src1", sizeof(CmdArgs.Source1) - 1);
+    strncpy(CmdArgs.Target, "/ram/tgt", sizeof(CmdArgs.Target) - 1);
+
+    /* Room for the first path only */
+    for (i = 1; i < FM_CHILD_PATH_BLOCK_COUNT; i++)
+    {
+        FM_GlobalData.ChildPathBlockBusy[i] = true;
+    }
+
+    UtAssert_BOOL_FALSE(FM_QueueArenaHasRoom());
+    UtAssert_BOOL_FALSE(FM_QueueEntryPack(0, &CmdArgs));
+
+    /* Blocks taken for the first path are given back */
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildPathBlockBusy[0]);
+    UtAssert_INT32_EQ(UT_FM_QueueArenaBusyCount(), FM_CHILD_PATH_BLOCK_COUNT - 1);
+}
+
+void Test_FM_QueueEntryRelease(void)
+{
+    FM_ChildQueueEntry_t CmdArgs;
+
+    memset(&CmdArgs, 0, sizeof(CmdArgs));
+    strncpy(CmdArgs.Source1, "/ram/src1", sizeof(CmdArgs.Source1) - 1);
+    strncpy(CmdArgs.Source2, "/ram/src2", sizeof(CmdArgs.Source2) - 1);
+
+    UtAssert_BOOL_TRUE(FM_QueueEntryPack(FM_CHILD_QUEUE_DEPTH - 1, &CmdArgs));
+    UtAssert_INT32_EQ(UT_FM_QueueArenaBusyCount(), 2);
+
+    FM_QueueEntryRelease(FM_CHILD_QUEUE_DEPTH - 1);
+    UtAssert_INT32_EQ(UT_FM_QueueArenaBusyCount(), 0);
+
+    /* Releasing twice does nothing */
+    FM_QueueEntryRelease(FM_CHILD_QUEUE_DEPTH - 1);
+    UtAssert_INT32_EQ(UT_FM_QueueArenaBusyCount(), 0);
+}
+
+/*****************
+ * QueueArenaHasRoom Tests
+ ****************/
+void Test_FM_QueueArenaHasRoom(void)
+{
+    FM_ChildQueueEntry_t CmdArgs;
+    uint8                QueueIndex = 0;
+
+    /* Every path of every command at the maximum length */
+    memset(&CmdArgs, 0, sizeof(CmdArgs));
+    memset(CmdArgs.Source1, '1', sizeof(CmdArgs.Source1) - 1);
+    memset(CmdArgs.Source2, '2', sizeof(CmdArgs.Source2) - 1);
+    memset(CmdArgs.Target, '3', sizeof(CmdArgs.Target) - 1);
+
+    /* A pack never fails while the arena reports room */
+    while ((QueueIndex < FM_CHILD_QUEUE_DEPTH) && (FM_QueueArenaHasRoom() == true))
+    {
+        UtAssert_BOOL_TRUE(FM_QueueEntryPack(QueueIndex, &CmdArgs));
+        QueueIndex++;
+    }
+
+    UtAssert_INT32_EQ(QueueIndex, FM_CHILD_PATH_BLOCK_COUNT / (FM_CHILD_PATH_BLOCK_MAX * FM_CHILD_PATH_COUNT));
+    UtAssert_BOOL_FALSE(FM_QueueArenaHasRoom());
+
+    /* Freeing the first entry makes room again */
+    FM_QueueEntryRelease(0);
+    UtAssert_BOOL_TRUE(FM_QueueArenaHasRoom());
+}
+
+void Test_FM_QueueArenaHasRoom_Fragmented(void)
+{
+    uint16 i = 0;
+
+    /* Free runs one block shorter than the longest path are not room */
+    for (i = FM_CHILD_PATH_BLOCK_MAX - 1; i < FM_CHILD_PATH_BLOCK_COUNT; i += FM_CHILD_PATH_BLOCK_MAX)
+    {
+        FM_GlobalData.ChildPathBlockBusy[i] = true;
+    }
+
+    UtAssert_BOOL_FALSE(FM_QueueArenaHasRoom());
+}
+
+/*****************
+ * QueuePendingInit Tests
+ ****************/
+void Test_FM_QueuePendingInit(void)
+{
+    FM_GlobalData.ChildPendingWriteIndex = 1;
+
+    FM_QueuePendingInit();
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(FM_GlobalData.ChildPendingWriteFd));
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(FM_GlobalData.ChildPendingReadFd));
+    UtAssert_INT32_EQ(FM_GlobalData.ChildPendingWriteIndex, 0);
+    UtAssert_INT32_EQ(FM_QueuePendingCount(), 0);
+    UtAssert_BOOL_TRUE(FM_QueuePendingHasRoom());
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_QueuePendingInit_OpenFail(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 2, OS_ERROR);
+
+    FM_QueuePendingInit();
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(FM_GlobalData.ChildPendingWriteFd));
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(FM_GlobalData.ChildPendingReadFd));
+    UtAssert_BOOL_FALSE(FM_QueuePendingHasRoom());
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_PENDING_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+/*****************
+ * QueuePendingPush / QueuePendingPop Tests
+ ****************/
+void Test_FM_QueuePendingPushPop(void)
+{
+    FM_ChildQueueEntry_t CmdArgs = {.CommandCode = FM_COPY_CC};
+    FM_ChildQueueEntry_t Result;
+
+    FM_GlobalData.ChildPendingWriteFd = FM_UT_OBJID_1;
+    FM_GlobalData.ChildPendingReadFd  = FM_UT_OBJID_2;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_ChildQueueEntry_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(FM_ChildQueueEntry_t));
+
+    /* Empty file */
+    UtAssert_BOOL_FALSE(FM_QueuePendingPop(&Result));
+    UtAssert_STUB_COUNT(OS_read, 0);
+
+    UtAssert_BOOL_TRUE(FM_QueuePendingPush(&CmdArgs, FM_CHILD_LANE_BULK));
+    UtAssert_INT32_EQ(FM_QueuePendingCount(), 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+
+    UtAssert_BOOL_TRUE(FM_QueuePendingPop(&Result));
+    UtAssert_INT32_EQ(FM_QueuePendingCount(), 0);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+}
+
+void Test_FM_QueuePendingPushPop_Wrap(void)
+{
+    FM_ChildQueueEntry_t CmdArgs = {.CommandCode = FM_COPY_CC};
+    FM_ChildQueueEntry_t Result;
+    int32                Offset = (FM_CHILD_PENDING_DEPTH - 1) * sizeof(FM_ChildQueueEntry_t);
+
+    FM_GlobalData.ChildPendingWriteFd    = FM_UT_OBJID_1;
+    FM_GlobalData.ChildPendingReadFd     = FM_UT_OBJID_2;
+    FM_GlobalData.ChildPendingWriteIndex = (FM_CHILD_PENDING_DEPTH * 2) - 1;
+    FM_GlobalData.ChildPendingReadIndex  = (FM_CHILD_PENDING_DEPTH * 2) - 1;
+
+    /* Last record in the file */
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), Offset);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_ChildQueueEntry_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(FM_ChildQueueEntry_t));
+
+    UtAssert_BOOL_TRUE(FM_QueuePendingPush(&CmdArgs, FM_CHILD_LANE_BULK));
+    UtAssert_INT32_EQ(FM_GlobalData.ChildPendingWriteIndex, 0);
+    UtAssert_INT32_EQ(FM_QueuePendingCount(), 1);
+
+    UtAssert_BOOL_TRUE(FM_QueuePendingPop(&Result));
+    UtAssert_INT32_EQ(FM_GlobalData.ChildPendingReadIndex, 0);
+    UtAssert_INT32_EQ(FM_QueuePendingCount(), 0);
+}
+
+void Test_FM_QueuePendingPush_Full(void)
+{
+    FM_ChildQueueEntry_t CmdArgs = {.CommandCode = FM_COPY_CC};
+
+    /* Disabled */
+    UtAssert_BOOL_FALSE(FM_QueuePendingHasRoom());
+    UtAssert_BOOL_FALSE(FM_QueuePendingPush(&CmdArgs, FM_CHILD_LANE_BULK));
+
+    /* Full */
+    FM_GlobalData.ChildPendingWriteFd    = FM_UT_OBJID_1;
+    FM_GlobalData.ChildPendingWriteIndex = FM_CHILD_PENDING_DEPTH;
+    UtAssert_INT32_EQ(FM_QueuePendingCount(), FM_CHILD_PENDING_DEPTH);
+    UtAssert_BOOL_FALSE(FM_QueuePendingHasRoom());
+    UtAssert_BOOL_FALSE(FM_QueuePendingPush(&CmdArgs, FM_CHILD_LANE_BULK));
+
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void Test_FM_QueuePendingPush_WriteFail(void)
+{
+    FM_ChildQueueEntry_t CmdArgs = {.CommandCode = FM_COPY_CC};
+
+    FM_GlobalData.ChildPendingWriteFd = FM_UT_OBJID_1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
+
+    UtAssert_BOOL_FALSE(FM_QueuePendingPush(&CmdArgs, FM_CHILD_LANE_BULK));
+    UtAssert_INT32_EQ(FM_QueuePendingCount(), 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildPendingWriteIndex, 0);
+}
+
+void Test_FM_QueuePendingHasInteractive(void)
+{
+    FM_ChildQueueEntry_t CmdArgs = {.CommandCode = FM_COPY_CC};
+    FM_ChildQueueEntry_t Result;
+
+    FM_GlobalData.ChildPendingWriteFd = FM_UT_OBJID_1;
+    FM_GlobalData.ChildPendingReadFd  = FM_UT_OBJID_2;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_ChildQueueEntry_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(FM_ChildQueueEntry_t));
+
+    UtAssert_BOOL_FALSE(FM_QueuePendingHasInteractive());
+
+    /* Bulk commands alone */
+    UtAssert_BOOL_TRUE(FM_QueuePendingPush(&CmdArgs, FM_CHILD_LANE_BULK));
+    UtAssert_BOOL_FALSE(FM_QueuePendingHasInteractive());
+
+    /* Interactive command stays waiting behind the bulk command and the one after it */
+    UtAssert_BOOL_TRUE(FM_QueuePendingPush(&CmdArgs, FM_CHILD_LANE_INTERACTIVE));
+    UtAssert_BOOL_TRUE(FM_QueuePendingPush(&CmdArgs, FM_CHILD_LANE_BULK));
+    UtAssert_BOOL_TRUE(FM_QueuePendingHasInteractive());
+    UtAssert_BOOL_TRUE(FM_QueuePendingPop(&Result));
+    UtAssert_BOOL_TRUE(FM_QueuePendingHasInteractive());
+
+    /* Interactive command read, bulk command still waiting */
+    UtAssert_BOOL_TRUE(FM_QueuePendingPop(&Result));
+    UtAssert_BOOL_FALSE(FM_QueuePendingHasInteractive());
+    UtAssert_INT32_EQ(FM_QueuePendingCount(), 1);
+
+    /* Later bulk commands do not revive the mark */
+    UtAssert_BOOL_TRUE(FM_QueuePendingPop(&Result));
+    UtAssert_BOOL_TRUE(FM_QueuePendingPush(&CmdArgs, FM_CHILD_LANE_BULK));
+    UtAssert_BOOL_FALSE(FM_QueuePendingHasInteractive());
+}
+
+void Test_FM_QueuePendingPop_ReadFail(void)
+{
+    FM_ChildQueueEntry_t Result;
+
+    FM_GlobalData.ChildPendingReadFd     = FM_UT_OBJID_2;
+    FM_GlobalData.ChildPendingWriteIndex = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), OS_ERROR);
+
+    /* Unreadable command is dropped so that the next one can run */
+    UtAssert_BOOL_FALSE(FM_QueuePendingPop(&Result));
+    UtAssert_INT32_EQ(FM_GlobalData.ChildPendingReadIndex, 1);
+    UtAssert_INT32_EQ(FM_QueuePendingCount(), 1);
+
+    /* Corrupt read index */
+    FM_GlobalData.ChildPendingReadIndex = FM_CHILD_PENDING_DEPTH * 2;
+    UtAssert_BOOL_FALSE(FM_QueuePendingPop(&Result));
+    UtAssert_STUB_COUNT(OS_read, 1);
+}
+
+/*****************
+ * QueuePendingAbort Tests
+ ****************/
+void Test_FM_QueuePendingAbort(void)
+{
+    FM_ChildQueueEntry_t Entry = {.CommandCode = FM_COPY_CC, .JobID = 6};
+
+    FM_GlobalData.ChildPendingWriteFd    = FM_UT_OBJID_1;
+    FM_GlobalData.ChildPendingWriteIndex = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(FM_ChildQueueEntry_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_ChildQueueEntry_t));
+    UT_SetDataBuffer(UT_KEY(OS_read), &Entry, sizeof(Entry), false);
+
+    /* Waiting command is rewritten in place, the file indexes are unchanged */
+    UtAssert_BOOL_TRUE(FM_QueuePendingAbort(6));
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+    UtAssert_INT32_EQ(FM_QueuePendingCount(), 1);
+}
+
+void Test_FM_QueuePendingAbort_NotFound(void)
+{
+    FM_ChildQueueEntry_t Entry = {.CommandCode = FM_COPY_CC, .JobID = 6};
+
+    /* Disabled */
+    FM_GlobalData.ChildPendingWriteIndex = 1;
+    UtAssert_BOOL_FALSE(FM_QueuePendingAbort(6));
+    UtAssert_STUB_COUNT(OS_read, 0);
+
+    /* Empty */
+    FM_GlobalData.ChildPendingWriteFd    = FM_UT_OBJID_1;
+    FM_GlobalData.ChildPendingWriteIndex = 0;
+    UtAssert_BOOL_FALSE(FM_QueuePendingAbort(6));
+    UtAssert_STUB_COUNT(OS_read, 0);
+
+    /* Other job */
+    FM_GlobalData.ChildPendingWriteIndex = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(FM_ChildQueueEntry_t));
+    UT_SetDataBuffer(UT_KEY(OS_read), &Entry, sizeof(Entry), false);
+
+    UtAssert_BOOL_FALSE(FM_QueuePendingAbort(7));
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void Test_FM_QueuePendingAbort_WriteFail(void)
+{
+    FM_ChildQueueEntry_t Entry = {.CommandCode = FM_COPY_CC, .JobID = 6};
+
+    FM_GlobalData.ChildPendingWriteFd    = FM_UT_OBJID_1;
+    FM_GlobalData.ChildPendingWriteIndex = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(FM_ChildQueueEntry_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(OS_read), &Entry, sizeof(Entry), false);
+
+    /* Command could not be marked and will still run */
+    UtAssert_BOOL_FALSE(FM_QueuePendingAbort(6));
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+/*****************
+ * Producer/Consumer Stress Tests
+ ****************/
+
+/* Results reported by the stress test threads (UtAssert is not thread safe) */
+typedef struct
+{
+    uint32 Processed;
+    uint32 OrderErrors;
+    uint32 CountErrors;
+    uint32 LaneErrors;
+} UT_FM_QueueStress_t;
+
+static UT_FM_QueueStress_t UT_FM_QueueStress;
+
+/*
+ * Mirrors FM_VerifyChildTask() and FM_InvokeChildTask() running in the FM main task
+ */
+static void *UT_FM_QueueStressProducer(void *Arg)
+{
+    FM_ChildQueueEntry_t CmdArgs;
+    uint32               Sequence   = 0;
+    uint8                QueueIndex = 0;
+    uint8                Lane       = 0;
+
+    memset(&CmdArgs, 0, sizeof(CmdArgs));
+
+    while (Sequence < UT_FM_QUEUE_STRESS_COUNT)
+    {
+        /* Wait for a free queue entry and path arena room */
+        while ((FM_ATOMIC_LOAD(&FM_GlobalData.ChildQueueCount) >= FM_CHILD_QUEUE_DEPTH) ||
+               (FM_ATOMIC_LOAD(&FM_GlobalData.ChildQueueBusy[QueueIndex]) == true) ||
+               (FM_QueueArenaHasRoom() == false))
+        {
+            sched_yield();
+        }
+
+        Lane = Sequence % FM_CHILD_LANE_COUNT;
+
+        CmdArgs.CommandCode  = Lane;
+        CmdArgs.FileInfoTime = Sequence;
+        snprintf(CmdArgs.Source1, sizeof(CmdArgs.Source1), "/ram/%lu", (unsigned long)Sequence);
+
+        /* Path length varies with the sequence number, so arena blocks are reused in different patterns */
+        memset(CmdArgs.Target, 't', Sequence % sizeof(CmdArgs.Target));
+        CmdArgs.Target[Sequence % sizeof(CmdArgs.Target)] = '\0';
+
+        if (FM_QueueEntryPack(QueueIndex, &CmdArgs) == false)
+        {
+            FM_ATOMIC_INCREMENT(&UT_FM_QueueStress.LaneErrors);
+            break;
+        }
+
+        FM_ATOMIC_STORE(&FM_GlobalData.ChildQueueBusy[QueueIndex], true);
+        FM_ATOMIC_INCREMENT(&FM_GlobalData.ChildQueueCount);
+
+        if (FM_QueueLanePush(&FM_GlobalData.ChildLane[Lane], QueueIndex) == false)
+        {
+            FM_ATOMIC_INCREMENT(&UT_FM_QueueStress.LaneErrors);
+            break;
+        }
+
+        QueueIndex = (QueueIndex + 1) % FM_CHILD_QUEUE_DEPTH;
+        Sequence++;
+    }
+
+    return NULL;
+}
+
+/*
+ * Mirrors FM_ChildProcess() running in a child task worker
+ */
+static void *UT_FM_QueueStressConsumer(void *Arg)
+{
+    FM_ChildQueueEntry_t CmdArgs;
+    char                 Source1[OS_MAX_PATH_LEN];
+    uint32               Expected[FM_CHILD_LANE_COUNT];
+    uint8                QueueIndex = 0;
+    uint8                Lane       = 0;
+
+    for (Lane = 0; Lane < FM_CHILD_LANE_COUNT; Lane++)
+    {
+        Expected[Lane] = Lane;
+    }
+
+    while ((UT_FM_QueueStress.Processed < UT_FM_QUEUE_STRESS_COUNT) &&
+           (FM_ATOMIC_LOAD(&UT_FM_QueueStress.LaneErrors) == 0))
+    {
+        if (FM_QueueLanePop(&FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE], &QueueIndex) == false)
+        {
+            if (FM_QueueLanePop(&FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK], &QueueIndex) == false)
+            {
+                sched_yield();
+                continue;
+            }
+        }
+
+        FM_QueueEntryUnpack(QueueIndex, &CmdArgs);
+        FM_ATOMIC_STORE(&FM_GlobalData.ChildQueueBusy[QueueIndex], false);
+
+        snprintf(Source1, sizeof(Source1), "/ram/%lu", (unsigned long)CmdArgs.FileInfoTime);
+
+        /* Commands within a lane must arrive in order and intact */
+        Lane = CmdArgs.CommandCode;
+        if ((Lane >= FM_CHILD_LANE_COUNT) || (CmdArgs.FileInfoTime != Expected[Lane]) ||
+            (strcmp(CmdArgs.Source1, Source1) != 0) ||
+            (strlen(CmdArgs.Target) != (CmdArgs.FileInfoTime % sizeof(CmdArgs.Target))))
+        {
+            UT_FM_QueueStress.OrderErrors++;
+        }
+        else
+        {
+            Expected[Lane] += FM_CHILD_LANE_COUNT;
+        }
+
+        /* The producer counts an entry before the entry becomes visible */
+        if (FM_ATOMIC_LOAD(&FM_GlobalData.ChildQueueCount) == 0)
+        {
+            UT_FM_QueueStress.CountErrors++;
+        }
+
+        FM_ATOMIC_DECREMENT(&FM_GlobalData.ChildQueueCount);
+        UT_FM_QueueStress.Processed++;
+    }
+
+    return NULL;
+}
+
+void Test_FM_QueueLane_ProducerConsumerStress(void)
+{
+    pthread_t Producer;
+    pthread_t Consumer;
+
+    memset(&UT_FM_QueueStress, 0, sizeof(UT_FM_QueueStress));
+
+    UtAssert_INT32_EQ(pthread_create(&Consumer, NULL, UT_FM_QueueStressConsumer, NULL), 0);
+    UtAssert_INT32_EQ(pthread_create(&Producer, NULL, UT_FM_QueueStressProducer, NULL), 0);
+
+    UtAssert_INT32_EQ(pthread_join(Producer, NULL), 0);
+    UtAssert_INT32_EQ(pthread_join(Consumer, NULL), 0);
+
+    UtAssert_INT32_EQ(UT_FM_QueueStress.Processed, UT_FM_QUEUE_STRESS_COUNT);
+    UtAssert_INT32_EQ(UT_FM_QueueStress.OrderErrors, 0);
+    UtAssert_INT32_EQ(UT_FM_QueueStress.CountErrors, 0);
+    UtAssert_INT32_EQ(UT_FM_QueueStress.LaneErrors, 0);
+
+    /* Everything handed over, nothing left behind */
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 0);
+    UtAssert_INT32_EQ(FM_QueueLaneCount(&FM_GlobalData.ChildLane[FM_CHILD_LANE_INTERACTIVE]), 0);
+    UtAssert_INT32_EQ(FM_QueueLaneCount(&FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK]), 0);
+    UtAssert_INT32_EQ(UT_FM_QueueArenaBusyCount(), 0);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_FM_QueueLanePushPop_Fifo, FM_Test_Setup, FM_Test_Teardown, "Test_FM_QueueLanePushPop_Fifo");
+    UtTest_Add(Test_FM_QueueLanePush_InvalidQueueIndex, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_QueueLanePush_InvalidQueueIndex");
+    UtTest_Add(Test_FM_QueueLanePushPop_Wrap, FM_Test_Setup, FM_Test_Teardown, "Test_FM_QueueLanePushPop_Wrap");
+    UtTest_Add(Test_FM_QueueLanePushPop_CorruptIndex, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_QueueLanePushPop_CorruptIndex");
+    UtTest_Add(Test_FM_QueueLaneAbort, FM_Test_Setup, FM_Test_Teardown, "Test_FM_QueueLaneAbort");
+    UtTest_Add(Test_FM_QueueLaneIsValid, FM_Test_Setup, FM_Test_Teardown, "Test_FM_QueueLaneIsValid");
+    UtTest_Add(Test_FM_QueueEntryPackUnpack, FM_Test_Setup, FM_Test_Teardown, "Test_FM_QueueEntryPackUnpack");
+    UtTest_Add(Test_FM_QueueEntryPack_ArenaFull, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_QueueEntryPack_ArenaFull");
+    UtTest_Add(Test_FM_QueueEntryRelease, FM_Test_Setup, FM_Test_Teardown, "Test_FM_QueueEntryRelease");
+    UtTest_Add(Test_FM_QueueArenaHasRoom, FM_Test_Setup, FM_Test_Teardown, "Test_FM_QueueArenaHasRoom");
+    UtTest_Add(Test_FM_QueueArenaHasRoom_Fragmented, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_QueueArenaHasRoom_Fragmented");
+    UtTest_Add(Test_FM_QueuePendingInit, FM_Test_Setup, FM_Test_Teardown, "Test_FM_QueuePendingInit");
+    UtTest_Add(Test_FM_QueuePendingInit_OpenFail, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_QueuePendingInit_OpenFail");
+    UtTest_Add(Test_FM_QueuePendingPushPop, FM_Test_Setup, FM_Test_Teardown, "Test_FM_QueuePendingPushPop");
+    UtTest_Add(Test_FM_QueuePendingPushPop_Wrap, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_QueuePendingPushPop_Wrap");
+    UtTest_Add(Test_FM_QueuePendingPush_Full, FM_Test_Setup, FM_Test_Teardown, "Test_FM_QueuePendingPush_Full");
+    UtTest_Add(Test_FM_QueuePendingPush_WriteFail, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_QueuePendingPush_WriteFail");
+    UtTest_Add(Test_FM_QueuePendingHasInteractive, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_QueuePendingHasInteractive");
+    UtTest_Add(Test_FM_QueuePendingAbort, FM_Test_Setup, FM_Test_Teardown, "Test_FM_QueuePendingAbort");
+    UtTest_Add(Test_FM_QueuePendingAbort_NotFound, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_QueuePendingAbort_NotFound");
+    UtTest_Add(Test_FM_QueuePendingAbort_WriteFail, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_QueuePendingAbort_WriteFail");
+    UtTest_Add(Test_FM_QueuePendingPop_ReadFail, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_QueuePendingPop_ReadFail");
+    UtTest_Add(Test_FM_QueueLane_ProducerConsumerStress, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_QueueLane_ProducerConsumerStress");
+}
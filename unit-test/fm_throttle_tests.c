@@ -0,0 +1,422 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task I/O Throttle Functions
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_defs.h"
+#include "fm_throttle.h"
+#include "fm_platform_cfg.h"
+
+/*
+ * UT Assert
+ */
+#include "fm_test_utils.h"
+
+/*
+ * UT includes
+ */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <string.h>
+
+/* Local time returned by the OS_GetLocalTime stub */
+static OS_time_t UT_FM_Throttle_Now;
+
+void UT_Handler_OS_GetLocalTime(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *TimePtr = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+
+    *TimePtr = UT_FM_Throttle_Now;
+}
+
+/* Advance the local time returned by the OS_GetLocalTime stub */
+void UT_FM_Throttle_Advance(uint32 Microseconds)
+{
+    UT_FM_Throttle_Now = OS_TimeAdd(UT_FM_Throttle_Now, OS_TimeAssembleFromMicroseconds(0, Microseconds));
+}
+
+void UT_FM_Throttle_Test_Setup(void)
+{
+    FM_Test_Setup();
+
+    UT_FM_Throttle_Now = OS_TimeAssembleFromMilliseconds(1000, 0);
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), UT_Handler_OS_GetLocalTime, NULL);
+
+    /* Workers take the block size when a command starts */
+    FM_GlobalData.ChildWorker[0].BlockSize = FM_CHILD_FILE_BLOCK_SIZE;
+}
+
+/*********************************************************************************
+ *          TEST CASE FUNCTIONS
+ *********************************************************************************/
+
+/*****************
+ * ThrottleInit Tests
+ ****************/
+void Test_FM_ThrottleInit_Success(void)
+{
+    UtAssert_INT32_EQ(FM_ThrottleInit(), OS_SUCCESS);
+
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Rate, FM_CHILD_THROTTLE_BYTES_PER_SEC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Current, FM_CHILD_THROTTLE_BYTES_PER_SEC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Stats.Rate, FM_CHILD_THROTTLE_STATS_PER_SEC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.LatencyLimit, FM_CHILD_THROTTLE_LATENCY_US);
+}
+
+void Test_FM_ThrottleInit_MutSemCreateNotSuccess(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(OS_MutSemCreate), OS_ERROR);
+
+    UtAssert_INT32_EQ(FM_ThrottleInit(), OS_ERROR);
+
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Rate, 0);
+}
+
+/*****************
+ * ThrottleSet Tests
+ ****************/
+void Test_FM_ThrottleSet(void)
+{
+    FM_GlobalData.ChildThrottle.Bytes.Tokens = -100;
+    FM_GlobalData.ChildThrottle.Stats.Tokens = 5;
+    FM_GlobalData.ChildThrottle.Latency      = 7;
+
+    UtAssert_VOIDCALL(FM_ThrottleSet(100000, 50, 2000));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Rate, 100000);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Current, 100000);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Tokens, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Stats.Rate, 50);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle.Stats.Tokens, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.LatencyLimit, 2000);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Latency, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+/*****************
+ * ThrottleBytes Tests
+ ****************/
+void Test_FM_ThrottleBytes_Unlimited(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    FM_ThrottleSet(0, 0, 0);
+    FM_ThrottleStart(Worker);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, FM_CHILD_FILE_BLOCK_SIZE));
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, FM_CHILD_FILE_BLOCK_SIZE));
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Tokens, 0);
+}
+
+void Test_FM_ThrottleBytes_Debt(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    /* Ten blocks per second, the bucket starts empty */
+    FM_ThrottleSet(FM_CHILD_FILE_BLOCK_SIZE * 10, 0, 0);
+    FM_ThrottleStart(Worker);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, FM_CHILD_FILE_BLOCK_SIZE));
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogExit, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Tokens, -FM_CHILD_FILE_BLOCK_SIZE);
+
+    /* The debt is repaid after a tenth of a second */
+    UT_FM_Throttle_Advance(100000);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, FM_CHILD_FILE_BLOCK_SIZE / 2));
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 2);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Tokens, -FM_CHILD_FILE_BLOCK_SIZE / 2);
+}
+
+void Test_FM_ThrottleBytes_SubMillisecondDebt(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    /* Less than a milli-sec of debt is carried to the next block */
+    FM_ThrottleSet(FM_CHILD_FILE_BLOCK_SIZE * 2000, 0, 0);
+    FM_ThrottleStart(Worker);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, FM_CHILD_FILE_BLOCK_SIZE));
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Tokens, -FM_CHILD_FILE_BLOCK_SIZE);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, FM_CHILD_FILE_BLOCK_SIZE));
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+}
+
+void Test_FM_ThrottleBytes_Burst(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+    uint32            Rate   = FM_CHILD_FILE_BLOCK_SIZE * 1000;
+
+    FM_ThrottleSet(Rate, 0, 0);
+    FM_ThrottleStart(Worker);
+
+    /* Idle for a second fills the bucket to the burst size only */
+    UT_FM_Throttle_Advance(1000000);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, FM_CHILD_FILE_BLOCK_SIZE));
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Tokens,
+                      ((int64)Rate * FM_CHILD_THROTTLE_BURST_MS / 1000) - FM_CHILD_FILE_BLOCK_SIZE);
+}
+
+void Test_FM_ThrottleBytes_BurstBlockSize(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+    uint32            Rate   = FM_CHILD_FILE_BLOCK_SIZE * 2;
+
+    /* One commanded block per second, the burst is less than a block */
+    Worker->BlockSize = Rate;
+    FM_ThrottleSet(Rate, 0, 0);
+    FM_ThrottleStart(Worker);
+
+    /* Idle for a second still earns a whole block of the worker block size */
+    UT_FM_Throttle_Advance(1000000);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, Rate));
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Tokens, 0);
+}
+
+void Test_FM_ThrottleBytes_PartialToken(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+    OS_time_t         Start  = UT_FM_Throttle_Now;
+
+    FM_ThrottleSet(FM_CHILD_FILE_BLOCK_SIZE, 0, 0);
+    FM_ThrottleStart(Worker);
+
+    /* 1.5 tokens have been earned, only the time of one token is used */
+    UT_FM_Throttle_Advance(1500000 / FM_CHILD_FILE_BLOCK_SIZE);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, 1));
+
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Tokens, 0);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(OS_TimeSubtract(FM_GlobalData.ChildThrottle.Bytes.LastFill, Start)),
+                      1000000 / FM_CHILD_FILE_BLOCK_SIZE);
+}
+
+void Test_FM_ThrottleBytes_ClockSetBackwards(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+
+    FM_ThrottleSet(FM_CHILD_FILE_BLOCK_SIZE * 1000, 0, 0);
+    FM_ThrottleStart(Worker);
+
+    UT_FM_Throttle_Now = OS_TimeAssembleFromMilliseconds(10, 0);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, 0));
+
+    /* No tokens are added, the fill interval restarts */
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Tokens, 0);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMilliseconds(FM_GlobalData.ChildThrottle.Bytes.LastFill), 10000);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Latency, 0);
+}
+
+void Test_FM_ThrottleBytes_BackoffHighLatency(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+    uint32            Rate   = FM_CHILD_FILE_BLOCK_SIZE * 64;
+
+    FM_ThrottleSet(Rate, 0, 1000);
+    FM_ThrottleStart(Worker);
+
+    /* A 200 ms block raises the smoothed latency above the limit */
+    UT_FM_Throttle_Advance(200000);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, 0));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Latency, 200000 / FM_THROTTLE_LATENCY_WEIGHT);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Current, Rate / 2);
+
+    /* No further adjustment until the adjust interval has passed */
+    UT_FM_Throttle_Advance(1000);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, 0));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Current, Rate / 2);
+}
+
+void Test_FM_ThrottleBytes_BackoffFloor(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+    uint32            Rate   = FM_CHILD_FILE_BLOCK_SIZE * 64;
+
+    FM_ThrottleSet(Rate, 0, 1000);
+    FM_GlobalData.ChildThrottle.Bytes.Current = Rate / FM_THROTTLE_BACKOFF_DIV;
+    FM_ThrottleStart(Worker);
+
+    UT_FM_Throttle_Advance(200000);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, 0));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Current, Rate / FM_THROTTLE_BACKOFF_DIV);
+}
+
+void Test_FM_ThrottleBytes_BackoffBlockSize(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+    uint32            Rate   = FM_CHILD_FILE_BLOCK_SIZE * 64;
+
+    /* The floor is one block per second of the worker block size */
+    Worker->BlockSize = Rate / 2;
+    FM_ThrottleSet(Rate, 0, 1000);
+    FM_ThrottleStart(Worker);
+
+    UT_FM_Throttle_Advance(200000);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, 0));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Current, Rate / 2);
+
+    UT_FM_Throttle_Advance(FM_THROTTLE_ADJUST_MS * 1000);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, 0));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Current, Rate / 2);
+
+    /* A block size left from before the rate was set never raises the floor above the rate */
+    Worker->BlockSize = Rate * 2;
+    UT_FM_Throttle_Advance(FM_THROTTLE_ADJUST_MS * 1000);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, 0));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Current, Rate);
+}
+
+void Test_FM_ThrottleBytes_BackoffRecover(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+    uint32            Rate   = FM_CHILD_FILE_BLOCK_SIZE * 64;
+    uint32            Step   = Rate / FM_THROTTLE_BACKOFF_DIV;
+
+    FM_ThrottleSet(Rate, 0, 1000);
+    FM_GlobalData.ChildThrottle.Bytes.Current = Rate - Step - 1;
+
+    /* Low latency blocks after the adjust interval */
+    UT_FM_Throttle_Advance(FM_THROTTLE_ADJUST_MS * 1000);
+    FM_ThrottleStart(Worker);
+    UT_FM_Throttle_Advance(100);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, 0));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Current, Rate - 1);
+
+    /* Recovery stops at the commanded rate */
+    UT_FM_Throttle_Advance(FM_THROTTLE_ADJUST_MS * 1000);
+    FM_ThrottleStart(Worker);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, 0));
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Current, Rate);
+}
+
+void Test_FM_ThrottleBytes_BackoffDisabled(void)
+{
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[0];
+    uint32            Rate   = FM_CHILD_FILE_BLOCK_SIZE * 64;
+
+    FM_ThrottleSet(Rate, 0, 0);
+    FM_ThrottleStart(Worker);
+
+    UT_FM_Throttle_Advance(200000);
+
+    UtAssert_VOIDCALL(FM_ThrottleBytes(Worker, 0));
+
+    /* Latency is still measured for housekeeping telemetry */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Latency, 200000 / FM_THROTTLE_LATENCY_WEIGHT);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle.Bytes.Current, Rate);
+}
+
+/*****************
+ * ThrottleStats Tests
+ ****************/
+void Test_FM_ThrottleStats(void)
+{
+    /* Ten OS_stat calls per second, the bucket starts empty */
+    FM_ThrottleSet(0, 10, 0);
+
+    UtAssert_VOIDCALL(FM_ThrottleStats());
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle.Stats.Tokens, -1);
+
+    /* Unlimited */
+    FM_ThrottleSet(0, 0, 0);
+
+    UtAssert_VOIDCALL(FM_ThrottleStats());
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_FM_ThrottleInit_Success, UT_FM_Throttle_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ThrottleInit_Success");
+    UtTest_Add(Test_FM_ThrottleInit_MutSemCreateNotSuccess, UT_FM_Throttle_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ThrottleInit_MutSemCreateNotSuccess");
+    UtTest_Add(Test_FM_ThrottleSet, UT_FM_Throttle_Test_Setup, FM_Test_Teardown, "Test_FM_ThrottleSet");
+    UtTest_Add(Test_FM_ThrottleBytes_Unlimited, UT_FM_Throttle_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ThrottleBytes_Unlimited");
+    UtTest_Add(Test_FM_ThrottleBytes_Debt, UT_FM_Throttle_Test_Setup, FM_Test_Teardown, "Test_FM_ThrottleBytes_Debt");
+    UtTest_Add(Test_FM_ThrottleBytes_SubMillisecondDebt, UT_FM_Throttle_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ThrottleBytes_SubMillisecondDebt");
+    UtTest_Add(Test_FM_ThrottleBytes_Burst, UT_FM_Throttle_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ThrottleBytes_Burst");
+    UtTest_Add(Test_FM_ThrottleBytes_BurstBlockSize, UT_FM_Throttle_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ThrottleBytes_BurstBlockSize");
+    UtTest_Add(Test_FM_ThrottleBytes_PartialToken, UT_FM_Throttle_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ThrottleBytes_PartialToken");
+    UtTest_Add(Test_FM_ThrottleBytes_ClockSetBackwards, UT_FM_Throttle_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ThrottleBytes_ClockSetBackwards");
+    UtTest_Add(Test_FM_ThrottleBytes_BackoffHighLatency, UT_FM_Throttle_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ThrottleBytes_BackoffHighLatency");
+    UtTest_Add(Test_FM_ThrottleBytes_BackoffFloor, UT_FM_Throttle_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ThrottleBytes_BackoffFloor");
+    UtTest_Add(Test_FM_ThrottleBytes_BackoffBlockSize, UT_FM_Throttle_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ThrottleBytes_BackoffBlockSize");
+    UtTest_Add(Test_FM_ThrottleBytes_BackoffRecover, UT_FM_Throttle_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ThrottleBytes_BackoffRecover");
+    UtTest_Add(Test_FM_ThrottleBytes_BackoffDisabled, UT_FM_Throttle_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ThrottleBytes_BackoffDisabled");
+    UtTest_Add(Test_FM_ThrottleStats, UT_FM_Throttle_Test_Setup, FM_Test_Teardown, "Test_FM_ThrottleStats");
+}
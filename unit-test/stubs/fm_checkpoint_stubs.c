@@ -0,0 +1,127 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task Copy Checkpoint Functions
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_checkpoint.h"
+#include "fm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- register and restore CDS blocks       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CheckpointInit(void)
+{
+    UT_DEFAULT_IMPL(FM_CheckpointInit);
+} /* End FM_CheckpointInit */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- verify restored checkpoint            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_CheckpointIsValid(const FM_ChildCheckpoint_t *Checkpoint)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_CheckpointIsValid), Checkpoint);
+
+    return UT_DEFAULT_IMPL(FM_CheckpointIsValid);
+} /* End FM_CheckpointIsValid */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- worker has a checkpoint block         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_CheckpointIsEnabled(const FM_ChildWorker_t *Worker)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_CheckpointIsEnabled), Worker);
+
+    return UT_DEFAULT_IMPL(FM_CheckpointIsEnabled);
+} /* End FM_CheckpointIsEnabled */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- prepare checkpoint for a command      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CheckpointStart(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_CheckpointStart), Worker);
+    UT_Stub_RegisterContext(UT_KEY(FM_CheckpointStart), CmdArgs);
+
+    UT_DEFAULT_IMPL(FM_CheckpointStart);
+} /* End FM_CheckpointStart */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- add written block to checkpoint       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CheckpointUpdate(FM_ChildWorker_t *Worker, const void *Data, uint32 Size)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_CheckpointUpdate), Worker);
+    UT_Stub_RegisterContext(UT_KEY(FM_CheckpointUpdate), Data);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_CheckpointUpdate), Size);
+
+    UT_DEFAULT_IMPL(FM_CheckpointUpdate);
+} /* End FM_CheckpointUpdate */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- copy checkpoint to CDS block          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CheckpointSave(FM_ChildWorker_t *Worker)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_CheckpointSave), Worker);
+
+    UT_DEFAULT_IMPL(FM_CheckpointSave);
+} /* End FM_CheckpointSave */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM checkpoint function -- command no longer needs a checkpoint  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CheckpointClear(FM_ChildWorker_t *Worker)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_CheckpointClear), Worker);
+
+    UT_DEFAULT_IMPL(FM_CheckpointClear);
+} /* End FM_CheckpointClear */
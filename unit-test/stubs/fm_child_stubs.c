@@ -101,6 +101,121 @@ void FM_ChildProcess(void)
     UT_DEFAULT_IMPL(FM_ChildProcess);
 } /* End of FM_ChildProcess() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- get data for the calling worker                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+FM_ChildWorker_t *FM_ChildGetWorker(void)
+{
+    UT_DEFAULT_IMPL(FM_ChildGetWorker);
+
+    return &FM_GlobalData.ChildWorker[0];
+} /* End of FM_ChildGetWorker() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- search abort list for job ID                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildIsAborted(uint32 JobID)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_ChildIsAborted), JobID);
+
+    return UT_DEFAULT_IMPL(FM_ChildIsAborted) != 0;
+} /* End of FM_ChildIsAborted() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- check for abort of worker's current command    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildCheckAbort(FM_ChildWorker_t *Worker, const char *CmdText)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildCheckAbort), Worker);
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildCheckAbort), CmdText);
+
+    return UT_DEFAULT_IMPL(FM_ChildCheckAbort) != 0;
+} /* End of FM_ChildCheckAbort() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- report error or warning for current command    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildReportStatus(uint8 Status)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_ChildReportStatus), Status);
+    UT_DEFAULT_IMPL(FM_ChildReportStatus);
+} /* End of FM_ChildReportStatus() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- start of job completion telemetry              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildJobStart(FM_ChildWorker_t *Worker)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildJobStart), Worker);
+    UT_DEFAULT_IMPL(FM_ChildJobStart);
+} /* End of FM_ChildJobStart() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- send job completion telemetry                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildJobComplete(FM_ChildWorker_t *Worker)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildJobComplete), Worker);
+    UT_DEFAULT_IMPL(FM_ChildJobComplete);
+} /* End of FM_ChildJobComplete() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- add file size to expected job total            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildJobTotal(FM_ChildWorker_t *Worker, const char *Filename)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildJobTotal), Worker);
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildJobTotal), Filename);
+    UT_DEFAULT_IMPL(FM_ChildJobTotal);
+} /* End of FM_ChildJobTotal() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- count a block of file data for the current job */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildJobBytes(FM_ChildWorker_t *Worker, uint32 Bytes)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildJobBytes), Worker);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_ChildJobBytes), Bytes);
+    UT_DEFAULT_IMPL(FM_ChildJobBytes);
+} /* End of FM_ChildJobBytes() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- send job progress telemetry                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildJobProgress(FM_ChildWorker_t *Worker, int64 Elapsed)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildJobProgress), Worker);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_ChildJobProgress), Elapsed);
+    UT_DEFAULT_IMPL(FM_ChildJobProgress);
+} /* End of FM_ChildJobProgress() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM child task command handler -- Copy File                      */
@@ -249,6 +364,83 @@ void FM_ChildSetPermissionsCmd(const FM_ChildQueueEntry_t *CmdArgs)
     UT_DEFAULT_IMPL(FM_ChildSetPermissionsCmd);
 } /* End of FM_ChildSetPermissionsCmd() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Copy Directory                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCopyDirCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_DEFAULT_IMPL(FM_ChildCopyDirCmd);
+} /* End of FM_ChildCopyDirCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Delete Directory Tree          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDeleteTreeCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_DEFAULT_IMPL(FM_ChildDeleteTreeCmd);
+} /* End of FM_ChildDeleteTreeCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Delete Filtered Files          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDeleteFilterCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_DEFAULT_IMPL(FM_ChildDeleteFilterCmd);
+} /* End of FM_ChildDeleteFilterCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Concatenate File List          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildConcatListCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_DEFAULT_IMPL(FM_ChildConcatListCmd);
+} /* End of FM_ChildConcatListCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Split File                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildSplitCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_DEFAULT_IMPL(FM_ChildSplitCmd);
+} /* End of FM_ChildSplitCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Preallocate File               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildPreallocateCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_DEFAULT_IMPL(FM_ChildPreallocateCmd);
+} /* End of FM_ChildPreallocateCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Truncate File                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildTruncateCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_DEFAULT_IMPL(FM_ChildTruncateCmd);
+} /* End of FM_ChildTruncateCmd() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM child task utility function -- create dir list output file   */
@@ -272,6 +464,43 @@ void FM_ChildDirListFileLoop(osal_id_t DirId, osal_id_t FileHandle, const char *
     UT_DEFAULT_IMPL(FM_ChildDirListFileLoop);
 } /* End of FM_ChildDirListFileLoop */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- read back copy target file    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildVerifyTarget(FM_ChildWorker_t *Worker, const char *CmdText, const FM_ChildCopyEvents_t *Events)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildVerifyTarget), Worker);
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildVerifyTarget), CmdText);
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildVerifyTarget), Events);
+
+    return UT_DEFAULT_IMPL(FM_ChildVerifyTarget);
+} /* End of FM_ChildVerifyTarget */
+
+#ifdef FM_INCLUDE_KERNEL_COPY
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- kernel copy one source        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildKernelCopy(FM_ChildWorker_t *Worker, const char *CmdText, const FM_ChildCopyEvents_t *Events,
+                        const char *Source, bool *CopyResult)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildKernelCopy), Worker);
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildKernelCopy), CmdText);
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildKernelCopy), Events);
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildKernelCopy), Source);
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildKernelCopy), CopyResult);
+
+    return UT_DEFAULT_IMPL(FM_ChildKernelCopy);
+} /* End of FM_ChildKernelCopy */
+
+#endif
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM child task utility function -- get dir entry size and time   */
@@ -283,22 +512,171 @@ int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileT
     return UT_DEFAULT_IMPL(FM_ChildSizeTimeMode);
 } /* End of FM_ChildSizeTimeMode */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- get file allocated size       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_ChildAllocatedSize(const char *Filename)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildAllocatedSize), Filename);
+
+    return UT_DEFAULT_IMPL(FM_ChildAllocatedSize);
+} /* End of FM_ChildAllocatedSize */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM child task utility function -- sleep between OS_stat on files*/
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep,
-                       bool getSizeTimeMode)
+void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, bool getSizeTimeMode)
 {
     UT_Stub_RegisterContext(UT_KEY(FM_ChildSleepStat), Filename);
     UT_Stub_RegisterContext(UT_KEY(FM_ChildSleepStat), DirListData);
-    UT_Stub_RegisterContext(UT_KEY(FM_ChildSleepStat), FilesTillSleep);
     UT_Stub_RegisterContextGenericArg(UT_KEY(FM_ChildSleepStat), getSizeTimeMode);
     UT_DEFAULT_IMPL(FM_ChildSleepStat);
 } /* FM_ChildSleepStat */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- match name against pattern    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildPatternMatch(const char *Pattern, const char *Name)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildPatternMatch), Pattern);
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildPatternMatch), Name);
+    return UT_DEFAULT_IMPL(FM_ChildPatternMatch) != 0;
+} /* End of FM_ChildPatternMatch */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- check concat source list      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildConcatListCheck(FM_ChildWorker_t *Worker, const char *CmdText, uint32 *EntryCount)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildConcatListCheck), Worker);
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildConcatListCheck), CmdText);
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildConcatListCheck), EntryCount);
+    return UT_DEFAULT_IMPL(FM_ChildConcatListCheck) != 0;
+} /* End of FM_ChildConcatListCheck */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- open file list for reading    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildListOpen(FM_ChildListFile_t *ListFile, const char *Filename)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildListOpen), ListFile);
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildListOpen), Filename);
+    return UT_DEFAULT_IMPL(FM_ChildListOpen);
+} /* End of FM_ChildListOpen */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- read next name from file list */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildListNext(FM_ChildListFile_t *ListFile, char *Name)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildListNext), ListFile);
+    UT_Stub_RegisterContext(UT_KEY(FM_ChildListNext), Name);
+    return UT_DEFAULT_IMPL(FM_ChildListNext);
+} /* End of FM_ChildListNext */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- check split segment names     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildSplitCheck(const char *CmdText, const char *Target, uint32 SourceSize, uint32 SegmentSize,
+                        uint32 *SegmentCount)
+{
+    return UT_DEFAULT_IMPL(FM_ChildSplitCheck);
+} /* End of FM_ChildSplitCheck */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- write one split segment file  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildSplitSegment(FM_ChildWorker_t *Worker, const char *CmdText, osal_id_t FileHandleSrc, const char *Name,
+                          FM_SplitManifestEntry_t *Entry)
+{
+    return UT_DEFAULT_IMPL(FM_ChildSplitSegment);
+} /* End of FM_ChildSplitSegment */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- build split segment filename  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildSplitName(char *Name, const char *Target, uint32 Segment)
+{
+    return UT_DEFAULT_IMPL(FM_ChildSplitName);
+} /* End of FM_ChildSplitName */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- extend file with zero blocks  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildPreallocateWrite(FM_ChildWorker_t *Worker, const char *CmdText, osal_id_t FileHandle,
+                              const char *Filename, uint32 Offset, uint32 FileSize)
+{
+    return UT_DEFAULT_IMPL(FM_ChildPreallocateWrite);
+} /* End of FM_ChildPreallocateWrite */
+
+#ifdef FM_INCLUDE_FILE_ALLOCATE
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- fallocate file space          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildFileAllocate(FM_ChildWorker_t *Worker, const char *CmdText, const char *Filename, uint32 Offset,
+                          uint32 FileSize, bool *AllocateResult)
+{
+    return UT_DEFAULT_IMPL(FM_ChildFileAllocate);
+} /* End of FM_ChildFileAllocate */
+
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- truncate file in place        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildTruncateFile(const char *Filename, uint32 FileSize)
+{
+    return UT_DEFAULT_IMPL(FM_ChildTruncateFile);
+} /* End of FM_ChildTruncateFile */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- link or clone a file          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildLinkFile(const char *Source, const char *Target, uint8 Link)
+{
+    return UT_DEFAULT_IMPL(FM_ChildLinkFile);
+} /* End of FM_ChildLinkFile */
+
 /************************/
 /*  End of File Comment */
 /************************/
@@ -44,9 +44,6 @@
 #include "uttest.h"
 #include "utstubs.h"
 
-// static uint32 OpenFileCount = 0;
-// static bool FileIsOpen = false;
-
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM utility function -- verify command packet length             */
@@ -78,6 +75,17 @@ bool FM_VerifyOverwrite(uint16 Overwrite, uint32 EventID, const char *CmdText)
     return UT_DEFAULT_IMPL(FM_VerifyOverwrite);
 } /* End FM_VerifyOverwrite */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- verify CRC type is not invalid           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_VerifyCRCType(uint32 CRCType, uint32 EventID, const char *CmdText)
+{
+    return UT_DEFAULT_IMPL(FM_VerifyCRCType);
+} /* End FM_VerifyCRCType */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM utility function -- get open files data                      */
@@ -103,6 +111,23 @@ uint32 FM_GetFilenameState(char *Filename, uint32 BufferSize, bool FileInfoCmd)
     return UT_DEFAULT_IMPL(FM_GetFilenameState);
 } /* End FM_GetFilenameState */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- query filename state from open file list */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_GetFilenameStateFromList(const char *Filename, uint32 BufferSize, const FM_OpenFilesEntry_t *OpenFiles,
+                                   uint32 OpenCount)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_GetFilenameStateFromList), Filename);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_GetFilenameStateFromList), BufferSize);
+    UT_Stub_RegisterContext(UT_KEY(FM_GetFilenameStateFromList), OpenFiles);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_GetFilenameStateFromList), OpenCount);
+
+    return UT_DEFAULT_IMPL(FM_GetFilenameStateFromList);
+} /* End FM_GetFilenameStateFromList */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM utility function -- verify state is not invalid              */
@@ -193,6 +218,19 @@ bool FM_VerifyChildTask(uint32 EventID, const char *CmdText)
     return UT_DEFAULT_IMPL(FM_VerifyChildTask);
 } /* End FM_VerifyChildTask */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- select child task command queue lane     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint8 FM_GetChildQueueLane(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_GetChildQueueLane), CmdArgs);
+
+    return UT_DEFAULT_IMPL(FM_GetChildQueueLane);
+} /* End of FM_GetChildQueueLane */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM utility function -- invoke child task command processor      */
@@ -216,6 +254,19 @@ void FM_AppendPathSep(char *Directory, uint32 BufferSize)
     UT_DEFAULT_IMPL(FM_AppendPathSep);
 } /* End of FM_AppendPathSep */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- get file system table index for a file   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_GetVolumeIndex(const char *Filename)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_GetVolumeIndex), Filename);
+
+    return UT_DEFAULT_IMPL(FM_GetVolumeIndex);
+} /* End of FM_GetVolumeIndex */
+
 /************************/
 /*  End of File Comment */
 /************************/
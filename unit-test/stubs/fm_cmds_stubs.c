@@ -246,6 +246,74 @@ bool FM_SetPermissionsCmd(const CFE_SB_Buffer_t *BufPtr)
     return UT_DEFAULT_IMPL(FM_SetPermissionsCmd) != 0;
 } /* End of FM_SetPermissionsCmd() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Abort child task command                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_AbortCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    return UT_DEFAULT_IMPL(FM_AbortCmd) != 0;
+} /* End of FM_AbortCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Set child task I/O throttle command       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SetThrottleCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    return UT_DEFAULT_IMPL(FM_SetThrottleCmd) != 0;
+} /* End of FM_SetThrottleCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Set child task file I/O block size        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SetBlockSizeCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    return UT_DEFAULT_IMPL(FM_SetBlockSizeCmd) != 0;
+} /* End of FM_SetBlockSizeCmd() */
+
+bool FM_CopyDirCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    return UT_DEFAULT_IMPL(FM_CopyDirCmd) != 0;
+} /* End of FM_CopyDirCmd() */
+
+bool FM_DeleteTreeCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    return UT_DEFAULT_IMPL(FM_DeleteTreeCmd) != 0;
+} /* End of FM_DeleteTreeCmd() */
+
+bool FM_DeleteFilterCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    return UT_DEFAULT_IMPL(FM_DeleteFilterCmd) != 0;
+} /* End of FM_DeleteFilterCmd() */
+
+bool FM_ConcatListCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    return UT_DEFAULT_IMPL(FM_ConcatListCmd) != 0;
+} /* End of FM_ConcatListCmd() */
+
+bool FM_SplitCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    return UT_DEFAULT_IMPL(FM_SplitCmd) != 0;
+} /* End of FM_SplitCmd() */
+
+bool FM_PreallocateCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    return UT_DEFAULT_IMPL(FM_PreallocateCmd) != 0;
+} /* End of FM_PreallocateCmd() */
+
+bool FM_TruncateCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    return UT_DEFAULT_IMPL(FM_TruncateCmd) != 0;
+} /* End of FM_TruncateCmd() */
+
 /************************/
 /*  End of File Comment */
 /************************/
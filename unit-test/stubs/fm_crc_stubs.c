@@ -0,0 +1,96 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task CRC Functions
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_crc.h"
+#include "fm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- startup initialization                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CrcInit(void)
+{
+    UT_DEFAULT_IMPL(FM_CrcInit);
+} /* End FM_CrcInit */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- calculate CRC of a block of data             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_CrcCalculate(const void *DataPtr, size_t DataLength, uint32 InputCRC, uint32 TypeCRC)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_CrcCalculate), DataPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_CrcCalculate), DataLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_CrcCalculate), InputCRC);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_CrcCalculate), TypeCRC);
+
+    return UT_DEFAULT_IMPL(FM_CrcCalculate);
+} /* End FM_CrcCalculate */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- CRC-16 slicing-by-8 kernel                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint16 FM_CrcSlice16(uint16 Crc, const uint8 *Buffer, size_t Length)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_CrcSlice16), Crc);
+    UT_Stub_RegisterContext(UT_KEY(FM_CrcSlice16), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_CrcSlice16), Length);
+
+    return UT_DEFAULT_IMPL(FM_CrcSlice16);
+} /* End FM_CrcSlice16 */
+
+#ifdef FM_CRC_INCLUDE_PCLMUL
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- CRC-16 carry-less multiply kernel            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint16 FM_CrcFold16(uint16 Crc, const uint8 *Buffer, size_t Length)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_CrcFold16), Crc);
+    UT_Stub_RegisterContext(UT_KEY(FM_CrcFold16), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_CrcFold16), Length);
+
+    return UT_DEFAULT_IMPL(FM_CrcFold16);
+} /* End FM_CrcFold16 */
+
+#endif
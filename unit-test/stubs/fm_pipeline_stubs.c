@@ -0,0 +1,154 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task Transfer Pipeline Functions
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_pipeline.h"
+#include "fm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- allocate the file I/O buffers           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_PipelineBufferInit(void)
+{
+    return UT_DEFAULT_IMPL(FM_PipelineBufferInit);
+} /* End FM_PipelineBufferInit */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- startup initialization                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_PipelineInit(void)
+{
+    UT_DEFAULT_IMPL(FM_PipelineInit);
+} /* End FM_PipelineInit */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- helper task entry point                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_PipelineTask(void)
+{
+    UT_DEFAULT_IMPL(FM_PipelineTask);
+} /* End FM_PipelineTask */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- write or CRC the oldest block           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_PipelineProcess(FM_ChildWorker_t *Worker)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_PipelineProcess), Worker);
+
+    UT_DEFAULT_IMPL(FM_PipelineProcess);
+} /* End FM_PipelineProcess */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- start of a transfer                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_PipelineStart(FM_ChildWorker_t *Worker, uint8 Mode, osal_id_t FileHandle, uint32 CRCType, uint32 CRC)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_PipelineStart), Worker);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_PipelineStart), Mode);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_PipelineStart), FileHandle);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_PipelineStart), CRCType);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_PipelineStart), CRC);
+
+    UT_DEFAULT_IMPL(FM_PipelineStart);
+} /* End FM_PipelineStart */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- get the buffer for the next block       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+char *FM_PipelineBuffer(FM_ChildWorker_t *Worker)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_PipelineBuffer), Worker);
+
+    UT_DEFAULT_IMPL(FM_PipelineBuffer);
+
+    return Worker->ChildBuffer;
+} /* End FM_PipelineBuffer */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- submit the most recent block            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_PipelineSubmit(FM_ChildWorker_t *Worker, int32 Size)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_PipelineSubmit), Worker);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_PipelineSubmit), Size);
+
+    return UT_DEFAULT_IMPL(FM_PipelineSubmit) != 0;
+} /* End FM_PipelineSubmit */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- wait for the end of a transfer          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_PipelineFinish(FM_ChildWorker_t *Worker)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_PipelineFinish), Worker);
+
+    return UT_DEFAULT_IMPL(FM_PipelineFinish) != 0;
+} /* End FM_PipelineFinish */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM pipeline function -- test for an all-zero block              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_PipelineIsZero(const char *Buffer, int32 Size)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_PipelineIsZero), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_PipelineIsZero), Size);
+
+    return UT_DEFAULT_IMPL(FM_PipelineIsZero) != 0;
+} /* End FM_PipelineIsZero */
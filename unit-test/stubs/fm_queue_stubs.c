@@ -0,0 +1,259 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task Command Queue Functions
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_queue.h"
+#include "fm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- append entry to lane (FM main task only)   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueueLanePush(FM_ChildLane_t *Lane, uint8 QueueIndex)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_QueueLanePush), Lane);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_QueueLanePush), QueueIndex);
+
+    return UT_DEFAULT_IMPL(FM_QueueLanePush);
+} /* End FM_QueueLanePush */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- remove entry from lane (child task only)   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueueLanePop(FM_ChildLane_t *Lane, uint8 *QueueIndex)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(FM_QueueLanePop), Lane);
+    UT_Stub_RegisterContext(UT_KEY(FM_QueueLanePop), QueueIndex);
+
+    status = UT_DEFAULT_IMPL(FM_QueueLanePop);
+
+    /* Test cases may supply the popped queue entry index */
+    if (status != 0)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(FM_QueueLanePop), QueueIndex, sizeof(*QueueIndex));
+    }
+
+    return status;
+} /* End FM_QueueLanePop */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- mark waiting lane entry as aborted         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueueLaneAbort(const FM_ChildLane_t *Lane, uint32 JobID)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_QueueLaneAbort), Lane);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_QueueLaneAbort), JobID);
+
+    return UT_DEFAULT_IMPL(FM_QueueLaneAbort);
+} /* End FM_QueueLaneAbort */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- number of entries waiting in lane          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint8 FM_QueueLaneCount(const FM_ChildLane_t *Lane)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_QueueLaneCount), Lane);
+
+    return UT_DEFAULT_IMPL(FM_QueueLaneCount);
+} /* End FM_QueueLaneCount */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- verify lane indexes                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueueLaneIsValid(const FM_ChildLane_t *Lane)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_QueueLaneIsValid), Lane);
+
+    return UT_DEFAULT_IMPL(FM_QueueLaneIsValid);
+} /* End FM_QueueLaneIsValid */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- verify arena room for one more command     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueueArenaHasRoom(void)
+{
+    return UT_DEFAULT_IMPL(FM_QueueArenaHasRoom);
+} /* End FM_QueueArenaHasRoom */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- store command args in queue entry          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueueEntryPack(uint8 QueueIndex, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_QueueEntryPack), QueueIndex);
+    UT_Stub_RegisterContext(UT_KEY(FM_QueueEntryPack), CmdArgs);
+
+    return UT_DEFAULT_IMPL(FM_QueueEntryPack);
+} /* End FM_QueueEntryPack */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- copy command args out of queue entry       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_QueueEntryUnpack(uint8 QueueIndex, FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_QueueEntryUnpack), QueueIndex);
+    UT_Stub_RegisterContext(UT_KEY(FM_QueueEntryUnpack), CmdArgs);
+
+    UT_DEFAULT_IMPL(FM_QueueEntryUnpack);
+} /* End FM_QueueEntryUnpack */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- release queue entry path arena blocks      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_QueueEntryRelease(uint8 QueueIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_QueueEntryRelease), QueueIndex);
+
+    UT_DEFAULT_IMPL(FM_QueueEntryRelease);
+} /* End FM_QueueEntryRelease */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- open the pending commands file             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_QueuePendingInit(void)
+{
+    UT_DEFAULT_IMPL(FM_QueuePendingInit);
+} /* End FM_QueuePendingInit */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- verify pending file room for one command   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueuePendingHasRoom(void)
+{
+    return UT_DEFAULT_IMPL(FM_QueuePendingHasRoom);
+} /* End FM_QueuePendingHasRoom */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- append command to pending file (main task) */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueuePendingPush(const FM_ChildQueueEntry_t *CmdArgs, uint8 Lane)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_QueuePendingPush), CmdArgs);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_QueuePendingPush), Lane);
+
+    return UT_DEFAULT_IMPL(FM_QueuePendingPush);
+} /* End FM_QueuePendingPush */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- remove command from pending file (child)   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueuePendingPop(FM_ChildQueueEntry_t *CmdArgs)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(FM_QueuePendingPop), CmdArgs);
+
+    status = UT_DEFAULT_IMPL(FM_QueuePendingPop);
+
+    /* Test cases may supply the command read from the pending file */
+    if (status != 0)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(FM_QueuePendingPop), CmdArgs, sizeof(*CmdArgs));
+    }
+
+    return status;
+} /* End FM_QueuePendingPop */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- mark pending file command as aborted       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueuePendingAbort(uint32 JobID)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_QueuePendingAbort), JobID);
+
+    return UT_DEFAULT_IMPL(FM_QueuePendingAbort);
+} /* End FM_QueuePendingAbort */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- number of commands in pending file         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint16 FM_QueuePendingCount(void)
+{
+    return UT_DEFAULT_IMPL(FM_QueuePendingCount);
+} /* End FM_QueuePendingCount */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM queue function -- interactive command in pending file        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_QueuePendingHasInteractive(void)
+{
+    return UT_DEFAULT_IMPL(FM_QueuePendingHasInteractive);
+} /* End FM_QueuePendingHasInteractive */
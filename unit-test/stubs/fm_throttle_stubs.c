@@ -0,0 +1,99 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Child Task I/O Throttle Functions
+ */
+
+#include "cfe.h"
+#include "fm_msg.h"
+#include "fm_throttle.h"
+#include "fm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- startup initialization                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ThrottleInit(void)
+{
+    return UT_DEFAULT_IMPL(FM_ThrottleInit);
+} /* End FM_ThrottleInit */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- set rate limits                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ThrottleSet(uint32 BytesPerSec, uint32 StatsPerSec, uint32 LatencyLimit)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_ThrottleSet), BytesPerSec);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_ThrottleSet), StatsPerSec);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_ThrottleSet), LatencyLimit);
+
+    UT_DEFAULT_IMPL(FM_ThrottleSet);
+} /* End FM_ThrottleSet */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- start of a file data loop               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ThrottleStart(FM_ChildWorker_t *Worker)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ThrottleStart), Worker);
+
+    UT_DEFAULT_IMPL(FM_ThrottleStart);
+} /* End FM_ThrottleStart */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- pace a block of file data               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ThrottleBytes(FM_ChildWorker_t *Worker, uint32 Bytes)
+{
+    UT_Stub_RegisterContext(UT_KEY(FM_ThrottleBytes), Worker);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(FM_ThrottleBytes), Bytes);
+
+    UT_DEFAULT_IMPL(FM_ThrottleBytes);
+} /* End FM_ThrottleBytes */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM throttle function -- pace an OS_stat call                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ThrottleStats(void)
+{
+    UT_DEFAULT_IMPL(FM_ThrottleStats);
+} /* End FM_ThrottleStats */
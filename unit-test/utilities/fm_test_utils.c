@@ -38,6 +38,9 @@ CFE_EVS_SendEvent_context_t context_CFE_EVS_SendEvent[UT_MAX_SENDEVENT_DEPTH];
 
 UT_CmdBuf_t UT_CmdBuf;
 
+/* Child task file I/O buffers, allocated from the memory pool by the application */
+char UT_FM_ChildBuffers[FM_CHILD_BUFFER_COUNT][FM_CHILD_MAX_BLOCK_SIZE];
+
 void UT_Handler_CFE_EVS_SendEvent(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context, va_list va)
 {
     uint16 CallCount;
@@ -64,6 +67,9 @@ void UT_Handler_CFE_EVS_SendEvent(void *UserObj, UT_EntryKey_t FuncKey, const UT
 
 void FM_Test_Setup(void)
 {
+    FM_ChildWorker_t *Worker      = NULL;
+    uint32            WorkerIndex = 0;
+    uint32            BufferIndex = 0;
 
     UT_ResetState(0);
 
@@ -71,6 +77,22 @@ void FM_Test_Setup(void)
     memset(context_CFE_EVS_SendEvent, 0, sizeof(context_CFE_EVS_SendEvent));
     memset(&UT_CmdBuf, 0, sizeof(UT_CmdBuf));
 
+    for (WorkerIndex = 0; WorkerIndex < FM_CHILD_WORKER_COUNT; WorkerIndex++)
+    {
+        Worker = &FM_GlobalData.ChildWorker[WorkerIndex];
+
+        Worker->ChildBuffer = UT_FM_ChildBuffers[WorkerIndex * (FM_CHILD_PIPELINE_DEPTH + 1)];
+        Worker->BlockSize   = FM_CHILD_FILE_BLOCK_SIZE;
+
+        for (BufferIndex = 0; BufferIndex < FM_CHILD_PIPELINE_DEPTH; BufferIndex++)
+        {
+            Worker->Pipeline.Buffer[BufferIndex] =
+                UT_FM_ChildBuffers[(WorkerIndex * (FM_CHILD_PIPELINE_DEPTH + 1)) + BufferIndex + 1];
+        }
+    }
+
+    FM_GlobalData.ChildBlockSize = FM_CHILD_FILE_BLOCK_SIZE;
+
     /* Register custom handlers */
     UT_SetVaHandlerFunction(UT_KEY(CFE_EVS_SendEvent), UT_Handler_CFE_EVS_SendEvent, NULL);
 }
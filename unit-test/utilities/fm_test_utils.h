@@ -60,6 +60,16 @@ typedef union
     FM_GetFreeSpaceCmd_t  GetFreeSpaceCmd;
     FM_SetTableStateCmd_t SetTableStateCmd;
     FM_SetPermCmd_t       SetPermCmd;
+    FM_AbortCmd_t         AbortCmd;
+    FM_SetThrottleCmd_t   SetThrottleCmd;
+    FM_SetBlockSizeCmd_t  SetBlockSizeCmd;
+    FM_CopyDirCmd_t       CopyDirCmd;
+    FM_DeleteTreeCmd_t    DeleteTreeCmd;
+    FM_DeleteFilterCmd_t  DeleteFilterCmd;
+    FM_ConcatListCmd_t    ConcatListCmd;
+    FM_SplitCmd_t         SplitCmd;
+    FM_PreallocateCmd_t   PreallocateCmd;
+    FM_TruncateCmd_t      TruncateCmd;
 } UT_CmdBuf_t;
 
 extern UT_CmdBuf_t UT_CmdBuf;